@@ -0,0 +1,335 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#include "BenchmarkRunner.hpp"
+#include <algorithm>
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+
+namespace gpcc_benchmarks {
+
+namespace {
+
+// Escapes a string for use in JSON.
+std::string EscapeJSON(std::string const & s)
+{
+  std::ostringstream oss;
+  for (char const c : s)
+  {
+    switch (c)
+    {
+      case '"':  oss << "\\\""; break;
+      case '\\': oss << "\\\\"; break;
+      case '\n': oss << "\\n";  break;
+      case '\t': oss << "\\t";  break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20U)
+          oss << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<unsigned int>(c) << std::dec;
+        else
+          oss << c;
+    }
+  }
+  return oss.str();
+}
+
+// Quotes a string for use in CSV if necessary.
+std::string QuoteCSV(std::string const & s)
+{
+  if (s.find_first_of(",\"\n") == std::string::npos)
+    return s;
+
+  std::string ret = "\"";
+  for (char const c : s)
+  {
+    if (c == '"')
+      ret += '"';
+    ret += c;
+  }
+  ret += '"';
+  return ret;
+}
+
+// Determines the value of a percentile from sorted samples (nearest-rank method).
+int64_t Percentile(std::vector<int64_t> const & sortedSamples, unsigned int const p)
+{
+  size_t rank = (sortedSamples.size() * p + 99U) / 100U;
+  if (rank == 0U)
+    rank = 1U;
+  return sortedSamples[rank - 1U];
+}
+
+} // anonymous namespace
+
+/**
+ * \brief Adds a measured value to the result.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * - - -
+ *
+ * \param metricName
+ * Name of the metric.
+ * \param unit
+ * Unit of the metric.
+ * \param value
+ * Measured value.
+ */
+void Result::Add(std::string const & metricName, std::string const & unit, double const value)
+{
+  metrics.push_back(Metric{metricName, unit, value});
+}
+
+/**
+ * \brief Adds the metrics "throughput" (ops/s) and "time_per_op" (ns) to the result.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * Basic guarantee.
+ *
+ * - - -
+ *
+ * \param nbOfOps
+ * Number of operations that have been executed.
+ * \param elapsed
+ * Time required to execute the operations.
+ */
+void Result::AddThroughput(size_t const nbOfOps, std::chrono::steady_clock::duration const elapsed)
+{
+  double const elapsed_ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+  if ((nbOfOps == 0U) || (elapsed_ns <= 0.0))
+    throw std::invalid_argument("Result::AddThroughput: Invalid args");
+
+  Add("throughput", "ops/s", static_cast<double>(nbOfOps) * 1.0E9 / elapsed_ns);
+  Add("time_per_op", "ns", elapsed_ns / static_cast<double>(nbOfOps));
+}
+
+/**
+ * \brief Adds the number of samples and the metrics "p50", "p90", "p99", "max" and "mean" (all us) to the result.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * Basic guarantee.
+ *
+ * - - -
+ *
+ * \param samples_ns
+ * Latency samples in ns. The samples will be sorted by this method.\n
+ * At least one sample is required.
+ */
+void Result::AddLatencyPercentiles(std::vector<int64_t> & samples_ns)
+{
+  if (samples_ns.empty())
+    throw std::invalid_argument("Result::AddLatencyPercentiles: No samples");
+
+  std::sort(samples_ns.begin(), samples_ns.end());
+
+  double sum = 0.0;
+  for (auto const s : samples_ns)
+    sum += static_cast<double>(s);
+
+  Add("samples", "", static_cast<double>(samples_ns.size()));
+  Add("p50",   "us", static_cast<double>(Percentile(samples_ns, 50U)) / 1000.0);
+  Add("p90",   "us", static_cast<double>(Percentile(samples_ns, 90U)) / 1000.0);
+  Add("p99",   "us", static_cast<double>(Percentile(samples_ns, 99U)) / 1000.0);
+  Add("max",   "us", static_cast<double>(samples_ns.back()) / 1000.0);
+  Add("mean",  "us", sum / static_cast<double>(samples_ns.size()) / 1000.0);
+}
+
+/**
+ * \brief Registers a benchmark.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * - - -
+ *
+ * \param name
+ * Unique name of the benchmark. By convention, the name is composed of the name of the examined class and the
+ * scenario, e.g. "WorkQueue/Throughput_1P_Dynamic".
+ * \param benchmark
+ * Benchmark function.
+ */
+void BenchmarkRunner::Register(std::string const & name, tBenchmark const & benchmark)
+{
+  if ((name.empty()) || (!benchmark))
+    throw std::invalid_argument("BenchmarkRunner::Register: Invalid args");
+
+  for (auto const & e : entries)
+  {
+    if (e.name == name)
+      throw std::invalid_argument("BenchmarkRunner::Register: Duplicate name");
+  }
+
+  entries.push_back(Entry{name, benchmark});
+}
+
+/**
+ * \brief Prints the names of all registered benchmarks, one per line.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * Basic guarantee.
+ *
+ * - - -
+ *
+ * \param out
+ * Stream to which the names shall be written.
+ */
+void BenchmarkRunner::List(std::ostream & out) const
+{
+  for (auto const & e : entries)
+    out << e.name << std::endl;
+}
+
+/**
+ * \brief Executes the registered benchmarks.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * Basic guarantee.\n
+ * Exceptions thrown by benchmarks will propagate out of this method.
+ *
+ * - - -
+ *
+ * \param filter
+ * Only benchmarks whose name contains this string will be executed. An empty string selects all benchmarks.
+ * \param progress
+ * Stream to which progress information is written.
+ * \return
+ * Results of the executed benchmarks, in order of registration.
+ */
+std::vector<Result> BenchmarkRunner::Run(std::string const & filter, std::ostream & progress) const
+{
+  std::vector<Result> results;
+
+  for (auto const & e : entries)
+  {
+    if ((!filter.empty()) && (e.name.find(filter) == std::string::npos))
+      continue;
+
+    progress << "Running " << e.name << "..." << std::endl;
+
+    Result r;
+    r.name = e.name;
+    e.benchmark(r);
+    results.push_back(std::move(r));
+  }
+
+  return results;
+}
+
+/**
+ * \brief Writes benchmark results in JSON format.
+ *
+ * Format:
+ * ~~~{.json}
+ * {
+ *   "benchmarks": [
+ *     {
+ *       "name": "WorkQueue/Throughput_1P_Dynamic",
+ *       "metrics": [
+ *         { "name": "throughput", "unit": "ops/s", "value": 1234567.8 },
+ *         ...
+ *       ]
+ *     },
+ *     ...
+ *   ]
+ * }
+ * ~~~
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * Basic guarantee.
+ *
+ * - - -
+ *
+ * \param results
+ * Results that shall be written.
+ * \param out
+ * Stream to which the results shall be written.
+ */
+void BenchmarkRunner::WriteJSON(std::vector<Result> const & results, std::ostream & out)
+{
+  out << "{" << std::endl << "  \"benchmarks\": [";
+
+  bool firstResult = true;
+  for (auto const & r : results)
+  {
+    out << (firstResult ? "" : ",") << std::endl;
+    firstResult = false;
+
+    out << "    {" << std::endl
+        << "      \"name\": \"" << EscapeJSON(r.name) << "\"," << std::endl
+        << "      \"metrics\": [";
+
+    bool firstMetric = true;
+    for (auto const & m : r.metrics)
+    {
+      out << (firstMetric ? "" : ",") << std::endl;
+      firstMetric = false;
+
+      out << "        { \"name\": \"" << EscapeJSON(m.name) << "\", \"unit\": \"" << EscapeJSON(m.unit)
+          << "\", \"value\": " << std::setprecision(10) << m.value << " }";
+    }
+
+    out << std::endl << "      ]" << std::endl << "    }";
+  }
+
+  out << std::endl << "  ]" << std::endl << "}" << std::endl;
+}
+
+/**
+ * \brief Writes benchmark results in CSV format.
+ *
+ * There is one header line and one line per metric:
+ * ~~~
+ * benchmark,metric,unit,value
+ * WorkQueue/Throughput_1P_Dynamic,throughput,ops/s,1234567.8
+ * ~~~
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * Basic guarantee.
+ *
+ * - - -
+ *
+ * \param results
+ * Results that shall be written.
+ * \param out
+ * Stream to which the results shall be written.
+ */
+void BenchmarkRunner::WriteCSV(std::vector<Result> const & results, std::ostream & out)
+{
+  out << "benchmark,metric,unit,value" << std::endl;
+
+  for (auto const & r : results)
+  {
+    for (auto const & m : r.metrics)
+    {
+      out << QuoteCSV(r.name) << ',' << QuoteCSV(m.name) << ',' << QuoteCSV(m.unit) << ','
+          << std::setprecision(10) << m.value << std::endl;
+    }
+  }
+}
+
+} // namespace gpcc_benchmarks
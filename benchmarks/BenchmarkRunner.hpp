@@ -0,0 +1,90 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#ifndef BENCHMARKRUNNER_HPP_202610161015
+#define BENCHMARKRUNNER_HPP_202610161015
+
+#include <chrono>
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace gpcc_benchmarks {
+
+/// One value measured by a benchmark.
+struct Metric
+{
+  std::string name;  ///<Name of the metric, e.g. "throughput" or "p99".
+  std::string unit;  ///<Unit of the metric, e.g. "ops/s" or "us".
+  double value;      ///<Measured value.
+};
+
+/// Result of one benchmark.
+struct Result
+{
+  std::string name;             ///<Name of the benchmark.
+  std::vector<Metric> metrics;  ///<Measured values.
+
+  void Add(std::string const & metricName, std::string const & unit, double const value);
+  void AddThroughput(size_t const nbOfOps, std::chrono::steady_clock::duration const elapsed);
+  void AddLatencyPercentiles(std::vector<int64_t> & samples_ns);
+};
+
+/**
+ * \brief Registry and runner for benchmarks.
+ *
+ * Benchmarks are registered via @ref Register() and executed via @ref Run(). The results can be written in JSON or
+ * CSV format, which allows to track performance regressions across releases.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * Not thread-safe, but accessing const methods is thread-safe.
+ */
+class BenchmarkRunner final
+{
+  public:
+    /// Type of a benchmark function. The benchmark function adds its measured values to the passed @ref Result.
+    typedef std::function<void(Result&)> tBenchmark;
+
+    BenchmarkRunner(void) = default;
+    BenchmarkRunner(BenchmarkRunner const &) = delete;
+    BenchmarkRunner(BenchmarkRunner&&) = delete;
+    ~BenchmarkRunner(void) = default;
+
+    BenchmarkRunner& operator=(BenchmarkRunner const &) = delete;
+    BenchmarkRunner& operator=(BenchmarkRunner&&) = delete;
+
+    void Register(std::string const & name, tBenchmark const & benchmark);
+
+    void List(std::ostream & out) const;
+    std::vector<Result> Run(std::string const & filter, std::ostream & progress) const;
+
+    static void WriteJSON(std::vector<Result> const & results, std::ostream & out);
+    static void WriteCSV(std::vector<Result> const & results, std::ostream & out);
+
+  private:
+    /// A registered benchmark.
+    struct Entry
+    {
+      std::string name;      ///<Name of the benchmark.
+      tBenchmark benchmark;  ///<Benchmark function.
+    };
+
+    /// Registered benchmarks, in order of registration.
+    std::vector<Entry> entries;
+};
+
+} // namespace gpcc_benchmarks
+
+#endif // BENCHMARKRUNNER_HPP_202610161015
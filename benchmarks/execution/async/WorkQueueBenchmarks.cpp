@@ -0,0 +1,508 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#include "WorkQueueBenchmarks.hpp"
+#include "../../BenchmarkRunner.hpp"
+#include <gpcc/execution/async/DeferredWorkPackage.hpp>
+#include <gpcc/execution/async/DeferredWorkQueue.hpp>
+#include <gpcc/execution/async/DWQwithThread.hpp>
+#include <gpcc/execution/async/IDeferredWorkQueue.hpp>
+#include <gpcc/execution/async/SuspendableDWQwithThread.hpp>
+#include <gpcc/execution/async/WorkPackage.hpp>
+#include <gpcc/execution/async/WorkQueue.hpp>
+#include <gpcc/osal/ConditionVariable.hpp>
+#include <gpcc/osal/Semaphore.hpp>
+#include <gpcc/osal/Thread.hpp>
+#include <gpcc/time/TimePoint.hpp>
+#include <gpcc/time/TimeSpan.hpp>
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace gpcc_benchmarks {
+
+using namespace gpcc::execution::async;
+using gpcc::osal::ConditionVariable;
+using gpcc::osal::Semaphore;
+using gpcc::osal::Thread;
+using gpcc::time::TimePoint;
+using gpcc::time::TimeSpan;
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+// Number of work packages used by the throughput benchmarks.
+size_t const nbOfWPs = 200000U;
+
+// Number of work packages added per round by the throughput benchmarks. The work queue is flushed after each round.
+size_t const wpsPerRound = 1000U;
+
+// Number of producer threads used by the multi-producer throughput benchmarks.
+size_t const nbOfProducers = 4U;
+
+// Number of deferred work packages used by the deferred insert/expiry benchmarks.
+size_t const nbOfDWPs = 100000U;
+
+// Depth of the work queue used by the Remove(owner) benchmarks.
+size_t const removeQueueDepth = 100000U;
+
+// Number of different owners of the work packages used by the Remove(owner) benchmarks.
+size_t const removeNbOfOwners = 100U;
+
+// Number of Remove(owner) invocations measured by the Remove(owner) benchmarks.
+size_t const removeNbOfMeasurements = 10U;
+
+// Number of samples taken by the latency benchmarks.
+size_t const nbOfLatencySamples = 1000U;
+
+// Time point for deferred work packages which shall not expire during a benchmark.
+TimePoint FarFuture(void)
+{
+  return TimePoint::FromSystemClock(ConditionVariable::clockID) + TimeSpan::sec(3600);
+}
+
+// Base class for a work queue under test, whose work packages are executed by a thread.
+class QueueUnderTest
+{
+  public:
+    virtual ~QueueUnderTest(void) = default;
+    virtual IWorkQueue& Get(void) noexcept = 0;
+};
+
+// A WorkQueue or a DeferredWorkQueue whose work packages are executed by a thread.
+template<typename T>
+class QueueWithThread final : public QueueUnderTest
+{
+  public:
+    template<typename... ARGS>
+    explicit QueueWithThread(ARGS&&... args)
+    : QueueUnderTest()
+    , wq(std::forward<ARGS>(args)...)
+    , thread("Worker")
+    {
+      thread.Start([this]() -> void* { wq.Work(); return nullptr; },
+                   Thread::SchedPolicy::Other, 0U, Thread::GetDefaultStackSize());
+    }
+
+    ~QueueWithThread(void)
+    {
+      wq.RequestTermination();
+      thread.Join();
+    }
+
+    IWorkQueue& Get(void) noexcept override { return wq; }
+    T& GetQueue(void) noexcept { return wq; }
+
+  private:
+    T wq;
+    Thread thread;
+};
+
+// A DWQwithThread.
+class DWQwithThreadUnderTest final : public QueueUnderTest
+{
+  public:
+    DWQwithThreadUnderTest(void)
+    : QueueUnderTest()
+    , dwq("Worker")
+    {
+      dwq.Start(Thread::SchedPolicy::Other, 0U, Thread::GetDefaultStackSize());
+    }
+
+    ~DWQwithThreadUnderTest(void) { dwq.Stop(); }
+
+    IWorkQueue& Get(void) noexcept override { return dwq.GetDWQ(); }
+
+  private:
+    DWQwithThread dwq;
+};
+
+// A SuspendableDWQwithThread.
+class SuspendableDWQwithThreadUnderTest final : public QueueUnderTest
+{
+  public:
+    SuspendableDWQwithThreadUnderTest(void)
+    : QueueUnderTest()
+    , dwq("Worker")
+    {
+      dwq.Start(Thread::SchedPolicy::Other, 0U, Thread::GetDefaultStackSize());
+      dwq.Resume();
+    }
+
+    ~SuspendableDWQwithThreadUnderTest(void)
+    {
+      dwq.Suspend();
+      dwq.Stop();
+    }
+
+    IWorkQueue& Get(void) noexcept override { return dwq.GetDWQ(); }
+
+  private:
+    SuspendableDWQwithThread dwq;
+};
+
+typedef std::function<std::unique_ptr<QueueUnderTest>(void)> tQueueFactory;
+
+// Single producer, dynamic work packages.
+void Throughput_1P_Dynamic(Result & result, tQueueFactory const & factory)
+{
+  auto spQUT = factory();
+  IWorkQueue & wq = spQUT->Get();
+
+  size_t cnt = 0U;
+
+  auto const start = Clock::now();
+  for (size_t i = 0U; i < nbOfWPs; i += wpsPerRound)
+  {
+    for (size_t j = 0U; j < wpsPerRound; j++)
+      wq.Add(WorkPackage::CreateDynamic(nullptr, 0U, [&cnt]() { cnt++; }));
+    wq.FlushNonDeferredWorkPackages();
+  }
+  auto const end = Clock::now();
+
+  if (cnt != nbOfWPs)
+    throw std::runtime_error("Throughput_1P_Dynamic: Unexpected number of executed work packages");
+
+  result.AddThroughput(nbOfWPs, end - start);
+}
+
+// Single producer, static work packages.
+void Throughput_1P_Static(Result & result, tQueueFactory const & factory)
+{
+  auto spQUT = factory();
+  IWorkQueue & wq = spQUT->Get();
+
+  size_t cnt = 0U;
+
+  std::vector<std::unique_ptr<WorkPackage>> wps;
+  for (size_t i = 0U; i < wpsPerRound; i++)
+    wps.emplace_back(std::make_unique<WorkPackage>(nullptr, 0U, [&cnt]() { cnt++; }));
+
+  auto const start = Clock::now();
+  for (size_t i = 0U; i < nbOfWPs; i += wpsPerRound)
+  {
+    for (auto & spWP : wps)
+      wq.Add(*spWP);
+    wq.FlushNonDeferredWorkPackages();
+  }
+  auto const end = Clock::now();
+
+  if (cnt != nbOfWPs)
+    throw std::runtime_error("Throughput_1P_Static: Unexpected number of executed work packages");
+
+  result.AddThroughput(nbOfWPs, end - start);
+}
+
+// Single producer, dynamic work packages added in batches via the batch-Add() of WorkQueue or DeferredWorkQueue.
+template<typename T, typename... ARGS>
+void Throughput_1P_DynamicBatch(Result & result, ARGS&&... args)
+{
+  QueueWithThread<T> qut(std::forward<ARGS>(args)...);
+  T & wq = qut.GetQueue();
+
+  size_t cnt = 0U;
+  std::vector<std::unique_ptr<WorkPackage>> batch;
+  batch.reserve(wpsPerRound);
+
+  auto const start = Clock::now();
+  for (size_t i = 0U; i < nbOfWPs; i += wpsPerRound)
+  {
+    for (size_t j = 0U; j < wpsPerRound; j++)
+      batch.emplace_back(WorkPackage::CreateDynamic(nullptr, 0U, [&cnt]() { cnt++; }));
+    wq.Add(batch);
+    wq.FlushNonDeferredWorkPackages();
+  }
+  auto const end = Clock::now();
+
+  if (cnt != nbOfWPs)
+    throw std::runtime_error("Throughput_1P_DynamicBatch: Unexpected number of executed work packages");
+
+  result.AddThroughput(nbOfWPs, end - start);
+}
+
+// Multiple producers, dynamic work packages.
+void Throughput_MP_Dynamic(Result & result, tQueueFactory const & factory)
+{
+  auto spQUT = factory();
+  IWorkQueue & wq = spQUT->Get();
+
+  size_t const nbOfWPsPerProducer = nbOfWPs / nbOfProducers;
+  size_t cnt = 0U;
+  Semaphore go(0U);
+
+  auto producerEntry = [&]() -> void*
+  {
+    go.Wait();
+
+    for (size_t i = 0U; i < nbOfWPsPerProducer; i++)
+      wq.Add(WorkPackage::CreateDynamic(nullptr, 0U, [&cnt]() { cnt++; }));
+
+    return nullptr;
+  };
+
+  std::vector<std::unique_ptr<Thread>> producers;
+  for (size_t i = 0U; i < nbOfProducers; i++)
+  {
+    producers.emplace_back(std::make_unique<Thread>("Producer" + std::to_string(i)));
+    producers.back()->Start(producerEntry, Thread::SchedPolicy::Other, 0U, Thread::GetDefaultStackSize());
+  }
+
+  auto const start = Clock::now();
+  for (size_t i = 0U; i < nbOfProducers; i++)
+    go.Post();
+
+  for (auto & spProducer : producers)
+    spProducer->Join();
+  wq.FlushNonDeferredWorkPackages();
+  auto const end = Clock::now();
+
+  if (cnt != nbOfWPsPerProducer * nbOfProducers)
+    throw std::runtime_error("Throughput_MP_Dynamic: Unexpected number of executed work packages");
+
+  result.AddThroughput(nbOfWPsPerProducer * nbOfProducers, end - start);
+}
+
+// Inserts and removes static deferred work packages with random time points into a deferred work queue.
+void DeferredInsertAndRemove(Result & result)
+{
+  DeferredWorkQueue dwq;
+
+  std::mt19937 rng(42U);
+  std::uniform_int_distribution<int64_t> dist(0, 3600LL * 1000LL);
+  TimePoint const base = FarFuture();
+
+  std::vector<std::unique_ptr<DeferredWorkPackage>> dwps;
+  dwps.reserve(nbOfDWPs);
+  for (size_t i = 0U; i < nbOfDWPs; i++)
+    dwps.emplace_back(std::make_unique<DeferredWorkPackage>(nullptr, 0U, []() {}, base + TimeSpan::ms(dist(rng))));
+
+  auto const startInsert = Clock::now();
+  for (auto & spDWP : dwps)
+    dwq.Add(*spDWP);
+  auto const endInsert = Clock::now();
+
+  std::shuffle(dwps.begin(), dwps.end(), rng);
+
+  auto const startRemove = Clock::now();
+  for (auto & spDWP : dwps)
+    dwq.Remove(*spDWP);
+  auto const endRemove = Clock::now();
+
+  auto const nsPerOp = [](std::chrono::steady_clock::duration const d)
+  {
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(d).count()) /
+           static_cast<double>(nbOfDWPs);
+  };
+
+  result.Add("queue_depth", "", static_cast<double>(nbOfDWPs));
+  result.Add("insert_time_per_op", "ns", nsPerOp(endInsert - startInsert));
+  result.Add("remove_time_per_op", "ns", nsPerOp(endRemove - startRemove));
+}
+
+// Executes a large number of expired dynamic deferred work packages with random time points.
+void DeferredExpiry(Result & result)
+{
+  DeferredWorkQueue dwq;
+
+  std::mt19937 rng(42U);
+  std::uniform_int_distribution<int64_t> dist(1, 1000);
+  TimePoint const now = TimePoint::FromSystemClock(ConditionVariable::clockID);
+
+  size_t cnt = 0U;
+  for (size_t i = 0U; i < nbOfDWPs; i++)
+    dwq.Add(DeferredWorkPackage::CreateDynamic(nullptr, 0U, [&cnt]() { cnt++; }, now - TimeSpan::ms(dist(rng))));
+
+  // expired deferred work packages have priority above normal work packages
+  dwq.Add(WorkPackage::CreateDynamic(nullptr, 0U, [&dwq]() { dwq.RequestTermination(); }));
+
+  auto const start = Clock::now();
+  dwq.Work();
+  auto const end = Clock::now();
+
+  if (cnt != nbOfDWPs)
+    throw std::runtime_error("DeferredExpiry: Unexpected number of executed work packages");
+
+  result.Add("queue_depth", "", static_cast<double>(nbOfDWPs));
+  result.AddThroughput(nbOfDWPs, end - start);
+}
+
+// Measures Remove(owner) on a deep queue of dynamic (deferred) work packages.
+template<typename T, bool deferred>
+void RemoveByOwner(Result & result)
+{
+  T wq;
+  std::vector<uint8_t> owners(removeNbOfOwners);
+  TimePoint const tp = FarFuture();
+
+  for (size_t i = 0U; i < removeQueueDepth; i++)
+  {
+    void const * const pOwner = &owners[i % removeNbOfOwners];
+    if constexpr (deferred)
+      wq.Add(DeferredWorkPackage::CreateDynamic(pOwner, 0U, []() {}, tp));
+    else
+      wq.Add(WorkPackage::CreateDynamic(pOwner, 0U, []() {}));
+  }
+
+  auto const start = Clock::now();
+  for (size_t i = 0U; i < removeNbOfMeasurements; i++)
+    wq.Remove(&owners[i]);
+  auto const end = Clock::now();
+
+  result.Add("queue_depth", "", static_cast<double>(removeQueueDepth));
+  result.Add("removed_per_call", "", static_cast<double>(removeQueueDepth / removeNbOfOwners));
+  result.Add("time_per_call", "us",
+             static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()) /
+             static_cast<double>(removeNbOfMeasurements) / 1000.0);
+}
+
+// Measures the time from adding a work package to an idle work queue until the work package is executed.
+void WakeupLatency(Result & result, tQueueFactory const & factory)
+{
+  auto spQUT = factory();
+  IWorkQueue & wq = spQUT->Get();
+
+  std::vector<int64_t> samples(nbOfLatencySamples);
+  Semaphore done(0U);
+
+  for (size_t i = 0U; i < nbOfLatencySamples; i++)
+  {
+    // ensure that the work queue's thread is waiting for work
+    Thread::Sleep_ms(1U);
+
+    auto const start = Clock::now();
+    wq.Add(WorkPackage::CreateDynamic(nullptr, 0U,
+                                      [&, i, start]()
+                                      {
+                                        auto const d = Clock::now() - start;
+                                        samples[i] = std::chrono::duration_cast<std::chrono::nanoseconds>(d).count();
+                                        done.Post();
+                                      }));
+    done.Wait();
+  }
+
+  result.AddLatencyPercentiles(samples);
+}
+
+// Measures the delay between the point in time of a deferred work package and its execution.
+void DeferredTimerLatency(Result & result, tQueueFactory const & factory)
+{
+  auto spQUT = factory();
+  IDeferredWorkQueue & dwq = dynamic_cast<IDeferredWorkQueue&>(spQUT->Get());
+
+  std::vector<int64_t> samples(nbOfLatencySamples);
+  Semaphore done(0U);
+
+  for (size_t i = 0U; i < nbOfLatencySamples; i++)
+  {
+    TimePoint const tp = TimePoint::FromSystemClock(ConditionVariable::clockID) + TimeSpan::ms(1);
+    dwq.Add(DeferredWorkPackage::CreateDynamic(nullptr, 0U,
+                                               [&, i, tp]()
+                                               {
+                                                 auto const now = TimePoint::FromSystemClock(ConditionVariable::clockID);
+                                                 samples[i] = (now - tp).ns();
+                                                 done.Post();
+                                               },
+                                               tp));
+    done.Wait();
+  }
+
+  result.AddLatencyPercentiles(samples);
+}
+
+} // anonymous namespace
+
+/**
+ * \brief Registers the benchmarks for @ref WorkQueue, @ref DeferredWorkQueue, @ref DWQwithThread and
+ *        @ref SuspendableDWQwithThread.
+ *
+ * Scenarios:
+ * - Throughput with one producer thread, dynamic and static work packages and batches.
+ * - Throughput with multiple producer threads.
+ * - Insertion, removal and expiry of deferred work packages at scale.
+ * - Cost of `Remove(owner)` on deep queues.
+ * - Wake-up latency percentiles (time from adding a work package to an idle queue until execution) and timer
+ *   latency percentiles of deferred work packages.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * Basic guarantee.
+ *
+ * - - -
+ *
+ * \param runner
+ * The benchmarks are registered here.
+ */
+void RegisterWorkQueueBenchmarks(BenchmarkRunner & runner)
+{
+  using namespace std::placeholders;
+
+  struct Queue
+  {
+    char const * pName;
+    tQueueFactory factory;
+  };
+
+  std::vector<Queue> const queues =
+  {
+    { "WorkQueue",
+      []() { return std::make_unique<QueueWithThread<WorkQueue>>(); } },
+    { "WorkQueueLockFree",
+      []() { return std::make_unique<QueueWithThread<WorkQueue>>(WorkQueue::IngressMode::lockFree); } },
+    { "DeferredWorkQueue",
+      []() { return std::make_unique<QueueWithThread<DeferredWorkQueue>>(); } },
+    { "DWQwithThread",
+      []() { return std::make_unique<DWQwithThreadUnderTest>(); } },
+    { "SuspendableDWQwithThread",
+      []() { return std::make_unique<SuspendableDWQwithThreadUnderTest>(); } }
+  };
+
+  for (auto const & q : queues)
+  {
+    std::string const name = q.pName;
+    runner.Register(name + "/Throughput_1P_Dynamic", std::bind(Throughput_1P_Dynamic, _1, q.factory));
+    runner.Register(name + "/Throughput_1P_Static", std::bind(Throughput_1P_Static, _1, q.factory));
+    runner.Register(name + "/Throughput_" + std::to_string(nbOfProducers) + "P_Dynamic",
+                    std::bind(Throughput_MP_Dynamic, _1, q.factory));
+  }
+
+  runner.Register("WorkQueue/Throughput_1P_DynamicBatch",
+                  [](Result & r) { Throughput_1P_DynamicBatch<WorkQueue>(r); });
+  runner.Register("WorkQueueLockFree/Throughput_1P_DynamicBatch",
+                  [](Result & r) { Throughput_1P_DynamicBatch<WorkQueue>(r, WorkQueue::IngressMode::lockFree); });
+  runner.Register("DeferredWorkQueue/Throughput_1P_DynamicBatch",
+                  [](Result & r) { Throughput_1P_DynamicBatch<DeferredWorkQueue>(r); });
+
+  runner.Register("DeferredWorkQueue/DeferredInsertAndRemove", DeferredInsertAndRemove);
+  runner.Register("DeferredWorkQueue/DeferredExpiry", DeferredExpiry);
+
+  runner.Register("WorkQueue/RemoveByOwner", RemoveByOwner<WorkQueue, false>);
+  runner.Register("DeferredWorkQueue/RemoveByOwner", RemoveByOwner<DeferredWorkQueue, false>);
+  runner.Register("DeferredWorkQueue/RemoveByOwner_Deferred", RemoveByOwner<DeferredWorkQueue, true>);
+
+  for (auto const & q : queues)
+    runner.Register(std::string(q.pName) + "/WakeupLatency", std::bind(WakeupLatency, _1, q.factory));
+
+  runner.Register("DeferredWorkQueue/DeferredTimerLatency",
+                  std::bind(DeferredTimerLatency, _1, queues[2].factory));
+  runner.Register("DWQwithThread/DeferredTimerLatency",
+                  std::bind(DeferredTimerLatency, _1, queues[3].factory));
+}
+
+} // namespace gpcc_benchmarks
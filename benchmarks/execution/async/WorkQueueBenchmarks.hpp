@@ -0,0 +1,22 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#ifndef WORKQUEUEBENCHMARKS_HPP_202610161020
+#define WORKQUEUEBENCHMARKS_HPP_202610161020
+
+namespace gpcc_benchmarks {
+
+class BenchmarkRunner;
+
+void RegisterWorkQueueBenchmarks(BenchmarkRunner & runner);
+
+} // namespace gpcc_benchmarks
+
+#endif // WORKQUEUEBENCHMARKS_HPP_202610161020
@@ -0,0 +1,428 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#include "LogBenchmarks.hpp"
+#include "../BenchmarkRunner.hpp"
+#include <gpcc/log/backends/Backend.hpp>
+#include <gpcc/log/logfacilities/ThreadedLogFacility.hpp>
+#include <gpcc/log/log_levels.hpp>
+#include <gpcc/log/Logger.hpp>
+#include <gpcc/osal/Semaphore.hpp>
+#include <gpcc/osal/Thread.hpp>
+#include <gpcc_test/log/backends/Backend_Recorder.hpp>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace gpcc_benchmarks {
+
+using namespace gpcc::log;
+using gpcc::osal::Semaphore;
+using gpcc::osal::Thread;
+using gpcc_tests::log::Backend_Recorder;
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+typedef ThreadedLogFacility::IntakeMode IntakeMode;
+
+// Capacity of the log facility used by the caller latency and throughput benchmarks.
+size_t const capacity = 1024U;
+
+// Number of log messages emitted per round by the caller latency and throughput benchmarks. The log facility is
+// flushed after each round, so that no log message is dropped.
+size_t const msgsPerRound = capacity / 2U;
+
+// Number of samples taken by the caller latency benchmarks.
+size_t const nbOfCallerLatencySamples = 20000U;
+
+// Number of samples taken by the end-to-end latency benchmarks.
+size_t const nbOfDeliveryLatencySamples = 1000U;
+
+// Number of log messages used by the throughput benchmarks.
+size_t const nbOfMsgs = 200000U;
+
+// Capacity of the log facility used by the saturation benchmarks.
+size_t const saturationCapacity = 1000U;
+
+// Number of log messages emitted by each producer thread in the saturation benchmarks.
+size_t const nbOfSaturationMsgsPerProducer = 100000U;
+
+// Text of the log messages which are not created from a format string.
+char const * const pMsgText = "Benchmark message";
+
+// Back-end which discards all log messages, but counts the number of log messages of type LogType::Info.
+class NullBackend final : public Backend
+{
+  public:
+    NullBackend(void) : Backend(), nbOfInfoMsgs(0U) {}
+
+    size_t GetNbOfInfoMsgs(void) const noexcept { return nbOfInfoMsgs.load(std::memory_order_relaxed); }
+
+    void Process(std::string const & msg, LogType const type) override
+    {
+      (void)msg;
+      if (type == LogType::Info)
+        nbOfInfoMsgs.fetch_add(1U, std::memory_order_relaxed);
+    }
+
+  private:
+    std::atomic<size_t> nbOfInfoMsgs;
+};
+
+// Back-end which records the point in time when a log message is delivered and posts a semaphore.
+class LatencyBackend final : public Backend
+{
+  public:
+    LatencyBackend(void) : Backend(), delivered(0U), deliveryTime() {}
+
+    void WaitForDelivery(void) { delivered.Wait(); }
+    Clock::time_point GetDeliveryTime(void) const noexcept { return deliveryTime; }
+
+    void Process(std::string const & msg, LogType const type) override
+    {
+      (void)msg;
+      (void)type;
+      deliveryTime = Clock::now();
+      delivered.Post();
+    }
+
+  private:
+    Semaphore delivered;
+    Clock::time_point deliveryTime;
+};
+
+// A started ThreadedLogFacility with a Logger and a back-end registered.
+class Pipeline final
+{
+  public:
+    Pipeline(IntakeMode const mode, size_t const _capacity, Backend & _backend)
+    : facility("LogFacility", _capacity, mode)
+    , logger("Bench")
+    , backend(_backend)
+    {
+      facility.Register(logger);
+      try
+      {
+        facility.Register(backend);
+        try
+        {
+          facility.Start(Thread::SchedPolicy::Other, 0U, Thread::GetDefaultStackSize());
+        }
+        catch (std::exception const &)
+        {
+          facility.Unregister(backend);
+          throw;
+        }
+      }
+      catch (std::exception const &)
+      {
+        facility.Unregister(logger);
+        throw;
+      }
+    }
+
+    ~Pipeline(void)
+    {
+      facility.Stop();
+      facility.Unregister(backend);
+      facility.Unregister(logger);
+    }
+
+    ThreadedLogFacility facility;
+    Logger logger;
+
+  private:
+    Backend & backend;
+};
+
+// Measures the time spent by the caller in one overload of Logger::Log...().
+// "logFunc" emits one log message. It receives the logger, a prepared std::string containing the message text and
+// the number of the sample. Construction of the std::string is not included in the measurement.
+template<typename F>
+void CallerLatency(Result & result, IntakeMode const mode, F const & logFunc)
+{
+  NullBackend backend;
+  Pipeline pipeline(mode, capacity, backend);
+
+  std::vector<int64_t> samples(nbOfCallerLatencySamples);
+
+  for (size_t i = 0U; i < nbOfCallerLatencySamples; i++)
+  {
+    std::string s(pMsgText);
+
+    auto const start = Clock::now();
+    logFunc(pipeline.logger, s, static_cast<unsigned int>(i));
+    auto const end = Clock::now();
+
+    samples[i] = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+    if (((i + 1U) % msgsPerRound) == 0U)
+      pipeline.facility.Flush();
+  }
+
+  pipeline.facility.Flush();
+  if (backend.GetNbOfInfoMsgs() != nbOfCallerLatencySamples)
+    throw std::runtime_error("CallerLatency: Unexpected number of delivered log messages");
+
+  result.AddLatencyPercentiles(samples);
+}
+
+// Measures the time from emitting a log message via LogD() to an idle log facility until it is delivered to the
+// back-end.
+void DeliveryLatency(Result & result, IntakeMode const mode)
+{
+  LatencyBackend backend;
+  Pipeline pipeline(mode, capacity, backend);
+
+  std::vector<int64_t> samples(nbOfDeliveryLatencySamples);
+
+  for (size_t i = 0U; i < nbOfDeliveryLatencySamples; i++)
+  {
+    // ensure that the log facility's thread is waiting for log messages
+    Thread::Sleep_ms(1U);
+
+    auto const start = Clock::now();
+    pipeline.logger.LogD(LogType::Info, "Value: %u", static_cast<unsigned int>(i));
+    backend.WaitForDelivery();
+
+    samples[i] = std::chrono::duration_cast<std::chrono::nanoseconds>(backend.GetDeliveryTime() - start).count();
+  }
+
+  result.AddLatencyPercentiles(samples);
+}
+
+// Multiple producer threads emit log messages as fast as possible. Each producer flushes the log facility after each
+// round, so that no log message is dropped. The elapsed time includes delivery of all log messages.
+void Throughput(Result & result, IntakeMode const mode, size_t const nbOfProducers)
+{
+  NullBackend backend;
+  Pipeline pipeline(mode, capacity, backend);
+
+  size_t const msgsPerProducerRound = msgsPerRound / nbOfProducers;
+  size_t const nbOfMsgsPerProducer = (nbOfMsgs / nbOfProducers / msgsPerProducerRound) * msgsPerProducerRound;
+  Semaphore go(0U);
+
+  auto producerEntry = [&]() -> void*
+  {
+    go.Wait();
+
+    for (size_t i = 0U; i < nbOfMsgsPerProducer; i += msgsPerProducerRound)
+    {
+      for (size_t j = 0U; j < msgsPerProducerRound; j++)
+        pipeline.logger.Log(LogType::Info, pMsgText);
+      pipeline.facility.Flush();
+    }
+
+    return nullptr;
+  };
+
+  std::vector<std::unique_ptr<Thread>> producers;
+  for (size_t i = 0U; i < nbOfProducers; i++)
+  {
+    producers.emplace_back(std::make_unique<Thread>("Producer" + std::to_string(i)));
+    producers.back()->Start(producerEntry, Thread::SchedPolicy::Other, 0U, Thread::GetDefaultStackSize());
+  }
+
+  auto const start = Clock::now();
+  for (size_t i = 0U; i < nbOfProducers; i++)
+    go.Post();
+
+  for (auto & spProducer : producers)
+    spProducer->Join();
+  pipeline.facility.Flush();
+  auto const end = Clock::now();
+
+  if (backend.GetNbOfInfoMsgs() != nbOfMsgsPerProducer * nbOfProducers)
+    throw std::runtime_error("Throughput: Unexpected number of delivered log messages");
+
+  result.AddThroughput(nbOfMsgsPerProducer * nbOfProducers, end - start);
+}
+
+// Single producer, log messages are created via LogD() and delivered to a Backend_Recorder, which stores the log
+// message text strings. This includes the costs for building the log message text strings on the log facility's
+// thread.
+void Throughput_Recorder(Result & result, IntakeMode const mode)
+{
+  Backend_Recorder backend;
+  Pipeline pipeline(mode, capacity, backend);
+
+  auto const start = Clock::now();
+  for (size_t i = 0U; i < nbOfMsgs; i += msgsPerRound)
+  {
+    for (size_t j = 0U; j < msgsPerRound; j++)
+      pipeline.logger.LogD(LogType::Info, "Value: %u", static_cast<unsigned int>(j));
+    pipeline.facility.Flush();
+  }
+  auto const end = Clock::now();
+
+  size_t const n = ((nbOfMsgs + msgsPerRound - 1U) / msgsPerRound) * msgsPerRound;
+  if (backend.GetNbOfRecords() != n)
+    throw std::runtime_error("Throughput_Recorder: Unexpected number of delivered log messages");
+
+  result.AddThroughput(n, end - start);
+}
+
+// Multiple producer threads emit log messages as fast as possible without any flush. Log messages are dropped if the
+// capacity of the log facility is exceeded.
+void Saturation(Result & result, IntakeMode const mode, size_t const nbOfProducers)
+{
+  NullBackend backend;
+  Pipeline pipeline(mode, saturationCapacity, backend);
+
+  Semaphore go(0U);
+
+  auto producerEntry = [&]() -> void*
+  {
+    go.Wait();
+
+    for (size_t i = 0U; i < nbOfSaturationMsgsPerProducer; i++)
+      pipeline.logger.Log(LogType::Info, pMsgText);
+
+    return nullptr;
+  };
+
+  std::vector<std::unique_ptr<Thread>> producers;
+  for (size_t i = 0U; i < nbOfProducers; i++)
+  {
+    producers.emplace_back(std::make_unique<Thread>("Producer" + std::to_string(i)));
+    producers.back()->Start(producerEntry, Thread::SchedPolicy::Other, 0U, Thread::GetDefaultStackSize());
+  }
+
+  auto const start = Clock::now();
+  for (size_t i = 0U; i < nbOfProducers; i++)
+    go.Post();
+
+  for (auto & spProducer : producers)
+    spProducer->Join();
+  auto const endOfProduction = Clock::now();
+  pipeline.facility.Flush();
+  auto const endOfDelivery = Clock::now();
+
+  size_t const sent = nbOfSaturationMsgsPerProducer * nbOfProducers;
+  size_t const delivered = backend.GetNbOfInfoMsgs();
+
+  auto const toSec = [](Clock::duration const d)
+  {
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(d).count()) / 1.0E9;
+  };
+
+  result.Add("capacity", "", static_cast<double>(saturationCapacity));
+  result.Add("offered_rate", "msgs/s", static_cast<double>(sent) / toSec(endOfProduction - start));
+  result.Add("delivered_rate", "msgs/s", static_cast<double>(delivered) / toSec(endOfDelivery - start));
+  result.Add("dropped", "%", 100.0 * static_cast<double>(sent - delivered) / static_cast<double>(sent));
+}
+
+} // anonymous namespace
+
+/**
+ * \brief Registers the benchmarks for the log pipeline (@ref Logger, @ref ThreadedLogFacility and back-ends).
+ *
+ * Each scenario is registered for each @ref ThreadedLogFacility::IntakeMode:
+ * - Caller latency percentiles for the overloads of `Logger::Log...()`.
+ * - End-to-end latency percentiles (time from emitting a log message to an idle log facility until delivery to the
+ *   back-end).
+ * - Throughput with 1..4 producer threads without any dropped log messages (null back-end).
+ * - Throughput with one producer thread and deferred formatting, delivered to a `Backend_Recorder`.
+ * - Saturation with 1..4 producer threads emitting log messages without any flush: Offered rate, delivered rate
+ *   and percentage of dropped log messages at the configured capacity.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * Basic guarantee.
+ *
+ * - - -
+ *
+ * \param runner
+ * The benchmarks are registered here.
+ */
+void RegisterLogBenchmarks(BenchmarkRunner & runner)
+{
+  struct Mode
+  {
+    char const * pName;
+    IntakeMode mode;
+  };
+
+  std::vector<Mode> const modes =
+  {
+    { "ThreadedLogFacility",                   IntakeMode::locked },
+    { "ThreadedLogFacilityLockFreeRing",       IntakeMode::lockFreeRing }
+#if (defined(OS_LINUX_ARM) || defined(OS_LINUX_ARM_TFC) || defined(OS_LINUX_X64) || defined(OS_LINUX_X64_TFC))
+  , { "ThreadedLogFacilityPerThreadBuffers",   IntakeMode::perThreadBuffers }
+#endif
+  };
+
+  for (auto const & m : modes)
+  {
+    std::string const name = m.pName;
+    IntakeMode const mode = m.mode;
+
+    runner.Register(name + "/CallerLatency_Log_cstr", [mode](Result & r)
+    {
+      CallerLatency(r, mode, [](Logger & l, std::string &, unsigned int) { l.Log(LogType::Info, pMsgText); });
+    });
+    runner.Register(name + "/CallerLatency_Log_string_copy", [mode](Result & r)
+    {
+      CallerLatency(r, mode, [](Logger & l, std::string & s, unsigned int) { l.Log(LogType::Info, s); });
+    });
+    runner.Register(name + "/CallerLatency_Log_string_move", [mode](Result & r)
+    {
+      CallerLatency(r, mode, [](Logger & l, std::string & s, unsigned int) { l.Log(LogType::Info, std::move(s)); });
+    });
+    runner.Register(name + "/CallerLatency_LogV", [mode](Result & r)
+    {
+      CallerLatency(r, mode, [](Logger & l, std::string &, unsigned int i) { l.LogV(LogType::Info, "Value: %u", i); });
+    });
+    runner.Register(name + "/CallerLatency_LogD", [mode](Result & r)
+    {
+      CallerLatency(r, mode, [](Logger & l, std::string &, unsigned int i) { l.LogD(LogType::Info, "Value: %u", i); });
+    });
+    runner.Register(name + "/CallerLatency_LogTS_cstr", [mode](Result & r)
+    {
+      CallerLatency(r, mode, [](Logger & l, std::string &, unsigned int) { l.LogTS(LogType::Info, pMsgText); });
+    });
+    runner.Register(name + "/CallerLatency_LogVTS", [mode](Result & r)
+    {
+      CallerLatency(r, mode,
+                    [](Logger & l, std::string &, unsigned int i) { l.LogVTS(LogType::Info, "Value: %u", i); });
+    });
+    runner.Register(name + "/CallerLatency_LogDTS", [mode](Result & r)
+    {
+      CallerLatency(r, mode,
+                    [](Logger & l, std::string &, unsigned int i) { l.LogDTS(LogType::Info, "Value: %u", i); });
+    });
+
+    runner.Register(name + "/DeliveryLatency", [mode](Result & r) { DeliveryLatency(r, mode); });
+
+    for (size_t nbOfProducers : { 1U, 2U, 4U })
+    {
+      runner.Register(name + "/Throughput_" + std::to_string(nbOfProducers) + "P",
+                      [mode, nbOfProducers](Result & r) { Throughput(r, mode, nbOfProducers); });
+    }
+
+    runner.Register(name + "/Throughput_1P_Recorder", [mode](Result & r) { Throughput_Recorder(r, mode); });
+
+    for (size_t nbOfProducers : { 1U, 2U, 4U })
+    {
+      runner.Register(name + "/Saturation_" + std::to_string(nbOfProducers) + "P",
+                      [mode, nbOfProducers](Result & r) { Saturation(r, mode, nbOfProducers); });
+    }
+  }
+}
+
+} // namespace gpcc_benchmarks
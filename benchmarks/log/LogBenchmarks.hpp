@@ -0,0 +1,22 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#ifndef LOGBENCHMARKS_HPP_202610162110
+#define LOGBENCHMARKS_HPP_202610162110
+
+namespace gpcc_benchmarks {
+
+class BenchmarkRunner;
+
+void RegisterLogBenchmarks(BenchmarkRunner & runner);
+
+} // namespace gpcc_benchmarks
+
+#endif // LOGBENCHMARKS_HPP_202610162110
@@ -0,0 +1,120 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#include "BenchmarkRunner.hpp"
+#include "execution/async/WorkQueueBenchmarks.hpp"
+#include "log/LogBenchmarks.hpp"
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+using namespace gpcc_benchmarks;
+
+namespace {
+
+void PrintUsage(char const * const pProgName)
+{
+  std::cout << "Usage: " << pProgName << " [options]" << std::endl
+            << "Options:" << std::endl
+            << "  --format=json|csv  Output format (default: json)" << std::endl
+            << "  --output=<file>    Writes the results into <file> instead of stdout" << std::endl
+            << "  --filter=<text>    Runs only benchmarks whose name contains <text>" << std::endl
+            << "  --list             Lists all benchmarks and exits" << std::endl
+            << "  --help             Prints this text and exits" << std::endl;
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv)
+{
+  std::string format = "json";
+  std::string outputFile;
+  std::string filter;
+  bool list = false;
+
+  for (int i = 1; i < argc; i++)
+  {
+    std::string const arg = argv[i];
+
+    if (arg.rfind("--format=", 0) == 0)
+      format = arg.substr(9);
+    else if (arg.rfind("--output=", 0) == 0)
+      outputFile = arg.substr(9);
+    else if (arg.rfind("--filter=", 0) == 0)
+      filter = arg.substr(9);
+    else if (arg == "--list")
+      list = true;
+    else if (arg == "--help")
+    {
+      PrintUsage(argv[0]);
+      return 0;
+    }
+    else
+    {
+      std::cerr << "Invalid argument: " << arg << std::endl;
+      PrintUsage(argv[0]);
+      return 1;
+    }
+  }
+
+  if ((format != "json") && (format != "csv"))
+  {
+    std::cerr << "Invalid format: " << format << std::endl;
+    return 1;
+  }
+
+  try
+  {
+    BenchmarkRunner runner;
+    RegisterWorkQueueBenchmarks(runner);
+    RegisterLogBenchmarks(runner);
+
+    if (list)
+    {
+      runner.List(std::cout);
+      return 0;
+    }
+
+    // progress goes to stderr, so that the results can be redirected from stdout
+    auto const results = runner.Run(filter, std::cerr);
+
+    std::ofstream file;
+    if (!outputFile.empty())
+    {
+      file.open(outputFile, std::ios_base::out | std::ios_base::trunc);
+      if (!file)
+      {
+        std::cerr << "Cannot open output file: " << outputFile << std::endl;
+        return 1;
+      }
+    }
+    std::ostream & out = outputFile.empty() ? std::cout : file;
+
+    if (format == "json")
+      BenchmarkRunner::WriteJSON(results, out);
+    else
+      BenchmarkRunner::WriteCSV(results, out);
+
+    out.flush();
+    if (!out)
+    {
+      std::cerr << "Failed to write results." << std::endl;
+      return 1;
+    }
+  }
+  catch (std::exception const & e)
+  {
+    std::cerr << "Error: " << e.what() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
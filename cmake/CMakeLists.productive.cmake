@@ -16,6 +16,22 @@
 # ---------------------------------------------------------------------------------------------------------------------
 option(GPCC_CliNoFontStyles "Disables gpcc::cli::CLI font style control." OFF)
 
+# ---------------------------------------------------------------------------------------------------------------------
+# Option "GPCC_LogMinLevel"
+# ---------------------------------------------------------------------------------------------------------------------
+set(GPCC_LogMinLevel "DebugOrAbove" CACHE STRING "Log level threshold applied at compile time. Log messages below are removed by the compiler.")
+set_property(CACHE GPCC_LogMinLevel PROPERTY STRINGS DebugOrAbove InfoOrAbove WarningOrAbove ErrorOrAbove FatalOrAbove Nothing)
+
+# ---------------------------------------------------------------------------------------------------------------------
+# Option "GPCC_BuildBenchmarks"
+# ---------------------------------------------------------------------------------------------------------------------
+option(GPCC_BuildBenchmarks "Builds the benchmark executable 'gpcc_benchmarks' (requires GPCC_OS=linux_arm or linux_x64)." OFF)
+
+# ---------------------------------------------------------------------------------------------------------------------
+# Option "GPCC_BuildLogDecoder"
+# ---------------------------------------------------------------------------------------------------------------------
+option(GPCC_BuildLogDecoder "Builds the tool 'gpcc_log_decoder' which converts binary log files into text (requires GPCC_OS=linux_arm or linux_x64)." OFF)
+
 
 
 # ---------------------------------------------------------------------------------------------------------------------
@@ -30,3 +46,45 @@ target_include_directories(${PROJECT_NAME} PRIVATE . PUBLIC include)
 SetupBasicDefines(${PROJECT_NAME})
 SetRequiredCompilerOptionsAndFeatures(${PROJECT_NAME})
 SetupLinkLibraries(${PROJECT_NAME})
+
+
+
+# ---------------------------------------------------------------------------------------------------------------------
+# Artifact: gpcc_benchmarks executable (optional)
+# ---------------------------------------------------------------------------------------------------------------------
+if(GPCC_BuildBenchmarks)
+  if(NOT ((${GPCC_OS} STREQUAL "linux_arm") OR (${GPCC_OS} STREQUAL "linux_x64")))
+    message(FATAL_ERROR "Error: 'GPCC_BuildBenchmarks' requires 'GPCC_OS=linux_arm' or 'GPCC_OS=linux_x64'.")
+  endif()
+
+  add_executable(${PROJECT_NAME}_benchmarks)
+
+  add_subdirectory(benchmarks)
+
+  target_include_directories(${PROJECT_NAME}_benchmarks PRIVATE .)
+
+  SetRequiredCompilerOptionsAndFeatures(${PROJECT_NAME}_benchmarks)
+
+  target_link_libraries(${PROJECT_NAME}_benchmarks PRIVATE ${PROJECT_NAME})
+endif()
+
+
+
+# ---------------------------------------------------------------------------------------------------------------------
+# Artifact: gpcc_log_decoder executable (optional)
+# ---------------------------------------------------------------------------------------------------------------------
+if(GPCC_BuildLogDecoder)
+  if(NOT ((${GPCC_OS} STREQUAL "linux_arm") OR (${GPCC_OS} STREQUAL "linux_x64")))
+    message(FATAL_ERROR "Error: 'GPCC_BuildLogDecoder' requires 'GPCC_OS=linux_arm' or 'GPCC_OS=linux_x64'.")
+  endif()
+
+  add_executable(${PROJECT_NAME}_log_decoder)
+
+  add_subdirectory(tools/log_decoder)
+
+  target_include_directories(${PROJECT_NAME}_log_decoder PRIVATE .)
+
+  SetRequiredCompilerOptionsAndFeatures(${PROJECT_NAME}_log_decoder)
+
+  target_link_libraries(${PROJECT_NAME}_log_decoder PRIVATE ${PROJECT_NAME})
+endif()
@@ -16,6 +16,11 @@
 # ---------------------------------------------------------------------------------------------------------------------
 set(GPCC_CliNoFontStyles ON CACHE BOOL "" FORCE)
 
+# ---------------------------------------------------------------------------------------------------------------------
+# Option "GPCC_LogMinLevel" (always DebugOrAbove in unittest environment)
+# ---------------------------------------------------------------------------------------------------------------------
+set(GPCC_LogMinLevel "DebugOrAbove" CACHE STRING "" FORCE)
+
 # ---------------------------------------------------------------------------------------------------------------------
 # Option "GPCC_BuildEmptyTestCaseLibrary"
 # ---------------------------------------------------------------------------------------------------------------------
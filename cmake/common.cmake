@@ -65,6 +65,22 @@ function(SetupBasicDefines target)
   if(GPCC_CliNoFontStyles)
     target_compile_definitions(${target} PUBLIC GPCC_CLI_NO_FONT_STYLES)
   endif()
+
+  if((NOT DEFINED GPCC_LogMinLevel) OR (${GPCC_LogMinLevel} STREQUAL "DebugOrAbove"))
+    # GPCC_LOG_MIN_LEVEL defaults to 0 (DebugOrAbove)
+  elseif(${GPCC_LogMinLevel} STREQUAL "InfoOrAbove")
+    target_compile_definitions(${target} PUBLIC GPCC_LOG_MIN_LEVEL=1)
+  elseif(${GPCC_LogMinLevel} STREQUAL "WarningOrAbove")
+    target_compile_definitions(${target} PUBLIC GPCC_LOG_MIN_LEVEL=2)
+  elseif(${GPCC_LogMinLevel} STREQUAL "ErrorOrAbove")
+    target_compile_definitions(${target} PUBLIC GPCC_LOG_MIN_LEVEL=3)
+  elseif(${GPCC_LogMinLevel} STREQUAL "FatalOrAbove")
+    target_compile_definitions(${target} PUBLIC GPCC_LOG_MIN_LEVEL=4)
+  elseif(${GPCC_LogMinLevel} STREQUAL "Nothing")
+    target_compile_definitions(${target} PUBLIC GPCC_LOG_MIN_LEVEL=5)
+  else()
+    message(FATAL_ERROR "Error: Value of 'GPCC_LogMinLevel' is not supported by function 'SetupBasicDefines'.")
+  endif()
 endfunction()
 
 function(SetupDefinesForSkippingUnitTests target)
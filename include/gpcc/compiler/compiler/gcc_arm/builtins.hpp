@@ -376,6 +376,90 @@ inline uint32_t ReverseBits32(uint32_t const value) noexcept
   return result;
 }
 
+/**
+ * \ingroup GPCC_COMPILER_BUILTINS
+ * \brief Reverses the byte order in a 16 bit value.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \param value
+ * Input value.
+ *
+ * \return
+ * @p value with bytes being reversed.
+ */
+inline uint16_t ByteSwap16(uint16_t const value) noexcept
+{
+  return __builtin_bswap16(value);
+}
+
+/**
+ * \ingroup GPCC_COMPILER_BUILTINS
+ * \brief Reverses the byte order in a 32 bit value.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \param value
+ * Input value.
+ *
+ * \return
+ * @p value with bytes being reversed.
+ */
+inline uint32_t ByteSwap32(uint32_t const value) noexcept
+{
+  return __builtin_bswap32(value);
+}
+
+/**
+ * \ingroup GPCC_COMPILER_BUILTINS
+ * \brief Reverses the byte order in a 64 bit value.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \param value
+ * Input value.
+ *
+ * \return
+ * @p value with bytes being reversed.
+ */
+inline uint64_t ByteSwap64(uint64_t const value) noexcept
+{
+  return __builtin_bswap64(value);
+}
+
 } // namespace compiler
 } // namespace gpcc
 
@@ -0,0 +1,571 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#ifndef AWAITABLES_HPP_202610161148
+#define AWAITABLES_HPP_202610161148
+
+// Coroutine support requires C++20. If GPCC is compiled with an older standard, then this header is empty.
+#if defined(__cpp_impl_coroutine) && (__cpp_impl_coroutine >= 201902L)
+
+#include <gpcc/execution/async/DeferredWorkPackage.hpp>
+#include <gpcc/execution/async/IDeferredWorkQueue.hpp>
+#include <gpcc/execution/async/Task.hpp>
+#include <gpcc/osal/ConditionVariable.hpp>
+#include <gpcc/time/TimePoint.hpp>
+#include <gpcc/time/TimeSpan.hpp>
+#include <atomic>
+#include <coroutine>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <cstdint>
+
+namespace gpcc      {
+namespace execution {
+namespace async     {
+
+/**
+ * \ingroup GPCC_EXECUTION_ASYNC
+ * \brief Awaitable that suspends a coroutine and resumes it via a work queue (C++20 only).
+ *
+ * Instances are created via @ref Yield().
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * Not thread-safe.
+ */
+class YieldAwaitable final
+{
+  public:
+    YieldAwaitable(IWorkQueue & _wq, WorkPackagePool* const _pPool) noexcept : wq(_wq), pPool(_pPool) {}
+
+    bool await_ready(void) const noexcept { return false; }
+    void await_suspend(std::coroutine_handle<> const h) { wq.Add(internal::CreateResumeWP(h, pPool)); }
+    void await_resume(void) const noexcept {}
+
+  private:
+    /// Work queue that shall resume the coroutine.
+    IWorkQueue & wq;
+
+    /// Optional pool for the work package. `nullptr` = heap.
+    WorkPackagePool* const pPool;
+};
+
+/**
+ * \ingroup GPCC_EXECUTION_ASYNC
+ * \brief Awaitable that suspends a coroutine and resumes it via a deferred work queue at a given point in time
+ *        (C++20 only).
+ *
+ * Instances are created via @ref Delay() and @ref DelayUntil().
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * Not thread-safe.
+ */
+class DelayAwaitable final
+{
+  public:
+    DelayAwaitable(IDeferredWorkQueue & _dwq, time::TimePoint const & _tp, WorkPackagePool* const _pPool) noexcept
+    : dwq(_dwq), tp(_tp), pPool(_pPool) {}
+
+    bool await_ready(void) const noexcept { return false; }
+    void await_suspend(std::coroutine_handle<> const h);
+    void await_resume(void) const noexcept {}
+
+  private:
+    /// Deferred work queue that shall resume the coroutine.
+    IDeferredWorkQueue & dwq;
+
+    /// Point in time when the coroutine shall be resumed (clock: @ref gpcc::osal::ConditionVariable::clockID).
+    time::TimePoint const tp;
+
+    /// Optional pool for the deferred work package. `nullptr` = heap.
+    WorkPackagePool* const pPool;
+};
+
+namespace internal {
+
+/**
+ * \ingroup GPCC_EXECUTION_ASYNC
+ * \brief Common part of all @ref AsyncResult class templates.
+ *
+ * This implements the lock-free handshake between the thread delivering the result and the awaiting coroutine.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * See @ref AsyncResult.
+ */
+class AsyncResultBase
+{
+  public:
+    AsyncResultBase(AsyncResultBase const &) = delete;
+    AsyncResultBase(AsyncResultBase &&) = delete;
+
+    AsyncResultBase& operator=(AsyncResultBase const &) = delete;
+    AsyncResultBase& operator=(AsyncResultBase &&) = delete;
+
+    bool await_ready(void) const noexcept { return (state.load(std::memory_order_acquire) == States::completed); }
+    bool await_suspend(std::coroutine_handle<> const h);
+
+  protected:
+    AsyncResultBase(IWorkQueue & _wq, WorkPackagePool* const _pPool) noexcept;
+    ~AsyncResultBase(void) = default;
+
+    void SignalCompletion(void);
+    bool IsCompleted(void) const noexcept { return (state.load(std::memory_order_acquire) == States::completed); }
+
+  private:
+    /// States of the handshake.
+    enum class States : uint8_t
+    {
+      empty,      ///<No result available, no coroutine waiting.
+      waiting,    ///<No result available, coroutine waiting.
+      completed   ///<Result available.
+    };
+
+    /// Work queue that shall resume the awaiting coroutine.
+    IWorkQueue & wq;
+
+    /// Optional pool for the work package resuming the coroutine. `nullptr` = heap.
+    WorkPackagePool* const pPool;
+
+    /// Current state.
+    std::atomic<States> state;
+
+    /// Work package that will resume the awaiting coroutine.
+    /** This is created when the coroutine starts waiting. This way, delivery of the result cannot fail. */
+    std::unique_ptr<WorkPackage> spResumeWP;
+};
+
+} // namespace internal
+
+/**
+ * \ingroup GPCC_EXECUTION_ASYNC
+ * \brief One-shot result that can be awaited by a coroutine and delivered by any thread (C++20 only).
+ *
+ * This is intended to wrap callback-style APIs into awaitables. The coroutine creates an @ref AsyncResult, passes it to
+ * the callback and awaits it. The callback delivers the result via @ref SetResult(). The awaiting coroutine will
+ * be resumed by the work queue passed to the constructor.
+ *
+ * Example: Wrapping the read-callback of `gpcc::cood::IRemoteObjectDictionaryAccessNotifiable`:
+ * ~~~{.cpp}
+ * class MyClient : public IRemoteObjectDictionaryAccessNotifiable
+ * {
+ *   // ...
+ *   AsyncResult<ResponseBase::ReturnStackItem> * pPendingRequest;
+ *
+ *   void OnRequestProcessed(std::unique_ptr<ResponseBase> spResponse) noexcept override
+ *   {
+ *     // ... (executed in the context of the RODA's thread)
+ *     pPendingRequest->SetResult(result);
+ *   }
+ *
+ *   Task<void> ReadAndProcess(void)
+ *   {
+ *     AsyncResult<ResponseBase::ReturnStackItem> result(myWorkQueue);
+ *     pPendingRequest = &result;
+ *     pRODA->Send(std::move(spRequest));
+ *     auto const x = co_await result; // resumed in the context of myWorkQueue
+ *     // ...
+ *   }
+ * };
+ * ~~~
+ *
+ * The result can be delivered before or after the coroutine starts to await it. If the coroutine is suspended, then it
+ * will be resumed via a dynamic work package added to the work queue. The work package is created when the coroutine
+ * is suspended, so @ref SetResult() cannot fail due to lack of memory.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * @ref SetResult() is thread-safe and may be invoked from any thread. The object may be destroyed by the awaiting
+ * coroutine immediately after it has been resumed. @ref SetResult() does not access the object after the awaiting
+ * coroutine has been scheduled for resumption.\n
+ * Only one coroutine may await the object.
+ *
+ * \tparam T
+ * Type of the result.
+ */
+template <typename T>
+class AsyncResult final : public internal::AsyncResultBase
+{
+  public:
+    AsyncResult(void) = delete;
+    explicit AsyncResult(IWorkQueue & _wq, WorkPackagePool* const _pPool = nullptr) noexcept;
+    ~AsyncResult(void) = default;
+
+    template <typename U>
+    void SetResult(U && value);
+
+    T await_resume(void);
+
+  private:
+    /// The result.
+    std::optional<T> result;
+};
+
+/**
+ * \ingroup GPCC_EXECUTION_ASYNC
+ * \brief One-shot completion event that can be awaited by a coroutine and signaled by any thread (C++20 only).
+ *
+ * This is the variant of @ref AsyncResult for callbacks that do not deliver any data.
+ */
+template <>
+class AsyncResult<void> final : public internal::AsyncResultBase
+{
+  public:
+    AsyncResult(void) = delete;
+    explicit AsyncResult(IWorkQueue & _wq, WorkPackagePool* const _pPool = nullptr) noexcept
+    : AsyncResultBase(_wq, _pPool) {}
+    ~AsyncResult(void) = default;
+
+    void SetResult(void) { SignalCompletion(); }
+
+    void await_resume(void) const noexcept {}
+};
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * \ingroup GPCC_EXECUTION_ASYNC
+ * \brief Suspends the awaiting coroutine and resumes it in the context of a work queue (C++20 only).
+ *
+ * This can be used to split a long running coroutine into smaller steps, or to move a coroutine to a different work
+ * queue.
+ *
+ * ~~~{.cpp}
+ * co_await Yield(wq);
+ * ~~~
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.\n
+ * `co_await` may throw if the work package cannot be allocated. The coroutine will not be suspended in this case.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param wq
+ * Work queue that shall resume the coroutine.
+ *
+ * \param pPool
+ * Optional pool that shall be used to allocate the work package.\n
+ * `nullptr` = the work package will be allocated on the heap.
+ *
+ * \return
+ * Awaitable.
+ */
+inline YieldAwaitable Yield(IWorkQueue & wq, WorkPackagePool* const pPool = nullptr) noexcept
+{
+  return YieldAwaitable(wq, pPool);
+}
+
+/**
+ * \ingroup GPCC_EXECUTION_ASYNC
+ * \brief Suspends the awaiting coroutine and resumes it in the context of a deferred work queue after a delay
+ *        (C++20 only).
+ *
+ * ~~~{.cpp}
+ * co_await Delay(dwq, TimeSpan::ms(100));
+ * ~~~
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.\n
+ * `co_await` may throw if the work package cannot be allocated. The coroutine will not be suspended in this case.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param dwq
+ * Deferred work queue that shall resume the coroutine.
+ *
+ * \param delay
+ * Delay, measured from now.
+ *
+ * \param pPool
+ * Optional pool that shall be used to allocate the deferred work package.\n
+ * `nullptr` = the work package will be allocated on the heap.
+ *
+ * \return
+ * Awaitable.
+ */
+inline DelayAwaitable Delay(IDeferredWorkQueue & dwq, time::TimeSpan const & delay,
+                            WorkPackagePool* const pPool = nullptr)
+{
+  return DelayAwaitable(dwq, time::TimePoint::FromSystemClock(gpcc::osal::ConditionVariable::clockID) + delay, pPool);
+}
+
+/**
+ * \ingroup GPCC_EXECUTION_ASYNC
+ * \brief Suspends the awaiting coroutine and resumes it in the context of a deferred work queue at a given point in
+ *        time (C++20 only).
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.\n
+ * `co_await` may throw if the work package cannot be allocated. The coroutine will not be suspended in this case.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param dwq
+ * Deferred work queue that shall resume the coroutine.
+ *
+ * \param tp
+ * Point in time when the coroutine shall be resumed.\n
+ * The time point must be specified using the clock @ref gpcc::osal::ConditionVariable::clockID.
+ *
+ * \param pPool
+ * Optional pool that shall be used to allocate the deferred work package.\n
+ * `nullptr` = the work package will be allocated on the heap.
+ *
+ * \return
+ * Awaitable.
+ */
+inline DelayAwaitable DelayUntil(IDeferredWorkQueue & dwq, time::TimePoint const & tp,
+                                 WorkPackagePool* const pPool = nullptr) noexcept
+{
+  return DelayAwaitable(dwq, tp, pPool);
+}
+
+/**
+ * \brief Suspends the coroutine and adds a deferred work package resuming it to the deferred work queue.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param h
+ * Handle of the awaiting coroutine.
+ */
+inline void DelayAwaitable::await_suspend(std::coroutine_handle<> const h)
+{
+  auto resume = [h]() { h.resume(); };
+
+  if (pPool != nullptr)
+    dwq.Add(DeferredWorkPackage::CreateDynamic(*pPool, h.address(), 0U, resume, tp));
+  else
+    dwq.Add(DeferredWorkPackage::CreateDynamic(h.address(), 0U, resume, tp));
+}
+
+namespace internal {
+
+/**
+ * \brief Constructor.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param _wq
+ * Work queue that shall resume the awaiting coroutine.
+ *
+ * \param _pPool
+ * Optional pool that shall be used to allocate the work package resuming the coroutine.\n
+ * `nullptr` = the work package will be allocated on the heap.
+ */
+inline AsyncResultBase::AsyncResultBase(IWorkQueue & _wq, WorkPackagePool* const _pPool) noexcept
+: wq(_wq)
+, pPool(_pPool)
+, state(States::empty)
+, spResumeWP()
+{
+}
+
+/**
+ * \brief Suspends the awaiting coroutine, unless the result is already available.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param h
+ * Handle of the awaiting coroutine.
+ *
+ * \retval true   Coroutine is suspended.
+ * \retval false  Result is already available, coroutine is not suspended.
+ */
+inline bool AsyncResultBase::await_suspend(std::coroutine_handle<> const h)
+{
+  if (state.load(std::memory_order_acquire) == States::waiting)
+    throw std::logic_error("AsyncResultBase::await_suspend: Already awaited");
+
+  spResumeWP = CreateResumeWP(h, pPool);
+
+  States expected = States::empty;
+  if (state.compare_exchange_strong(expected, States::waiting, std::memory_order_acq_rel, std::memory_order_acquire))
+    return true;
+
+  // result has been delivered in the meantime
+  spResumeWP.reset();
+  return false;
+}
+
+/**
+ * \brief Signals that the result is available and schedules resumption of the awaiting coroutine (if any).
+ *
+ * The result must have been stored before this is invoked.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ */
+inline void AsyncResultBase::SignalCompletion(void)
+{
+  States const prev = state.exchange(States::completed, std::memory_order_acq_rel);
+
+  if (prev == States::waiting)
+  {
+    // The coroutine may destroy this object as soon as it has been resumed. Do not access any member after Add().
+    IWorkQueue & _wq = wq;
+    _wq.Add(std::move(spResumeWP));
+  }
+  else if (prev == States::completed)
+  {
+    throw std::logic_error("AsyncResultBase::SignalCompletion: Result already set");
+  }
+}
+
+} // namespace internal
+
+/**
+ * \brief Constructor.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param _wq
+ * Work queue that shall resume the awaiting coroutine.
+ *
+ * \param _pPool
+ * Optional pool that shall be used to allocate the work package resuming the coroutine.\n
+ * `nullptr` = the work package will be allocated on the heap.
+ */
+template <typename T>
+AsyncResult<T>::AsyncResult(IWorkQueue & _wq, WorkPackagePool* const _pPool) noexcept
+: AsyncResultBase(_wq, _pPool)
+, result()
+{
+}
+
+/**
+ * \brief Delivers the result and schedules resumption of the awaiting coroutine (if any).
+ *
+ * This must be invoked only once.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * Basic guarantee:
+ * - `value` could be left in an undefined state if it has been passed as an rvalue.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param value
+ * The result.
+ */
+template <typename T>
+template <typename U>
+void AsyncResult<T>::SetResult(U && value)
+{
+  if (IsCompleted())
+    throw std::logic_error("AsyncResult::SetResult: Result already set");
+
+  result.emplace(std::forward<U>(value));
+  SignalCompletion();
+}
+
+/**
+ * \brief Retrieves the result after the awaiting coroutine has been resumed.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * Basic guarantee:
+ * - the result may be moved away
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \return
+ * The result. It is moved out of the object.
+ */
+template <typename T>
+T AsyncResult<T>::await_resume(void)
+{
+  return std::move(*result);
+}
+
+} // namespace async
+} // namespace execution
+} // namespace gpcc
+
+#endif // #if defined(__cpp_impl_coroutine) && (__cpp_impl_coroutine >= 201902L)
+#endif // AWAITABLES_HPP_202610161148
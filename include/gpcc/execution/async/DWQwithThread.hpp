@@ -27,6 +27,9 @@ namespace async     {
  * This is a convenient class for clients. Each work queue usually also requires a thread. Using this class, clients do
  * not need to setup a thread themselves.
  *
+ * The encapsulated @ref DeferredWorkQueue can optionally be created with multiple priority lanes for normal work
+ * packages. See @ref DeferredWorkQueue for details.
+ *
  * This class does not expect work packages to throw. If a work package throws, then this class will
  * [panic](@ref GPCC_OSAL_PANIC).
  *
@@ -57,6 +60,10 @@ class DWQwithThread final
   public:
     DWQwithThread(void) = delete;
     DWQwithThread(std::string const & threadName);
+    DWQwithThread(std::string const & threadName,
+                  size_t const nbOfLanes,
+                  size_t const defaultLane,
+                  uint32_t const agingThreshold);
     DWQwithThread(DWQwithThread const &) = delete;
     DWQwithThread(DWQwithThread&&) = delete;
     ~DWQwithThread(void) = default;
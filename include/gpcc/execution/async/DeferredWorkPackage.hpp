@@ -11,10 +11,16 @@
 #ifndef DEFERREDWORKPACKAGE_HPP_201612212229
 #define DEFERREDWORKPACKAGE_HPP_201612212229
 
+#include <gpcc/execution/async/WorkPackagePool.hpp>
 #include <gpcc/time/TimePoint.hpp>
 #include <atomic>
 #include <functional>
 #include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <cstddef>
 #include <cstdint>
 
 namespace gpcc {
@@ -53,8 +59,30 @@ namespace async {
  * creator of the work package.
  *
  * _Static_ work packages can be recycled and do not use any memory allocation during runtime.\n
+ * _Dynamic_ work packages can be created without any heap allocation using a @ref WorkPackagePool.\n
  * See @ref GPCC_EXECUTION_ASYNC for details.
  *
+ * # Periodic execution
+ * A _static_ work package can be configured for periodic execution via @ref SetPeriodic(). After execution, a
+ * @ref DeferredWorkQueue will automatically enqueue a periodic work package again. The next point in time is
+ * calculated by adding the period to the previous point in time (not to the time when execution has finished), so the
+ * period does not drift due to execution time or late start.
+ *
+ * If the point in time of the next period has already been reached when execution has finished (overrun), then the
+ * @ref OverrunPolicy determines how the work queue proceeds. Overruns and periods without execution are counted (see
+ * @ref GetPeriodicStatistics()).
+ *
+ * Periodic execution ends if the work package is removed from the work queue (also during its execution), or if
+ * @ref SetNonPeriodic() is invoked (e.g. by the work package's functor).
+ *
+ * Example:
+ * ~~~{.cpp}
+ * DeferredWorkPackage dwp(this, 0U, std::bind(&MyClass::Housekeeping, this));
+ * dwp.SetTimeSpan(TimeSpan::ms(10));
+ * dwp.SetPeriodic(TimeSpan::ms(10), DeferredWorkPackage::OverrunPolicy::skip);
+ * dwq.Add(dwp);
+ * ~~~
+ *
  * ---
  *
  * __Thread safety:__\n
@@ -68,6 +96,27 @@ class DeferredWorkPackage final
     /// Type definition of the functor encapsulated by the deferred work package.
     typedef std::function<void(void)> tFunctor;
 
+    /// Policies for periodic deferred work packages if the point in time of the next period has already been reached
+    /// when execution has finished (overrun).
+    enum class OverrunPolicy
+    {
+      skip,       ///<Skip all periods whose point in time has been reached. Execution continues with the next period
+                  ///<in the future. Skipped periods are counted as missed periods.
+      catchUp,    ///<Execute the work package once for each period whose point in time has been reached
+                  ///<(back-to-back) until it has caught up. No period is missed.
+      coalesce    ///<Execute the work package once immediately for all periods whose point in time has been
+                  ///<reached, then continue with the regular period. All but one of these periods are counted as
+                  ///<missed periods.
+    };
+
+    /// Statistics of a periodic deferred work package.
+    struct PeriodicStatistics
+    {
+      uint64_t nbOfOverruns;        ///<Number of executions that have finished after the point in time of the next
+                                    ///<period has been reached.
+      uint64_t nbOfMissedPeriods;   ///<Number of periods without any execution.
+    };
+
     DeferredWorkPackage(void) = delete;
     DeferredWorkPackage(void const * const _pOwnerObject,
                         uint32_t const _ownerID,
@@ -111,6 +160,21 @@ class DeferredWorkPackage final
                                                               uint32_t const _ownerID,
                                                               tFunctor && _functor,
                                                               time::TimeSpan const & delay);
+    template <typename F>
+    static std::unique_ptr<DeferredWorkPackage> CreateDynamic(WorkPackagePool & pool,
+                                                              void const * const _pOwnerObject,
+                                                              uint32_t const _ownerID,
+                                                              F && callable,
+                                                              time::TimePoint const & _tp);
+    template <typename F>
+    static std::unique_ptr<DeferredWorkPackage> CreateDynamic(WorkPackagePool & pool,
+                                                              void const * const _pOwnerObject,
+                                                              uint32_t const _ownerID,
+                                                              F && callable,
+                                                              time::TimeSpan const & delay);
+
+    static void* operator new(size_t const size);
+    static void operator delete(void* const p) noexcept;
 
     DeferredWorkPackage& operator=(DeferredWorkPackage const &) = delete;
     DeferredWorkPackage& operator=(DeferredWorkPackage &&) = delete;
@@ -118,6 +182,12 @@ class DeferredWorkPackage final
     void SetTimePoint(time::TimePoint const & _tp);
     void SetTimeSpan(time::TimeSpan const & delay);
 
+    void SetPeriodic(time::TimeSpan const & _period, OverrunPolicy const _overrunPolicy);
+    void SetNonPeriodic(void);
+    bool IsPeriodic(void) const noexcept;
+    PeriodicStatistics GetPeriodicStatistics(void) const noexcept;
+    void ResetPeriodicStatistics(void) noexcept;
+
   private:
     /// States of the work package.
     enum class States
@@ -146,15 +216,268 @@ class DeferredWorkPackage final
     time::TimePoint tp;
 
     /// Pointer to next @ref DeferredWorkPackage in a work queue.
+    /** The work queue's list of deferred work packages is not sorted. It is used to iterate over all enqueued
+        deferred work packages. */
     DeferredWorkPackage* pNext;
 
     /// Pointer to previous @ref DeferredWorkPackage in a work queue.
+    /** The work queue's list of deferred work packages is not sorted. It is used to iterate over all enqueued
+        deferred work packages. */
     DeferredWorkPackage* pPrev;
 
+    /// Pointer to the first child in the work queue's pairing heap. nullptr = none.
+    DeferredWorkPackage* pHeapChild;
+
+    /// Pointer to the next sibling in the work queue's pairing heap. nullptr = none.
+    DeferredWorkPackage* pHeapNext;
+
+    /// Pointer to the previous sibling in the work queue's pairing heap.
+    /** If this is the first child, then this points to the parent.\n
+        If this is the root of the pairing heap, then this is nullptr. */
+    DeferredWorkPackage* pHeapPrev;
+
+    /// Work queue in which the deferred work package is enqueued.
+    /** This is only valid, if the deferred work package is enqueued in a work queue. */
+    void const * pQueue;
+
+    /// Sequence number assigned by the work queue when the deferred work package is enqueued.
+    /** This is used to establish FIFO order among deferred work packages with equal time points. */
+    uint64_t seqNo;
+
+    /// Period in ns for periodic execution. Zero = not periodic.
+    int64_t period_ns;
+
+    /// Overrun policy for periodic execution.
+    OverrunPolicy overrunPolicy;
+
+    /// Number of overruns. See @ref PeriodicStatistics.
+    std::atomic<uint64_t> nbOfOverruns;
+
+    /// Number of missed periods. See @ref PeriodicStatistics.
+    std::atomic<uint64_t> nbOfMissedPeriods;
+
     /// Current state of the work package.
     std::atomic<States> state;
+
+
+    template <typename F, typename T>
+    static std::unique_ptr<DeferredWorkPackage> CreateDynamicInPool(WorkPackagePool & pool,
+                                                                    void const * const _pOwnerObject,
+                                                                    uint32_t const _ownerID,
+                                                                    F && callable,
+                                                                    T const & tpOrDelay);
 };
 
+/**
+ * \brief Factory. Creates a dynamic deferred work package using a @ref WorkPackagePool. The point in time until when
+ *        execution shall be deferred is specified by a [TimePoint](@ref gpcc::time::TimePoint).
+ *
+ * The work package and a copy of the callable are placed in a block of the given pool. The functor of the work package
+ * only references the callable, so neither the creation nor the release of the work package allocates memory on the
+ * heap.
+ *
+ * If the pool is exhausted or if the callable does not fit into a block, then the work package will be created on the
+ * heap. This is recorded in the pool's statistics.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * Basic guarantee:
+ * - Parameter `callable` could be left in an undefined state if it has been passed as an rvalue.
+ *
+ * __Thread cancellation safety:__\n
+ * Deferred cancellation is safe.
+ *
+ * ---
+ *
+ * \tparam F
+ * Type of the callable. It must be invocable without any parameters.
+ *
+ * \param pool
+ * Pool providing the memory for the work package.\n
+ * The pool must not be destroyed before the work package has been released.
+ * \param _pOwnerObject
+ * Pointer to the object which is the owner of the work package.\n
+ * The owner object must not be destroyed before the work package is destroyed or before its execution has finished.\n
+ * This may be `nullptr` if there is no owner object (anonymous owner).\n
+ * The owner pointer can later be used to remove specific work packages from a work queue.
+ * \param _ownerID
+ * ID assigned by the owner of the work package.\n
+ * The ID can later be used to remove specific work packages from a work queue.\n
+ * The ID is also applicable, if `_pOwnerObject` is `nullptr` (anonymous owner).\n
+ * The same ID may be assigned to multiple work packages of the same owner.
+ * \param callable
+ * Callable (e.g. a lambda) which shall be invoked when the work package is processed.\n
+ * The callable is copied or moved into the new created work package.
+ * \param _tp
+ * Time point until when execution of the work package shall be deferred.\n
+ * The time point must be specified using the clock @ref gpcc::osal::ConditionVariable::clockID.
+ * \return
+ * An `std::unique_ptr` to a new @ref DeferredWorkPackage instance.
+ */
+template <typename F>
+std::unique_ptr<DeferredWorkPackage> DeferredWorkPackage::CreateDynamic(WorkPackagePool & pool,
+                                                                        void const * const _pOwnerObject,
+                                                                        uint32_t const _ownerID,
+                                                                        F && callable,
+                                                                        time::TimePoint const & _tp)
+{
+  return CreateDynamicInPool(pool, _pOwnerObject, _ownerID, std::forward<F>(callable), _tp);
+}
+
+/**
+ * \brief Factory. Creates a dynamic deferred work package using a @ref WorkPackagePool. The point in time until when
+ *        execution shall be deferred is specified by a [TimeSpan](@ref gpcc::time::TimeSpan) measured from now.
+ *
+ * See @ref CreateDynamic(WorkPackagePool &, void const * const, uint32_t const, F &&, time::TimePoint const &) for
+ * details.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * Basic guarantee:
+ * - Parameter `callable` could be left in an undefined state if it has been passed as an rvalue.
+ *
+ * __Thread cancellation safety:__\n
+ * Deferred cancellation is safe.
+ *
+ * ---
+ *
+ * \tparam F
+ * Type of the callable. It must be invocable without any parameters.
+ *
+ * \param pool
+ * Pool providing the memory for the work package.\n
+ * The pool must not be destroyed before the work package has been released.
+ * \param _pOwnerObject
+ * Pointer to the object which is the owner of the work package.\n
+ * The owner object must not be destroyed before the work package is destroyed or before its execution has finished.\n
+ * This may be `nullptr` if there is no owner object (anonymous owner).\n
+ * The owner pointer can later be used to remove specific work packages from a work queue.
+ * \param _ownerID
+ * ID assigned by the owner of the work package.\n
+ * The ID can later be used to remove specific work packages from a work queue.\n
+ * The ID is also applicable, if `_pOwnerObject` is `nullptr` (anonymous owner).\n
+ * The same ID may be assigned to multiple work packages of the same owner.
+ * \param callable
+ * Callable (e.g. a lambda) which shall be invoked when the work package is processed.\n
+ * The callable is copied or moved into the new created work package.
+ * \param delay
+ * Time span measured from now until when execution of the work package shall be deferred.
+ * \return
+ * An `std::unique_ptr` to a new @ref DeferredWorkPackage instance.
+ */
+template <typename F>
+std::unique_ptr<DeferredWorkPackage> DeferredWorkPackage::CreateDynamic(WorkPackagePool & pool,
+                                                                        void const * const _pOwnerObject,
+                                                                        uint32_t const _ownerID,
+                                                                        F && callable,
+                                                                        time::TimeSpan const & delay)
+{
+  return CreateDynamicInPool(pool, _pOwnerObject, _ownerID, std::forward<F>(callable), delay);
+}
+
+/**
+ * \brief Common implementation of the factories creating dynamic deferred work packages using a
+ *        @ref WorkPackagePool.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * Basic guarantee:
+ * - Parameter `callable` could be left in an undefined state if it has been passed as an rvalue.
+ *
+ * __Thread cancellation safety:__\n
+ * Deferred cancellation is safe.
+ *
+ * ---
+ *
+ * \tparam F
+ * Type of the callable.
+ * \tparam T
+ * Either [TimePoint](@ref gpcc::time::TimePoint) or [TimeSpan](@ref gpcc::time::TimeSpan).
+ *
+ * \param pool
+ * Pool providing the memory for the work package.\n
+ * The pool must not be destroyed before the work package has been released.
+ * \param _pOwnerObject
+ * Pointer to the object which is the owner of the work package.\n
+ * The owner object must not be destroyed before the work package is destroyed or before its execution has finished.\n
+ * This may be `nullptr` if there is no owner object (anonymous owner).\n
+ * The owner pointer can later be used to remove specific work packages from a work queue.
+ * \param _ownerID
+ * ID assigned by the owner of the work package.\n
+ * The ID can later be used to remove specific work packages from a work queue.\n
+ * The ID is also applicable, if `_pOwnerObject` is `nullptr` (anonymous owner).\n
+ * The same ID may be assigned to multiple work packages of the same owner.
+ * \param callable
+ * Callable (e.g. a lambda) which shall be invoked when the work package is processed.\n
+ * The callable is copied or moved into the new created work package.
+ * \param tpOrDelay
+ * Time point or delay, passed to the constructor of @ref DeferredWorkPackage.
+ * \return
+ * An `std::unique_ptr` to a new @ref DeferredWorkPackage instance.
+ */
+template <typename F, typename T>
+std::unique_ptr<DeferredWorkPackage> DeferredWorkPackage::CreateDynamicInPool(WorkPackagePool & pool,
+                                                                              void const * const _pOwnerObject,
+                                                                              uint32_t const _ownerID,
+                                                                              F && callable,
+                                                                              T const & tpOrDelay)
+{
+  using tCallable = typename std::decay<F>::type;
+
+  if constexpr (std::is_constructible<bool, tCallable const &>::value)
+  {
+    if (!callable)
+      throw std::invalid_argument("DeferredWorkPackage::CreateDynamic: !callable");
+  }
+
+  void* const pMem = pool.Allocate(sizeof(tCallable), alignof(tCallable));
+  if (pMem == nullptr)
+    return CreateDynamic(_pOwnerObject, _ownerID, tFunctor(std::forward<F>(callable)), tpOrDelay);
+
+  tCallable* pCallable;
+  DeferredWorkPackage* pDWP;
+  try
+  {
+    pCallable = ::new (WorkPackagePool::GetFunctorStorage(pMem)) tCallable(std::forward<F>(callable));
+  }
+  catch (...)
+  {
+    WorkPackagePool::Free(pMem);
+    throw;
+  }
+
+  WorkPackagePool::SetFunctorDestructor(pMem, [](void* const p) { static_cast<tCallable*>(p)->~tCallable(); });
+
+  try
+  {
+    // A lambda capturing a single pointer fits into the small buffer of std::function.
+    pDWP = ::new (pMem) DeferredWorkPackage(_pOwnerObject, _ownerID,
+                                            tFunctor([pCallable]() { (*pCallable)(); }),
+                                            tpOrDelay);
+  }
+  catch (...)
+  {
+    // (this destroys the callable, too)
+    WorkPackagePool::Free(pMem);
+    throw;
+  }
+
+  pDWP->state = States::dynamicNotInQ;
+  return std::unique_ptr<DeferredWorkPackage>(pDWP);
+}
+
 } // namespace async
 } // namespace execution
 } // namespace gpcc
@@ -14,6 +14,10 @@
 #include <gpcc/execution/async/IDeferredWorkQueue.hpp>
 #include <gpcc/osal/ConditionVariable.hpp>
 #include <gpcc/osal/Mutex.hpp>
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
 
 namespace gpcc {
 namespace execution {
@@ -21,6 +25,7 @@ namespace async {
 
 class DeferredWorkPackage;
 class WorkPackage;
+class WorkQueueTelemetry;
 
 /**
  * \ingroup GPCC_EXECUTION_ASYNC
@@ -37,6 +42,44 @@ class WorkPackage;
  *   + sorted by point in time; most far in the past first.
  *   + FIFO-order if time-points of work packages are equal.
  * - Deferred work packages (if time point reached) have priority above normal work packages.
+ * - Optional priority lanes for normal work packages (see below).
+ * - Deferred work packages are organized in a pairing heap. Adding a deferred work package is O(1), removing
+ *   the next deferred work package for execution or removing a specific deferred work package is O(log n)
+ *   (amortized). Removal by owner requires one pass over all enqueued deferred work packages.
+ * - Optional telemetry (see @ref SetTelemetry()).
+ * - Periodic deferred work packages (see below).
+ * - Batch enqueue of multiple (deferred) work packages with one lock acquisition and no more than one wake-up of
+ *   the work queue's thread.
+ *
+ * # Priority lanes
+ * By default, there is one lane for normal work packages. Using
+ * @ref DeferredWorkQueue(size_t const, size_t const, uint32_t const), the work queue can be created with up to
+ * @ref maxNbOfLanes lanes:
+ * - Lane 0 has the highest priority. Normal work packages are taken from the non-empty lane with the highest
+ *   priority. Work packages in the same lane are executed in FIFO order.
+ * - @ref Add(std::unique_ptr<WorkPackage> spWP, size_t const lane) and @ref Add(WorkPackage & wp, size_t const lane)
+ *   add work packages to a specific lane. The other methods of @ref IWorkQueue use the default lane specified at
+ *   construction.
+ * - @ref InsertAtHeadOfList() inserts into the head of lane 0.
+ * - For each lane, the work queue counts how often the lane has been bypassed in favour of a different lane while it
+ *   contained work packages (starvation counters, see @ref GetLaneStatistics()).
+ * - Optional aging: If a lane has been bypassed a configurable number of times in a row, then the next work package
+ *   is taken from that lane, regardless of its priority.
+ * - Deferred work packages (if time point reached) still have priority above all lanes.
+ * - @ref FlushNonDeferredWorkPackages() appends a flush work package to each non-empty lane and waits until all of
+ *   them have been executed. Flush work packages are subject to aging like any other work package.
+ *
+ * # Periodic deferred work packages
+ * Static deferred work packages configured via `DeferredWorkPackage::SetPeriodic()` are enqueued again automatically
+ * after their execution has finished:
+ * - The next point in time is the previous point in time plus the period. Execution time and late start do not cause
+ *   any drift.
+ * - If the next point in time has already been reached when execution has finished, then the work package's
+ *   @ref DeferredWorkPackage::OverrunPolicy is applied and the overrun is recorded in the work package's statistics.
+ * - Periodic execution ends if the work package is removed from the work queue via any of the `Remove(...)` methods.
+ *   This also applies if the work package is currently executed.
+ * - If the work package enqueues itself during its execution, then this takes precedence over the automatic
+ *   rescheduling.
  *
  * For general information about work queues and work packages please refer to @ref GPCC_EXECUTION_ASYNC.
  *
@@ -46,7 +89,22 @@ class WorkPackage;
 class DeferredWorkQueue final: public IDeferredWorkQueue
 {
   public:
+    /// Statistics of one lane for normal work packages.
+    struct LaneStatistics
+    {
+      uint64_t nbOfExecutedWPs = 0U;        ///<Number of work packages taken from the lane for execution.
+      uint64_t nbOfBypasses = 0U;           ///<Number of times a work package from a different lane has been
+                                            /**<selected for execution while this lane contained work packages.\n
+                                                This is the starvation counter of the lane. */
+      uint32_t maxConsecutiveBypasses = 0U; ///<Maximum number of consecutive bypasses observed.
+      uint64_t nbOfAgingPromotions = 0U;    ///<Number of work packages taken from the lane due to aging.
+    };
+
+    /// Maximum number of lanes for normal work packages.
+    static constexpr size_t maxNbOfLanes = 8U;
+
     DeferredWorkQueue(void);
+    DeferredWorkQueue(size_t const nbOfLanes, size_t const _defaultLane, uint32_t const _agingThreshold);
     DeferredWorkQueue(DeferredWorkQueue const &) = delete;
     DeferredWorkQueue(DeferredWorkQueue&&) = delete;
     virtual ~DeferredWorkQueue(void);
@@ -73,10 +131,49 @@ class DeferredWorkQueue final: public IDeferredWorkQueue
     void Remove(DeferredWorkPackage & dwp) override;
     // <--
 
+    void Add(std::unique_ptr<WorkPackage> spWP, size_t const lane);
+    void Add(WorkPackage & wp, size_t const lane);
+
+    void Add(std::vector<std::unique_ptr<WorkPackage>> & spWPs);
+    void Add(std::vector<std::unique_ptr<WorkPackage>> & spWPs, size_t const lane);
+    void Add(WorkPackage* const * const ppWPs, size_t const n);
+    void Add(WorkPackage* const * const ppWPs, size_t const n, size_t const lane);
+    void Add(std::vector<std::unique_ptr<DeferredWorkPackage>> & spDWPs);
+    void Add(DeferredWorkPackage* const * const ppDWPs, size_t const n);
+
+    size_t GetNbOfLanes(void) const noexcept;
+    LaneStatistics GetLaneStatistics(size_t const lane) const;
+
     void Work(void);
     void RequestTermination(void) noexcept;
 
+    void SetTelemetry(WorkQueueTelemetry* const _pTelemetry);
+
   private:
+    /// Lane for normal work packages.
+    struct Lane
+    {
+      /// First work package in the lane. This is the next work package of the lane to be executed.
+      /** The pPrev-pointers of the enqueued work packages point towards this. */
+      WorkPackage* pFirst = nullptr;
+
+      /// Last work package in the lane. New work packages are enqueued here.
+      /** The pNext-pointers of the enqueued work packages point towards this. */
+      WorkPackage* pLast = nullptr;
+
+      /// Number of consecutive selections of a work package from a different lane while this lane was not empty.
+      uint32_t consecutiveBypasses = 0U;
+
+      /// Statistics.
+      LaneStatistics stats;
+    };
+
+    /// Lane used by the methods of @ref IWorkQueue that do not allow to specify a lane.
+    size_t const defaultLane;
+
+    /// Aging threshold. Zero = aging disabled.
+    uint32_t const agingThreshold;
+
     /// Mutex for queue-related stuff.
     /** Locking order: @ref flushMutex -> @ref queueMutex */
     osal::Mutex mutable queueMutex;
@@ -92,32 +189,46 @@ class DeferredWorkQueue final: public IDeferredWorkQueue
         This is also used to generate defined timeouts for the execution of deferred work packages. */
     osal::ConditionVariable queueConVar;
 
-    /// First enqueued "normal" work package. This is the next "normal" work package to be executed.
+    /// Lanes for "normal" work packages. Index 0 = highest priority.
     /** @ref queueMutex is required.\n
-        The pPrev-pointers of the enqueued work packages point towards this. */
-    WorkPackage* pQueueFirst;
+        The number of lanes is fixed during the life-time of the object. */
+    std::vector<Lane> lanes;
 
-    /// Last enqueued "normal" work package. New "normal" work packages are enqueued here.
-    /** @ref queueMutex is required.\n
-        The pNext-pointers of the enqueued work packages point towards this. */
-    WorkPackage* pQueueLast;
+    /// Number of work packages in all lanes.
+    /** @ref queueMutex is required. */
+    size_t nbOfEnqueuedWPs;
 
-    /// First enqueued "deferred" work package. This is the next "deferred" work package to be executed.
+    /// Telemetry data collector. nullptr = none.
+    /** Writing requires @ref flushMutex and @ref queueMutex.\n
+        Reading requires @ref flushMutex or @ref queueMutex. */
+    WorkQueueTelemetry* pTelemetry;
+
+    /// First enqueued "deferred" work package.
     /** @ref queueMutex is required.\n
         The pPrev-pointers of the enqueued work packages point towards this.\n
-        The deferred work packages in this queue are sorted by the point in time until when their
-        execution is deferred. The work package which reaches its point in time next is referenced
-        by this pointer. */
+        The list of deferred work packages is not sorted. It is used to iterate over all enqueued deferred work
+        packages. The order of execution is determined by the pairing heap (see @ref pDeferredHeapRoot). */
     DeferredWorkPackage* pDeferredQueueFirst;
 
-    /// Last enqueued "deferred" work package. This is the last "deferred" work package to be executed.
+    /// Last enqueued "deferred" work package.
     /** @ref queueMutex is required.\n
         The pNext-pointers of the enqueued work packages point towards this.\n
-        The deferred work packages in this queue are sorted by the point in time until when their
-        execution is deferred. The work package which reaches its point in time last is referenced
-        by this pointer. */
+        The list of deferred work packages is not sorted. It is used to iterate over all enqueued deferred work
+        packages. The order of execution is determined by the pairing heap (see @ref pDeferredHeapRoot). */
     DeferredWorkPackage *pDeferredQueueLast;
 
+    /// Root of the pairing heap containing all enqueued "deferred" work packages. This is the next "deferred" work
+    /// package to be executed.
+    /** @ref queueMutex is required.\n
+        The deferred work packages are ordered by the point in time until when their execution is deferred. If the
+        time points of two deferred work packages are equal, then the sequence number assigned by @ref Enqueue()
+        determines the order. */
+    DeferredWorkPackage* pDeferredHeapRoot;
+
+    /// Sequence number that will be assigned to the next deferred work package added to the queue.
+    /** @ref queueMutex is required. */
+    uint64_t nextDeferredSeqNo;
+
     /// Terminate flag.
     /** @ref queueMutex is required.\n
         true  = Work package execution shall stop after execution of the current work package.
@@ -140,10 +251,33 @@ class DeferredWorkQueue final: public IDeferredWorkQueue
         This is used to allow enqueueing of currently executed static (deferred) work packages. */
     void const * pCurrentExecutedWP;
 
+    /// Pointer to the currently executed static deferred work package. nullptr = none.
+    /** @ref queueMutex is required.\n
+        If the deferred work package is periodic, then it will be enqueued again after execution. The `Remove(...)`
+        methods set this to nullptr if they match the deferred work package in order to end periodic execution. */
+    DeferredWorkPackage* pCurrentExecutedStaticDWP;
+
     void CheckStateAndSetToInQ_static(WorkPackage& wp) const;
     void CheckStateAndSetToInQ_static(DeferredWorkPackage& dwp) const;
     void CheckStateAndSetToInQ_dynamic(WorkPackage& wp) const noexcept;
     void CheckStateAndSetToInQ_dynamic(DeferredWorkPackage& dwp) const noexcept;
+    void CheckStateAndSetToInQ_static(WorkPackage* const * const ppWPs, size_t const n) const;
+    void CheckStateAndSetToInQ_static(DeferredWorkPackage* const * const ppDWPs, size_t const n) const;
+
+    bool IsNormalQueueEmpty(void) const noexcept;
+    void AppendToLane(Lane & lane, WorkPackage & wp) noexcept;
+    void PrependToLane(Lane & lane, WorkPackage & wp) noexcept;
+    void UnlinkFromLane(Lane & lane, WorkPackage & wp) noexcept;
+    void OnAddedToLane(WorkPackage & wp) noexcept;
+    WorkPackage* FetchNextWP(void) noexcept;
+
+    void Enqueue(DeferredWorkPackage& dwp) noexcept;
+    void Dequeue(DeferredWorkPackage& dwp) noexcept;
+    void Reschedule(DeferredWorkPackage& dwp) noexcept;
+
+    static bool IsBefore(DeferredWorkPackage const & a, DeferredWorkPackage const & b) noexcept;
+    static DeferredWorkPackage* HeapMeld(DeferredWorkPackage* const pA, DeferredWorkPackage* const pB) noexcept;
+    static DeferredWorkPackage* HeapMergePairs(DeferredWorkPackage* pFirst) noexcept;
 
     void Release(WorkPackage* const pWP) noexcept;
     void Release(DeferredWorkPackage* const pDWP) noexcept;
@@ -151,6 +285,30 @@ class DeferredWorkQueue final: public IDeferredWorkQueue
     void Finish(DeferredWorkPackage* const pDWP) noexcept;
 };
 
+/**
+ * \brief Retrieves the number of lanes for normal work packages.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \return
+ * Number of lanes for normal work packages.
+ */
+inline size_t DeferredWorkQueue::GetNbOfLanes(void) const noexcept
+{
+  return lanes.size();
+}
+
 } // namespace async
 } // namespace execution
 } // namespace gpcc
@@ -16,6 +16,7 @@
 #include <gpcc/osal/Mutex.hpp>
 #include <gpcc/osal/Thread.hpp>
 #include <string>
+#include <cstdint>
 
 namespace gpcc      {
 namespace execution {
@@ -29,6 +30,9 @@ namespace async     {
  * This is a convenient class for clients. Each work queue usually also requires a thread. Using this class, clients do
  * not need to setup a thread themselves.
  *
+ * The encapsulated @ref DeferredWorkQueue can optionally be created with multiple priority lanes for normal work
+ * packages. See @ref DeferredWorkQueue for details.
+ *
  * This class does not expect work packages to throw. If a work package throws, then this class will
  * [panic](@ref GPCC_OSAL_PANIC).
  *
@@ -74,6 +78,10 @@ class SuspendableDWQwithThread final
   public:
     SuspendableDWQwithThread(void) = delete;
     SuspendableDWQwithThread(std::string const & threadName);
+    SuspendableDWQwithThread(std::string const & threadName,
+                             size_t const nbOfLanes,
+                             size_t const defaultLane,
+                             uint32_t const agingThreshold);
     SuspendableDWQwithThread(SuspendableDWQwithThread const &) = delete;
     SuspendableDWQwithThread(SuspendableDWQwithThread&&) = delete;
     ~SuspendableDWQwithThread(void);
@@ -0,0 +1,844 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#ifndef TASK_HPP_202610161102
+#define TASK_HPP_202610161102
+
+// Coroutine support requires C++20. If GPCC is compiled with an older standard, then this header is empty.
+#if defined(__cpp_impl_coroutine) && (__cpp_impl_coroutine >= 201902L)
+
+#include <gpcc/execution/async/IWorkQueue.hpp>
+#include <gpcc/execution/async/WorkPackage.hpp>
+#include <gpcc/osal/Panic.hpp>
+#include <coroutine>
+#include <exception>
+#include <memory>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <cstddef>
+
+namespace gpcc      {
+namespace execution {
+namespace async     {
+
+class WorkPackagePool;
+
+/**
+ * \ingroup GPCC_EXECUTION_ASYNC
+ * \brief Interface for caller-supplied allocators for the frames of @ref Task coroutines.
+ *
+ * By default, the frame of a @ref Task coroutine is allocated on the heap. If the first parameter of the coroutine is
+ * `std::allocator_arg` followed by a reference to an @ref ICoroutineFrameAllocator (for member functions: the first
+ * parameter after the implicit object parameter), then the frame is allocated via the given allocator instead:
+ *
+ * ~~~{.cpp}
+ * Task<int> ReadValue(std::allocator_arg_t, ICoroutineFrameAllocator & alloc, uint32_t index);
+ *
+ * // ...
+ * int const value = co_await ReadValue(std::allocator_arg, myFrameAllocator, 5U);
+ * ~~~
+ *
+ * The allocator must not be destroyed before all frames allocated from it have been released.
+ *
+ * __Note:__\n
+ * GCC 12 emits a false `-Wmismatched-new-delete` warning at the definition of coroutines taking `std::allocator_arg`,
+ * because the frame is allocated via a function template `operator new` and released via the usual
+ * `operator delete`. The warning can be suppressed around the coroutine via `#pragma GCC diagnostic`.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * Depends on the implementation. Frames may be released in a different thread than they have been allocated in.
+ */
+class ICoroutineFrameAllocator
+{
+  public:
+    ICoroutineFrameAllocator(void) = default;
+    ICoroutineFrameAllocator(ICoroutineFrameAllocator const &) = delete;
+    ICoroutineFrameAllocator(ICoroutineFrameAllocator &&) = delete;
+
+    ICoroutineFrameAllocator& operator=(ICoroutineFrameAllocator const &) = delete;
+    ICoroutineFrameAllocator& operator=(ICoroutineFrameAllocator &&) = delete;
+
+    /**
+     * \brief Allocates memory for a coroutine frame.
+     *
+     * - - -
+     *
+     * __Exception safety:__\n
+     * Strong guarantee.
+     *
+     * __Thread cancellation safety:__\n
+     * Safe, no cancellation point included.
+     *
+     * - - -
+     *
+     * \param size
+     * Number of bytes that shall be allocated.
+     *
+     * \return
+     * Pointer to the allocated memory. The memory must be aligned to `alignof(std::max_align_t)`.\n
+     * If no memory can be allocated, then the method shall throw `std::bad_alloc`. It shall not return `nullptr`.
+     */
+    virtual void* Allocate(size_t const size) = 0;
+
+    /**
+     * \brief Releases memory that has been allocated via @ref Allocate().
+     *
+     * - - -
+     *
+     * __Exception safety:__\n
+     * No-throw guarantee.
+     *
+     * __Thread cancellation safety:__\n
+     * Safe, no cancellation point included.
+     *
+     * - - -
+     *
+     * \param p
+     * Pointer to the memory that shall be released.
+     *
+     * \param size
+     * Number of bytes that have been passed to @ref Allocate().
+     */
+    virtual void Deallocate(void* const p, size_t const size) noexcept = 0;
+
+  protected:
+    virtual ~ICoroutineFrameAllocator(void) = default;
+};
+
+template <typename T>
+class Task;
+
+void Spawn(IWorkQueue & wq, Task<void> && task, WorkPackagePool* const pPool = nullptr);
+
+namespace internal {
+
+std::unique_ptr<WorkPackage> CreateResumeWP(std::coroutine_handle<> const h, WorkPackagePool* const pPool);
+
+/**
+ * \ingroup GPCC_EXECUTION_ASYNC
+ * \brief Base class for the promise types of @ref Task coroutines.
+ *
+ * This provides frame allocation, the initial and final suspend points and exception handling.
+ *
+ * A @ref Task is lazy: The coroutine is suspended at its initial suspend point until it is awaited or until it is
+ * passed to @ref Spawn(). At its final suspend point, the coroutine transfers control to the awaiting coroutine
+ * (symmetric transfer) or destroys itself if it has been detached via @ref Spawn().
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * Not thread-safe, but the coroutine may be resumed in a different thread each time.
+ */
+class TaskPromiseBase
+{
+    friend void gpcc::execution::async::Spawn(IWorkQueue & wq, Task<void> && task, WorkPackagePool* const pPool);
+
+  public:
+    /// Awaiter for the final suspend point.
+    struct FinalAwaiter
+    {
+      bool await_ready(void) const noexcept { return false; }
+
+      template <typename PROMISE>
+      std::coroutine_handle<> await_suspend(std::coroutine_handle<PROMISE> h) noexcept
+      {
+        TaskPromiseBase & p = h.promise();
+        if (p.detached)
+        {
+          h.destroy();
+          return std::noop_coroutine();
+        }
+        else if (p.continuation)
+          return p.continuation;
+        else
+          return std::noop_coroutine();
+      }
+
+      void await_resume(void) const noexcept {}
+    };
+
+    TaskPromiseBase(void) noexcept = default;
+    TaskPromiseBase(TaskPromiseBase const &) = delete;
+    TaskPromiseBase(TaskPromiseBase &&) = delete;
+
+    TaskPromiseBase& operator=(TaskPromiseBase const &) = delete;
+    TaskPromiseBase& operator=(TaskPromiseBase &&) = delete;
+
+    static void* operator new(size_t const size);
+    template <typename... ARGS>
+    static void* operator new(size_t const size, std::allocator_arg_t, ICoroutineFrameAllocator & allocator, ARGS &...);
+    template <typename C, typename... ARGS>
+    static void* operator new(size_t const size, C &, std::allocator_arg_t, ICoroutineFrameAllocator & allocator,
+                              ARGS &...);
+    static void operator delete(void* const p, size_t const size) noexcept;
+
+    std::suspend_always initial_suspend(void) const noexcept { return {}; }
+    FinalAwaiter final_suspend(void) const noexcept { return {}; }
+    void unhandled_exception(void) noexcept;
+
+    void SetContinuation(std::coroutine_handle<> const h) noexcept { continuation = h; }
+
+  protected:
+    ~TaskPromiseBase(void) = default;
+
+    void RethrowIfException(void) const;
+
+  private:
+    /// Header placed in front of each coroutine frame.
+    /** The size is a multiple of the alignment of `std::max_align_t` in order to keep the frame properly aligned. */
+    struct alignas(std::max_align_t) FrameHeader
+    {
+      /// Allocator used to allocate the frame. `nullptr` = heap.
+      ICoroutineFrameAllocator* pAllocator;
+    };
+
+    /// Coroutine that shall be resumed when this coroutine has finished.
+    std::coroutine_handle<> continuation;
+
+    /// Flag indicating if the coroutine has been detached via @ref Spawn().
+    bool detached = false;
+
+    /// Exception thrown by the coroutine body, if any.
+    std::exception_ptr spException;
+
+
+    static void* AllocateFrame(size_t const size, ICoroutineFrameAllocator* const pAllocator);
+};
+
+/**
+ * \ingroup GPCC_EXECUTION_ASYNC
+ * \brief Promise type of a @ref Task returning a value.
+ *
+ * \tparam T
+ * Type of the result.
+ */
+template <typename T>
+class TaskPromise final : public TaskPromiseBase
+{
+  public:
+    TaskPromise(void) noexcept = default;
+    ~TaskPromise(void) = default;
+
+    Task<T> get_return_object(void) noexcept;
+
+    template <typename U>
+    void return_value(U && value) { result.emplace(std::forward<U>(value)); }
+
+    T GetResult(void);
+
+  private:
+    /// Result of the coroutine.
+    std::optional<T> result;
+};
+
+/**
+ * \ingroup GPCC_EXECUTION_ASYNC
+ * \brief Promise type of a @ref Task that does not return any value.
+ */
+template <>
+class TaskPromise<void> final : public TaskPromiseBase
+{
+  public:
+    TaskPromise(void) noexcept = default;
+    ~TaskPromise(void) = default;
+
+    Task<void> get_return_object(void) noexcept;
+
+    void return_void(void) const noexcept {}
+
+    void GetResult(void) const { RethrowIfException(); }
+};
+
+} // namespace internal
+
+/**
+ * \ingroup GPCC_EXECUTION_ASYNC
+ * \brief Coroutine task type for coroutines executed by work queues (C++20 only).
+ *
+ * A coroutine returning a @ref Task can be awaited by another @ref Task coroutine (`co_await`) or it can be passed to
+ * @ref Spawn() in order to start it on a work queue. Tasks are lazy: The coroutine body is not executed before the
+ * task is awaited or spawned.
+ *
+ * Control is transferred between awaiting and awaited coroutines via symmetric transfer without involving any work
+ * queue. A coroutine is moved to a work queue via the awaitables provided by `gpcc/execution/async/Awaitables.hpp`,
+ * e.g. @ref Yield() or @ref Delay(). These return control to the work queue's thread and resume the coroutine via a
+ * dynamic work package. If a @ref WorkPackagePool is passed to them, then no memory is allocated on the heap for the
+ * work packages.
+ *
+ * The coroutine frame is allocated on the heap, unless a @ref ICoroutineFrameAllocator is passed to the coroutine (see
+ * @ref ICoroutineFrameAllocator for details).
+ *
+ * Exceptions thrown by the coroutine body are rethrown when the result is retrieved by the awaiting coroutine. If a
+ * coroutine started via @ref Spawn() throws, then the application will panic.
+ *
+ * Example:
+ * ~~~{.cpp}
+ * Task<int> Calculate(IDeferredWorkQueue & dwq)
+ * {
+ *   co_await Delay(dwq, TimeSpan::ms(10));
+ *   co_return 42;
+ * }
+ *
+ * Task<void> Run(IDeferredWorkQueue & dwq)
+ * {
+ *   int const result = co_await Calculate(dwq);
+ *   // ...
+ * }
+ *
+ * // ...
+ * Spawn(dwq, Run(dwq));
+ * ~~~
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * Not thread-safe, but the coroutine may be resumed in a different thread each time.
+ *
+ * \tparam T
+ * Type of the result of the coroutine.
+ */
+template <typename T = void>
+class [[nodiscard]] Task final
+{
+    friend class internal::TaskPromise<T>;
+    friend void Spawn(IWorkQueue & wq, Task<void> && task, WorkPackagePool* const pPool);
+
+  public:
+    /// Promise type required by the compiler.
+    using promise_type = internal::TaskPromise<T>;
+
+    /// Awaiter returned by @ref operator co_await().
+    class Awaiter final
+    {
+      public:
+        explicit Awaiter(std::coroutine_handle<promise_type> const _h) noexcept : h(_h) {}
+
+        bool await_ready(void) const noexcept { return false; }
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> const awaitingCoroutine) noexcept
+        {
+          h.promise().SetContinuation(awaitingCoroutine);
+          return h;
+        }
+        T await_resume(void) { return h.promise().GetResult(); }
+
+      private:
+        /// Handle of the awaited coroutine.
+        std::coroutine_handle<promise_type> const h;
+    };
+
+    Task(void) = delete;
+    Task(Task const &) = delete;
+    Task(Task && other) noexcept;
+    ~Task(void);
+
+    Task& operator=(Task const &) = delete;
+    Task& operator=(Task && rhv) noexcept;
+
+    Awaiter operator co_await(void) &&;
+
+  private:
+    /// Handle of the coroutine. `nullptr`, if the task has been moved away or spawned.
+    std::coroutine_handle<promise_type> h;
+
+
+    explicit Task(std::coroutine_handle<promise_type> const _h) noexcept;
+};
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+namespace internal {
+
+/**
+ * \brief Allocates a coroutine frame on the heap.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param size
+ * Size of the frame in byte.
+ *
+ * \return
+ * Pointer to the memory for the frame.
+ */
+inline void* TaskPromiseBase::operator new(size_t const size)
+{
+  return AllocateFrame(size, nullptr);
+}
+
+/**
+ * \brief Allocates a coroutine frame via a @ref ICoroutineFrameAllocator.
+ *
+ * This is selected by the compiler if the first parameter of the coroutine is `std::allocator_arg`, followed by
+ * a reference to an @ref ICoroutineFrameAllocator.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param size
+ * Size of the frame in byte.
+ *
+ * \param allocator
+ * Allocator that shall be used to allocate the frame.
+ *
+ * \return
+ * Pointer to the memory for the frame.
+ */
+template <typename... ARGS>
+void* TaskPromiseBase::operator new(size_t const size, std::allocator_arg_t, ICoroutineFrameAllocator & allocator,
+                                    ARGS &...)
+{
+  return AllocateFrame(size, &allocator);
+}
+
+/**
+ * \brief Allocates the frame of a member function coroutine via a @ref ICoroutineFrameAllocator.
+ *
+ * This is selected by the compiler if the first parameter of the coroutine (after the implicit object parameter) is
+ * `std::allocator_arg`, followed by a reference to an @ref ICoroutineFrameAllocator.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param size
+ * Size of the frame in byte.
+ *
+ * \param allocator
+ * Allocator that shall be used to allocate the frame.
+ *
+ * \return
+ * Pointer to the memory for the frame.
+ */
+template <typename C, typename... ARGS>
+void* TaskPromiseBase::operator new(size_t const size, C &, std::allocator_arg_t,
+                                    ICoroutineFrameAllocator & allocator, ARGS &...)
+{
+  return AllocateFrame(size, &allocator);
+}
+
+/**
+ * \brief Releases a coroutine frame.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param p
+ * Pointer to the frame.
+ *
+ * \param size
+ * Size of the frame in byte.
+ */
+inline void TaskPromiseBase::operator delete(void* const p, size_t const size) noexcept
+{
+  FrameHeader* const pHeader = static_cast<FrameHeader*>(p) - 1;
+  ICoroutineFrameAllocator* const pAllocator = pHeader->pAllocator;
+  pHeader->~FrameHeader();
+
+  if (pAllocator != nullptr)
+    pAllocator->Deallocate(pHeader, size + sizeof(FrameHeader));
+  else
+    ::operator delete(pHeader);
+}
+
+/**
+ * \brief Handles an exception thrown by the coroutine body.
+ *
+ * The exception is stored and rethrown when the result is retrieved. If the coroutine has been detached via
+ * @ref Spawn(), then there is no one who could retrieve the exception and the application will panic.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ */
+inline void TaskPromiseBase::unhandled_exception(void) noexcept
+{
+  if (detached)
+    gpcc::osal::Panic("TaskPromiseBase::unhandled_exception: Unhandled exception in spawned coroutine");
+
+  spException = std::current_exception();
+}
+
+/**
+ * \brief Rethrows the exception thrown by the coroutine body, if any.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ */
+inline void TaskPromiseBase::RethrowIfException(void) const
+{
+  if (spException)
+    std::rethrow_exception(spException);
+}
+
+/**
+ * \brief Allocates memory for a coroutine frame plus a @ref FrameHeader.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param size
+ * Size of the frame in byte.
+ *
+ * \param pAllocator
+ * Allocator that shall be used to allocate the frame. `nullptr` = heap.
+ *
+ * \return
+ * Pointer to the memory for the frame.
+ */
+inline void* TaskPromiseBase::AllocateFrame(size_t const size, ICoroutineFrameAllocator* const pAllocator)
+{
+  void* const pMem = (pAllocator != nullptr) ? pAllocator->Allocate(size + sizeof(FrameHeader)) :
+                                               ::operator new(size + sizeof(FrameHeader));
+
+  FrameHeader* const pHeader = ::new (pMem) FrameHeader;
+  pHeader->pAllocator = pAllocator;
+  return pHeader + 1;
+}
+
+/**
+ * \brief Creates the @ref Task object returned to the caller of the coroutine.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \return
+ * @ref Task object referencing the coroutine.
+ */
+template <typename T>
+Task<T> TaskPromise<T>::get_return_object(void) noexcept
+{
+  return Task<T>(std::coroutine_handle<TaskPromise<T>>::from_promise(*this));
+}
+
+/**
+ * \brief Retrieves the result of the coroutine.
+ *
+ * If the coroutine body has thrown an exception, then the exception will be rethrown.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * Basic guarantee:
+ * - the result may be moved away
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \return
+ * Result of the coroutine. The result is moved out of the promise.
+ */
+template <typename T>
+T TaskPromise<T>::GetResult(void)
+{
+  RethrowIfException();
+  return std::move(*result);
+}
+
+/**
+ * \brief Creates the @ref Task object returned to the caller of the coroutine.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \return
+ * @ref Task object referencing the coroutine.
+ */
+inline Task<void> TaskPromise<void>::get_return_object(void) noexcept
+{
+  return Task<void>(std::coroutine_handle<TaskPromise<void>>::from_promise(*this));
+}
+
+/**
+ * \brief Creates a dynamic work package that resumes a coroutine.
+ *
+ * The owner of the work package is the address of the coroutine frame.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param h
+ * Handle of the coroutine that shall be resumed by the work package.
+ *
+ * \param pPool
+ * Optional pool that shall be used to allocate the work package.\n
+ * `nullptr` = the work package will be allocated on the heap.
+ *
+ * \return
+ * New dynamic work package.
+ */
+inline std::unique_ptr<WorkPackage> CreateResumeWP(std::coroutine_handle<> const h, WorkPackagePool* const pPool)
+{
+  auto resume = [h]() { h.resume(); };
+
+  if (pPool != nullptr)
+    return WorkPackage::CreateDynamic(*pPool, h.address(), 0U, resume);
+  else
+    return WorkPackage::CreateDynamic(h.address(), 0U, resume);
+}
+
+} // namespace internal
+
+/**
+ * \brief Move constructor.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param other
+ * The task is moved from this into the new constructed object.\n
+ * `other` will no longer reference any coroutine.
+ */
+template <typename T>
+Task<T>::Task(Task && other) noexcept
+: h(std::exchange(other.h, nullptr))
+{
+}
+
+/**
+ * \brief Destructor. Destroys the coroutine, if the task still references one.
+ *
+ * The coroutine must either not have been started yet, or it must be suspended at its final suspend point.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ */
+template <typename T>
+Task<T>::~Task(void)
+{
+  if (h)
+    h.destroy();
+}
+
+/**
+ * \brief Move assignment operator.
+ *
+ * The coroutine currently referenced by this task (if any) is destroyed.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param rhv
+ * The task is moved from this into this object.\n
+ * `rhv` will no longer reference any coroutine.
+ *
+ * \return
+ * Reference to this object.
+ */
+template <typename T>
+Task<T>& Task<T>::operator=(Task && rhv) noexcept
+{
+  if (&rhv != this)
+  {
+    if (h)
+      h.destroy();
+
+    h = std::exchange(rhv.h, nullptr);
+  }
+
+  return *this;
+}
+
+/**
+ * \brief Starts the coroutine and suspends the awaiting coroutine until the result is available.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \return
+ * Awaiter. `co_await` yields the result of the coroutine or rethrows the exception thrown by the coroutine body.
+ */
+template <typename T>
+typename Task<T>::Awaiter Task<T>::operator co_await(void) &&
+{
+  if (!h)
+    throw std::logic_error("Task::operator co_await: No coroutine");
+
+  return Awaiter(h);
+}
+
+/**
+ * \brief Constructor. Used by the promise type only.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param _h
+ * Handle of the coroutine.
+ */
+template <typename T>
+Task<T>::Task(std::coroutine_handle<promise_type> const _h) noexcept
+: h(_h)
+{
+}
+
+/**
+ * \ingroup GPCC_EXECUTION_ASYNC
+ * \brief Starts a @ref Task coroutine on a work queue and detaches it (C++20 only).
+ *
+ * The coroutine will be started by a dynamic work package added to the given work queue. After that, the coroutine
+ * destroys itself when it has finished.
+ *
+ * If the coroutine body throws an exception, then the application will panic.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param wq
+ * Work queue that shall start the coroutine.
+ *
+ * \param task
+ * Task that shall be started. The coroutine must not have been started yet.\n
+ * In case of success, `task` will no longer reference any coroutine.
+ *
+ * \param pPool
+ * Optional pool that shall be used to allocate the work package starting the coroutine.\n
+ * `nullptr` = the work package will be allocated on the heap.
+ */
+inline void Spawn(IWorkQueue & wq, Task<void> && task, WorkPackagePool* const pPool)
+{
+  if (!task.h)
+    throw std::invalid_argument("Spawn: No coroutine");
+
+  auto spWP = internal::CreateResumeWP(task.h, pPool);
+
+  // The coroutine may be resumed by the work queue before Add() returns, so it must be detached in advance.
+  task.h.promise().detached = true;
+  try
+  {
+    wq.Add(std::move(spWP));
+  }
+  catch (...)
+  {
+    task.h.promise().detached = false;
+    throw;
+  }
+
+  task.h = nullptr;
+}
+
+} // namespace async
+} // namespace execution
+} // namespace gpcc
+
+#endif // #if defined(__cpp_impl_coroutine) && (__cpp_impl_coroutine >= 201902L)
+#endif // TASK_HPP_202610161102
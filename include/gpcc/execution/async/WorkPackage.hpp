@@ -11,9 +11,15 @@
 #ifndef WORKPACKAGE_HPP_201612212208
 #define WORKPACKAGE_HPP_201612212208
 
+#include <gpcc/execution/async/WorkPackagePool.hpp>
 #include <atomic>
 #include <functional>
 #include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <cstddef>
 #include <cstdint>
 
 namespace gpcc {
@@ -30,7 +36,8 @@ namespace async {
  * - A pointer to the owner (originator) of the work package (nullptr = anonymous).
  * - An ID for further identification of @ref WorkPackage instances on a per-owner basis.
  *
- * The owner and the ID are only used for selective removal of work packages from a work queue.
+ * The owner and the ID are only used for selective removal of work packages from a work queue and for
+ * aggregation of telemetry data (see @ref WorkQueueTelemetry).
  *
  * # Creation and Ownership
  * Use any of the constructors to create a _static_ work package.\n
@@ -41,6 +48,8 @@ namespace async {
  * creator of the work package.
  *
  * _Static_ work packages can be recycled and do not use any memory allocation during runtime.\n
+ * _Dynamic_ work packages can be created without any heap allocation using a @ref WorkPackagePool. See
+ * @ref CreateDynamic(WorkPackagePool &, void const * const, uint32_t const, F &&) for details.\n
  * See @ref GPCC_EXECUTION_ASYNC for details.
  *
  * ---
@@ -52,6 +61,7 @@ class WorkPackage final
 {
     friend class WorkQueue;
     friend class DeferredWorkQueue;
+    friend class WorkQueuePool;
 
   public:
     /// Type definition of the functor encapsulated by the work package.
@@ -70,6 +80,14 @@ class WorkPackage final
     static std::unique_ptr<WorkPackage> CreateDynamic(void const * const _pOwnerObject,
                                                       uint32_t const _ownerID,
                                                       tFunctor && _functor);
+    template <typename F>
+    static std::unique_ptr<WorkPackage> CreateDynamic(WorkPackagePool & pool,
+                                                      void const * const _pOwnerObject,
+                                                      uint32_t const _ownerID,
+                                                      F && callable);
+
+    static void* operator new(size_t const size);
+    static void operator delete(void* const p) noexcept;
 
     WorkPackage& operator=(WorkPackage const &) = delete;
     WorkPackage& operator=(WorkPackage &&) = delete;
@@ -103,10 +121,113 @@ class WorkPackage final
     /// Pointer to previous @ref WorkPackage in a work queue.
     WorkPackage* pPrev;
 
+    /// Timestamp (see @ref WorkQueueTelemetry::GetTimestamp_ns()) when the work package has been added to a work
+    /// queue. Zero = none.
+    /** This is only setup if a @ref WorkQueueTelemetry instance is attached to the work queue. */
+    uint64_t enqueueTimestamp_ns;
+
     /// Current state of the work package.
     std::atomic<States> state;
 };
 
+/**
+ * \brief Factory. Creates a dynamic work package using a @ref WorkPackagePool.
+ *
+ * The work package and a copy of the callable are placed in a block of the given pool. The functor of the work package
+ * only references the callable, so neither the creation nor the release of the work package allocates memory on the
+ * heap.
+ *
+ * If the pool is exhausted or if the callable does not fit into a block, then the work package will be created on the
+ * heap like @ref CreateDynamic(void const * const, uint32_t const, tFunctor &&) does. This is recorded in the pool's
+ * statistics.
+ *
+ * The returned work package is used and released like any other dynamic work package. The block will be returned to
+ * the pool when the work package is released.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * Basic guarantee:
+ * - Parameter `callable` could be left in an undefined state if it has been passed as an rvalue.
+ *
+ * __Thread cancellation safety:__\n
+ * Deferred cancellation is safe.
+ *
+ * ---
+ *
+ * \tparam F
+ * Type of the callable. It must be invocable without any parameters.
+ *
+ * \param pool
+ * Pool providing the memory for the work package.\n
+ * The pool must not be destroyed before the work package has been released.
+ * \param _pOwnerObject
+ * Pointer to the object which is the owner of the work package.\n
+ * The owner object must not be destroyed before the work package is destroyed or before its execution has finished.\n
+ * This may be `nullptr` if there is no owner object (anonymous owner).\n
+ * The owner pointer can later be used to remove specific work packages from a work queue.
+ * \param _ownerID
+ * ID assigned by the owner of the work package.\n
+ * The ID can later be used to remove specific work packages from a work queue.\n
+ * The ID is also applicable, if `_pOwnerObject` is `nullptr` (anonymous owner).\n
+ * The same ID may be assigned to multiple work packages of the same owner.
+ * \param callable
+ * Callable (e.g. a lambda) which shall be invoked when the work package is processed.\n
+ * The callable is copied or moved into the new created work package.
+ * \return
+ * An `std::unique_ptr` to a new @ref WorkPackage instance.
+ */
+template <typename F>
+std::unique_ptr<WorkPackage> WorkPackage::CreateDynamic(WorkPackagePool & pool,
+                                                        void const * const _pOwnerObject,
+                                                        uint32_t const _ownerID,
+                                                        F && callable)
+{
+  using tCallable = typename std::decay<F>::type;
+
+  if constexpr (std::is_constructible<bool, tCallable const &>::value)
+  {
+    if (!callable)
+      throw std::invalid_argument("WorkPackage::CreateDynamic: !callable");
+  }
+
+  void* const pMem = pool.Allocate(sizeof(tCallable), alignof(tCallable));
+  if (pMem == nullptr)
+    return CreateDynamic(_pOwnerObject, _ownerID, tFunctor(std::forward<F>(callable)));
+
+  tCallable* pCallable;
+  WorkPackage* pWP;
+  try
+  {
+    pCallable = ::new (WorkPackagePool::GetFunctorStorage(pMem)) tCallable(std::forward<F>(callable));
+  }
+  catch (...)
+  {
+    WorkPackagePool::Free(pMem);
+    throw;
+  }
+
+  WorkPackagePool::SetFunctorDestructor(pMem, [](void* const p) { static_cast<tCallable*>(p)->~tCallable(); });
+
+  try
+  {
+    // A lambda capturing a single pointer fits into the small buffer of std::function.
+    pWP = ::new (pMem) WorkPackage(_pOwnerObject, _ownerID, tFunctor([pCallable]() { (*pCallable)(); }));
+  }
+  catch (...)
+  {
+    // (this destroys the callable, too)
+    WorkPackagePool::Free(pMem);
+    throw;
+  }
+
+  pWP->state = States::dynamicNotInQ;
+  return std::unique_ptr<WorkPackage>(pWP);
+}
+
 } // namespace async
 } // namespace execution
 } // namespace gpcc
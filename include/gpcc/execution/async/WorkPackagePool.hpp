@@ -0,0 +1,183 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#ifndef WORKPACKAGEPOOL_HPP_202610151432
+#define WORKPACKAGEPOOL_HPP_202610151432
+
+#include <gpcc/osal/Mutex.hpp>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+
+namespace gpcc      {
+namespace execution {
+namespace async     {
+
+class WorkPackage;
+class DeferredWorkPackage;
+
+/**
+ * \ingroup GPCC_EXECUTION_ASYNC
+ * \brief Fixed-size pool of memory blocks for allocation-free creation of dynamic @ref WorkPackage and
+ *        @ref DeferredWorkPackage instances.
+ *
+ * Each block of the pool provides storage for one @ref WorkPackage or @ref DeferredWorkPackage instance plus storage
+ * for a callable object (e.g. a lambda) of up to @ref GetInlineFunctorSize() bytes.
+ *
+ * The pool is used by the following factories:
+ * - `WorkPackage::CreateDynamic(WorkPackagePool & pool, ...)`
+ * - `DeferredWorkPackage::CreateDynamic(WorkPackagePool & pool, ...)`
+ *
+ * These factories place the work package and the callable inside a block of the pool. The `std::function` inside the
+ * work package only references the callable and therefore does not allocate memory either. When a work queue releases
+ * the dynamic work package, the block is returned to the pool. No special deleter is required, `delete` and
+ * `std::unique_ptr` work as usual.
+ *
+ * If the pool is exhausted, or if the callable is too large for a block, then the factories fall back to allocating
+ * the work package on the heap. This is recorded in the pool's @ref Statistics.
+ *
+ * To allow `delete` to distinguish between both kinds of memory, the class-specific `operator new` of
+ * @ref WorkPackage and @ref DeferredWorkPackage places an @ref ObjectTag in front of each work package allocated on
+ * the heap. This costs `alignof(std::max_align_t)` bytes (typically 16 bytes on 64-bit and 8 bytes on 32-bit
+ * platforms) per heap-allocated work package, regardless of whether a pool is used at all.
+ *
+ * The pool must not be destroyed before all blocks have been returned to the pool.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * Thread-safe.
+ */
+class WorkPackagePool final
+{
+    friend class WorkPackage;
+    friend class DeferredWorkPackage;
+
+  public:
+    /// Statistics of a @ref WorkPackagePool.
+    struct Statistics
+    {
+      size_t nbOfBlocks;                ///<Total number of blocks of the pool.
+      size_t nbOfFreeBlocks;            ///<Number of blocks currently not in use.
+      size_t minNbOfFreeBlocks;         ///<Minimum number of free blocks observed since creation of the pool.
+      uint64_t nbOfAllocations;         ///<Number of work packages successfully created in a block of the pool.
+      uint64_t nbOfExhaustions;         ///<Number of work packages allocated on the heap because the pool was empty.
+      uint64_t nbOfOversizedFunctors;   ///<Number of work packages allocated on the heap because the callable did
+                                        /**<not fit into the inline functor storage of a block. */
+    };
+
+    /// Default size of the inline functor storage of each block in bytes.
+    static constexpr size_t defaultInlineFunctorSize = 64U;
+
+    WorkPackagePool(void) = delete;
+    WorkPackagePool(size_t const nbOfBlocks, size_t const inlineFunctorSize = defaultInlineFunctorSize);
+    WorkPackagePool(WorkPackagePool const &) = delete;
+    WorkPackagePool(WorkPackagePool &&) = delete;
+    ~WorkPackagePool(void);
+
+    WorkPackagePool& operator=(WorkPackagePool const &) = delete;
+    WorkPackagePool& operator=(WorkPackagePool &&) = delete;
+
+    size_t GetInlineFunctorSize(void) const noexcept;
+    Statistics GetStatistics(void) const;
+
+  private:
+    /// Tag placed directly in front of each object allocated by @ref Allocate() or @ref AllocateFromHeap().
+    struct alignas(std::max_align_t) ObjectTag
+    {
+      /// Pool the object's block belongs to. nullptr = object has been allocated on the heap.
+      WorkPackagePool* pPool;
+    };
+
+    /// Header of each block of the pool.
+    /** The header ends with the @ref ObjectTag of the object placed in the block. Objects allocated on the heap
+        via @ref AllocateFromHeap() are preceded by an @ref ObjectTag only. */
+    struct BlockHeader
+    {
+      /// Next free block. Only valid if the block is in the pool's list of free blocks.
+      BlockHeader* pNextFree;
+
+      /// Function used to destroy the callable in the block's inline functor storage. nullptr = none.
+      void (*pFunctorDestructor)(void* pFunctor);
+
+      /// Tag of the object placed in the block.
+      ObjectTag tag;
+    };
+
+    /// Size of the storage for the work package (@ref WorkPackage or @ref DeferredWorkPackage) of each block.
+    /** This is a multiple of `alignof(std::max_align_t)`. */
+    static size_t const objectSize;
+
+    /// Size of the inline functor storage of each block in bytes.
+    /** This is a multiple of `alignof(std::max_align_t)`. */
+    size_t const inlineFunctorSize;
+
+    /// Size of each block (header + work package + inline functor storage) in bytes.
+    size_t const blockSize;
+
+    /// Total number of blocks.
+    size_t const nbOfBlocks;
+
+    /// Storage for all blocks.
+    std::unique_ptr<std::max_align_t[]> spStorage;
+
+    /// Mutex protecting the list of free blocks and the statistics.
+    gpcc::osal::Mutex mutable mutex;
+
+    /// First block in the list of free blocks. nullptr = pool exhausted.
+    /** @ref mutex is required. */
+    BlockHeader* pFirstFree;
+
+    /// Statistics.
+    /** @ref mutex is required. */
+    Statistics stats;
+
+
+    void* Allocate(size_t const functorSize, size_t const functorAlignment) noexcept;
+    void ReturnBlock(BlockHeader* const pHeader) noexcept;
+
+    static BlockHeader* GetBlockHeader(void* const pObject) noexcept;
+    static void* GetFunctorStorage(void* const pObject) noexcept;
+    static void SetFunctorDestructor(void* const pObject, void (*pFunctorDestructor)(void*)) noexcept;
+
+    static void* AllocateFromHeap(size_t const size);
+    static void Free(void* const pObject) noexcept;
+};
+
+/**
+ * \brief Retrieves the size of the inline functor storage of each block.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \return
+ * Size of the inline functor storage of each block in bytes. Callables up to this size (and with an alignment
+ * requirement not exceeding `alignof(std::max_align_t)`) can be placed inside a block.
+ */
+inline size_t WorkPackagePool::GetInlineFunctorSize(void) const noexcept
+{
+  return inlineFunctorSize;
+}
+
+} // namespace async
+} // namespace execution
+} // namespace gpcc
+
+#endif // WORKPACKAGEPOOL_HPP_202610151432
@@ -14,12 +14,18 @@
 #include <gpcc/execution/async/IWorkQueue.hpp>
 #include <gpcc/osal/ConditionVariable.hpp>
 #include <gpcc/osal/Mutex.hpp>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
 
 namespace gpcc {
 namespace execution {
 namespace async {
 
 class WorkPackage;
+class WorkQueueTelemetry;
 
 /**
  * \ingroup GPCC_EXECUTION_ASYNC
@@ -28,6 +34,9 @@ class WorkPackage;
  * Features/characteristics:
  * - One thread.
  * - Execution in FIFO order.
+ * - Optional lock-free ingress path for @ref Add() (see @ref IngressMode).
+ * - Batch enqueue of multiple work packages with one lock acquisition and one wake-up of the work queue's thread.
+ * - Optional telemetry (see @ref SetTelemetry()).
  *
  * For general information about work queues and work packages please refer to @ref GPCC_EXECUTION_ASYNC.
  *
@@ -42,7 +51,19 @@ class WorkPackage;
 class WorkQueue final: public IWorkQueue
 {
   public:
+    /// Modes for adding work packages to the work queue via @ref Add().
+    enum class IngressMode
+    {
+      locked,   ///<@ref Add() locks the work queue's mutex and signals the work queue's thread each time.
+      lockFree  ///<@ref Add() pushes work packages onto a lock-free intrusive list.
+                /**<The thread executing @ref Work() moves the work packages from the list into the work queue in
+                    batches. The mutex is only locked and the thread is only signaled, if the list was empty.\n
+                    This reduces contention if many threads add work packages at the same time.\n
+                    The order of execution is the same as in mode @ref IngressMode::locked. */
+    };
+
     WorkQueue(void);
+    explicit WorkQueue(IngressMode const _ingressMode);
     WorkQueue(WorkQueue const &) = delete;
     WorkQueue(WorkQueue&&) = delete;
     virtual ~WorkQueue(void);
@@ -63,10 +84,25 @@ class WorkQueue final: public IWorkQueue
     void FlushNonDeferredWorkPackages(void) override;
     // <--
 
+    void Add(std::vector<std::unique_ptr<WorkPackage>> & spWPs);
+    void Add(WorkPackage* const * const ppWPs, size_t const n);
+
     void Work(void);
     void RequestTermination(void) noexcept;
 
+    void SetTelemetry(WorkQueueTelemetry* const _pTelemetry);
+
   private:
+    /// Ingress mode.
+    IngressMode const ingressMode;
+
+    /// Head of the lock-free intrusive list used by @ref Add() if @ref ingressMode is @ref IngressMode::lockFree.
+    /** The list is linked via the pNext-pointers of the work packages and it is in LIFO order. The last work package
+        added by @ref Add() is referenced by this.\n
+        Any thread may push work packages onto this list without locking @ref queueMutex.\n
+        @ref queueMutex is required to remove work packages from this list. */
+    std::atomic<WorkPackage*> ingressHead;
+
     /// Mutex for queue-related stuff.
     /** Locking order: @ref flushMutex -> @ref queueMutex */
     osal::Mutex mutable queueMutex;
@@ -90,6 +126,16 @@ class WorkQueue final: public IWorkQueue
         The pNext-pointers of the enqueued work packages point towards this. */
     WorkPackage* pQueueLast;
 
+    /// Number of work packages in the queue (@ref pQueueFirst ... @ref pQueueLast).
+    /** @ref queueMutex is required.\n
+        Work packages on the ingress list (@ref ingressHead) are not included. */
+    size_t nbOfEnqueuedWPs;
+
+    /// Telemetry data collector. nullptr = none.
+    /** Writing requires @ref flushMutex and @ref queueMutex.\n
+        Reading requires @ref flushMutex or @ref queueMutex, except for @ref StampEnqueueTime(). */
+    std::atomic<WorkQueueTelemetry*> pTelemetry;
+
     /// Terminate flag.
     /** @ref queueMutex is required.\n
         true  = Work package execution shall stop after execution of the current work package.
@@ -112,8 +158,16 @@ class WorkQueue final: public IWorkQueue
         This is used to allow enqueueing of currently executed static work packages. */
     WorkPackage const * pCurrentExecutedWP;
 
+    void PushToIngress(WorkPackage& wp) noexcept;
+    void DrainIngress(void) noexcept;
+
+    void StampEnqueueTime(WorkPackage& wp) const noexcept;
+    void IncrementDepth(size_t const n) noexcept;
+
     void CheckStateAndSetToInQ_static(WorkPackage& wp) const;
     void CheckStateAndSetToInQ_dynamic(WorkPackage& wp) const noexcept;
+    void CheckStateAndSetToInQ_static(WorkPackage* const * const ppWPs, size_t const n) const;
+    void AppendToQueue(WorkPackage& wp) noexcept;
 
     void Release(WorkPackage* const pWP) noexcept;
     void Finish(WorkPackage* const pWP) noexcept;
@@ -0,0 +1,218 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#ifndef WORKQUEUEPOOL_HPP_202610151012
+#define WORKQUEUEPOOL_HPP_202610151012
+
+#include <gpcc/execution/async/IWorkQueue.hpp>
+#include <gpcc/osal/ConditionVariable.hpp>
+#include <gpcc/osal/Mutex.hpp>
+#include <gpcc/osal/Thread.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstddef>
+
+namespace gpcc      {
+namespace execution {
+namespace async     {
+
+class WorkPackage;
+
+/**
+ * \ingroup GPCC_EXECUTION_ASYNC
+ * \brief Work queue for executing @ref WorkPackage instances using a pool of multiple
+ *        [threads](@ref gpcc::osal::Thread).
+ *
+ * Features/characteristics:
+ * - N threads, provided and managed by this class.
+ * - Work packages of the same owner (`pOwnerObject`) are executed in FIFO order and never concurrently.
+ * - Work packages of different owners may be executed concurrently.
+ * - Work packages of the anonymous owner (`nullptr`) are treated like the work packages of any other owner, so they
+ *   are executed in FIFO order and never concurrently, too.
+ *
+ * This class implements @ref IWorkQueue. Clients which use a @ref WorkQueue via @ref IWorkQueue can switch to this
+ * class without any modification, provided that they do not rely on work packages of _different_ owners being
+ * executed sequentially.
+ *
+ * @ref FlushNonDeferredWorkPackages() acts as a barrier: While the flush is in progress, work packages enqueued after
+ * the invocation of @ref FlushNonDeferredWorkPackages() are not started before all work packages enqueued before
+ * have been executed.
+ *
+ * This class does not expect work packages to throw. If a work package throws, then this class will
+ * [panic](@ref GPCC_OSAL_PANIC).
+ *
+ * The work packages are executed with deferred thread cancellation disabled. The @ref Stop() method will stop the
+ * threads after all work packages currently in progress have completed. Until then the @ref Stop() method blocks.
+ *
+ * Usage example:
+ * ~~~{.cpp}
+ * auto spWQP = std::make_unique<WorkQueuePool>("MyPool", 4U);
+ *
+ * // start the threads
+ * spWQP->Start(Thread::SchedPolicy::Other, 0U, Thread::GetDefaultStackSize()));
+ *
+ * // put work packages into the work queue and watch them being executed
+ * // [...]
+ *
+ * // stop the threads and destroy the object
+ * spWQP->Stop();
+ * spWQP.reset();
+ * ~~~
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * Thread-safe.
+ */
+class WorkQueuePool final: public IWorkQueue
+{
+  public:
+    WorkQueuePool(void) = delete;
+    WorkQueuePool(std::string const & threadNamePrefix, size_t const nbOfThreads);
+    WorkQueuePool(WorkQueuePool const &) = delete;
+    WorkQueuePool(WorkQueuePool&&) = delete;
+    virtual ~WorkQueuePool(void);
+
+    WorkQueuePool& operator=(WorkQueuePool const &) = delete;
+    WorkQueuePool& operator=(WorkQueuePool&&) = delete;
+
+    // --> Interface required by IWorkQueue
+    void Add(std::unique_ptr<WorkPackage> spWP) override;
+    void Add(WorkPackage & wp) override;
+    void InsertAtHeadOfList(std::unique_ptr<WorkPackage> spWP) override;
+    void InsertAtHeadOfList(WorkPackage & wp) override;
+    void Remove(WorkPackage & wp) override;
+    void Remove(void const * const pOwnerObject) override;
+    void Remove(void const * const pOwnerObject, uint32_t const ownerID) override;
+    void WaitUntilCurrentWorkPackageHasBeenExecuted(void const * const pOwnerObject) const override;
+    bool IsAnyInQueue(void const * const pOwnerObject) const override;
+    void FlushNonDeferredWorkPackages(void) override;
+    // <--
+
+    void Start(gpcc::osal::Thread::SchedPolicy const schedPolicy,
+               gpcc::osal::Thread::priority_t const priority,
+               size_t const stackSize);
+    void Stop(void) noexcept;
+
+    size_t GetNbOfThreads(void) const noexcept;
+
+  private:
+    /// Data associated with one worker thread.
+    struct Worker final
+    {
+      Worker(std::string const & threadName);
+
+      /// The thread.
+      gpcc::osal::Thread thread;
+
+      /// Pointer to the currently executed work package. nullptr = none.
+      /** @ref queueMutex is required. */
+      WorkPackage const * pCurrentExecutedWP;
+
+      /// Pointer to the owner object of the currently executed work package.
+      /** @ref queueMutex is required.\n
+          Only valid if @ref pCurrentExecutedWP is not nullptr. */
+      void const * pOwnerOfCurrentExecutedWP;
+    };
+
+    /// Mutex used to make @ref Start() and @ref Stop() thread-safe.
+    /** Locking order: @ref startStopMutex -> @ref queueMutex */
+    osal::Mutex startStopMutex;
+
+    /// Flag indicating if the threads are running.
+    /** @ref startStopMutex is required. */
+    bool running;
+
+    /// Mutex for queue-related stuff.
+    /** Locking order: @ref startStopMutex -> @ref queueMutex */
+    osal::Mutex mutable queueMutex;
+
+    /// Condition variable indicating that the queue has changed, that a worker has finished a work package, or that
+    /// @ref terminate has been asserted.
+    /** This is to be used in conjunction with @ref queueMutex. */
+    osal::ConditionVariable queueConVar;
+
+    /// First enqueued work package.
+    /** @ref queueMutex is required.\n
+        The pPrev-pointers of the enqueued work packages point towards this. */
+    WorkPackage* pQueueFirst;
+
+    /// Last enqueued work package. New work packages are enqueued here.
+    /** @ref queueMutex is required.\n
+        The pNext-pointers of the enqueued work packages point towards this. */
+    WorkPackage* pQueueLast;
+
+    /// Terminate flag.
+    /** @ref queueMutex is required.\n
+        true  = All workers shall stop after execution of their current work package.\n
+        false = No terminate request. */
+    bool terminate;
+
+    /// Number of workers currently executing a work package.
+    /** @ref queueMutex is required. */
+    size_t nbOfBusyWorkers;
+
+    /// Condition variable indicating that a worker has finished execution of a work package.
+    /** This is to be used in conjunction with @ref queueMutex. */
+    mutable osal::ConditionVariable ownerChangedConVar;
+
+    /// Workers.
+    /** The number of workers is fixed during the life-time of the object.\n
+        The members of the workers are protected by @ref queueMutex. */
+    std::vector<std::unique_ptr<Worker>> workers;
+
+
+    void* ThreadEntry(Worker & worker);
+    void Work(Worker & worker);
+
+    WorkPackage* FetchNext(void) const noexcept;
+    bool IsOwnerBusy(void const * const pOwnerObject) const noexcept;
+    bool IsExecuted(WorkPackage const & wp) const noexcept;
+    bool IsFlushMarker(WorkPackage const & wp) const noexcept;
+
+    void Unlink(WorkPackage & wp) noexcept;
+
+    void CheckStateAndSetToInQ_static(WorkPackage& wp) const;
+    void CheckStateAndSetToInQ_dynamic(WorkPackage& wp) const noexcept;
+
+    void Release(WorkPackage* const pWP) noexcept;
+    void Finish(WorkPackage* const pWP) noexcept;
+};
+
+/**
+ * \brief Retrieves the number of threads of the pool.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \return
+ * Number of threads of the pool.
+ */
+inline size_t WorkQueuePool::GetNbOfThreads(void) const noexcept
+{
+  return workers.size();
+}
+
+} // namespace async
+} // namespace execution
+} // namespace gpcc
+
+#endif // WORKQUEUEPOOL_HPP_202610151012
@@ -0,0 +1,210 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#ifndef WORKQUEUETELEMETRY_HPP_202610160915
+#define WORKQUEUETELEMETRY_HPP_202610160915
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace gpcc      {
+namespace execution {
+namespace async     {
+
+/**
+ * \ingroup GPCC_EXECUTION_ASYNC
+ * \brief Collects telemetry data of a work queue.
+ *
+ * An instance of this class can be attached to a @ref WorkQueue or @ref DeferredWorkQueue via `SetTelemetry()`.
+ * The work queue will then record the following data:
+ * - Queue latency: Time between adding a (non-deferred) work package to the work queue and start of its execution.
+ * - Execution time: Time required to execute a work package's functor.
+ * - Late start: Time between the point in time specified by a deferred work package and start of its execution.
+ * - Maximum queue depth: Maximum number of non-deferred work packages enqueued at the same time.
+ *
+ * Latency, execution time and late start are aggregated per work package owner (`pOwnerObject` and `ownerID`) in
+ * @ref Histogram instances. The maximum number of different owners is specified when the object is instantiated.
+ * Data of work packages whose owners do not fit into the table of owners is aggregated in a common record.
+ *
+ * Recording is lock-free and does not allocate any memory. If no telemetry object is attached to a work queue, then
+ * the overhead is a check of a pointer for each added and executed work package.
+ *
+ * The data can be retrieved via @ref GetSnapshot() and printed to a CLI via @ref CliCmdPrintWorkQueueTelemetry().
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * Thread-safe.
+ */
+class WorkQueueTelemetry final
+{
+  public:
+    /// Number of buckets of a @ref Histogram.
+    static constexpr size_t nbOfBuckets = 24U;
+
+    /**
+     * \brief Lock-free histogram with logarithmic buckets for time values.
+     *
+     * Bucket 0 counts values below 1us. Bucket n (1..22) counts values in the range [2^(n-1)us, 2^n us).
+     * The last bucket counts all values of 2^22us (approx. 4.2s) and above.
+     *
+     * - - -
+     *
+     * __Thread safety:__\n
+     * Thread-safe.
+     */
+    class Histogram final
+    {
+      public:
+        /// Snapshot of the content of a @ref Histogram.
+        struct Snapshot
+        {
+          uint64_t count;                               ///<Number of recorded values.
+          uint64_t sum_ns;                              ///<Sum of all recorded values in ns.
+          uint64_t max_ns;                              ///<Maximum recorded value in ns.
+          std::array<uint64_t, nbOfBuckets> buckets;    ///<Number of recorded values per bucket.
+
+          uint64_t GetAverage_ns(void) const noexcept;
+          uint64_t GetPercentile_ns(uint8_t const percent) const noexcept;
+        };
+
+        Histogram(void) noexcept;
+        Histogram(Histogram const &) = delete;
+        Histogram(Histogram &&) = delete;
+        ~Histogram(void) = default;
+
+        Histogram& operator=(Histogram const &) = delete;
+        Histogram& operator=(Histogram &&) = delete;
+
+        void Record(uint64_t const value_ns) noexcept;
+        Snapshot GetSnapshot(void) const noexcept;
+        void Reset(void) noexcept;
+
+        static size_t ValueToBucket(uint64_t const value_ns) noexcept;
+        static uint64_t GetBucketUpperLimit_ns(size_t const bucket) noexcept;
+
+      private:
+        /// Number of recorded values.
+        std::atomic<uint64_t> count;
+
+        /// Sum of all recorded values in ns.
+        std::atomic<uint64_t> sum_ns;
+
+        /// Maximum recorded value in ns.
+        std::atomic<uint64_t> max_ns;
+
+        /// Number of recorded values per bucket.
+        std::array<std::atomic<uint64_t>, nbOfBuckets> buckets;
+    };
+
+    /// Telemetry data of one work package owner.
+    struct OwnerRecord
+    {
+      void const * pOwnerObject;        ///<Owner object. Not valid if @ref others is true.
+      uint32_t ownerID;                 ///<ID assigned by the owner. Not valid if @ref others is true.
+      bool others;                      ///<true = record of all owners that did not fit into the table of owners.
+      Histogram::Snapshot latency;      ///<Queue latency of non-deferred work packages.
+      Histogram::Snapshot execution;    ///<Execution time.
+      Histogram::Snapshot lateStart;    ///<Late start of deferred work packages.
+    };
+
+    /// Snapshot of all telemetry data.
+    struct Snapshot
+    {
+      size_t maxQueueDepth;               ///<Maximum number of non-deferred work packages enqueued at the same time.
+      std::vector<OwnerRecord> owners;    ///<Records of owners that have recorded data.
+    };
+
+    WorkQueueTelemetry(void) = delete;
+    explicit WorkQueueTelemetry(size_t const _maxNbOfOwners);
+    WorkQueueTelemetry(WorkQueueTelemetry const &) = delete;
+    WorkQueueTelemetry(WorkQueueTelemetry &&) = delete;
+    ~WorkQueueTelemetry(void) = default;
+
+    WorkQueueTelemetry& operator=(WorkQueueTelemetry const &) = delete;
+    WorkQueueTelemetry& operator=(WorkQueueTelemetry &&) = delete;
+
+    Snapshot GetSnapshot(void) const;
+    void Reset(void) noexcept;
+
+    static uint64_t GetTimestamp_ns(void);
+
+    void RecordQueueDepth(size_t const depth) noexcept;
+    void RecordExecution(void const * const pOwnerObject,
+                         uint32_t const ownerID,
+                         uint64_t const enqueueTimestamp_ns,
+                         uint64_t const startTimestamp_ns,
+                         uint64_t const endTimestamp_ns) noexcept;
+    void RecordDeferredExecution(void const * const pOwnerObject,
+                                 uint32_t const ownerID,
+                                 int64_t const lateStart_ns,
+                                 uint64_t const startTimestamp_ns,
+                                 uint64_t const endTimestamp_ns) noexcept;
+
+  private:
+    /// States of an @ref Entry.
+    enum class EntryStates : uint8_t
+    {
+      free,       ///<Entry is not in use.
+      claiming,   ///<Entry is being assigned to an owner.
+      used        ///<Entry is assigned to an owner.
+    };
+
+    /// Entry in the table of owners.
+    struct Entry
+    {
+      /// State of the entry.
+      /** @ref pOwnerObject and @ref ownerID are valid if the state is @ref EntryStates::used. */
+      std::atomic<EntryStates> state;
+
+      /// Owner object.
+      void const * pOwnerObject;
+
+      /// ID assigned by the owner.
+      uint32_t ownerID;
+
+      /// Queue latency of non-deferred work packages.
+      Histogram latency;
+
+      /// Execution time.
+      Histogram execution;
+
+      /// Late start of deferred work packages.
+      Histogram lateStart;
+
+      Entry(void) noexcept;
+    };
+
+    /// Maximum number of owners in @ref spEntries.
+    size_t const maxNbOfOwners;
+
+    /// Table of owners (hash table with linear probing).
+    std::unique_ptr<Entry[]> spEntries;
+
+    /// Entry for all owners that do not fit into @ref spEntries.
+    Entry others;
+
+    /// Maximum number of non-deferred work packages enqueued at the same time.
+    std::atomic<size_t> maxQueueDepth;
+
+
+    Entry& GetEntry(void const * const pOwnerObject, uint32_t const ownerID) noexcept;
+    static void AppendRecord(std::vector<OwnerRecord> & v, Entry const & e, bool const isOthers);
+};
+
+} // namespace async
+} // namespace execution
+} // namespace gpcc
+
+#endif // WORKQUEUETELEMETRY_HPP_202610160915
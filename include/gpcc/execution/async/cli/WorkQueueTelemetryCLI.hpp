@@ -0,0 +1,38 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#ifndef WORKQUEUETELEMETRYCLI_HPP_202610160948
+#define WORKQUEUETELEMETRYCLI_HPP_202610160948
+
+#include <string>
+
+namespace gpcc      {
+namespace cli       {
+  class CLI;
+}
+
+namespace execution {
+namespace async     {
+  class WorkQueueTelemetry;
+}}}
+
+namespace gpcc      {
+namespace execution {
+namespace async     {
+
+void CliCmdPrintWorkQueueTelemetry(std::string const & restOfLine,
+                                   gpcc::cli::CLI & cli,
+                                   WorkQueueTelemetry* const pTelemetry);
+
+} // namespace async
+} // namespace execution
+} // namespace gpcc
+
+#endif // WORKQUEUETELEMETRYCLI_HPP_202610160948
@@ -39,8 +39,8 @@ namespace internal
  *
  * Files can be read and written via the [IStreamReader](@ref gpcc::stream::IStreamReader) and
  * [IStreamWriter](@ref gpcc::stream::IStreamWriter) interfaces.
- * [IStreamReader::RemainingBytes()](@ref gpcc::stream::IStreamReader::RemainingBytes) and
- * [IStreamWriter::RemainingCapacity()](@ref gpcc::stream::IStreamWriter::RemainingCapacity) are not supported.
+ * [IStreamReader::RemainingBytes()](@ref gpcc::stream::IStreamReader::RemainingBytes) is supported.
+ * [IStreamWriter::RemainingCapacity()](@ref gpcc::stream::IStreamWriter::RemainingCapacity) is not supported.
  *
  * __Note:__\n
  * The methods of this interface dereference links. Please refer to the documentation of each method for details
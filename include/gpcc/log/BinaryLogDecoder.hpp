@@ -0,0 +1,111 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#ifndef BINARYLOGDECODER_HPP_202610162035
+#define BINARYLOGDECODER_HPP_202610162035
+
+#include <gpcc/log/log_levels.hpp>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace gpcc {
+
+namespace stream
+{
+  class IStreamReader;
+}
+
+namespace log {
+
+/**
+ * \ingroup GPCC_LOG
+ * \brief Converts a binary log written by @ref Backend_Binary back into log message text strings.
+ *
+ * The created log message text strings are equal to the text strings that would have been passed to text-based
+ * back-ends like @ref Backend_CLI, with one restriction: Only the conversion specifications supported by @ref Logger
+ * for deferred formatting are supported. Conversion specifications containing a '*' for field width or precision
+ * are not supported. Unsupported conversion specifications and conversion specifications that do not match the type
+ * of the argument are replaced by "<?>".
+ *
+ * The tool `gpcc_log_decoder` (see CMake option `GPCC_BuildLogDecoder`) uses this class to decode binary log files.
+ *
+ * Usage:
+ * ~~~{.cpp}
+ * BinaryLogDecoder decoder(reader);
+ * std::string msg;
+ * LogType type;
+ * while (decoder.Next(msg, type))
+ *   std::cout << msg << std::endl;
+ * ~~~
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * Not thread safe, but non-modifying concurrent access is safe.
+ */
+class BinaryLogDecoder final
+{
+  public:
+    BinaryLogDecoder(void) = delete;
+    explicit BinaryLogDecoder(gpcc::stream::IStreamReader & _reader);
+    BinaryLogDecoder(BinaryLogDecoder const &) = delete;
+    BinaryLogDecoder(BinaryLogDecoder &&) = delete;
+    ~BinaryLogDecoder(void) = default;
+
+    BinaryLogDecoder& operator=(BinaryLogDecoder const &) = delete;
+    BinaryLogDecoder& operator=(BinaryLogDecoder &&) = delete;
+
+    bool Next(std::string & msg, LogType & type);
+
+  private:
+    /// Value of an argument of a log message.
+    struct Arg
+    {
+      /// Type code (see [Backend_Binary](@ref Backend_Binary)).
+      char code;
+
+      /// Value, if @ref code refers to a signed integer type.
+      int64_t i;
+
+      /// Value, if @ref code refers to an unsigned integer type or to a pointer.
+      uint64_t u;
+
+      /// Value, if @ref code refers to a floating point type.
+      double d;
+
+      /// Value, if @ref code refers to a string.
+      std::string s;
+    };
+
+
+    /// Stream from which the binary log is read.
+    gpcc::stream::IStreamReader & reader;
+
+    /// Source names. The index is the ID.
+    std::vector<std::string> srcNames;
+
+    /// Format strings. The index is the ID.
+    std::vector<std::string> fmtStrings;
+
+
+    LogType ReadLogType(void);
+    void ReadDefinition(std::vector<std::string> & v);
+    std::string DecodeMessage(LogType const type);
+    Arg ReadArg(void);
+
+    static std::string Format(std::string const & fmt, std::vector<Arg> const & args);
+    static std::string FormatArg(std::string const & spec, char const conv, Arg const & arg);
+};
+
+} // namespace log
+} // namespace gpcc
+
+#endif // BINARYLOGDECODER_HPP_202610162035
@@ -0,0 +1,503 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#ifndef DEFERREDFORMATARGS_HPP_202610160950
+#define DEFERREDFORMATARGS_HPP_202610160950
+
+#include <gpcc/string/tools.hpp>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <cstddef>
+#include <cstring>
+
+namespace gpcc {
+namespace log  {
+
+/**
+ * \ingroup GPCC_LOG
+ * \brief Compact binary record of the raw values of the arguments of a printf-style log message.
+ *
+ * This is used by [Logger::LogD()](@ref Logger::LogD) and [Logger::LogDTS()](@ref Logger::LogDTS) to defer
+ * formatting of a log message to the log facility's thread.
+ *
+ * The argument values are copied byte-wise into an internal buffer of @ref storageSize bytes. In addition, a pointer
+ * to a formatting function is stored. The formatting function is a template instantiated for the exact types of the
+ * arguments. It restores the argument values from the buffer and passes them to @ref gpcc::string::ASPrintf().
+ * Capturing the arguments therefore does neither format anything, nor allocate any memory.
+ *
+ * Supported argument types are checked at compile time:
+ * - arithmetic types (`int`, `unsigned long`, `double`, `char`, `bool`, ...)
+ * - pointers (e.g. `void const *` for `%p`, or `char const *` for `%s`)
+ *
+ * Pointers are captured, but not the referenced data. Strings passed for `%s` must therefore be located in
+ * ROM/code memory and must not change, just like the format string itself.
+ *
+ * In addition to the formatting function, a type signature is stored (see @ref GetTypeSignature()). It allows
+ * back-ends like @ref Backend_Binary to serialize the raw argument values without formatting them.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * Not thread safe, but non-modifying concurrent access is safe.
+ */
+class DeferredFormatArgs final
+{
+  public:
+    /// Size of the buffer for the argument values in bytes.
+    static constexpr size_t storageSize = 64U;
+
+    DeferredFormatArgs(void) = delete;
+    DeferredFormatArgs(DeferredFormatArgs const &) noexcept = default;
+    DeferredFormatArgs(DeferredFormatArgs &&) noexcept = default;
+    ~DeferredFormatArgs(void) = default;
+
+    DeferredFormatArgs& operator=(DeferredFormatArgs const &) noexcept = default;
+    DeferredFormatArgs& operator=(DeferredFormatArgs &&) noexcept = default;
+
+    template <typename... Args>
+    static DeferredFormatArgs Capture(Args const... args) noexcept;
+
+    std::unique_ptr<char[]> Format(char const * const pFmt) const;
+
+    char const * GetTypeSignature(void) const noexcept;
+    unsigned char const * GetStorage(void) const noexcept;
+
+  private:
+    /// Type of the formatting function.
+    typedef std::unique_ptr<char[]> (*tFormatter)(char const * const pFmt, unsigned char const * const pStorage);
+
+    /// Buffer containing the raw values of the arguments, without any padding.
+    unsigned char storage[storageSize];
+
+    /// Function used to format the arguments stored in @ref storage.
+    tFormatter pFormatter;
+
+    /// Type signature of the arguments stored in @ref storage. See @ref GetTypeSignature().
+    char const * pTypeSig;
+
+
+    DeferredFormatArgs(tFormatter const _pFormatter, char const * const _pTypeSig) noexcept;
+
+    template <typename T>
+    static constexpr bool IsSupportedType(void) noexcept;
+
+    template <typename T>
+    static constexpr char TypeCode(void) noexcept;
+
+    /// Type signature for arguments of types `Args`. See @ref GetTypeSignature().
+    template <typename... Args>
+    static constexpr char typeSignature[sizeof...(Args) + 1U] = { TypeCode<Args>()..., '\0' };
+
+    template <typename... Args>
+    static constexpr size_t OffsetOf(size_t const index) noexcept;
+
+    template <typename T>
+    static T Load(unsigned char const * const p) noexcept;
+
+    template <typename... Args, size_t... I>
+    static std::unique_ptr<char[]> FormatImpl(char const * const pFmt,
+                                              unsigned char const * const pStorage,
+                                              std::index_sequence<I...>);
+
+    template <typename... Args>
+    static std::unique_ptr<char[]> Formatter(char const * const pFmt, unsigned char const * const pStorage);
+};
+
+/**
+ * \brief Creates a @ref DeferredFormatArgs object and captures the values of the arguments.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \tparam Args
+ * Types of the arguments. Only arithmetic types and pointers are supported. An empty pack is allowed.\n
+ * The total size of the arguments must not exceed @ref storageSize.
+ *
+ * \param args
+ * Values of the arguments.
+ *
+ * \return
+ * @ref DeferredFormatArgs object containing the values of the arguments.
+ */
+template <typename... Args>
+DeferredFormatArgs DeferredFormatArgs::Capture(Args const... args) noexcept
+{
+  static_assert((IsSupportedType<Args>() && ...),
+                "DeferredFormatArgs: Only arithmetic types and pointers are supported as arguments.");
+  static_assert(OffsetOf<Args...>(sizeof...(Args)) <= storageSize,
+                "DeferredFormatArgs: Arguments exceed storageSize.");
+
+  DeferredFormatArgs record(&DeferredFormatArgs::Formatter<Args...>, typeSignature<Args...>);
+
+  size_t offset = 0U;
+  ((std::memcpy(&record.storage[offset], &args, sizeof(Args)), offset += sizeof(Args)), ...);
+  (void)offset;
+
+  return record;
+}
+
+/**
+ * \brief Formats the captured arguments according to a printf-style format string.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \param pFmt
+ * Pointer to a null-terminated c-string containing the text and printf-style conversion specifications. The number
+ * and types of the captured arguments must match the conversion specifications.\n
+ * Details about format specifiers are [here](@ref gpcc::string::VASPrintf).\n
+ * nullptr is not allowed.
+ *
+ * \return
+ * Pointer to the created null-terminated c-string.
+ */
+inline std::unique_ptr<char[]> DeferredFormatArgs::Format(char const * const pFmt) const
+{
+  return pFormatter(pFmt, storage);
+}
+
+/**
+ * \brief Retrieves the type signature of the captured arguments.
+ *
+ * The type signature contains one character per argument:
+ * Code | Type
+ * ---- | ----
+ * c, C | 8 bit integer, signed/unsigned (incl. `char` and `bool`)
+ * h, H | 16 bit integer, signed/unsigned
+ * i, I | 32 bit integer, signed/unsigned
+ * l, L | 64 bit integer, signed/unsigned
+ * f    | `float`
+ * d    | `double`
+ * e    | `long double`
+ * s    | `char const *` (pointer to null-terminated string)
+ * p    | any other pointer
+ *
+ * The values are located in the buffer returned by @ref GetStorage() in the order of the arguments, without any
+ * padding and in native byte order.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \return
+ * Pointer to a null-terminated c-string containing the type signature. It is located in ROM/code memory.
+ */
+inline char const * DeferredFormatArgs::GetTypeSignature(void) const noexcept
+{
+  return pTypeSig;
+}
+
+/**
+ * \brief Retrieves the buffer containing the raw values of the captured arguments.
+ *
+ * See @ref GetTypeSignature() for the layout.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \return
+ * Pointer to the buffer. There are no alignment guarantees.
+ */
+inline unsigned char const * DeferredFormatArgs::GetStorage(void) const noexcept
+{
+  return storage;
+}
+
+/**
+ * \brief Constructor.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \param _pFormatter
+ * Formatting function matching the arguments that will be stored in @ref storage.
+ *
+ * \param _pTypeSig
+ * Type signature matching the arguments that will be stored in @ref storage.
+ */
+inline DeferredFormatArgs::DeferredFormatArgs(tFormatter const _pFormatter, char const * const _pTypeSig) noexcept
+: storage()
+, pFormatter(_pFormatter)
+, pTypeSig(_pTypeSig)
+{
+}
+
+/**
+ * \brief Determines if a type is supported as argument.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \tparam T
+ * Type that shall be checked.
+ *
+ * \retval true   `T` is supported.
+ * \retval false  `T` is not supported.
+ */
+template <typename T>
+constexpr bool DeferredFormatArgs::IsSupportedType(void) noexcept
+{
+  return ((std::is_arithmetic<T>::value) || (std::is_pointer<T>::value));
+}
+
+/**
+ * \brief Determines the type code of an argument type. See @ref GetTypeSignature().
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \tparam T
+ * Type of the argument. This must be a supported type (see @ref IsSupportedType()).
+ *
+ * \return
+ * Type code.
+ */
+template <typename T>
+constexpr char DeferredFormatArgs::TypeCode(void) noexcept
+{
+  if constexpr (std::is_pointer<T>::value)
+  {
+    return (std::is_same<typename std::remove_cv<typename std::remove_pointer<T>::type>::type, char>::value) ? 's' : 'p';
+  }
+  else if constexpr (std::is_floating_point<T>::value)
+  {
+    return (sizeof(T) == sizeof(float)) ? 'f' : ((sizeof(T) == sizeof(double)) ? 'd' : 'e');
+  }
+  else
+  {
+    static_assert((sizeof(T) == 1U) || (sizeof(T) == 2U) || (sizeof(T) == 4U) || (sizeof(T) == 8U),
+                  "DeferredFormatArgs: Unsupported size of integral type.");
+
+    bool const s = std::is_signed<T>::value;
+    switch (sizeof(T))
+    {
+      case 1U: return s ? 'c' : 'C';
+      case 2U: return s ? 'h' : 'H';
+      case 4U: return s ? 'i' : 'I';
+      default: return s ? 'l' : 'L';
+    }
+  }
+}
+
+/**
+ * \brief Determines the offset of an argument inside @ref storage.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \tparam Args
+ * Types of the arguments.
+ *
+ * \param index
+ * Index of the argument. `sizeof...(Args)` yields the total size of all arguments.
+ *
+ * \return
+ * Offset of the argument in bytes.
+ */
+template <typename... Args>
+constexpr size_t DeferredFormatArgs::OffsetOf(size_t const index) noexcept
+{
+  size_t const sizes[] = { 0U, sizeof(Args)... };
+
+  size_t offset = 0U;
+  for (size_t i = 0U; i < index; ++i)
+    offset += sizes[i + 1U];
+
+  return offset;
+}
+
+/**
+ * \brief Restores the value of an argument from @ref storage.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \tparam T
+ * Type of the argument.
+ *
+ * \param p
+ * Pointer to the value of the argument. There are no alignment requirements.
+ *
+ * \return
+ * Value of the argument.
+ */
+template <typename T>
+T DeferredFormatArgs::Load(unsigned char const * const p) noexcept
+{
+  T value;
+  std::memcpy(&value, p, sizeof(T));
+  return value;
+}
+
+/**
+ * \brief Restores the values of the arguments from @ref storage and formats them.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \tparam Args
+ * Types of the arguments.
+ *
+ * \tparam I
+ * Indices of the arguments.
+ *
+ * \param pFmt
+ * Pointer to a null-terminated c-string containing the text and printf-style conversion specifications.
+ *
+ * \param pStorage
+ * Pointer to @ref storage.
+ *
+ * \return
+ * Pointer to the created null-terminated c-string.
+ */
+template <typename... Args, size_t... I>
+std::unique_ptr<char[]> DeferredFormatArgs::FormatImpl(char const * const pFmt,
+                                                       unsigned char const * const pStorage,
+                                                       std::index_sequence<I...>)
+{
+  (void)pStorage;
+  return gpcc::string::ASPrintf(pFmt, Load<Args>(pStorage + OffsetOf<Args...>(I))...);
+}
+
+/**
+ * \brief Formatting function referenced by @ref pFormatter.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \tparam Args
+ * Types of the arguments.
+ *
+ * \param pFmt
+ * Pointer to a null-terminated c-string containing the text and printf-style conversion specifications.
+ *
+ * \param pStorage
+ * Pointer to @ref storage.
+ *
+ * \return
+ * Pointer to the created null-terminated c-string.
+ */
+template <typename... Args>
+std::unique_ptr<char[]> DeferredFormatArgs::Formatter(char const * const pFmt, unsigned char const * const pStorage)
+{
+  return FormatImpl<Args...>(pFmt, pStorage, std::index_sequence_for<Args...>{});
+}
+
+} // namespace log
+} // namespace gpcc
+
+#endif // DEFERREDFORMATARGS_HPP_202610160950
@@ -11,10 +11,12 @@
 #ifndef LOGGER_HPP_201701141240
 #define LOGGER_HPP_201701141240
 
+#include <gpcc/log/DeferredFormatArgs.hpp>
 #include <gpcc/log/log_levels.hpp>
 #include <gpcc/osal/Mutex.hpp>
 #include <gpcc/osal/MutexLocker.hpp>
 #include <gpcc/string/SharedString.hpp>
+#include <gpcc/time/TimePoint.hpp>
 #include <atomic>
 #include <exception>
 #include <string>
@@ -59,6 +61,12 @@ class ILogFacility;
  * - @ref LogTS(LogType const type, std::string const & msg, std::exception_ptr const & ePtr)
  * - @ref LogTS(LogType const type, std::string && msg, std::exception_ptr const & ePtr)
  * - @ref LogVTS(LogType const type, char const * const pFmt, ...)
+ * - @ref LogD(LogType const type, char const * const pFmt, Args const... args)
+ * - @ref LogDTS(LogType const type, char const * const pFmt, Args const... args)
+ *
+ * @ref LogV() and @ref LogVTS() build the log message text on the caller's thread. @ref LogD() and @ref LogDTS()
+ * only capture the format string and the raw values of the arguments and defer building the log message text to
+ * the log facility's thread. See @ref LogD() for details.
  *
  * All Log()-methods will not emit a log message, if the type of the log message (see @ref LogType) is below the
  * log level (see @ref LogLevel) configured at the @ref Logger instance. To prevent building a log message for nothing
@@ -105,6 +113,37 @@ class ILogFacility;
  * The interface @ref ILogFacilityCtrl, which is implemented by any log facility also offers some methods for
  * settings log levels. See @ref ILogFacilityCtrl for details.
  *
+ * # Compile-time log level threshold
+ * In addition to the log level configured at runtime, there is a log level threshold applied at compile time
+ * (@ref compileTimeLogLevel, setup via `-DGPCC_LOG_MIN_LEVEL=<n>` or cmake option `GPCC_LogMinLevel`). Log messages
+ * with a log type below that threshold are always dropped. The log level configured at runtime via
+ * @ref SetLogLevel() and friends is still effective for log types at or above the compile-time threshold.
+ *
+ * @ref IsAboveLevel() considers the compile-time threshold first and it is inlined. If the log type is a constant
+ * expression and below the compile-time threshold, then the compiler can remove the whole log statement including
+ * the atomic load of the log level. This applies to the macros @ref LOG, @ref LOGTS, @ref LOGV, @ref LOGVTS,
+ * @ref LOGD, and @ref LOGDTS, which also skip evaluation of their arguments:
+ *
+ * ~~~{.cpp}
+ * // If built with GPCC_LOG_MIN_LEVEL > 0, then this generates no code at all:
+ * LOG(myLogger, LogType::Debug, "Controller state: " + controller.StateToString());
+ * ~~~
+ *
+ * # Rate limiting
+ * A misbehaving component may flood the log system with log messages. This could fill up the log facility's log
+ * message queue and other log messages would be dropped then. To prevent this, the number of log messages emitted by
+ * a @ref Logger instance can be limited via @ref SetRateLimit().
+ *
+ * Rate limiting uses a token bucket: Each log message consumes one token. The bucket is refilled at the configured
+ * rate and it can hold up to the configured number of tokens (burst size). If the bucket is empty, then log messages
+ * are dropped before they are even created. Dropped log messages are reported to the log facility, which will create
+ * a special log message about not (properly) delivered log messages, just like it does if its log message queue is
+ * full.
+ *
+ * Rate limiting does not apply to log messages of type @ref LogType::Error and @ref LogType::Fatal. They are never
+ * dropped by rate limiting and they do not consume any tokens. Log messages suppressed by the log level do not consume
+ * any tokens either.
+ *
  * # Error handling
  * Errors may occur during any phase of logging:
  * - During preparation of a log message before invocation of a Log()-method
@@ -188,6 +227,8 @@ class Logger final
 
     ILogFacility* GetLogFacility(void) const noexcept;
 
+    void SetRateLimit(uint32_t const maxMsgsPerSec, uint16_t const burstSize);
+
     void Log(LogType const type, char const * const pMsg) noexcept;
     void Log(LogType const type, char const * const pMsg, std::exception_ptr const & ePtr) noexcept;
     void Log(LogType const type, std::string const & msg) noexcept;
@@ -202,6 +243,10 @@ class Logger final
     void LogTS(LogType const type, std::string const & msg, std::exception_ptr const & ePtr) noexcept;
     void LogTS(LogType const type, std::string && msg, std::exception_ptr const & ePtr) noexcept;
     void LogVTS(LogType const type, char const * const pFmt, ...) noexcept;
+    template <typename... Args>
+    void LogD(LogType const type, char const * const pFmt, Args const... args) noexcept;
+    template <typename... Args>
+    void LogDTS(LogType const type, char const * const pFmt, Args const... args) noexcept;
     void LogFailed(void) noexcept;
 
   private:
@@ -222,11 +267,25 @@ class Logger final
     ILogFacility* pLogFacility;
 
 
-    /// Next-pointer for building lists of @ref Logger instances inside the log facility.
-    Logger* pNext;
+    /// Number of ns required to refill the token bucket by one token. Zero = rate limiting disabled.
+    /** @ref mutex is required. */
+    int64_t rateLimitInterval_ns;
+
+    /// Capacity of the token bucket in ns (burst size multiplied by @ref rateLimitInterval_ns).
+    /** @ref mutex is required. */
+    int64_t rateLimitCapacity_ns;
+
+    /// Content of the token bucket in ns. Each log message consumes @ref rateLimitInterval_ns.
+    /** @ref mutex is required. */
+    int64_t rateLimitBudget_ns;
+
+    /// Point in time when the token bucket has been refilled the last time.
+    /** @ref mutex is required. */
+    time::TimePoint rateLimitLastRefill;
 
-    /// Prev-pointer for building lists of @ref Logger instances inside the log facility.
-    Logger* pPrev;
+
+    bool PassRateLimit(LogType const type);
+    void LogDeferred(LogType const type, char const * const pFmt, DeferredFormatArgs const & args, bool const timestamp) noexcept;
 };
 
 /**
@@ -255,7 +314,8 @@ inline std::string const & Logger::GetName(void) const noexcept
 }
 
 /**
- * \brief Tests if a given log type is at or above the log level configured at this log source.
+ * \brief Tests if a given log type is at or above the log level configured at this log source and at or above the
+ *        log level threshold applied at compile time.
  *
  * - - -
  *
@@ -277,11 +337,15 @@ inline std::string const & Logger::GetName(void) const noexcept
  * @ref LogType `type` is at or above the log level configured at the log source.
  *
  * \retval false
- * @ref LogType `type` is below the log level configured at the log source. `Log()` and `LogTS()`
- * will drop any log message with this @ref LogType value.
+ * @ref LogType `type` is below the log level configured at the log source or below the log level threshold applied
+ * at compile time (@ref compileTimeLogLevel). `Log()` and `LogTS()` will drop any log message with this @ref LogType
+ * value.
  */
 inline bool Logger::IsAboveLevel(LogType const type) const noexcept
 {
+  if (!IsEnabledAtCompileTime(type))
+    return false;
+
   LogLevel const _level = level;
   return (static_cast<uint8_t>(type) >= static_cast<uint8_t>(_level));
 }
@@ -339,6 +403,206 @@ inline void Logger::SetLogLevel(LogLevel const _level) noexcept
   level = _level;
 }
 
+/**
+ * \brief Logs a message. Message type: printf-style format string located in ROM/code memory plus arguments.
+ *        Building the message text is deferred to the log facility.
+ *
+ * In contrast to @ref LogV(), this neither builds the log message text nor allocates any memory for the log message
+ * text on the caller's thread. Instead, the pointer to the format string and the raw values of the arguments are
+ * captured into a compact binary record (@ref DeferredFormatArgs). The log message text is built by the log
+ * facility's thread before the message is passed to the back-ends. This keeps the cost of logging low for
+ * latency-sensitive threads.
+ *
+ * The types of the arguments are checked at compile time. Only arithmetic types and pointers are supported.
+ * Passing e.g. an `std::string` results in a compile-time error.
+ *
+ * Note that pointers are captured, but not the referenced data. Strings passed for `%s` must therefore be located in
+ * ROM/code memory and must not change, just like the format string itself.
+ *
+ * Example:
+ * ~~~{.cpp}
+ * // Option 1
+ * logger.LogD(LogType::Debug, "'someValue' = %u", static_cast<unsigned int>(someValue));
+ *
+ * // Option 2
+ * LOGD(logger, LogType::Debug, "'someValue' = %u", static_cast<unsigned int>(someValue));
+ * ~~~
+ *
+ * __Format specifiers:__\n
+ * Please refer to [this](@ref gpcc::string::VASPrintf).
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \tparam Args
+ * Types of the arguments. Only arithmetic types and pointers are supported.\n
+ * The total size of the arguments must not exceed @ref DeferredFormatArgs::storageSize.
+ *
+ * \param type
+ * Type of log message. See @ref LogType for details.\n
+ * If this is below the log level configured at this @ref Logger instance, then this method will do nothing.
+ *
+ * \param pFmt
+ * Pointer to a null-terminated c-string located in ROM/code memory containing the log message text and printf-style
+ * conversion specifications that control how the arguments shall be converted and integrated into the log message
+ * text.\n
+ * Details about format specifiers are [here](@ref gpcc::string::VASPrintf).
+ *
+ * \param args
+ * Arguments that shall be printed. The number and type of arguments must match the conversion specifiers embedded in
+ * `pFmt`.
+ */
+template <typename... Args>
+void Logger::LogD(LogType const type, char const * const pFmt, Args const... args) noexcept
+{
+  if (!IsAboveLevel(type))
+    return;
+
+  LogDeferred(type, pFmt, DeferredFormatArgs::Capture(args...), false);
+}
+
+/**
+ * \brief Logs a message. Message type: printf-style format string located in ROM/code memory plus arguments plus
+ *        timestamp. Building the message text is deferred to the log facility.
+ *
+ * This is the same as @ref LogD(), but the log message will contain a timestamp.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \tparam Args
+ * Types of the arguments. Only arithmetic types and pointers are supported.\n
+ * The total size of the arguments must not exceed @ref DeferredFormatArgs::storageSize.
+ *
+ * \param type
+ * Type of log message. See @ref LogType for details.\n
+ * If this is below the log level configured at this @ref Logger instance, then this method will do nothing.
+ *
+ * \param pFmt
+ * Pointer to a null-terminated c-string located in ROM/code memory containing the log message text and printf-style
+ * conversion specifications that control how the arguments shall be converted and integrated into the log message
+ * text.\n
+ * Details about format specifiers are [here](@ref gpcc::string::VASPrintf).
+ *
+ * \param args
+ * Arguments that shall be printed. The number and type of arguments must match the conversion specifiers embedded in
+ * `pFmt`.
+ */
+template <typename... Args>
+void Logger::LogDTS(LogType const type, char const * const pFmt, Args const... args) noexcept
+{
+  if (!IsAboveLevel(type))
+    return;
+
+  LogDeferred(type, pFmt, DeferredFormatArgs::Capture(args...), true);
+}
+
+/**
+ * \ingroup GPCC_LOG
+ * \brief Macro for invocation of [Logger::Log()](@ref gpcc::log::Logger::Log).\n
+ *        The arguments will only be evaluated and Log() will only be invoked if the log type is equal to or above
+ *        the log level threshold configured at the logger.
+ *
+ * If `type` is a constant expression below the log level threshold applied at compile time
+ * ([compileTimeLogLevel](@ref gpcc::log::compileTimeLogLevel)), then the compiler removes the whole statement.
+ *
+ * Any exception thrown during evaluation of the arguments (e.g. `std::bad_alloc` while building an `std::string`)
+ * is caught and reported via [Logger::LogFailed()](@ref gpcc::log::Logger::LogFailed).
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \param logger
+ * Reference to logger instance that shall be used to log the message.
+ *
+ * \param type
+ * Type of log message. See [LogType](@ref gpcc::log::LogType) for details.\n
+ * If this is below the log level configured at `logger`, then this method will do nothing.
+ *
+ * \param ...
+ * Arguments passed to [Logger::Log()](@ref gpcc::log::Logger::Log) after `type`, e.g. a log message text or a
+ * log message text plus an `std::exception_ptr`.
+ */
+#define LOG(logger, type, ...) \
+do { \
+  if ((logger).IsAboveLevel(type)) { \
+    try { (logger).Log((type), __VA_ARGS__); } \
+    catch (std::exception const &) { (logger).LogFailed(); } \
+} } while(false)
+
+/**
+ * \ingroup GPCC_LOG
+ * \brief Macro for invocation of [Logger::LogTS()](@ref gpcc::log::Logger::LogTS).\n
+ *        The arguments will only be evaluated and LogTS() will only be invoked if the log type is equal to or above
+ *        the log level threshold configured at the logger.
+ *
+ * If `type` is a constant expression below the log level threshold applied at compile time
+ * ([compileTimeLogLevel](@ref gpcc::log::compileTimeLogLevel)), then the compiler removes the whole statement.
+ *
+ * Any exception thrown during evaluation of the arguments (e.g. `std::bad_alloc` while building an `std::string`)
+ * is caught and reported via [Logger::LogFailed()](@ref gpcc::log::Logger::LogFailed).
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \param logger
+ * Reference to logger instance that shall be used to log the message.
+ *
+ * \param type
+ * Type of log message. See [LogType](@ref gpcc::log::LogType) for details.\n
+ * If this is below the log level configured at `logger`, then this method will do nothing.
+ *
+ * \param ...
+ * Arguments passed to [Logger::LogTS()](@ref gpcc::log::Logger::LogTS) after `type`, e.g. a log message text or a
+ * log message text plus an `std::exception_ptr`.
+ */
+#define LOGTS(logger, type, ...) \
+do { \
+  if ((logger).IsAboveLevel(type)) { \
+    try { (logger).LogTS((type), __VA_ARGS__); } \
+    catch (std::exception const &) { (logger).LogFailed(); } \
+} } while(false)
+
 /**
  * \ingroup GPCC_LOG
  * \brief Macro for invocation of [Logger::LogV()](@ref gpcc::log::Logger::LogV).\n
@@ -425,6 +689,92 @@ do { \
     (logger).LogVTS((type), pFmt, __VA_ARGS__); \
 } } while(false)
 
+/**
+ * \ingroup GPCC_LOG
+ * \brief Macro for invocation of [Logger::LogD()](@ref gpcc::log::Logger::LogD).\n
+ *        The arguments will only be evaluated and LogD() will only be invoked if the log type is equal to or above
+ *        the log level threshold configured at the logger.
+ *
+ * For details on usage, please refer to [Logger::LogD()](@ref gpcc::log::Logger::LogD).
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \param logger
+ * Reference to logger instance that shall be used to log the message.
+ *
+ * \param type
+ * Type of log message. See [LogType](@ref gpcc::log::LogType) for details.\n
+ * If this is below the log level configured at `logger`, then this method will do nothing.
+ *
+ * \param pFmt
+ * Pointer to a null-terminated c-string located in ROM/code memory containing the log message text and printf-style
+ * conversion specifications that control how the arguments shall be converted and integrated into the log message
+ * text.
+ *
+ * \param ...
+ * Arguments that shall be printed. The number and type of arguments must match the conversion specifiers embedded in
+ * `pFmt`.
+ */
+#define LOGD(logger, type, pFmt, ...) \
+do { \
+  if ((logger).IsAboveLevel(type)) { \
+    (logger).LogD((type), pFmt, __VA_ARGS__); \
+} } while(false)
+
+/**
+ * \ingroup GPCC_LOG
+ * \brief Macro for invocation of [Logger::LogDTS()](@ref gpcc::log::Logger::LogDTS).\n
+ *        The arguments will only be evaluated and LogDTS() will only be invoked if the log type is equal to or
+ *        above the log level threshold configured at the logger.
+ *
+ * For details on usage, please refer to [Logger::LogDTS()](@ref gpcc::log::Logger::LogDTS).
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \param logger
+ * Reference to logger instance that shall be used to log the message.
+ *
+ * \param type
+ * Type of log message. See [LogType](@ref gpcc::log::LogType) for details.\n
+ * If this is below the log level configured at `logger`, then this method will do nothing.
+ *
+ * \param pFmt
+ * Pointer to a null-terminated c-string located in ROM/code memory containing the log message text and printf-style
+ * conversion specifications that control how the arguments shall be converted and integrated into the log message
+ * text.
+ *
+ * \param ...
+ * Arguments that shall be printed. The number and type of arguments must match the conversion specifiers embedded in
+ * `pFmt`.
+ */
+#define LOGDTS(logger, type, pFmt, ...) \
+do { \
+  if ((logger).IsAboveLevel(type)) { \
+    (logger).LogDTS((type), pFmt, __VA_ARGS__); \
+} } while(false)
+
 } // namespace log
 } // namespace gpcc
 
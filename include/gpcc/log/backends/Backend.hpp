@@ -18,6 +18,8 @@
 namespace gpcc {
 namespace log  {
 
+struct LogRecord;
+
 /**
  * \ingroup GPCC_LOG_BACKENDS
  * \brief Base class for log facility back-ends.
@@ -33,6 +35,11 @@ namespace log  {
  * particular back-end does. Back-ends could also filter log messages, e.g. a back-end could only write
  * error-messages to a file.
  *
+ * Back-ends may declare themselves as _structured_ back-ends by overriding @ref IsStructured(). Log messages that are
+ * available in unformatted form (see @ref LogRecord) are then offered to the back-end via @ref ProcessRecord() instead
+ * of @ref Process(). This allows to skip text formatting. All other log messages are still offered via
+ * @ref Process().
+ *
  * - - -
  *
  *  __Thread safety:__\n
@@ -53,6 +60,9 @@ class Backend
 
     virtual void Process(std::string const & msg, LogType const type) = 0;
 
+    virtual bool IsStructured(void) const noexcept;
+    virtual void ProcessRecord(LogRecord const & record);
+
   protected:
     Backend(void) noexcept;
     virtual ~Backend(void) = default;
@@ -94,6 +104,31 @@ class Backend
  * Log message type. Allows for filtering, if the back-end supports filtering.
  */
 
+/**
+ * \fn void Backend::ProcessRecord(LogRecord const & record)
+ * \brief Processes a log message offered in unformatted form.
+ *
+ * This is only invoked by log facilities, if @ref IsStructured() returns true.\n
+ * The default implementation throws `std::logic_error`.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * The state of the object is modified. Any concurrent accesses are not safe.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Basic guarantee:
+ * - Log message processing may be incomplete.
+ *
+ * - - -
+ *
+ * \param record
+ * Ingredients of the log message. The referenced data is only valid during this call.
+ */
+
 } // namespace log
 } // namespace gpcc
 
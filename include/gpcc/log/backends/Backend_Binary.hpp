@@ -0,0 +1,128 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#ifndef BACKEND_BINARY_HPP_202610162020
+#define BACKEND_BINARY_HPP_202610162020
+
+#include <gpcc/log/backends/Backend.hpp>
+#include <string>
+#include <unordered_map>
+#include <cstdint>
+
+namespace gpcc {
+
+namespace stream
+{
+  class IStreamWriter;
+}
+
+namespace log {
+
+/**
+ * \ingroup GPCC_LOG_BACKENDS
+ * \brief Log facility back-end which writes log messages in a compact binary format into a stream.
+ *
+ * This is a structured back-end (see [Backend::IsStructured()](@ref Backend::IsStructured)). Log messages created via
+ * [Logger::LogD()](@ref Logger::LogD) and [Logger::LogDTS()](@ref Logger::LogDTS) are written without formatting:
+ * Source name ID, @ref LogType, optional timestamp, format string ID, and the raw values of the arguments. Source
+ * names and format strings are written only once, when they are used for the first time. All other log messages are
+ * written as text.
+ *
+ * Binary log files can be converted back into text using @ref BinaryLogDecoder, e.g. via the tool
+ * `gpcc_log_decoder` (see CMake option `GPCC_BuildLogDecoder`).
+ *
+ * Format strings are identified by their address. This is fine, because format strings passed to
+ * [Logger::LogD()](@ref Logger::LogD) must be located in ROM/code memory.
+ *
+ * # Binary format
+ * All data is encoded in little endian.
+ *
+ * The stream starts with a header:
+ * - 8 characters: "GPCCBLOG"
+ * - uint8_t: Version (@ref version)
+ *
+ * The header is followed by records. Each record starts with a uint8_t tag (see @ref RecordTags):
+ * - @ref RecordTags::srcNameDef: uint32_t ID, null-terminated string
+ * - @ref RecordTags::fmtStringDef: uint32_t ID, null-terminated string
+ * - @ref RecordTags::message: uint8_t @ref LogType, uint32_t source name ID, uint8_t flags (bit 0: timestamp
+ *   present), [int64_t seconds, int32_t nanoseconds], uint32_t format string ID, uint8_t number of arguments,
+ *   arguments
+ * - @ref RecordTags::textMessage: uint8_t @ref LogType, null-terminated string with the complete log message text
+ *
+ * Each argument is encoded as uint8_t type code followed by the value. Type codes are the same as in
+ * [DeferredFormatArgs::GetTypeSignature()](@ref DeferredFormatArgs::GetTypeSignature), except that floating point
+ * values are always encoded as `double` ('d'), strings ('s') are encoded as null-terminated string, and other
+ * pointers ('p') are encoded as uint64_t.
+ *
+ * # Error handling
+ * If writing to the stream fails, then the exception thrown by the stream is forwarded to the log facility, which
+ * will treat the log message as not properly delivered. The stream is usually in an error state afterwards and the
+ * written data is not consistent any more.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * Not thread safe, but non-modifying concurrent access is safe.\n
+ * The stream passed to the constructor must not be accessed by anyone else while this back-end exists.
+ */
+class Backend_Binary final : public Backend
+{
+  public:
+    /// Version of the binary format.
+    static constexpr uint8_t version = 1U;
+
+    /// Tags of the records in the binary format.
+    enum class RecordTags : uint8_t
+    {
+      srcNameDef   = 1U,  ///<Definition of a source name ID.
+      fmtStringDef = 2U,  ///<Definition of a format string ID.
+      message      = 3U,  ///<Log message with format string ID and arguments.
+      textMessage  = 4U   ///<Log message as text.
+    };
+
+    /// Magic characters at the beginning of the stream.
+    static constexpr char magic[8] = { 'G', 'P', 'C', 'C', 'B', 'L', 'O', 'G' };
+
+
+    Backend_Binary(void) = delete;
+    explicit Backend_Binary(gpcc::stream::IStreamWriter & _writer);
+    Backend_Binary(Backend_Binary const &) = delete;
+    Backend_Binary(Backend_Binary &&) = delete;
+    ~Backend_Binary(void) = default;
+
+    Backend_Binary& operator=(Backend_Binary const &) = delete;
+    Backend_Binary& operator=(Backend_Binary &&) = delete;
+
+    // <-- Backend
+    void Process(std::string const & msg, LogType const type) override;
+    bool IsStructured(void) const noexcept override;
+    void ProcessRecord(LogRecord const & record) override;
+    // --> Backend
+
+  private:
+    /// Stream into which the binary log is written.
+    gpcc::stream::IStreamWriter & writer;
+
+    /// IDs of source names which have been written to @ref writer.
+    std::unordered_map<std::string, uint32_t> srcNameIDs;
+
+    /// IDs of format strings which have been written to @ref writer. Key is the address of the format string.
+    std::unordered_map<char const *, uint32_t> fmtStringIDs;
+
+
+    uint32_t GetSrcNameID(std::string const & srcName);
+    uint32_t GetFmtStringID(char const * const pFmt);
+    void WriteArgs(LogRecord const & record);
+};
+
+} // namespace log
+} // namespace gpcc
+
+#endif // BACKEND_BINARY_HPP_202610162020
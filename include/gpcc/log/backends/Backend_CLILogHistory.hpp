@@ -13,9 +13,8 @@
 
 #include <gpcc/log/backends/Backend.hpp>
 #include <gpcc/osal/Mutex.hpp>
-#include <list>
+#include <memory>
 #include <string>
-#include <utility>
 #include <cstddef>
 #include <cstdint>
 
@@ -59,18 +58,19 @@ namespace log {
  * Values for both limitations must be passed to the constructor upon object creation. Using two limitations
  * allows the user to limit the _number of recorded messages_ and the _memory_ occupied by them.
  *
+ * The ring buffer is a single contiguous block of memory allocated by the constructor. Each recorded log message is
+ * stored as a record comprised of a small header (log type and length) and the text of the log message. The size of
+ * the block is the maximum number of bytes for the text of the log messages plus the size of the headers for the
+ * maximum number of log messages. Recording a log message copies the text into the ring buffer and removing old
+ * log messages just advances the read position. No memory is allocated or released per log message.
+ *
  * # Additional status information
- * In addition to the log message buffer, this class implements additional attributes that provide additional
- * status information:
- * - Flag `oldMessagesRemoved`:\n
- *   This is set when a old log message is removed from the log message buffer in order to make room for a new log
- *   message. This indicates, that there have been more log messages than currently stored in the log message buffer.
- * - Counter `nbOfDroppedMessages`:\n
- *   This is incremented each time a log message could not be recorded due to an error (most likely an out-of-memory
- *   condition).
+ * In addition to the log message buffer, this class implements a flag `oldMessagesRemoved`. The flag is set when a
+ * old log message is removed from the log message buffer in order to make room for a new log message. This indicates,
+ * that there have been more log messages than currently stored in the log message buffer.
  *
- * Both the flag and the counter are reset each time the log message buffer is cleared either via CLI command
- * "LogHistory" or via @ref Clear().
+ * The flag is reset each time the log message buffer is cleared either via CLI command "LogHistory" or via
+ * @ref Clear().
  *
  * The additional status information is printed to CLI or exported together with the recorded log messages each time
  * the recorded log messages are exported or displayed.
@@ -104,8 +104,8 @@ class Backend_CLILogHistory final : public Backend
     /// specify the number of messages to be printed.
     static uint16_t const askBeforePrintThreshold = 128U;
 
-    /// Type definition for an item in the message buffer.
-    typedef std::pair<LogType,std::string> tBufferItem;
+    /// Size of the header of a record in the ring buffer in bytes: log type (1 byte) plus length of the text.
+    static size_t const headerSize = 1U + sizeof(size_t);
 
 
     /// Mutex used to make this class thread-safe.
@@ -118,10 +118,15 @@ class Backend_CLILogHistory final : public Backend
     /// Maximum number of messages in the buffer.
     uint16_t const maxNbOfMessages;
 
+    /// Size of the ring buffer in bytes.
+    size_t const ringSize;
+
+    /// Ring buffer containing the recorded log messages.
+    /** @ref mutex is required.\n
+        Each record is comprised of a header of @ref headerSize bytes followed by the text of the log message. Records
+        may wrap around the end of the ring buffer. */
+    std::unique_ptr<char[]> spRing;
 
-    /// Number of messages that could not be recorded due to an error (e.g. std::bad_alloc) since last buffer clear.
-    /** @ref mutex is required. */
-    uint8_t nbOfDroppedMessages;
 
     /// Flag indicating that at least one old message has been removed from the buffer since last buffer clear.
     /** @ref mutex is required. */
@@ -131,19 +136,29 @@ class Backend_CLILogHistory final : public Backend
     /** @ref mutex is required. */
     size_t remainingStorage;
 
-    /// The recorded log messages.
-    /** @ref mutex is required.\n
-        New messages are inserted at the back, old messages are removed at the front. */
-    std::list<tBufferItem> messages;
+    /// Number of recorded log messages.
+    /** @ref mutex is required. */
+    uint16_t nbOfMessages;
+
+    /// Position of the oldest record in @ref spRing.
+    /** @ref mutex is required. */
+    size_t readPos;
+
+    /// Position in @ref spRing where the next record will be written.
+    /** @ref mutex is required. */
+    size_t writePos;
 
 
     void UnprotectedClear(void) noexcept;
     void RemoveMessage(void) noexcept;
     void RemoveMessages(size_t const requiredRemainingStorage) noexcept;
 
-    std::string BuildWarningForDroppedMessages(void) const;
+    size_t Wrap(size_t const pos) const noexcept;
+    void WriteToRing(void const * const pData, size_t const n) noexcept;
+    void ReadFromRing(size_t const pos, void * const pData, size_t const n) const noexcept;
+    size_t ReadHeader(size_t const pos, LogType & type, size_t & length) const noexcept;
 
-    static void PrintBufferItem(uint_fast16_t const n, tBufferItem const & item, gpcc::cli::CLI & cli);
+    void PrintRecord(uint_fast16_t const n, size_t const pos, gpcc::cli::CLI & cli) const;
 
     void CLICMD_LogHistory(std::string const & restOfLine, gpcc::cli::CLI & cli);
 };
@@ -0,0 +1,228 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#ifndef BACKEND_FILE_HPP_202610161845
+#define BACKEND_FILE_HPP_202610161845
+
+#include <gpcc/log/backends/Backend.hpp>
+#include <gpcc/osal/ConditionVariable.hpp>
+#include <gpcc/osal/Mutex.hpp>
+#include <gpcc/osal/Thread.hpp>
+#include <memory>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+
+namespace gpcc {
+
+namespace file_systems
+{
+  class IFileStorage;
+}
+
+namespace stream
+{
+  class IStreamWriter;
+}
+
+namespace log {
+
+/**
+ * \ingroup GPCC_LOG_BACKENDS
+ * \brief Log facility back-end which writes log messages into a set of rotating files.
+ *
+ * Files are accessed via a [IFileStorage](@ref gpcc::file_systems::IFileStorage) interface. Log messages can
+ * therefore be written into any file system offered by GPCC, e.g.
+ * [linux_fs::FileStorage](@ref gpcc::file_systems::linux_fs::FileStorage) for plain files in a directory of the host.
+ *
+ * # Buffering
+ * This back-end has an own thread which writes to the file. @ref Process() never accesses the file system. Instead
+ * it appends the log message and a '\\n' to an _active buffer_. There is a second buffer which is written to the file
+ * by the back-end's thread. If the active buffer is full and the back-end's thread is idle, then the buffers are
+ * swapped and the back-end's thread is woken up. Both buffers are allocated upon construction, so @ref Process() does
+ * not allocate any memory.
+ *
+ * The back-end's thread also swaps the buffers and writes the content of the active buffer to the file, if the active
+ * buffer is not empty and...
+ * - ...the flush interval passed to the constructor has expired, or
+ * - ...@ref Flush() is invoked, or
+ * - ...@ref Stop() is invoked.
+ *
+ * Log messages are therefore written in large chunks, which is more efficient than writing each message separately.
+ *
+ * If a log message does not fit into the active buffer and the buffers cannot be swapped because the back-end's
+ * thread is still busy writing the other buffer, then the log message is dropped. The number of dropped log messages
+ * is recorded and a note is written to the file after the next chunk of log messages.\n
+ * Log messages which could not be written due to an error (e.g. file system full) are treated as dropped log messages
+ * as well.
+ *
+ * Log messages which are longer than the size of the buffers are truncated.
+ *
+ * # File rotation
+ * The log file has the base name passed to the constructor. Older log files are named `<base name>.1`,
+ * `<base name>.2`, and so on. The number of files is limited by a parameter passed to the constructor. If the limit is
+ * reached, then the oldest file is deleted.
+ *
+ * Files are rotated...
+ * - ...upon @ref Start(). Each start of the back-end therefore begins with a new log file.
+ * - ...if writing a chunk of log messages would let the current log file exceed the maximum file size passed to the
+ *   constructor.
+ * - ...upon the first write after a write error.
+ *
+ * A log file is only closed when the back-end is stopped or the files are rotated. The latest log file should
+ * therefore not be accessed while the back-end is running.
+ *
+ * # Usage
+ * ~~~{.cpp}
+ * gpcc::file_systems::linux_fs::FileStorage fs("/var/log/myapp/");
+ * gpcc::log::Backend_File backend(fs, "myapp.log", 64UL * 1024UL, 1000U, 1024UL * 1024UL, 4U, "LogFile");
+ *
+ * backend.Start(gpcc::osal::Thread::SchedPolicy::Other, 0U, gpcc::osal::Thread::GetDefaultStackSize());
+ * logFacility.Register(backend);
+ *
+ * // ...
+ *
+ * logFacility.Unregister(backend);
+ * backend.Stop();
+ * ~~~
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * Thread-safe.
+ */
+class Backend_File final : public Backend
+{
+  public:
+    Backend_File(void) = delete;
+    Backend_File(gpcc::file_systems::IFileStorage & _fs,
+                 std::string const & _baseName,
+                 size_t const _bufferSize,
+                 uint32_t const _flushInterval_ms,
+                 size_t const _maxFileSize,
+                 uint8_t const _maxNbOfFiles,
+                 char const * const pThreadName);
+    Backend_File(Backend_File const &) = delete;
+    Backend_File(Backend_File &&) = delete;
+    ~Backend_File(void);
+
+    Backend_File& operator=(Backend_File const &) = delete;
+    Backend_File& operator=(Backend_File &&) = delete;
+
+    void Start(gpcc::osal::Thread::SchedPolicy const schedPolicy,
+               gpcc::osal::Thread::priority_t const priority,
+               size_t const stackSize);
+    void Stop(void) noexcept;
+    void Flush(void);
+
+    // <-- Backend
+    void Process(std::string const & msg, LogType const type) override;
+    // --> Backend
+
+  private:
+    /// File storage containing the log files.
+    gpcc::file_systems::IFileStorage & fs;
+
+    /// Name of the current log file.
+    std::string const baseName;
+
+    /// Size of each of the two buffers in bytes.
+    size_t const bufferSize;
+
+    /// Interval in ms after which the content of the active buffer is written to the file.
+    uint32_t const flushInterval_ms;
+
+    /// Maximum size of a log file in bytes.
+    size_t const maxFileSize;
+
+    /// Maximum number of log files (current log file plus older log files).
+    uint8_t const maxNbOfFiles;
+
+
+    /// Mutex used to make this class thread-safe.
+    gpcc::osal::Mutex mutex;
+
+    /// Condition variable signaled when there is work for @ref thread.
+    /** This is to be used in conjunction with @ref mutex. */
+    gpcc::osal::ConditionVariable workCV;
+
+    /// Condition variable signaled when @ref thread has written a chunk of log messages.
+    /** This is to be used in conjunction with @ref mutex. */
+    gpcc::osal::ConditionVariable writtenCV;
+
+    /// Flag indicating if the back-end's thread is running.
+    /** @ref mutex is required. */
+    bool running;
+
+    /// Buffer collecting new log messages.
+    /** @ref mutex is required. */
+    std::string activeBuffer;
+
+    /// Number of log messages in @ref activeBuffer.
+    /** @ref mutex is required. */
+    uint32_t activeBufferNbOfMsgs;
+
+    /// Buffer which is written to the file by @ref thread.
+    /** @ref mutex is required.\n
+        While @ref nbOfSwaps and @ref nbOfWrittenChunks are not equal, this is accessed by @ref thread only and
+        @ref mutex is not required. */
+    std::string writeBuffer;
+
+    /// Number of log messages in @ref writeBuffer.
+    /** Same access rules as for @ref writeBuffer. */
+    uint32_t writeBufferNbOfMsgs;
+
+    /// Number of log messages dropped before the content of @ref writeBuffer was swapped out of @ref activeBuffer.
+    /** Same access rules as for @ref writeBuffer. */
+    uint32_t writeBufferDroppedMsgs;
+
+    /// Flag indicating that @ref Flush() requests that the active buffer is written to the file immediately.
+    /** @ref mutex is required. */
+    bool flushRequested;
+
+    /// Number of log messages dropped since the last swap of the buffers (saturating).
+    /** @ref mutex is required. */
+    uint32_t droppedMessages;
+
+    /// Number of swaps of the buffers.
+    /** @ref mutex is required. */
+    uint64_t nbOfSwaps;
+
+    /// Number of chunks written (or attempted to write) by @ref thread.
+    /** @ref mutex is required. */
+    uint64_t nbOfWrittenChunks;
+
+
+    /// Current log file. nullptr, if no log file is open.
+    /** This is accessed by @ref thread only. */
+    std::unique_ptr<gpcc::stream::IStreamWriter> spFile;
+
+    /// Number of bytes written to the current log file.
+    /** This is accessed by @ref thread only. */
+    size_t currentFileSize;
+
+
+    /// The back-end's thread.
+    gpcc::osal::Thread thread;
+
+
+    void SwapBuffers(void) noexcept;
+    uint32_t WriteChunk(void);
+    void OpenNewFile(void);
+    void CloseFile(void) noexcept;
+    std::string BuildFileName(uint_fast8_t const index) const;
+
+    void* InternalThreadEntry(void) noexcept;
+};
+
+} // namespace log
+} // namespace gpcc
+
+#endif // BACKEND_FILE_HPP_202610161845
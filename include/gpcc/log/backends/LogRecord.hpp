@@ -0,0 +1,64 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#ifndef LOGRECORD_HPP_202610162010
+#define LOGRECORD_HPP_202610162010
+
+#include <gpcc/log/log_levels.hpp>
+#include <gpcc/time/TimePoint.hpp>
+#include <string>
+
+namespace gpcc {
+namespace log  {
+
+class DeferredFormatArgs;
+
+/**
+ * \ingroup GPCC_LOG_BACKENDS
+ * \brief Unformatted ingredients of a log message, offered to structured back-ends.
+ *
+ * Log facilities offer log messages created via [Logger::LogD()](@ref Logger::LogD) and
+ * [Logger::LogDTS()](@ref Logger::LogDTS) to back-ends whose [Backend::IsStructured()](@ref Backend::IsStructured)
+ * returns true as @ref LogRecord instead of a text string. This allows back-ends to store or transmit log messages
+ * without formatting them.
+ *
+ * All pointers refer to data owned by the log facility. They are only valid during the call to
+ * [Backend::ProcessRecord()](@ref Backend::ProcessRecord).
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * Not thread safe, but non-modifying concurrent access is safe.
+ */
+struct LogRecord final
+{
+  /// Name of the log source.
+  std::string const * pSrcName;
+
+  /// Type of the log message.
+  LogType type;
+
+  /// Flag indicating if @ref timestamp is valid.
+  bool hasTimestamp;
+
+  /// Timestamp (clock: realtimeCoarse). Only valid if @ref hasTimestamp is true.
+  gpcc::time::TimePoint timestamp;
+
+  /// printf-style format string located in ROM/code memory.
+  char const * pFmt;
+
+  /// Raw values of the arguments referenced by @ref pFmt.
+  DeferredFormatArgs const * pArgs;
+};
+
+} // namespace log
+} // namespace gpcc
+
+#endif // LOGRECORD_HPP_202610162010
@@ -70,6 +70,57 @@ enum class LogLevel
   Nothing               = 5,  ///<Logs __nothing__.
 };
 
+#ifndef GPCC_LOG_MIN_LEVEL
+#define GPCC_LOG_MIN_LEVEL 0
+#endif
+
+static_assert((GPCC_LOG_MIN_LEVEL >= 0) && (GPCC_LOG_MIN_LEVEL <= 5), "GPCC_LOG_MIN_LEVEL: Invalid value.");
+
+/**
+ * \ingroup GPCC_LOG
+ * \brief Log level threshold applied at compile time.
+ *
+ * Log messages with a log type below this threshold are dropped by any @ref Logger, regardless of the log level
+ * configured at the @ref Logger instance. If the log type is a constant expression, then the compiler removes the
+ * invocation of the logging macros (@ref LOG, @ref LOGV, @ref LOGD, ...) including evaluation of their arguments
+ * completely.
+ *
+ * The threshold is setup via `-DGPCC_LOG_MIN_LEVEL=<n>` (n = numeric value of @ref LogLevel). It is
+ * @ref LogLevel::DebugOrAbove if `GPCC_LOG_MIN_LEVEL` is not defined. When using cmake, then `GPCC_LOG_MIN_LEVEL`
+ * is setup according to the cmake option `GPCC_LogMinLevel`.\n
+ * The definition must be the same for GPCC and for any code including GPCC's headers.
+ */
+LogLevel constexpr compileTimeLogLevel = static_cast<LogLevel>(GPCC_LOG_MIN_LEVEL);
+
+/**
+ * \ingroup GPCC_LOG
+ * \brief Determines if a @ref LogType is at or above the log level threshold applied at compile time
+ *        (@ref compileTimeLogLevel).
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \param type
+ * @ref LogType that shall be tested.
+ *
+ * \retval true   Log messages of type `type` may be logged.
+ * \retval false  Log messages of type `type` will always be dropped.
+ */
+constexpr bool IsEnabledAtCompileTime(LogType const type) noexcept
+{
+  return (static_cast<int>(type) >= static_cast<int>(compileTimeLogLevel));
+}
+
 /**
  * \ingroup GPCC_LOG
  * \brief Length of any log message header string returned by @ref LogType2LogMsgHeader().
@@ -34,6 +34,8 @@ namespace internal
  * - pass [LogMessage](@ref gpcc::log::internal::LogMessage) objects (from an [Logger](@ref gpcc::log::Logger) instance)
  *   to the log facility for logging
  * - report errors that occurred during log message creation (e.g. std::bad_alloc) to the log facility for logging
+ * - report log messages dropped by a [Logger](@ref gpcc::log::Logger) instance (e.g. due to rate limiting) to the
+ *   log facility for logging
  *
  * Note that one and the same [Logger](@ref gpcc::log::Logger) instance can only be registered at one log facility.\n
  * The other way round, multiple different [Logger](@ref gpcc::log::Logger) instances can be registered at one and
@@ -60,6 +62,7 @@ class ILogFacility
 
     virtual void Log(std::unique_ptr<internal::LogMessage> spMsg) = 0;
     virtual void ReportLogMessageCreationFailed(void) noexcept = 0;
+    virtual void ReportLogMessageDropped(void) noexcept = 0;
 
   protected:
     virtual ~ILogFacility(void) = default;
@@ -214,6 +217,28 @@ class ILogFacility
  * No cancellation point included.
  */
 
+/**
+ * \fn void ILogFacility::ReportLogMessageDropped(void)
+ * \brief Reports that a [Logger](@ref gpcc::log::Logger) instance has dropped a log message, e.g. due to rate
+ *        limiting.
+ *
+ * This is intended to be invoked by [Logger](@ref gpcc::log::Logger) instances only.
+ *
+ * The log facility shall treat the dropped log message like a log message dropped due to limited capacity of the log
+ * facility itself.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ */
+
 } // namespace log
 } // namespace gpcc
 
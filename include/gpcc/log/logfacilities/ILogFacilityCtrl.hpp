@@ -13,6 +13,7 @@
 
 #include <gpcc/log/log_levels.hpp>
 #include <string>
+#include <cstddef>
 #include <tuple>
 #include <vector>
 
@@ -29,6 +30,7 @@ namespace log  {
  * - set the log level of a specific log source.
  * - ensure a minimum log level for a specific log source.
  * - ensure a maximum log level for a specific log source.
+ * - set the log level of all log sources whose names match a pattern.
  * - setup default settings for new @ref Logger instances registered at the log facility.
  * - remove previously setup default settings for new @ref Logger instances.
  *
@@ -49,6 +51,7 @@ class ILogFacilityCtrl
     virtual bool SetLogLevel(std::string const & srcName, LogLevel const level) = 0;
     virtual bool LowerLogLevel(std::string const & srcName, LogLevel const level) = 0;
     virtual bool RaiseLogLevel(std::string const & srcName, LogLevel const level) = 0;
+    virtual size_t SetLogLevelByPattern(std::string const & pattern, LogLevel const level) = 0;
 
     virtual void SetDefaultSettings(std::vector<tLogSrcConfig> _defaultSettings) = 0;
     virtual std::vector<tLogSrcConfig> RemoveDefaultSettings(void) = 0;
@@ -198,6 +201,43 @@ class ILogFacilityCtrl
  * false = log source `srcName` not found
  */
 
+/**
+ * \fn size_t ILogFacilityCtrl::SetLogLevelByPattern(std::string const & pattern, gpcc::log::LogLevel const level)
+ * \brief Sets the log level of all log sources whose names match a pattern.
+ *
+ * The pattern is evaluated using [TestSimplePatternMatch()](@ref gpcc::string::TestSimplePatternMatch) (case
+ * sensitive). Example: "cood.*" matches all log sources whose names start with "cood.".
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * \throws std::invalid_argument   Invalid pattern (see [TestSimplePatternMatch()](@ref gpcc::string::TestSimplePatternMatch)).
+ *                                 Note that errors in the pattern may not be detected, if there is no log source
+ *                                 that requires examination of the erroneous part of the pattern.
+ *
+ * \throws std::bad_alloc          Out-of-memory.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \param pattern
+ * Pattern that shall be matched against the names of the log sources.\n
+ * The pattern may contain wildcards ('*' = any string, '?' = any character).
+ *
+ * \param level
+ * New log level.
+ *
+ * \return
+ * Number of log sources whose names matched the pattern. Their log level has been set to `level`.
+ */
+
 /**
  * \fn void ILogFacilityCtrl::SetDefaultSettings(std::vector<tLogSrcConfig> _defaultSettings)
  * \brief Provides a list of [tLogSrcConfig](@ref gpcc::log::ILogFacilityCtrl::tLogSrcConfig) entries to the
@@ -19,10 +19,21 @@
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 
 namespace gpcc {
 namespace log  {
 
+struct LogRecord;
+
+namespace internal {
+  class LogStagingBuffer;
+}
+
 /**
  * \ingroup GPCC_LOG_LOGFACILITIES
  * \brief Thread-based log facility.
@@ -50,6 +61,43 @@ namespace log  {
  * The number of enqueued @ref LogType::Error and @ref LogType::Fatal messages is only limited by the
  * resources of the system.
  *
+ * # Log message intake
+ * There are three modes for passing log messages from @ref Logger instances to the log facility (see @ref IntakeMode):
+ * - @ref IntakeMode::locked: Each log message is enqueued with a mutex being locked and the log facility's thread
+ *   is signaled each time the queue goes non-empty.
+ * - @ref IntakeMode::lockFreeRing: Log messages are enqueued in a preallocated lock-free ring buffer. The log
+ *   facility's thread is only signaled, if it is idle and the ring buffer goes non-empty. Log message limitation
+ *   works the same way as in @ref IntakeMode::locked.
+ * - @ref IntakeMode::perThreadBuffers: Each thread emitting log messages gets a private staging buffer. The staging
+ *   buffers are merged in timestamp order by the log facility's thread. Log message limitation is applied per
+ *   staging buffer. This mode is only supported on Linux-based platforms.
+ *
+ * # Registry of log sources
+ * Registered @ref Logger instances are indexed by their log source name using a hash table. Registration,
+ * unregistration and look-up of a log source by name take constant time on average. Registering a large number of
+ * @ref Logger instances (including consumption of default settings, see @ref SetDefaultSettings()) takes linear time.
+ * @ref EnumerateLogSources() sorts the log sources by name each time it is invoked.
+ *
+ * The log level of all log sources whose names match a pattern can be set in one pass using
+ * @ref SetLogLevelByPattern().
+ *
+ * # Rate limiting
+ * @ref Logger instances may apply rate limiting to their log messages (see @ref Logger::SetRateLimit()). Log messages
+ * dropped by a @ref Logger due to rate limiting are reported to the log facility and they are included in the special
+ * error message indicating the number of dropped log messages.
+ *
+ * # Duplicate suppression
+ * Duplicate suppression can be enabled via @ref SetDuplicateSuppression(). If enabled, then consecutive log messages
+ * with identical type and identical text delivered by the log facility's thread within one batch of log messages are
+ * passed to the back-ends only once. The repetitions are summarized by a special log message of the same type:\n
+ * `[INFO ] *** Logger: Last message repeated 42 time(s) ***`\n
+ * The summary is delivered before the next different log message, or at the end of the batch.
+ *
+ * The log facility's thread processes all log messages enqueued at a time as one batch. Under high load (which is the
+ * case in which duplicate suppression is useful), the batches will become larger. Note that the message text includes
+ * the timestamp, if the @ref Logger is configured to add timestamps. In this case, only messages created within the
+ * same timestamp resolution will be recognized as duplicates.
+ *
  * # Errors during log message creation
  * Errors may occur during log message text creation at the user, and during log message creation inside the
  * @ref Logger instance. These errors are mostly `std::bad::alloc`.
@@ -66,7 +114,42 @@ namespace log  {
 class ThreadedLogFacility final: public ILogFacility, public ILogFacilityCtrl
 {
   public:
+    /// Modes for passing log messages to the log facility via @ref Log().
+    enum class IntakeMode
+    {
+      locked,           ///<@ref Log() locks a mutex and signals the log facility's thread if the queue was empty.
+      lockFreeRing,     ///<@ref Log() pushes log messages into a preallocated lock-free MPSC ring buffer.
+                        /**<The ring buffer has at least `capacity + capacity / 4` slots. The mutex is only locked and
+                            the log facility's thread is only signaled, if the thread is idle and the ring buffer goes
+                            non-empty. If the ring buffer is full (only possible if there are many
+                            @ref LogType::Error or @ref LogType::Fatal messages), then @ref Log() falls back to the
+                            mutex-protected queue.\n
+                            The order of delivery is the same as in mode @ref IntakeMode::locked. */
+      perThreadBuffers  ///<@ref Log() pushes log messages into a lock-free staging buffer private to the calling
+                        ///<thread.
+                        /**<The staging buffer is created and registered when a thread emits its first log message to
+                            the log facility. It has the same number of slots as the ring buffer in mode
+                            @ref IntakeMode::lockFreeRing. The log facility's thread merges the contents of all
+                            staging buffers in the order of timestamps (monotonic clock) taken by @ref Log().\n
+                            There is no data shared among producers, except for the staging buffer list during
+                            registration. Log message limitation is applied per staging buffer: Up to `capacity`
+                            messages which are not @ref LogType::Error or @ref LogType::Fatal can be enqueued in each
+                            staging buffer. @ref LogType::Error and @ref LogType::Fatal messages may use the remaining
+                            slots. If the staging buffer is full, then the message is dropped, even if it is of type
+                            @ref LogType::Error or @ref LogType::Fatal. Dropped messages are reported like in the other
+                            modes.\n
+                            The messages of each thread are delivered in the order they have been logged. Messages of
+                            different threads are delivered in timestamp order, as far as they are present in the
+                            staging buffers when the log facility's thread merges them.\n
+                            The staging buffer of a terminated thread is released by the log facility's thread after it
+                            has been drained.\n
+                            This mode is only supported on Linux-based platforms (`OS_LINUX_*`), because it requires
+                            `thread_local` objects with destructors. On other platforms, the constructor throws
+                            `std::invalid_argument`. */
+    };
+
     ThreadedLogFacility(char const * const pThreadName, size_t const capacity);
+    ThreadedLogFacility(char const * const pThreadName, size_t const capacity, IntakeMode const _intakeMode);
     ThreadedLogFacility(ThreadedLogFacility const &) = delete;
     ThreadedLogFacility(ThreadedLogFacility &&) = delete;
     ~ThreadedLogFacility(void);
@@ -82,6 +165,8 @@ class ThreadedLogFacility final: public ILogFacility, public ILogFacilityCtrl
 
     void Flush(void);
 
+    void SetDuplicateSuppression(bool const enable);
+
 
     // --> ILogFacility
     void Register(Logger& logger) override;
@@ -92,6 +177,7 @@ class ThreadedLogFacility final: public ILogFacility, public ILogFacilityCtrl
 
     void Log(std::unique_ptr<internal::LogMessage> spMsg) override;
     void ReportLogMessageCreationFailed(void) noexcept override;
+    void ReportLogMessageDropped(void) noexcept override;
     // <-- ILogFacility
 
     // --> ILogFacilityCtrl
@@ -100,12 +186,37 @@ class ThreadedLogFacility final: public ILogFacility, public ILogFacilityCtrl
     bool SetLogLevel(std::string const & srcName, LogLevel const level) override;
     bool LowerLogLevel(std::string const & srcName, LogLevel const level) override;
     bool RaiseLogLevel(std::string const & srcName, LogLevel const level) override;
+    size_t SetLogLevelByPattern(std::string const & pattern, LogLevel const level) override;
 
     void SetDefaultSettings(std::vector<tLogSrcConfig> _defaultSettings) override;
     std::vector<tLogSrcConfig> RemoveDefaultSettings(void) override;
     // <-- ILogFacilityCtrl
 
   private:
+    /// One slot of the ring buffer used in @ref IntakeMode::lockFreeRing.
+    struct RingSlot
+    {
+      /// Sequence number of the slot.
+      /** The slot is free for the producer that has claimed position `p`, if this is `p`.\n
+          The slot contains a log message for the consumer at position `p`, if this is `p + 1`. */
+      std::atomic<size_t> seq;
+
+      /// Log message stored in the slot.
+      internal::LogMessage* pMsg;
+    };
+
+    /// Source of unique IDs for @ref instanceId.
+    static std::atomic<uint64_t> nextInstanceId;
+
+
+
+    /// Intake mode.
+    IntakeMode const intakeMode;
+
+    /// Unique ID of this instance.
+    /** This is used by threads to find their staging buffer in @ref IntakeMode::perThreadBuffers. */
+    uint64_t const instanceId;
+
     /// Mutex protecting access to logger- and backend-lists.
     /** Locking order: @ref Logger::mutex -> @ref mutex -> @ref msgListMutex */
     mutable gpcc::osal::Mutex mutex;
@@ -115,11 +226,10 @@ class ThreadedLogFacility final: public ILogFacility, public ILogFacilityCtrl
     gpcc::osal::Mutex msgListMutex;
 
 
-    /// List containing registered loggers.
+    /// Registered loggers, indexed by log source name.
     /** @ref mutex is required.\n
-        The loggers in this list are sorted alphabetically and upper-case before lower-case.\n
-        The pPrev-pointers of the loggers point toward this. */
-    Logger* pLoggerList;
+        The keys refer to the log source names of the registered loggers ([Logger::srcName](@ref Logger::srcName)). */
+    std::unordered_map<std::string_view, Logger*> loggers;
 
     /// List containing registered backends.
     /** @ref mutex is required.\n
@@ -131,32 +241,69 @@ class ThreadedLogFacility final: public ILogFacility, public ILogFacilityCtrl
     bool defaultSettingsPresent;
 
     /// List of default log levels for new registered @ref Logger instances.
-    /** @ref mutex is required. */
+    /** @ref mutex is required.\n
+        Entries are not removed from this when they are consumed. Instead their index is removed from
+        @ref defaultSettingsIndex. */
     std::vector<tLogSrcConfig> defaultSettings;
 
+    /// Index of the entries in @ref defaultSettings that have not been consumed yet.
+    /** @ref mutex is required.\n
+        The keys refer to the log source names stored in @ref defaultSettings. The values are indices into
+        @ref defaultSettings. */
+    std::unordered_multimap<std::string_view, size_t> defaultSettingsIndex;
+
     /// Number of undelivered messages.
     /** @ref mutex is required.\n
         This variable contains the number of completely or partially undelivered log messages.\n
         The number includes:
         - errors during message text creation from message ingredients
         - errors during message processing by back-ends
-        - dropped messages due to limited capacity */
+        - dropped messages due to limited capacity
+        - dropped messages due to rate limiting applied by @ref Logger instances */
     uint8_t notProperlyDeliveredMessages;
 
+    /// Flag indicating if duplicate suppression is enabled.
+    /** @ref mutex is required. */
+    bool duplicateSuppression;
+
+    /// Text of the last log message passed to the back-ends. Only used if @ref duplicateSuppression is true.
+    /** @ref mutex is required.\n
+        This is cleared at the end of each batch of log messages processed by @ref DeliverMessages(). */
+    std::string lastDeliveredMsg;
+
+    /// Type of the last log message passed to the back-ends. Only valid if @ref lastDeliveredMsg is not empty.
+    /** @ref mutex is required. */
+    LogType lastDeliveredType;
+
+    /// Number of times the last log message passed to the back-ends has been suppressed.
+    /** @ref mutex is required. */
+    uint32_t repeatCount;
+
 
     /// Number of times a @ref Logger or user of a @ref Logger failed to create a log message,
     /// e.g. due to out-of-memory.
     /** @ref msgListMutex is required. */
     uint8_t messageCreationFailureCnt;
 
-    /// Number of log messages dropped due to log message queue limitation.
+    /// Number of log messages dropped due to log message queue limitation or due to rate limiting applied by
+    /// @ref Logger instances.
     /** @ref msgListMutex is required. */
     uint8_t droppedMessages;
 
+    /// Number of log messages dropped by the lock-free path of @ref Log() due to log message queue limitation.
+    /** Incremented without any mutex (saturating). Consumed by the log facility's thread with @ref msgListMutex
+        locked. Only used in @ref IntakeMode::lockFreeRing. */
+    std::atomic<uint8_t> ringDroppedMessages;
+
     /// Remaining contingent of log messages which are not @ref LogType::Error or @ref LogType::Fatal.
-    /** For decrementing, @ref msgListMutex is required. */
+    /** In @ref IntakeMode::locked, @ref msgListMutex is required for decrementing.\n
+        In @ref IntakeMode::lockFreeRing, decrementing is done via @ref TryConsumeCapacity().\n
+        Not used in @ref IntakeMode::perThreadBuffers. */
     std::atomic<size_t> remainingCapacity;
 
+    /// Capacity passed to the constructor. Used to create staging buffers in @ref IntakeMode::perThreadBuffers.
+    size_t const stagingBufferCapacity;
+
     /// Condition variable for signaling that either the message queue is no longer empty, that
     /// @ref messageCreationFailureCnt is no longer zero, or @ref droppedMessages is no longer zero.
     /** This is to be used in conjunction with @ref msgListMutex. */
@@ -181,17 +328,62 @@ class ThreadedLogFacility final: public ILogFacility, public ILogFacilityCtrl
         The pNext-pointer of the log messages points toward this. */
     internal::LogMessage* pMsgQueueTail;
 
+    /// Number of slots in @ref spRing (or in each staging buffer in @ref IntakeMode::perThreadBuffers) minus one.
+    /// The number of slots is a power of two.
+    size_t const ringMask;
+
+    /// Ring buffer used in @ref IntakeMode::lockFreeRing. nullptr in @ref IntakeMode::locked.
+    std::unique_ptr<RingSlot[]> spRing;
+
+    /// Next position in @ref spRing that will be claimed by a producer.
+    std::atomic<size_t> ringEnqueuePos;
+
+    /// Next position in @ref spRing that will be read by the log facility's thread.
+    /** Writing requires @ref msgListMutex.\n
+        Producers read this without any mutex to determine if the ring buffer went non-empty. */
+    std::atomic<size_t> ringDequeuePos;
+
+    /// Flag indicating that @ref Log() has fallen back to the mutex-protected queue because @ref spRing was full.
+    /** Setting and clearing requires @ref msgListMutex.\n
+        While this is set, all log messages are enqueued in the mutex-protected queue in order to maintain the order
+        of messages. */
+    std::atomic<bool> ringOverflow;
+
+    /// Flag indicating that the log facility's thread is idle and waits for @ref msgListNotEmptyCV.
+    /** Setting and clearing is done by the log facility's thread only.\n
+        Producers using @ref IntakeMode::lockFreeRing or @ref IntakeMode::perThreadBuffers read this without any
+        mutex in order to decide if signaling is required. */
+    std::atomic<bool> logThreadIdle;
+
+    /// Staging buffers registered in @ref IntakeMode::perThreadBuffers.
+    /** @ref msgListMutex is required. */
+    std::vector<std::shared_ptr<internal::LogStagingBuffer>> stagingBuffers;
+
     /// Thread used to process log messages.
     gpcc::osal::Thread thread;
 
 
     Logger* FindLogger(std::string const & srcName) const noexcept;
 
+    bool TryConsumeCapacity(void) noexcept;
+    bool PushToRing(internal::LogMessage* const pMsg) noexcept;
+    void IncRingDroppedMessages(void) noexcept;
+    bool IsRingEmpty(void) const noexcept;
+    void DrainRing(void) noexcept;
+#if (defined(OS_LINUX_ARM) || defined(OS_LINUX_ARM_TFC) || defined(OS_LINUX_X64) || defined(OS_LINUX_X64_TFC))
+    internal::LogStagingBuffer& GetStagingBuffer(void);
+#endif
+    void MergeStagingBuffers(void) noexcept;
+    bool IsAnyStagingBufferPending(void) const noexcept;
+    bool IsAnythingPending(void) const noexcept;
+
     void* InternalThreadEntry(void) noexcept;
 
     void ReleaseMessages(internal::LogMessage* pMessages) noexcept;
     void DeliverMessages(internal::LogMessage* pMessages, uint8_t const dropped, uint8_t const creationFailed);
     void Deliver(std::string const & msg, LogType const type);
+    void DeliverRecord(LogRecord const & record, std::string const & msg);
+    void DeliverRepeatSummary(void);
 
     void IncNotProperlyDeliveredMessages(void) noexcept;
 };
@@ -0,0 +1,122 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#ifndef BUFFEREDSTREAMREADER_HPP_202610161830
+#define BUFFEREDSTREAMREADER_HPP_202610161830
+
+#include <gpcc/stream/StreamReaderBase.hpp>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace gpcc   {
+namespace stream {
+
+/**
+ * \ingroup GPCC_STREAM
+ * \brief Decorator for any @ref IStreamReader that reads the data from the decorated stream in blocks.
+ *
+ * Data is read from the decorated stream in blocks of up to the configured buffer size. All read operations offered
+ * by the @ref IStreamReader interface are served from the buffer. This reduces the number of calls to the decorated
+ * stream, which is beneficial if each call is expensive (e.g. streams reading from files or from storage devices).
+ * @ref Read_string() and @ref Read_line() scan the buffer directly for the end of the string or line.
+ *
+ * Reading of bit-based data is handled by this class. The semantics are identical to the semantics of any other
+ * @ref IStreamReader implementation. @ref IStreamReader::RemainingBytes() is supported if it is supported by the
+ * decorated stream.
+ *
+ * If the decorated stream supports @ref IStreamReader::RemainingBytes(), then each block is read via one single call
+ * to the decorated stream. Otherwise the block is read byte by byte, because the decorated stream must not be read
+ * beyond its end. Large reads are always passed directly to the decorated stream.\n
+ * The readers returned by [FileStorage](@ref gpcc::file_systems::linux_fs::FileStorage) support
+ * @ref IStreamReader::RemainingBytes(). The readers returned by
+ * [EEPROMSectionSystem](@ref gpcc::file_systems::eeprom_section_system::EEPROMSectionSystem) do not, because
+ * determining the size of a section would require to load all of its blocks from the storage.
+ *
+ * The decorated stream must not be accessed by anyone else while it is decorated by a @ref BufferedStreamReader.
+ * Closing the @ref BufferedStreamReader does not close the decorated stream. Note that up to one block of data may have
+ * been read ahead from the decorated stream when the @ref BufferedStreamReader is closed.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * Not thread-safe.
+ */
+class BufferedStreamReader final: public StreamReaderBase
+{
+  public:
+    /// Default size of the buffer in bytes.
+    static constexpr size_t defaultBufferSize = 512U;
+
+    BufferedStreamReader(void) = delete;
+    BufferedStreamReader(IStreamReader & _underlyingStream, size_t const bufferSize = defaultBufferSize);
+    BufferedStreamReader(BufferedStreamReader const &) = delete;
+    BufferedStreamReader(BufferedStreamReader &&) = delete;
+    ~BufferedStreamReader(void) = default;
+
+    BufferedStreamReader& operator=(BufferedStreamReader const &) = delete;
+    BufferedStreamReader& operator=(BufferedStreamReader &&) = delete;
+
+    // --> IStreamReader
+    bool IsRemainingBytesSupported(void) const override;
+    size_t RemainingBytes(void) const override;
+    void EnsureAllDataConsumed(RemainingNbOfBits const expectation) const override;
+    void Close(void) noexcept override;
+
+    void Skip(size_t nBits) override;
+
+    std::string Read_string(void) override;
+    std::string Read_line(void) override;
+    // <-- IStreamReader
+
+  private:
+    /// The decorated stream.
+    IStreamReader & underlyingStream;
+
+    /// Flag indicating if the decorated stream supports @ref IStreamReader::RemainingBytes().
+    bool const remainingBytesSupported;
+
+    /// Buffer for data read from @ref underlyingStream.
+    std::vector<unsigned char> buffer;
+
+    /// Index of the next byte in @ref buffer that shall be read.
+    size_t readIdx;
+
+    /// Number of valid bytes in @ref buffer.
+    size_t fillLevel;
+
+    /// Flag indicating if @ref underlyingStream is empty.
+    bool underlyingEmpty;
+
+    /// Number of bits left to be read. The bits are stored in @ref bitData.
+    /** This is valid in stream's states @ref States::open and @ref States::empty. */
+    uint8_t nbOfBitsInBitData;
+
+    /// Bits of the last read byte that have not yet been read. The number of bits is stored in @ref nbOfBitsInBitData.
+    /** This is only valid if the stream's state is @ref States::open. */
+    uint16_t bitData;
+
+
+    // --> StreamReaderBase
+    unsigned char Pop(void) override;
+    void Pop(void* p, size_t n) override;
+    uint8_t PopBits(uint_fast8_t n) override;
+    // <-- StreamReaderBase
+
+    void FetchBlock(void);
+    void ReadDirect(void* const p, size_t const n);
+    void DiscardBits(void) noexcept;
+    void UpdateEmptyState(void) noexcept;
+};
+
+} // namespace stream
+} // namespace gpcc
+
+#endif // BUFFEREDSTREAMREADER_HPP_202610161830
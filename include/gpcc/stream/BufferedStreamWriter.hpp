@@ -0,0 +1,112 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#ifndef BUFFEREDSTREAMWRITER_HPP_202610161830
+#define BUFFEREDSTREAMWRITER_HPP_202610161830
+
+#include <gpcc/stream/StreamWriterBase.hpp>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace gpcc   {
+namespace stream {
+
+/**
+ * \ingroup GPCC_STREAM
+ * \brief Decorator for any @ref IStreamWriter that writes the data to the decorated stream in blocks.
+ *
+ * All data written via the @ref IStreamWriter interface is collected in a buffer of configurable size. The buffer is
+ * written to the decorated stream via one single call if it is full, if @ref Flush() is invoked, or if the stream is
+ * closed. This reduces the number of calls to the decorated stream, which is beneficial if each call is expensive
+ * (e.g. streams writing to files or to storage devices). Large writes are passed directly to the decorated stream.
+ *
+ * Writing of bit-based data is handled by this class. The semantics are identical to the semantics of any other
+ * @ref IStreamWriter implementation. Bits that have not been completed to a byte when the
+ * @ref BufferedStreamWriter is closed are passed to the decorated stream as bits.
+ *
+ * @ref IStreamWriter::RemainingCapacity() is supported if it is supported by the decorated stream. In this case, an
+ * attempt to write beyond the capacity of the decorated stream is detected before any data is buffered. Otherwise it
+ * is detected when the buffer is written to the decorated stream.
+ *
+ * The decorated stream must not be accessed by anyone else while it is decorated by a @ref BufferedStreamWriter.
+ * Closing the @ref BufferedStreamWriter does not close the decorated stream.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * Not thread-safe.
+ */
+class BufferedStreamWriter final: public StreamWriterBase
+{
+  public:
+    /// Default size of the buffer in bytes.
+    static constexpr size_t defaultBufferSize = 512U;
+
+    BufferedStreamWriter(void) = delete;
+    BufferedStreamWriter(IStreamWriter & _underlyingStream, size_t const bufferSize = defaultBufferSize);
+    BufferedStreamWriter(BufferedStreamWriter const &) = delete;
+    BufferedStreamWriter(BufferedStreamWriter &&) = delete;
+    ~BufferedStreamWriter(void);
+
+    BufferedStreamWriter& operator=(BufferedStreamWriter const &) = delete;
+    BufferedStreamWriter& operator=(BufferedStreamWriter &&) = delete;
+
+    void Flush(void);
+
+    // --> IStreamWriter
+    bool IsRemainingCapacitySupported(void) const override;
+    size_t RemainingCapacity(void) const override;
+    uint_fast8_t GetNbOfCachedBits(void) const override;
+
+    void Close(void) override;
+    // <-- IStreamWriter
+
+  private:
+    /// The decorated stream.
+    IStreamWriter & underlyingStream;
+
+    /// Flag indicating if the decorated stream supports @ref IStreamWriter::RemainingCapacity().
+    bool const remainingCapacitySupported;
+
+    /// Buffer for data that shall be written to @ref underlyingStream.
+    std::vector<unsigned char> buffer;
+
+    /// Number of valid bytes in @ref buffer.
+    size_t fillLevel;
+
+    /// Remaining capacity of the stream, incl. the data in @ref buffer.
+    /** This is only valid if @ref remainingCapacitySupported is true and if the stream's state is
+        @ref States::open or @ref States::full. */
+    size_t remainingCapacity;
+
+    /// Number of bits written via bit based write methods. The bits are stored in @ref bitData.
+    /** This is only valid if the stream's state is @ref States::open or @ref States::full. */
+    uint8_t nbOfBitsWritten;
+
+    /// Bits written via bit based write methods. The number of bits is stored in @ref nbOfBitsWritten.
+    /** This is only valid if the stream's state is @ref States::open. */
+    uint8_t bitData;
+
+
+    // --> StreamWriterBase
+    void Push(char c) override;
+    void Push(void const * pData, size_t n) override;
+    void PushBits(uint8_t bits, uint_fast8_t n) override;
+    // <-- StreamWriterBase
+
+    void AppendByte(unsigned char const c);
+    void FlushBuffer(void);
+};
+
+} // namespace stream
+} // namespace gpcc
+
+#endif // BUFFEREDSTREAMWRITER_HPP_202610161830
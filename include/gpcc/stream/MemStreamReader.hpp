@@ -27,6 +27,9 @@ namespace stream
  * \brief This class allows to read from a block of memory via an @ref IStreamReader interface.
  *
  * @ref IStreamReader::RemainingBytes() is supported.
+ *
+ * Byte-based data can be accessed without copying it via @ref PeekSpan() and @ref ReadSpan(). Both methods return a
+ * pointer into the underlying memory.
  */
 class MemStreamReader: public StreamReaderBase
 {
@@ -43,6 +46,9 @@ class MemStreamReader: public StreamReaderBase
     MemStreamReader SubStream(size_t const n);
     void Shrink(size_t const newRemainingBytes);
 
+    void const * PeekSpan(size_t const n) const;
+    void const * ReadSpan(size_t const n);
+
     void const * GetReadPtr(void const * const _pMem, size_t const _size) const;
 
     // --> IStreamReader
@@ -28,6 +28,7 @@ namespace stream
  *
  * @ref IStreamWriter::RemainingCapacity() is supported.
  *
+ * Byte-based data can be encoded directly into the underlying memory via @ref ReserveSpan().
  */
 class MemStreamWriter: public StreamWriterBase
 {
@@ -41,6 +42,8 @@ class MemStreamWriter: public StreamWriterBase
     MemStreamWriter& operator=(MemStreamWriter const & rhv) noexcept;
     MemStreamWriter& operator=(MemStreamWriter&& rhv) noexcept;
 
+    void* ReserveSpan(size_t const n);
+
     // --> IStreamWriter
     bool IsRemainingCapacitySupported(void) const override;
     size_t RemainingCapacity(void) const override;
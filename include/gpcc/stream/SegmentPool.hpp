@@ -0,0 +1,108 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#ifndef SEGMENTPOOL_HPP_202610161700
+#define SEGMENTPOOL_HPP_202610161700
+
+#include <gpcc/osal/Mutex.hpp>
+#include <vector>
+#include <cstddef>
+
+namespace gpcc   {
+namespace stream {
+
+class SegmentedStreamWriter;
+
+/**
+ * \ingroup GPCC_STREAM
+ * \brief Pool of fixed-size memory segments used by @ref SegmentedStreamWriter.
+ *
+ * Segments are allocated on the heap when they are requested and the pool is empty. Segments that are returned to the
+ * pool are kept for reuse, up to a configurable maximum number of cached segments. Any further returned segments are
+ * released to the heap.
+ *
+ * One pool can be shared by any number of @ref SegmentedStreamWriter instances.
+ *
+ * The pool must not be destroyed before all segments have been returned to the pool.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * Thread-safe.
+ */
+class SegmentPool final
+{
+    friend class SegmentedStreamWriter;
+
+  public:
+    SegmentPool(void) = delete;
+    SegmentPool(size_t const _segmentSize, size_t const _maxNbOfCachedSegments);
+    SegmentPool(SegmentPool const &) = delete;
+    SegmentPool(SegmentPool &&) = delete;
+    ~SegmentPool(void);
+
+    SegmentPool& operator=(SegmentPool const &) = delete;
+    SegmentPool& operator=(SegmentPool &&) = delete;
+
+    size_t GetSegmentSize(void) const noexcept;
+    size_t GetNbOfCachedSegments(void) const;
+
+  private:
+    /// Size of each segment in bytes.
+    size_t const segmentSize;
+
+    /// Maximum number of segments cached in @ref cachedSegments.
+    size_t const maxNbOfCachedSegments;
+
+    /// Mutex protecting @ref cachedSegments and @ref nbOfSegmentsInUse.
+    gpcc::osal::Mutex mutable mutex;
+
+    /// Segments available for reuse.
+    /** @ref mutex is required.\n
+        The capacity of the vector is @ref maxNbOfCachedSegments, so adding segments will never allocate memory. */
+    std::vector<unsigned char*> cachedSegments;
+
+    /// Number of segments handed out by @ref Get() and not yet returned via @ref Put().
+    /** @ref mutex is required. */
+    size_t nbOfSegmentsInUse;
+
+
+    unsigned char* Get(void);
+    void Put(unsigned char* const pSegment) noexcept;
+};
+
+/**
+ * \brief Retrieves the size of the segments.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \return
+ * Size of each segment in bytes.
+ */
+inline size_t SegmentPool::GetSegmentSize(void) const noexcept
+{
+  return segmentSize;
+}
+
+} // namespace stream
+} // namespace gpcc
+
+#endif // SEGMENTPOOL_HPP_202610161700
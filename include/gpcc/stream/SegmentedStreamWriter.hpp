@@ -0,0 +1,124 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#ifndef SEGMENTEDSTREAMWRITER_HPP_202610161700
+#define SEGMENTEDSTREAMWRITER_HPP_202610161700
+
+#include <gpcc/stream/StreamWriterBase.hpp>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace gpcc   {
+namespace stream {
+
+class SegmentPool;
+
+/**
+ * \ingroup GPCC_STREAM
+ * \brief This class allows to write into a growable chain of memory segments via an @ref IStreamWriter interface.
+ *
+ * In contrast to @ref MemStreamWriter, the size of the data that will be written does not need to be known in
+ * advance. The written data is stored in a chain of fixed-size segments retrieved from a @ref SegmentPool. A new
+ * segment is appended to the chain each time the last segment is full. Large outputs therefore do not require a
+ * single large allocation.
+ *
+ * The written data can be retrieved in two ways:
+ * - @ref GetGatherList() provides a list of memory chunks (iovec-style) for vectored output without copying.
+ * - @ref Flatten() copies the data into a single contiguous buffer.
+ *
+ * Both methods can be used after the stream has been closed. The segments are returned to the pool when the
+ * @ref SegmentedStreamWriter is destroyed.
+ *
+ * @ref IStreamWriter::RemainingCapacity() is not supported. The state
+ * [States::full](@ref gpcc::stream::IStreamWriter::States::full) is not used by this class.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * Not thread-safe, but the @ref SegmentPool may be shared by @ref SegmentedStreamWriter instances used by different
+ * threads.
+ */
+class SegmentedStreamWriter final: public StreamWriterBase
+{
+  public:
+    /// A chunk of contiguous memory containing written data.
+    struct Chunk
+    {
+      void const * pData;   ///<Pointer to the data.
+      size_t size;          ///<Size of the data in bytes.
+    };
+
+    SegmentedStreamWriter(void) = delete;
+    SegmentedStreamWriter(SegmentPool & _pool, Endian const _endian);
+    SegmentedStreamWriter(SegmentedStreamWriter const &) = delete;
+    SegmentedStreamWriter(SegmentedStreamWriter &&) = delete;
+    ~SegmentedStreamWriter(void);
+
+    SegmentedStreamWriter& operator=(SegmentedStreamWriter const &) = delete;
+    SegmentedStreamWriter& operator=(SegmentedStreamWriter &&) = delete;
+
+    size_t GetSize(void) const;
+    std::vector<Chunk> GetGatherList(void) const;
+    std::vector<uint8_t> Flatten(void) const;
+    void Flatten(void* const pDest, size_t const destSize) const;
+
+    // --> IStreamWriter
+    bool IsRemainingCapacitySupported(void) const override;
+    size_t RemainingCapacity(void) const override;
+    uint_fast8_t GetNbOfCachedBits(void) const override;
+
+    void Close(void) noexcept override;
+    // <-- IStreamWriter
+
+  private:
+    /// Pool from which segments are retrieved.
+    SegmentPool & pool;
+
+    /// Size of each segment in bytes (copy of the pool's segment size).
+    size_t const segmentSize;
+
+    /// Chain of segments. All segments except the last one are completely filled with data.
+    std::vector<unsigned char*> segments;
+
+    /// Pointer to the next byte that shall be written into the last segment. nullptr = no segment yet.
+    unsigned char* pWrite;
+
+    /// Remaining number of bytes that can be written into the last segment.
+    size_t remainingBytesInSegment;
+
+    /// Number of bytes written into the segments.
+    size_t size;
+
+    /// Number of bits written via bit based write methods. The bits are stored in @ref bitData.
+    /** This is only valid if the stream's state is @ref States::open.\n
+        If there are any bits, then @ref remainingBytesInSegment is at least one. */
+    uint8_t nbOfBitsWritten;
+
+    /// Bits written via bit based write methods. The number of bits is stored in @ref nbOfBitsWritten.
+    /** This is only valid if the stream's state is @ref States::open. */
+    uint8_t bitData;
+
+
+    // --> StreamWriterBase
+    void Push(char c) override;
+    void Push(void const * pData, size_t n) override;
+    void PushBits(uint8_t bits, uint_fast8_t n) override;
+    // <-- StreamWriterBase
+
+    void AddSegment(void);
+    void FlushBits(void) noexcept;
+    void CheckDataAccessible(void) const;
+};
+
+} // namespace stream
+} // namespace gpcc
+
+#endif // SEGMENTEDSTREAMWRITER_HPP_202610161700
@@ -0,0 +1,108 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#ifndef STATICMEMSTREAMREADER_HPP_202610162215
+#define STATICMEMSTREAMREADER_HPP_202610162215
+
+#include <gpcc/stream/StaticStreamReaderBase.hpp>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+
+namespace gpcc   {
+namespace stream {
+
+/**
+ * \ingroup GPCC_STREAM
+ * \brief Header-only counterpart of @ref MemStreamReader with the endian fixed at compile time.
+ *
+ * This offers the same API and the same semantics as @ref MemStreamReader, but none of the methods is virtual and the
+ * endian of the data is a template parameter. If the type of the stream is known at the call site, then all read
+ * methods can be inlined completely and byte swapping is resolved at compile time.
+ *
+ * Use @ref StaticStreamReaderAdapter if an @ref IStreamReader is required.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * Not thread-safe.
+ *
+ * \tparam ENDIAN
+ * Endian of the data inside the stream.
+ */
+template<IStreamReader::Endian ENDIAN>
+class StaticMemStreamReader final: public StaticStreamReaderBase<StaticMemStreamReader<ENDIAN>, ENDIAN>
+{
+    friend class StaticStreamReaderBase<StaticMemStreamReader<ENDIAN>, ENDIAN>;
+    using Base = StaticStreamReaderBase<StaticMemStreamReader<ENDIAN>, ENDIAN>;
+
+  public:
+    using typename Base::States;
+    using typename Base::RemainingNbOfBits;
+
+    StaticMemStreamReader(void) = delete;
+    StaticMemStreamReader(void const * const _pMem, size_t const _size);
+    StaticMemStreamReader(StaticMemStreamReader const & other) noexcept;
+    StaticMemStreamReader(StaticMemStreamReader&& other) noexcept;
+    ~StaticMemStreamReader(void) = default;
+
+    StaticMemStreamReader& operator=(StaticMemStreamReader const & rhv) noexcept;
+    StaticMemStreamReader& operator=(StaticMemStreamReader&& rhv) noexcept;
+
+    StaticMemStreamReader SubStream(size_t const n);
+    void Shrink(size_t const newRemainingBytes);
+
+    void const * PeekSpan(size_t const n) const;
+    void const * ReadSpan(size_t const n);
+
+    void const * GetReadPtr(void const * const _pMem, size_t const _size) const;
+
+    constexpr bool IsRemainingBytesSupported(void) const noexcept { return true; }
+    size_t RemainingBytes(void) const;
+    void EnsureAllDataConsumed(RemainingNbOfBits const expectation) const;
+    void Close(void) noexcept;
+
+    void Skip(size_t nBits);
+
+    std::string Read_string(void);
+    std::string Read_line(void);
+
+  private:
+    using Base::state;
+
+    /// Pointer to the next byte to be read from memory. nullptr = none.
+    char const * pMem;
+
+    /// Number of bytes left to be read from memory via `pMem`.
+    /** This is valid in stream's states @ref States::open and @ref States::empty. */
+    size_t remainingBytes;
+
+    /// Number of bits left to be read. The bits are stored in @ref bitData.
+    /** This is valid in stream's states @ref States::open and @ref States::empty. */
+    uint8_t nbOfBitsInBitData;
+
+    /// Bits of the last read byte that have not yet been read. The number of bits is stored in @ref nbOfBitsInBitData.
+    /** This is only valid if the stream's state is @ref States::open. */
+    uint16_t bitData;
+
+
+    unsigned char Pop(void);
+    void Pop(void* p, size_t n);
+    uint8_t PopBits(uint_fast8_t n);
+
+    void DiscardBits(void) noexcept;
+};
+
+} // namespace stream
+} // namespace gpcc
+
+#include "StaticMemStreamReader.tcc"
+
+#endif // STATICMEMSTREAMREADER_HPP_202610162215
@@ -0,0 +1,848 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#include "StaticMemStreamReader.hpp"
+#include <gpcc/osal/Panic.hpp>
+#include <gpcc/raii/scope_guard.hpp>
+#include <gpcc/stream/stream_errors.hpp>
+#include <stdexcept>
+#include <cstring>
+
+namespace gpcc   {
+namespace stream {
+
+/**
+ * \brief Constructor.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \param _pMem
+ * Pointer to the memory that shall be read.\n
+ * nullptr is allowed, if `_size` is zero.
+ *
+ * \param _size
+ * Size of the memory block referenced by `_pMem`.\n
+ * If this is zero, then the stream will be created in state @ref IStreamReader::States::empty.
+ */
+template<IStreamReader::Endian ENDIAN>
+StaticMemStreamReader<ENDIAN>::StaticMemStreamReader(void const * const _pMem, size_t const _size)
+: Base(States::open)
+, pMem(static_cast<char const*>(_pMem))
+, remainingBytes(_size)
+, nbOfBitsInBitData(0)
+, bitData(0)
+{
+  if (remainingBytes == 0U)
+  {
+    pMem = nullptr;
+    state = States::empty;
+  }
+  else if (pMem == nullptr)
+    throw std::invalid_argument("StaticMemStreamReader::StaticMemStreamReader: _pMem == nullptr");
+}
+
+/// \copydoc MemStreamReader::MemStreamReader(MemStreamReader const &)
+template<IStreamReader::Endian ENDIAN>
+StaticMemStreamReader<ENDIAN>::StaticMemStreamReader(StaticMemStreamReader const & other) noexcept
+: Base(other)
+, pMem(other.pMem)
+, remainingBytes(other.remainingBytes)
+, nbOfBitsInBitData(other.nbOfBitsInBitData)
+, bitData(other.bitData)
+{
+}
+
+/// \copydoc MemStreamReader::MemStreamReader(MemStreamReader&&)
+template<IStreamReader::Endian ENDIAN>
+StaticMemStreamReader<ENDIAN>::StaticMemStreamReader(StaticMemStreamReader&& other) noexcept
+: Base(std::move(other))
+, pMem(other.pMem)
+, remainingBytes(other.remainingBytes)
+, nbOfBitsInBitData(other.nbOfBitsInBitData)
+, bitData(other.bitData)
+{
+  other.pMem = nullptr;
+  other.state = States::closed;
+}
+
+/// \copydoc MemStreamReader::operator=(MemStreamReader const &)
+template<IStreamReader::Endian ENDIAN>
+StaticMemStreamReader<ENDIAN>& StaticMemStreamReader<ENDIAN>::operator=(StaticMemStreamReader const & rhv) noexcept
+{
+  if (&rhv != this)
+  {
+    Close();
+
+    Base::operator=(rhv);
+
+    pMem = rhv.pMem;
+    remainingBytes = rhv.remainingBytes;
+    nbOfBitsInBitData = rhv.nbOfBitsInBitData;
+    bitData = rhv.bitData;
+  }
+
+  return *this;
+}
+
+/// \copydoc MemStreamReader::operator=(MemStreamReader&&)
+template<IStreamReader::Endian ENDIAN>
+StaticMemStreamReader<ENDIAN>& StaticMemStreamReader<ENDIAN>::operator=(StaticMemStreamReader&& rhv) noexcept
+{
+  if (&rhv != this)
+  {
+    Close();
+
+    Base::operator=(std::move(rhv));
+
+    pMem = rhv.pMem;
+    remainingBytes = rhv.remainingBytes;
+    nbOfBitsInBitData = rhv.nbOfBitsInBitData;
+    bitData = rhv.bitData;
+
+    rhv.pMem = nullptr;
+    rhv.state = States::closed;
+  }
+
+  return *this;
+}
+
+/// \copydoc MemStreamReader::SubStream
+template<IStreamReader::Endian ENDIAN>
+StaticMemStreamReader<ENDIAN> StaticMemStreamReader<ENDIAN>::SubStream(size_t const n)
+{
+  switch (state)
+  {
+    case States::open:
+    {
+      if (n > remainingBytes)
+        throw EmptyError();
+
+      StaticMemStreamReader subBlock(pMem, n);
+
+      DiscardBits();
+
+      remainingBytes -= n;
+
+      if (remainingBytes == 0U)
+      {
+        // (empty now)
+        pMem = nullptr;
+        state = States::empty;
+      }
+      else
+      {
+        // (move read pointer forward)
+        pMem += n;
+      }
+
+      return subBlock;
+    }
+
+    case States::empty:
+    {
+      if (n != 0U)
+        throw EmptyError();
+
+      return StaticMemStreamReader(nullptr, 0);
+    }
+
+    case States::closed:
+      throw ClosedError();
+
+    case States::error:
+      throw ErrorStateError();
+  } // switch (state)
+
+  PANIC();
+}
+
+/// \copydoc MemStreamReader::Shrink
+template<IStreamReader::Endian ENDIAN>
+void StaticMemStreamReader<ENDIAN>::Shrink(size_t const newRemainingBytes)
+{
+  switch (state)
+  {
+    case States::open:
+    {
+      if (newRemainingBytes > remainingBytes)
+        throw std::invalid_argument("StaticMemStreamReader::Shrink: Attempt to enlarge remaining number of bytes");
+
+      remainingBytes = newRemainingBytes;
+      if (remainingBytes == 0U)
+      {
+        pMem = nullptr;
+
+        if (nbOfBitsInBitData == 0U)
+          state = States::empty;
+      }
+
+      break;
+    }
+
+    case States::empty:
+    {
+      if (newRemainingBytes != 0U)
+        throw std::invalid_argument("StaticMemStreamReader::Shrink: 'newRemainingBytes' must be zero in state 'empty'");
+
+      break;
+    }
+
+    case States::closed:
+      throw ClosedError();
+
+    case States::error:
+      throw ErrorStateError();
+  } // switch (state)
+}
+
+/// \copydoc MemStreamReader::PeekSpan
+template<IStreamReader::Endian ENDIAN>
+void const * StaticMemStreamReader<ENDIAN>::PeekSpan(size_t const n) const
+{
+  switch (state)
+  {
+    case States::open:
+    {
+      if (n > remainingBytes)
+        throw EmptyError();
+
+      if (n == 0U)
+        return nullptr;
+
+      return pMem;
+    }
+
+    case States::empty:
+    {
+      if (n != 0U)
+        throw EmptyError();
+
+      return nullptr;
+    }
+
+    case States::closed:
+      throw ClosedError();
+
+    case States::error:
+      throw ErrorStateError();
+  } // switch (state)
+
+  PANIC();
+}
+
+/// \copydoc MemStreamReader::ReadSpan
+template<IStreamReader::Endian ENDIAN>
+void const * StaticMemStreamReader<ENDIAN>::ReadSpan(size_t const n)
+{
+  switch (state)
+  {
+    case States::open:
+    {
+      if (n > remainingBytes)
+        throw EmptyError();
+
+      DiscardBits();
+
+      if (n == 0U)
+      {
+        if (remainingBytes == 0U)
+          state = States::empty;
+
+        return nullptr;
+      }
+
+      char const * const pRet = pMem;
+      remainingBytes -= n;
+
+      if (remainingBytes == 0U)
+      {
+        // (empty now)
+        pMem = nullptr;
+        state = States::empty;
+      }
+      else
+      {
+        // (move read pointer forward)
+        pMem += n;
+      }
+
+      return pRet;
+    }
+
+    case States::empty:
+    {
+      if (n != 0U)
+        throw EmptyError();
+
+      return nullptr;
+    }
+
+    case States::closed:
+      throw ClosedError();
+
+    case States::error:
+      throw ErrorStateError();
+  } // switch (state)
+
+  PANIC();
+}
+
+/// \copydoc MemStreamReader::GetReadPtr
+template<IStreamReader::Endian ENDIAN>
+void const * StaticMemStreamReader<ENDIAN>::GetReadPtr(void const * const _pMem, size_t const _size) const
+{
+  if (state != States::open)
+    throw std::logic_error("StaticMemStreamReader::GetReadPtr: State is not 'open'");
+
+  // No more bytes left?
+  // Note: there may be up to 7 bits left to be read before the stream is empty.
+  if (remainingBytes == 0U)
+    throw std::logic_error("StaticMemStreamReader::GetReadPtr: No more bytes to be read.");
+
+  // Check authorization by comparing the end of this reader and the end of the memory described by _pMem and _size.
+  uintptr_t const thisEnd = reinterpret_cast<uintptr_t>(pMem) + remainingBytes;
+  uintptr_t const memEnd  = reinterpret_cast<uintptr_t>(_pMem) + _size;
+
+  if (thisEnd != memEnd)
+    throw std::logic_error("StaticMemStreamReader::GetReadPtr: _pMem and _size are not plausible.");
+
+  return pMem;
+}
+
+/// \copydoc IStreamReader::RemainingBytes
+template<IStreamReader::Endian ENDIAN>
+inline size_t StaticMemStreamReader<ENDIAN>::RemainingBytes(void) const
+{
+  switch (state)
+  {
+    case States::open:
+    case States::empty:
+      return remainingBytes;
+
+    case States::closed:
+      throw ClosedError();
+
+    case States::error:
+      throw ErrorStateError();
+  }
+
+  PANIC();
+}
+
+/// \copydoc IStreamReader::EnsureAllDataConsumed
+template<IStreamReader::Endian ENDIAN>
+void StaticMemStreamReader<ENDIAN>::EnsureAllDataConsumed(RemainingNbOfBits const expectation) const
+{
+  switch (state)
+  {
+    case States::open:
+    case States::empty:
+    {
+      switch (expectation)
+      {
+        case RemainingNbOfBits::sevenOrLess:
+        {
+          if (remainingBytes != 0U)
+            throw RemainingBitsError();
+          break;
+        }
+
+        case RemainingNbOfBits::moreThanSeven:
+        {
+          if (remainingBytes == 0U)
+            throw RemainingBitsError();
+          break;
+        }
+
+        case RemainingNbOfBits::any:
+        {
+          break;
+        }
+
+        default:
+        {
+          // (0..7)
+
+          if ((remainingBytes != 0U) || (nbOfBitsInBitData != static_cast<uint8_t>(expectation)))
+            throw RemainingBitsError();
+          break;
+        }
+      } // switch (expectation)
+
+      break;
+    } // case States::open / States::empty
+
+    case States::closed:
+      throw ClosedError();
+
+    case States::error:
+      throw ErrorStateError();
+  } // switch (state)
+}
+
+/// \copydoc IStreamReader::Close
+template<IStreamReader::Endian ENDIAN>
+inline void StaticMemStreamReader<ENDIAN>::Close(void) noexcept
+{
+  pMem = nullptr;
+  state = States::closed;
+}
+
+/// \copydoc IStreamReader::Skip
+template<IStreamReader::Endian ENDIAN>
+void StaticMemStreamReader<ENDIAN>::Skip(size_t nBits)
+{
+  if (nBits == 0U)
+    return;
+
+  switch (state)
+  {
+    case States::open:
+    {
+      // are there any bits that have not been read yet? -> skip them first
+      if (nbOfBitsInBitData != 0U)
+      {
+        // will all bits be skipped or will at least one bit be left?
+        if (nBits < nbOfBitsInBitData)
+        {
+          // (at least one bit will be left to be read after skip)
+          bitData >>= nBits;
+          nbOfBitsInBitData -= nBits;
+          return;
+        }
+
+        // (all bits are skipped)
+        nBits -= nbOfBitsInBitData;
+        bitData = 0;
+        nbOfBitsInBitData = 0;
+
+        // stream empty now?
+        if (pMem == nullptr)
+          state = States::empty;
+
+        // finished?
+        if (nBits == 0U)
+          return;
+      }
+
+      // at this point program logic guarantees, that "nbOfBitsInBitData" is zero and "nBits" is not zero
+
+      // no more bytes left?
+      if (pMem == nullptr)
+      {
+        state = States::error;
+        throw EmptyError();
+      }
+
+      // calculate the number of bytes and bits to be skipped
+      size_t       const skip_bytes = nBits / 8U;
+      uint_fast8_t const skip_bits  = nBits % 8U;
+
+      // skip bytes
+      if (skip_bytes > remainingBytes)
+      {
+        pMem = nullptr;
+        state = States::error;
+        throw EmptyError();
+      }
+      else if (skip_bytes == remainingBytes)
+      {
+        pMem = nullptr;
+        remainingBytes = 0;
+        state = States::empty;
+      }
+      else
+      {
+        pMem += skip_bytes;
+        remainingBytes -= skip_bytes;
+      }
+
+      // skip bits
+      if (skip_bits != 0U)
+      {
+        // no more bytes left?
+        if (pMem == nullptr)
+        {
+          state = States::error;
+          throw EmptyError();
+        }
+
+        bitData = static_cast<uint8_t>(*pMem) >> skip_bits;
+        nbOfBitsInBitData = 8U - skip_bits;
+
+        remainingBytes--;
+        if (remainingBytes == 0U)
+          pMem = nullptr;
+        else
+          pMem++;
+      }
+      break;
+    } // case States::open
+
+    case States::empty:
+    {
+      state = States::error;
+      throw EmptyError();
+    }
+
+    case States::closed:
+      throw ClosedError();
+
+    case States::error:
+      throw ErrorStateError();
+  } // switch (state)
+}
+
+/// \copydoc IStreamReader::Read_string
+template<IStreamReader::Endian ENDIAN>
+std::string StaticMemStreamReader<ENDIAN>::Read_string(void)
+{
+  DiscardBits();
+
+  switch (state)
+  {
+    case States::open:
+    {
+      ON_SCOPE_EXIT()
+      {
+        pMem = nullptr;
+        state = States::error;
+      };
+
+      // no more bytes left?
+      if (pMem == nullptr)
+        throw EmptyError();
+
+      // look for null-terminator
+      void const * const pNul = memchr(pMem, 0x00, remainingBytes);
+      if (pNul == nullptr)
+        throw std::runtime_error("StaticMemStreamReader::Read_string: No null-terminator located");
+
+      // Read n bytes into an std::string instance. null-terminator is dropped.
+      size_t const n = static_cast<size_t>(static_cast<char const*>(pNul) - pMem) + 1U;
+      std::string str(pMem, n - 1U);
+      pMem += n;
+      remainingBytes -= n;
+
+      // empty now?
+      if (remainingBytes == 0U)
+      {
+        pMem = nullptr;
+        state = States::empty;
+      }
+
+      ON_SCOPE_EXIT_DISMISS();
+      return str;
+    }
+
+    case States::empty:
+    {
+      state = States::error;
+      throw EmptyError();
+    }
+
+    case States::closed:
+      throw ClosedError();
+
+    case States::error:
+      throw ErrorStateError();
+  } // switch (state)
+
+  PANIC();
+}
+
+/// \copydoc IStreamReader::Read_line
+template<IStreamReader::Endian ENDIAN>
+std::string StaticMemStreamReader<ENDIAN>::Read_line(void)
+{
+  DiscardBits();
+
+  switch (state)
+  {
+    case States::open:
+    {
+      ON_SCOPE_EXIT()
+      {
+        pMem = nullptr;
+        state = States::error;
+      };
+
+      // no more bytes left?
+      if (pMem == nullptr)
+        throw EmptyError();
+
+      // Locate the byte (p) beyond the last character of the line.
+      // Note: remainingBytes is not zero
+      size_t n = remainingBytes;
+      char const * p = pMem;
+      char c = *p;
+      while ((c != '\n') && (c != '\r') && (c != 0x00))
+      {
+        --n;
+        ++p;
+
+        if (n == 0U)
+          break;
+
+        c = *p;
+      }
+
+      // Calculate number of characters the line is comprised of. This is excl. NUL, \n, or \r.
+      n = static_cast<size_t>(p - pMem);
+
+      // read n bytes into an std::string instance
+      std::string str(pMem, n);
+      pMem += n;
+      remainingBytes -= n;
+
+      // consume NUL, '\r', '\n', or '\r\n'
+      if (remainingBytes != 0U)
+      {
+        if (c == '\r')
+        {
+          // its a '\r' or '\r\n'
+          ++pMem;
+          --remainingBytes;
+
+          if ((remainingBytes != 0U) && (*pMem == '\n'))
+          {
+            // it was an '\r\n'
+            ++pMem;
+            --remainingBytes;
+          }
+        }
+        else
+        {
+          // its a NUL or '\n'
+          ++pMem;
+          --remainingBytes;
+        }
+      }
+
+      // empty now?
+      if (remainingBytes == 0U)
+      {
+        pMem = nullptr;
+        state = States::empty;
+      }
+
+      ON_SCOPE_EXIT_DISMISS();
+      return str;
+    }
+
+    case States::empty:
+    {
+      state = States::error;
+      throw EmptyError();
+    }
+
+    case States::closed:
+      throw ClosedError();
+
+    case States::error:
+      throw ErrorStateError();
+  } // switch (state)
+
+  PANIC();
+}
+
+/// \copydoc StreamReaderBase::Pop(void)
+template<IStreamReader::Endian ENDIAN>
+inline unsigned char StaticMemStreamReader<ENDIAN>::Pop(void)
+{
+  DiscardBits();
+
+  switch (state)
+  {
+    case States::open:
+    {
+      // no more bytes left?
+      if (pMem == nullptr)
+      {
+        state = States::error;
+        throw EmptyError();
+      }
+
+      // read one byte
+      unsigned char const c = static_cast<unsigned char>(*pMem++);
+      remainingBytes--;
+
+      // empty now?
+      if (remainingBytes == 0U)
+      {
+        pMem = nullptr;
+        state = States::empty;
+      }
+
+      return c;
+    }
+
+    case States::empty:
+    {
+      state = States::error;
+      throw EmptyError();
+    }
+
+    case States::closed:
+      throw ClosedError();
+
+    case States::error:
+      throw ErrorStateError();
+  } // switch (state)
+
+  PANIC();
+}
+
+/// \copydoc StreamReaderBase::Pop(void* p, size_t n)
+template<IStreamReader::Endian ENDIAN>
+inline void StaticMemStreamReader<ENDIAN>::Pop(void* p, size_t n)
+{
+  if (n == 0U)
+    return;
+
+  DiscardBits();
+
+  switch (state)
+  {
+    case States::open:
+    {
+      // does "n" exceed the remaining number of bytes?
+      if (n > remainingBytes)
+      {
+        pMem = nullptr;
+        state = States::error;
+        throw EmptyError();
+      }
+
+      // read data
+      memcpy(p, pMem, n);
+      pMem += n;
+      remainingBytes -= n;
+
+      // empty now?
+      if (remainingBytes == 0U)
+      {
+        pMem = nullptr;
+        state = States::empty;
+      }
+
+      break;
+    }
+
+    case States::empty:
+    {
+      state = States::error;
+      throw EmptyError();
+    }
+
+    case States::closed:
+      throw ClosedError();
+
+    case States::error:
+      throw ErrorStateError();
+  } // switch (state)
+}
+
+/// \copydoc StreamReaderBase::PopBits(uint_fast8_t n)
+template<IStreamReader::Endian ENDIAN>
+inline uint8_t StaticMemStreamReader<ENDIAN>::PopBits(uint_fast8_t n)
+{
+  if (n == 0U)
+    return 0;
+
+  if (n > 8U)
+    throw std::invalid_argument("StaticMemStreamReader::PopBits: n must be [0..8].");
+
+  switch (state)
+  {
+    case States::open:
+    {
+      // fetch next 8 bits required?
+      if (n > nbOfBitsInBitData)
+      {
+        // no more bytes left?
+        if (pMem == nullptr)
+        {
+          state = States::error;
+          throw EmptyError();
+        }
+
+        // read one byte
+        unsigned char const c = static_cast<unsigned char>(*pMem++);
+        remainingBytes--;
+
+        // no more bytes left?
+        if (remainingBytes == 0U)
+          pMem = nullptr;
+
+        // append read byte to bitData
+        bitData |= static_cast<uint16_t>(c) << nbOfBitsInBitData;
+        nbOfBitsInBitData += 8U;
+      }
+
+      // read bits
+      uint8_t const bits = bitData & ((1U << n) - 1U);
+      bitData >>= n;
+      nbOfBitsInBitData -= n;
+
+      // all bits read and stream empty?
+      if ((nbOfBitsInBitData == 0U) && (pMem == nullptr))
+        state = States::empty;
+
+      return bits;
+    }
+
+    case States::empty:
+    {
+      state = States::error;
+      throw EmptyError();
+    }
+
+    case States::closed:
+      throw ClosedError();
+
+    case States::error:
+      throw ErrorStateError();
+  } // switch (state)
+
+  PANIC();
+}
+
+/**
+ * \brief Discards any bits from the last read byte that have not yet been read.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * The state of the object is modified. Concurrent accesses are not safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ */
+template<IStreamReader::Endian ENDIAN>
+inline void StaticMemStreamReader<ENDIAN>::DiscardBits(void) noexcept
+{
+  nbOfBitsInBitData = 0;
+  bitData = 0;
+}
+
+} // namespace stream
+} // namespace gpcc
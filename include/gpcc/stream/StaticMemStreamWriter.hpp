@@ -0,0 +1,94 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#ifndef STATICMEMSTREAMWRITER_HPP_202610162215
+#define STATICMEMSTREAMWRITER_HPP_202610162215
+
+#include <gpcc/stream/StaticStreamWriterBase.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace gpcc   {
+namespace stream {
+
+/**
+ * \ingroup GPCC_STREAM
+ * \brief Header-only counterpart of @ref MemStreamWriter with the endian fixed at compile time.
+ *
+ * This offers the same API and the same semantics as @ref MemStreamWriter, but none of the methods is virtual and the
+ * endian of the data is a template parameter. If the type of the stream is known at the call site, then all write
+ * methods can be inlined completely and byte swapping is resolved at compile time.
+ *
+ * Use @ref StaticStreamWriterAdapter if an @ref IStreamWriter is required.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * Not thread-safe.
+ *
+ * \tparam ENDIAN
+ * Endian of the data written into the stream.
+ */
+template<IStreamWriter::Endian ENDIAN>
+class StaticMemStreamWriter final: public StaticStreamWriterBase<StaticMemStreamWriter<ENDIAN>, ENDIAN>
+{
+    friend class StaticStreamWriterBase<StaticMemStreamWriter<ENDIAN>, ENDIAN>;
+    using Base = StaticStreamWriterBase<StaticMemStreamWriter<ENDIAN>, ENDIAN>;
+
+  public:
+    using typename Base::States;
+
+    StaticMemStreamWriter(void) = delete;
+    StaticMemStreamWriter(void* const _pMem, size_t const _size);
+    StaticMemStreamWriter(StaticMemStreamWriter const & other) noexcept;
+    StaticMemStreamWriter(StaticMemStreamWriter&& other) noexcept;
+    ~StaticMemStreamWriter(void);
+
+    StaticMemStreamWriter& operator=(StaticMemStreamWriter const & rhv) noexcept;
+    StaticMemStreamWriter& operator=(StaticMemStreamWriter&& rhv) noexcept;
+
+    void* ReserveSpan(size_t const n);
+
+    constexpr bool IsRemainingCapacitySupported(void) const noexcept { return true; }
+    size_t RemainingCapacity(void) const;
+    uint_fast8_t GetNbOfCachedBits(void) const;
+
+    void Close(void) noexcept;
+
+  private:
+    using Base::state;
+
+    /// Pointer to the next byte that shall be written. nullptr = none.
+    char* pMem;
+
+    /// Remaining number of bytes that can be written.
+    /** This is valid in stream's states @ref States::open and @ref States::full. */
+    size_t remainingBytes;
+
+    /// Number of bits written via bit based write methods. The bits are stored in @ref bitData.
+    /** This is only valid if the stream's state is @ref States::open or @ref States::full. */
+    uint8_t nbOfBitsWritten;
+
+    /// Bits written via bit based write methods. The number of bits is stored in @ref nbOfBitsWritten.
+    /** This is only valid if the stream's state is @ref States::open. */
+    uint8_t bitData;
+
+
+    void Push(char c);
+    void Push(void const * pData, size_t n);
+    void PushBits(uint8_t bits, uint_fast8_t n);
+};
+
+} // namespace stream
+} // namespace gpcc
+
+#include "StaticMemStreamWriter.tcc"
+
+#endif // STATICMEMSTREAMWRITER_HPP_202610162215
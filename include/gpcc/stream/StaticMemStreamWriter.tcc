@@ -0,0 +1,427 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#include "StaticMemStreamWriter.hpp"
+#include <gpcc/osal/Panic.hpp>
+#include <gpcc/stream/stream_errors.hpp>
+#include <stdexcept>
+#include <cstring>
+
+namespace gpcc   {
+namespace stream {
+
+/**
+ * \brief Constructor.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \param _pMem
+ * Pointer to the memory that shall be written.\n
+ * nullptr is allowed, if `_size` is zero.
+ *
+ * \param _size
+ * Size of the memory block referenced by `_pMem`.\n
+ * If this is zero, then the stream will be created in state @ref IStreamWriter::States::full.
+ */
+template<IStreamWriter::Endian ENDIAN>
+StaticMemStreamWriter<ENDIAN>::StaticMemStreamWriter(void* const _pMem, size_t const _size)
+: Base((_size != 0U) ? States::open : States::full)
+, pMem(static_cast<char*>(_pMem))
+, remainingBytes(_size)
+, nbOfBitsWritten(0)
+, bitData(0)
+{
+  if ((remainingBytes != 0U) && (pMem == nullptr))
+    throw std::invalid_argument("StaticMemStreamWriter::StaticMemStreamWriter: _pMem == nullptr");
+}
+
+/// \copydoc MemStreamWriter::MemStreamWriter(MemStreamWriter const &)
+template<IStreamWriter::Endian ENDIAN>
+StaticMemStreamWriter<ENDIAN>::StaticMemStreamWriter(StaticMemStreamWriter const & other) noexcept
+: Base(other)
+, pMem(other.pMem)
+, remainingBytes(other.remainingBytes)
+, nbOfBitsWritten(other.nbOfBitsWritten)
+, bitData(other.bitData)
+{
+}
+
+/// \copydoc MemStreamWriter::MemStreamWriter(MemStreamWriter&&)
+template<IStreamWriter::Endian ENDIAN>
+StaticMemStreamWriter<ENDIAN>::StaticMemStreamWriter(StaticMemStreamWriter&& other) noexcept
+: Base(std::move(other))
+, pMem(other.pMem)
+, remainingBytes(other.remainingBytes)
+, nbOfBitsWritten(other.nbOfBitsWritten)
+, bitData(other.bitData)
+{
+  other.pMem = nullptr;
+  other.state = States::closed;
+}
+
+/// \copydoc MemStreamWriter::~MemStreamWriter
+template<IStreamWriter::Endian ENDIAN>
+StaticMemStreamWriter<ENDIAN>::~StaticMemStreamWriter(void)
+{
+  if (state != States::closed)
+    Close();
+}
+
+/// \copydoc MemStreamWriter::operator=(MemStreamWriter const &)
+template<IStreamWriter::Endian ENDIAN>
+StaticMemStreamWriter<ENDIAN>& StaticMemStreamWriter<ENDIAN>::operator=(StaticMemStreamWriter const & rhv) noexcept
+{
+  if (&rhv != this)
+  {
+    Close();
+
+    Base::operator=(rhv);
+    pMem = rhv.pMem;
+    remainingBytes = rhv.remainingBytes;
+    nbOfBitsWritten = rhv.nbOfBitsWritten;
+    bitData = rhv.bitData;
+  }
+
+  return *this;
+}
+
+/// \copydoc MemStreamWriter::operator=(MemStreamWriter&&)
+template<IStreamWriter::Endian ENDIAN>
+StaticMemStreamWriter<ENDIAN>& StaticMemStreamWriter<ENDIAN>::operator=(StaticMemStreamWriter&& rhv) noexcept
+{
+  if (&rhv != this)
+  {
+    Close();
+
+    Base::operator=(std::move(rhv));
+    pMem = rhv.pMem;
+    remainingBytes = rhv.remainingBytes;
+    nbOfBitsWritten = rhv.nbOfBitsWritten;
+    bitData = rhv.bitData;
+
+    rhv.pMem = nullptr;
+    rhv.state = States::closed;
+  }
+
+  return *this;
+}
+
+/// \copydoc MemStreamWriter::ReserveSpan
+template<IStreamWriter::Endian ENDIAN>
+void* StaticMemStreamWriter<ENDIAN>::ReserveSpan(size_t const n)
+{
+  switch (state)
+  {
+    case States::open:
+    {
+      if (n == 0U)
+        return nullptr;
+
+      // Any bits not yet written will occupy one byte in front of the reserved bytes.
+      // The design guarantees that one byte of capacity is left if there are any bits.
+      size_t const nbOfBitBytes = (nbOfBitsWritten != 0U) ? 1U : 0U;
+      if (n > remainingBytes - nbOfBitBytes)
+        throw FullError();
+
+      // write bits first if some bits are not yet written
+      if (nbOfBitsWritten != 0U)
+      {
+        *pMem++ = static_cast<char>(bitData);
+        remainingBytes--;
+        nbOfBitsWritten = 0;
+        bitData = 0;
+      }
+
+      char * const pRet = pMem;
+      remainingBytes -= n;
+
+      // full?
+      if (remainingBytes == 0U)
+      {
+        pMem = nullptr;
+        state = States::full;
+      }
+      else
+      {
+        pMem += n;
+      }
+
+      return pRet;
+    }
+
+    case States::full:
+    {
+      if (n != 0U)
+        throw FullError();
+
+      return nullptr;
+    }
+
+    case States::closed:
+      throw ClosedError();
+
+    case States::error:
+      throw ErrorStateError();
+  } // switch (state)
+
+  PANIC();
+}
+
+/// \copydoc IStreamWriter::RemainingCapacity
+template<IStreamWriter::Endian ENDIAN>
+inline size_t StaticMemStreamWriter<ENDIAN>::RemainingCapacity(void) const
+{
+  switch (state)
+  {
+    case States::open:
+    case States::full:
+      return remainingBytes;
+
+    case States::closed:
+      throw ClosedError();
+
+    case States::error:
+      throw ErrorStateError();
+  }
+
+  PANIC();
+}
+
+/// \copydoc IStreamWriter::GetNbOfCachedBits
+template<IStreamWriter::Endian ENDIAN>
+inline uint_fast8_t StaticMemStreamWriter<ENDIAN>::GetNbOfCachedBits(void) const
+{
+  switch (state)
+  {
+    case States::open:
+    case States::full:
+      return nbOfBitsWritten;
+
+    case States::closed:
+      throw ClosedError();
+
+    case States::error:
+      throw ErrorStateError();
+  }
+
+  PANIC();
+}
+
+/// \copydoc IStreamWriter::Close
+template<IStreamWriter::Endian ENDIAN>
+void StaticMemStreamWriter<ENDIAN>::Close(void) noexcept
+{
+  if (state == States::open)
+  {
+    // any bits left to be written?
+    if (nbOfBitsWritten != 0U)
+    {
+      // the design guarantees that one byte of capacity is left
+      *pMem++ = static_cast<char>(bitData);
+      remainingBytes--;
+    }
+  }
+
+  pMem = nullptr;
+  state = States::closed;
+}
+
+/// \copydoc StreamWriterBase::Push(char c)
+template<IStreamWriter::Endian ENDIAN>
+inline void StaticMemStreamWriter<ENDIAN>::Push(char c)
+{
+  // Write bits first if some bits are not yet written so that the byte based data will
+  // be aligned to a byte boundary.
+  if (nbOfBitsWritten != 0U)
+  {
+    // move the bits to be written into d
+    char const d = static_cast<char>(bitData);
+
+    // clear bit buffer now and not after writing the bits, because we are going to call this method recursive now!
+    nbOfBitsWritten = 0;
+    bitData = 0;
+
+    // write bits
+    Push(d);
+  }
+
+  switch (state)
+  {
+    case States::open:
+    {
+      // write byte
+      *pMem++ = c;
+      remainingBytes--;
+
+      // full?
+      if (remainingBytes == 0U)
+      {
+        pMem = nullptr;
+        state = States::full;
+      }
+      break;
+    }
+
+    case States::full:
+    {
+      state = States::error;
+      throw FullError();
+    }
+
+    case States::closed:
+      throw ClosedError();
+
+    case States::error:
+      throw ErrorStateError();
+  } // switch (state)
+}
+
+/// \copydoc StreamWriterBase::Push(void const * pData, size_t n)
+template<IStreamWriter::Endian ENDIAN>
+inline void StaticMemStreamWriter<ENDIAN>::Push(void const * pData, size_t n)
+{
+  if (n == 0U)
+    return;
+
+  // Write bits first if some bits are not yet written so that the byte based data will
+  // be aligned to a byte boundary.
+  if (nbOfBitsWritten != 0U)
+  {
+    // move the bits to be written into d
+    char const d = static_cast<char>(bitData);
+
+    // clear bit buffer now and not after writing the bits, because we are going to call Push(char) now!
+    nbOfBitsWritten = 0;
+    bitData = 0;
+
+    // write bits
+    Push(d);
+  }
+
+  switch (state)
+  {
+    case States::open:
+    {
+      // does "n" exceed the remaining capacity?
+      if (n > remainingBytes)
+      {
+        pMem = nullptr;
+        state = States::error;
+        throw FullError();
+      }
+
+      // write bytes
+      memcpy(pMem, pData, n);
+      pMem += n;
+      remainingBytes -= n;
+
+      // full?
+      if (remainingBytes == 0U)
+      {
+        pMem = nullptr;
+        state = States::full;
+      }
+
+      break;
+    }
+
+    case States::full:
+    {
+      state = States::error;
+      throw FullError();
+    }
+
+    case States::closed:
+      throw ClosedError();
+
+    case States::error:
+      throw ErrorStateError();
+  } // switch (state)
+}
+
+/// \copydoc StreamWriterBase::PushBits
+template<IStreamWriter::Endian ENDIAN>
+inline void StaticMemStreamWriter<ENDIAN>::PushBits(uint8_t bits, uint_fast8_t n)
+{
+  if (n == 0U)
+    return;
+
+  if (n > 8U)
+    throw std::invalid_argument("StaticMemStreamWriter::PushBits: n must be [0..8].");
+
+  switch (state)
+  {
+    case States::open:
+    {
+      // clear upper bits that shall be ignored
+      bits &= (1U << n) - 1U;
+
+      // combine potential previously written bits with the bits that shall be written
+      uint_fast16_t data = static_cast<uint_fast16_t>(bitData) | (static_cast<uint_fast16_t>(bits) << nbOfBitsWritten);
+      nbOfBitsWritten += n;
+
+      // one byte filled up with bits?
+      if (nbOfBitsWritten >= 8U)
+      {
+        // write byte into the stream
+        *pMem++ = static_cast<char>(data);
+        remainingBytes--;
+
+        nbOfBitsWritten -= 8U;
+        data >>= 8U;
+
+        // buffer full?
+        if (remainingBytes == 0U)
+        {
+          pMem = nullptr;
+
+          // more bits to be written?
+          if (nbOfBitsWritten != 0U)
+          {
+            // wrote beyond end of stream
+            state = States::error;
+            throw FullError();
+          }
+
+          state = States::full;
+        }
+      }
+
+      // store temporary stuff back in bitData
+      bitData = static_cast<uint8_t>(data);
+
+      break;
+    }
+
+    case States::full:
+    {
+      // (attempt to write to a full buffer)
+      state = States::error;
+      throw FullError();
+    }
+
+    case States::closed:
+      throw ClosedError();
+
+    case States::error:
+      throw ErrorStateError();
+  } // switch (state)
+}
+
+} // namespace stream
+} // namespace gpcc
@@ -0,0 +1,127 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#ifndef STATICSTREAMREADERADAPTER_HPP_202610162215
+#define STATICSTREAMREADERADAPTER_HPP_202610162215
+
+#include <gpcc/stream/IStreamReader.hpp>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+
+namespace gpcc   {
+namespace stream {
+
+/**
+ * \ingroup GPCC_STREAM
+ * \brief Exposes a stream reader derived from @ref StaticStreamReaderBase via the @ref IStreamReader interface.
+ *
+ * This is intended for code paths that require type erasure, e.g. to pass a @ref StaticMemStreamReader to a
+ * function that takes an @ref IStreamReader. Each method of the @ref IStreamReader interface is forwarded to the
+ * adapted stream. The adapted stream must not be destroyed or moved while it is referenced by an adapter.
+ *
+ * Closing the adapter closes the adapted stream.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * Not thread-safe.
+ *
+ * \tparam READER
+ * Type of the adapted stream reader.
+ */
+template<class READER>
+class StaticStreamReaderAdapter final: public IStreamReader
+{
+  public:
+    StaticStreamReaderAdapter(void) = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * - - -
+     *
+     * __Exception safety:__\n
+     * No-throw guarantee.
+     *
+     * __Thread cancellation safety:__\n
+     * No cancellation point included.
+     *
+     * - - -
+     *
+     * \param _reader
+     * Stream reader that shall be exposed via the @ref IStreamReader interface.\n
+     * The referenced object must live longer than the adapter.
+     */
+    explicit StaticStreamReaderAdapter(READER & _reader) noexcept : IStreamReader(), reader(_reader) {}
+
+    StaticStreamReaderAdapter(StaticStreamReaderAdapter const &) = delete;
+    StaticStreamReaderAdapter(StaticStreamReaderAdapter &&) = delete;
+    ~StaticStreamReaderAdapter(void) = default;
+
+    StaticStreamReaderAdapter& operator=(StaticStreamReaderAdapter const &) = delete;
+    StaticStreamReaderAdapter& operator=(StaticStreamReaderAdapter &&) = delete;
+
+    // --> IStreamReader
+    States GetState(void) const override { return reader.GetState(); }
+    Endian GetEndian(void) const override { return reader.GetEndian(); }
+
+    bool IsRemainingBytesSupported(void) const override { return reader.IsRemainingBytesSupported(); }
+    size_t RemainingBytes(void) const override { return reader.RemainingBytes(); }
+    void EnsureAllDataConsumed(RemainingNbOfBits const expectation) const override
+    {
+      reader.EnsureAllDataConsumed(expectation);
+    }
+
+    void Close(void) override { reader.Close(); }
+
+    void Skip(size_t nBits) override { reader.Skip(nBits); }
+
+    uint8_t     Read_uint8(void)          override { return reader.Read_uint8();  }
+    uint16_t    Read_uint16(void)         override { return reader.Read_uint16(); }
+    uint32_t    Read_uint32(void)         override { return reader.Read_uint32(); }
+    uint64_t    Read_uint64(void)         override { return reader.Read_uint64(); }
+    int8_t      Read_int8(void)           override { return reader.Read_int8();   }
+    int16_t     Read_int16(void)          override { return reader.Read_int16();  }
+    int32_t     Read_int32(void)          override { return reader.Read_int32();  }
+    int64_t     Read_int64(void)          override { return reader.Read_int64();  }
+    float       Read_float(void)          override { return reader.Read_float();  }
+    double      Read_double(void)         override { return reader.Read_double(); }
+    bool        Read_bool(void)           override { return reader.Read_bool();   }
+    bool        Read_bit(void)            override { return reader.Read_bit();    }
+    uint8_t     Read_bits(uint_fast8_t n) override { return reader.Read_bits(n);  }
+    char        Read_char(void)           override { return reader.Read_char();   }
+    std::string Read_string(void)         override { return reader.Read_string(); }
+    std::string Read_line(void)           override { return reader.Read_line();   }
+
+    void Read_uint8( uint8_t*  pDest, size_t n) override { reader.Read_uint8(pDest, n);  }
+    void Read_uint16(uint16_t* pDest, size_t n) override { reader.Read_uint16(pDest, n); }
+    void Read_uint32(uint32_t* pDest, size_t n) override { reader.Read_uint32(pDest, n); }
+    void Read_uint64(uint64_t* pDest, size_t n) override { reader.Read_uint64(pDest, n); }
+    void Read_int8(  int8_t*   pDest, size_t n) override { reader.Read_int8(pDest, n);   }
+    void Read_int16( int16_t*  pDest, size_t n) override { reader.Read_int16(pDest, n);  }
+    void Read_int32( int32_t*  pDest, size_t n) override { reader.Read_int32(pDest, n);  }
+    void Read_int64( int64_t*  pDest, size_t n) override { reader.Read_int64(pDest, n);  }
+    void Read_float( float*    pDest, size_t n) override { reader.Read_float(pDest, n);  }
+    void Read_double(double*   pDest, size_t n) override { reader.Read_double(pDest, n); }
+    void Read_bool(  bool*     pDest, size_t n) override { reader.Read_bool(pDest, n);   }
+    void Read_bits(  uint8_t*  pDest, size_t n) override { reader.Read_bits(pDest, n);   }
+    void Read_char(  char*     pDest, size_t n) override { reader.Read_char(pDest, n);   }
+    // <-- IStreamReader
+
+  private:
+    /// The adapted stream reader.
+    READER & reader;
+};
+
+} // namespace stream
+} // namespace gpcc
+
+#endif // STATICSTREAMREADERADAPTER_HPP_202610162215
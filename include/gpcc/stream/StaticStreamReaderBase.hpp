@@ -0,0 +1,153 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#ifndef STATICSTREAMREADERBASE_HPP_202610162215
+#define STATICSTREAMREADERBASE_HPP_202610162215
+
+#include <gpcc/stream/internal/byte_order.hpp>
+#include <gpcc/stream/IStreamReader.hpp>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+
+namespace gpcc   {
+namespace stream {
+
+/**
+ * \ingroup GPCC_STREAM
+ * \brief CRTP base class for stream readers whose read methods are resolved at compile time.
+ *
+ * This is the compile-time counterpart of @ref StreamReaderBase. It offers the same read methods and the same
+ * semantics as @ref IStreamReader, but none of the methods is virtual. The endian of the data is a template parameter,
+ * so byte swapping is resolved at compile time, too. If the type of the stream is known at the call site, then all
+ * read methods can be inlined completely. This is intended for hot serialization paths with fixed record layouts.
+ *
+ * Subclasses must pass themselves as template parameter `DERIVED` and they must implement the following methods.
+ * The methods may be private if the subclass declares @ref StaticStreamReaderBase a friend:
+ * - `bool IsRemainingBytesSupported(void) const`
+ * - `size_t RemainingBytes(void) const`
+ * - `void EnsureAllDataConsumed(RemainingNbOfBits const expectation) const`
+ * - `void Close(void)`
+ * - `void Skip(size_t nBits)`
+ * - `std::string Read_string(void)`
+ * - `std::string Read_line(void)`
+ * - `unsigned char Pop(void)`
+ * - `void Pop(void* p, size_t n)`
+ * - `uint8_t PopBits(uint_fast8_t n)`
+ *
+ * The semantics of `Pop()` and `PopBits()` are identical to @ref StreamReaderBase::Pop(void),
+ * @ref StreamReaderBase::Pop(void* p, size_t n), and @ref StreamReaderBase::PopBits().
+ *
+ * Use @ref StaticStreamReaderAdapter to pass a stream derived from this class to code that expects an
+ * @ref IStreamReader.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * Not thread-safe.
+ *
+ * \tparam DERIVED
+ * Class derived from this class.
+ *
+ * \tparam ENDIAN
+ * Endian of the data inside the stream.
+ */
+template<class DERIVED, IStreamReader::Endian ENDIAN>
+class StaticStreamReaderBase
+{
+  public:
+    using States = IStreamReader::States;
+    using Endian = IStreamReader::Endian;
+    using RemainingNbOfBits = IStreamReader::RemainingNbOfBits;
+
+    /// Endian of the data inside the stream.
+    static constexpr Endian endian = ENDIAN;
+
+
+    inline DERIVED& operator>> (uint8_t     & value) { value = Read_uint8();  return Derived(); }
+    inline DERIVED& operator>> (uint16_t    & value) { value = Read_uint16(); return Derived(); }
+    inline DERIVED& operator>> (uint32_t    & value) { value = Read_uint32(); return Derived(); }
+    inline DERIVED& operator>> (uint64_t    & value) { value = Read_uint64(); return Derived(); }
+    inline DERIVED& operator>> (int8_t      & value) { value = Read_int8();   return Derived(); }
+    inline DERIVED& operator>> (int16_t     & value) { value = Read_int16();  return Derived(); }
+    inline DERIVED& operator>> (int32_t     & value) { value = Read_int32();  return Derived(); }
+    inline DERIVED& operator>> (int64_t     & value) { value = Read_int64();  return Derived(); }
+    inline DERIVED& operator>> (float       & value) { value = Read_float();  return Derived(); }
+    inline DERIVED& operator>> (double      & value) { value = Read_double(); return Derived(); }
+    inline DERIVED& operator>> (bool        & value) { value = Read_bool();   return Derived(); }
+    inline DERIVED& operator>> (char        & value) { value = Read_char();   return Derived(); }
+    inline DERIVED& operator>> (std::string & value) { value = Derived().Read_string(); return Derived(); }
+
+
+    States GetState(void) const noexcept;
+    constexpr Endian GetEndian(void) const noexcept { return ENDIAN; }
+
+    uint8_t     Read_uint8(void);
+    uint16_t    Read_uint16(void);
+    uint32_t    Read_uint32(void);
+    uint64_t    Read_uint64(void);
+    int8_t      Read_int8(void);
+    int16_t     Read_int16(void);
+    int32_t     Read_int32(void);
+    int64_t     Read_int64(void);
+    float       Read_float(void);
+    double      Read_double(void);
+    bool        Read_bool(void);
+    bool        Read_bit(void);
+    uint8_t     Read_bits(uint_fast8_t n);
+    char        Read_char(void);
+
+    void Read_uint8( uint8_t*  pDest, size_t n);
+    void Read_uint16(uint16_t* pDest, size_t n);
+    void Read_uint32(uint32_t* pDest, size_t n);
+    void Read_uint64(uint64_t* pDest, size_t n);
+    void Read_int8(  int8_t*   pDest, size_t n);
+    void Read_int16( int16_t*  pDest, size_t n);
+    void Read_int32( int32_t*  pDest, size_t n);
+    void Read_int64( int64_t*  pDest, size_t n);
+    void Read_float( float*    pDest, size_t n);
+    void Read_double(double*   pDest, size_t n);
+    void Read_bool(  bool*     pDest, size_t n);
+    void Read_bits(  uint8_t*  pDest, size_t n);
+    void Read_char(  char*     pDest, size_t n);
+
+  protected:
+    /// Flag indicating if the byte order of the data inside the stream differs from the byte order of the host.
+    static constexpr bool byteSwapRequired = ((ENDIAN == Endian::Little) != internal::hostIsLittleEndian);
+
+    /// Current state of the stream reader.
+    States state;
+
+
+    StaticStreamReaderBase(void) = delete;
+    explicit StaticStreamReaderBase(States const _state) noexcept;
+    StaticStreamReaderBase(StaticStreamReaderBase const &) noexcept = default;
+    StaticStreamReaderBase(StaticStreamReaderBase &&) noexcept = default;
+    ~StaticStreamReaderBase(void) = default;
+
+    StaticStreamReaderBase& operator=(StaticStreamReaderBase const &) noexcept = default;
+    StaticStreamReaderBase& operator=(StaticStreamReaderBase &&) noexcept = default;
+
+  private:
+    inline DERIVED& Derived(void) noexcept { return *static_cast<DERIVED*>(this); }
+
+    template<typename T>
+    T PopSwapped(void);
+
+    template<typename T>
+    void PopSwapped(void* pDest, size_t n);
+};
+
+} // namespace stream
+} // namespace gpcc
+
+#include "StaticStreamReaderBase.tcc"
+
+#endif // STATICSTREAMREADERBASE_HPP_202610162215
@@ -0,0 +1,317 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#include "StaticStreamReaderBase.hpp"
+#include <cstring>
+
+namespace gpcc   {
+namespace stream {
+
+/// \copydoc IStreamReader::GetState
+template<class DERIVED, IStreamReader::Endian ENDIAN>
+inline IStreamReader::States StaticStreamReaderBase<DERIVED, ENDIAN>::GetState(void) const noexcept
+{
+  return state;
+}
+
+/// \copydoc IStreamReader::Read_uint8(void)
+template<class DERIVED, IStreamReader::Endian ENDIAN>
+inline uint8_t StaticStreamReaderBase<DERIVED, ENDIAN>::Read_uint8(void)
+{
+  return static_cast<uint8_t>(Derived().Pop());
+}
+
+/// \copydoc IStreamReader::Read_uint16(void)
+template<class DERIVED, IStreamReader::Endian ENDIAN>
+inline uint16_t StaticStreamReaderBase<DERIVED, ENDIAN>::Read_uint16(void)
+{
+  return PopSwapped<uint16_t>();
+}
+
+/// \copydoc IStreamReader::Read_uint32(void)
+template<class DERIVED, IStreamReader::Endian ENDIAN>
+inline uint32_t StaticStreamReaderBase<DERIVED, ENDIAN>::Read_uint32(void)
+{
+  return PopSwapped<uint32_t>();
+}
+
+/// \copydoc IStreamReader::Read_uint64(void)
+template<class DERIVED, IStreamReader::Endian ENDIAN>
+inline uint64_t StaticStreamReaderBase<DERIVED, ENDIAN>::Read_uint64(void)
+{
+  return PopSwapped<uint64_t>();
+}
+
+/// \copydoc IStreamReader::Read_int8(void)
+template<class DERIVED, IStreamReader::Endian ENDIAN>
+inline int8_t StaticStreamReaderBase<DERIVED, ENDIAN>::Read_int8(void)
+{
+  return static_cast<int8_t>(Derived().Pop());
+}
+
+/// \copydoc IStreamReader::Read_int16(void)
+template<class DERIVED, IStreamReader::Endian ENDIAN>
+inline int16_t StaticStreamReaderBase<DERIVED, ENDIAN>::Read_int16(void)
+{
+  return static_cast<int16_t>(PopSwapped<uint16_t>());
+}
+
+/// \copydoc IStreamReader::Read_int32(void)
+template<class DERIVED, IStreamReader::Endian ENDIAN>
+inline int32_t StaticStreamReaderBase<DERIVED, ENDIAN>::Read_int32(void)
+{
+  return static_cast<int32_t>(PopSwapped<uint32_t>());
+}
+
+/// \copydoc IStreamReader::Read_int64(void)
+template<class DERIVED, IStreamReader::Endian ENDIAN>
+inline int64_t StaticStreamReaderBase<DERIVED, ENDIAN>::Read_int64(void)
+{
+  return static_cast<int64_t>(PopSwapped<uint64_t>());
+}
+
+/// \copydoc IStreamReader::Read_float(void)
+template<class DERIVED, IStreamReader::Endian ENDIAN>
+inline float StaticStreamReaderBase<DERIVED, ENDIAN>::Read_float(void)
+{
+  uint32_t const tmp = PopSwapped<uint32_t>();
+  float f;
+  memcpy(&f, &tmp, sizeof(f));
+  return f;
+}
+
+/// \copydoc IStreamReader::Read_double(void)
+template<class DERIVED, IStreamReader::Endian ENDIAN>
+inline double StaticStreamReaderBase<DERIVED, ENDIAN>::Read_double(void)
+{
+  uint64_t const tmp = PopSwapped<uint64_t>();
+  double d;
+  memcpy(&d, &tmp, sizeof(d));
+  return d;
+}
+
+/// \copydoc IStreamReader::Read_bool(void)
+template<class DERIVED, IStreamReader::Endian ENDIAN>
+inline bool StaticStreamReaderBase<DERIVED, ENDIAN>::Read_bool(void)
+{
+  return (Derived().PopBits(1U) != 0U);
+}
+
+/// \copydoc IStreamReader::Read_bit(void)
+template<class DERIVED, IStreamReader::Endian ENDIAN>
+inline bool StaticStreamReaderBase<DERIVED, ENDIAN>::Read_bit(void)
+{
+  return (Derived().PopBits(1U) != 0U);
+}
+
+/// \copydoc IStreamReader::Read_bits(uint_fast8_t)
+template<class DERIVED, IStreamReader::Endian ENDIAN>
+inline uint8_t StaticStreamReaderBase<DERIVED, ENDIAN>::Read_bits(uint_fast8_t n)
+{
+  return Derived().PopBits(n);
+}
+
+/// \copydoc IStreamReader::Read_char(void)
+template<class DERIVED, IStreamReader::Endian ENDIAN>
+inline char StaticStreamReaderBase<DERIVED, ENDIAN>::Read_char(void)
+{
+  return static_cast<char>(Derived().Pop());
+}
+
+/// \copydoc IStreamReader::Read_uint8(uint8_t*,size_t)
+template<class DERIVED, IStreamReader::Endian ENDIAN>
+inline void StaticStreamReaderBase<DERIVED, ENDIAN>::Read_uint8(uint8_t* pDest, size_t n)
+{
+  Derived().Pop(pDest, n);
+}
+
+/// \copydoc IStreamReader::Read_uint16(uint16_t*,size_t)
+template<class DERIVED, IStreamReader::Endian ENDIAN>
+inline void StaticStreamReaderBase<DERIVED, ENDIAN>::Read_uint16(uint16_t* pDest, size_t n)
+{
+  PopSwapped<uint16_t>(pDest, n);
+}
+
+/// \copydoc IStreamReader::Read_uint32(uint32_t*,size_t)
+template<class DERIVED, IStreamReader::Endian ENDIAN>
+inline void StaticStreamReaderBase<DERIVED, ENDIAN>::Read_uint32(uint32_t* pDest, size_t n)
+{
+  PopSwapped<uint32_t>(pDest, n);
+}
+
+/// \copydoc IStreamReader::Read_uint64(uint64_t*,size_t)
+template<class DERIVED, IStreamReader::Endian ENDIAN>
+inline void StaticStreamReaderBase<DERIVED, ENDIAN>::Read_uint64(uint64_t* pDest, size_t n)
+{
+  PopSwapped<uint64_t>(pDest, n);
+}
+
+/// \copydoc IStreamReader::Read_int8(int8_t*,size_t)
+template<class DERIVED, IStreamReader::Endian ENDIAN>
+inline void StaticStreamReaderBase<DERIVED, ENDIAN>::Read_int8(int8_t* pDest, size_t n)
+{
+  Derived().Pop(pDest, n);
+}
+
+/// \copydoc IStreamReader::Read_int16(int16_t*,size_t)
+template<class DERIVED, IStreamReader::Endian ENDIAN>
+inline void StaticStreamReaderBase<DERIVED, ENDIAN>::Read_int16(int16_t* pDest, size_t n)
+{
+  PopSwapped<uint16_t>(pDest, n);
+}
+
+/// \copydoc IStreamReader::Read_int32(int32_t*,size_t)
+template<class DERIVED, IStreamReader::Endian ENDIAN>
+inline void StaticStreamReaderBase<DERIVED, ENDIAN>::Read_int32(int32_t* pDest, size_t n)
+{
+  PopSwapped<uint32_t>(pDest, n);
+}
+
+/// \copydoc IStreamReader::Read_int64(int64_t*,size_t)
+template<class DERIVED, IStreamReader::Endian ENDIAN>
+inline void StaticStreamReaderBase<DERIVED, ENDIAN>::Read_int64(int64_t* pDest, size_t n)
+{
+  PopSwapped<uint64_t>(pDest, n);
+}
+
+/// \copydoc IStreamReader::Read_float(float*,size_t)
+template<class DERIVED, IStreamReader::Endian ENDIAN>
+inline void StaticStreamReaderBase<DERIVED, ENDIAN>::Read_float(float* pDest, size_t n)
+{
+  PopSwapped<uint32_t>(pDest, n);
+}
+
+/// \copydoc IStreamReader::Read_double(double*,size_t)
+template<class DERIVED, IStreamReader::Endian ENDIAN>
+inline void StaticStreamReaderBase<DERIVED, ENDIAN>::Read_double(double* pDest, size_t n)
+{
+  PopSwapped<uint64_t>(pDest, n);
+}
+
+/// \copydoc IStreamReader::Read_bool(bool*,size_t)
+template<class DERIVED, IStreamReader::Endian ENDIAN>
+inline void StaticStreamReaderBase<DERIVED, ENDIAN>::Read_bool(bool* pDest, size_t n)
+{
+  while (n-- != 0U)
+    *pDest++ = (Derived().PopBits(1U) != 0U);
+}
+
+/// \copydoc IStreamReader::Read_bits(uint8_t*,size_t)
+template<class DERIVED, IStreamReader::Endian ENDIAN>
+inline void StaticStreamReaderBase<DERIVED, ENDIAN>::Read_bits(uint8_t* pDest, size_t n)
+{
+  while (n >= 8U)
+  {
+    *pDest++ = Derived().PopBits(8U);
+    n -= 8U;
+  }
+  if (n != 0U)
+    *pDest = Derived().PopBits(n);
+}
+
+/// \copydoc IStreamReader::Read_char(char*,size_t)
+template<class DERIVED, IStreamReader::Endian ENDIAN>
+inline void StaticStreamReaderBase<DERIVED, ENDIAN>::Read_char(char* pDest, size_t n)
+{
+  Derived().Pop(pDest, n);
+}
+
+/**
+ * \brief Constructor.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \param _state
+ * Desired initial state for the stream.
+ */
+template<class DERIVED, IStreamReader::Endian ENDIAN>
+StaticStreamReaderBase<DERIVED, ENDIAN>::StaticStreamReaderBase(States const _state) noexcept
+: state(_state)
+{
+}
+
+/**
+ * \brief Pops a multi-byte value from the stream and converts it from the stream's endian to the host's endian.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * The state of the object is modified. Concurrent accesses are not safe.
+ *
+ * __Exception safety:__\n
+ * Same as `DERIVED::Pop(void* p, size_t n)`.
+ *
+ * __Thread cancellation safety:__\n
+ * Same as `DERIVED::Pop(void* p, size_t n)`.
+ *
+ * - - -
+ *
+ * \tparam T
+ * Unsigned integer type of the value (`uint16_t`, `uint32_t`, or `uint64_t`).
+ *
+ * \return
+ * Value read from the stream.
+ */
+template<class DERIVED, IStreamReader::Endian ENDIAN>
+template<typename T>
+inline T StaticStreamReaderBase<DERIVED, ENDIAN>::PopSwapped(void)
+{
+  T retVal;
+  Derived().Pop(&retVal, sizeof(retVal));
+  if constexpr (byteSwapRequired)
+    retVal = internal::ByteSwap(retVal);
+  return retVal;
+}
+
+/**
+ * \brief Pops an array of multi-byte values from the stream and converts each element from the stream's endian to
+ *        the host's endian.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * The state of the object is modified. Concurrent accesses are not safe.
+ *
+ * __Exception safety:__\n
+ * Same as `DERIVED::Pop(void* p, size_t n)`.
+ *
+ * __Thread cancellation safety:__\n
+ * Same as `DERIVED::Pop(void* p, size_t n)`.
+ *
+ * - - -
+ *
+ * \tparam T
+ * Unsigned integer type with the size of one element (`uint16_t`, `uint32_t`, or `uint64_t`).
+ *
+ * \param pDest
+ * Pointer to the destination array.
+ *
+ * \param n
+ * Number of elements.
+ */
+template<class DERIVED, IStreamReader::Endian ENDIAN>
+template<typename T>
+inline void StaticStreamReaderBase<DERIVED, ENDIAN>::PopSwapped(void* pDest, size_t n)
+{
+  Derived().Pop(pDest, n * sizeof(T));
+  if constexpr (byteSwapRequired)
+    internal::ByteSwapInPlace<T>(pDest, n);
+}
+
+} // namespace stream
+} // namespace gpcc
@@ -0,0 +1,128 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#ifndef STATICSTREAMWRITERADAPTER_HPP_202610162215
+#define STATICSTREAMWRITERADAPTER_HPP_202610162215
+
+#include <gpcc/stream/IStreamWriter.hpp>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+
+namespace gpcc   {
+namespace stream {
+
+/**
+ * \ingroup GPCC_STREAM
+ * \brief Exposes a stream writer derived from @ref StaticStreamWriterBase via the @ref IStreamWriter interface.
+ *
+ * This is intended for code paths that require type erasure, e.g. to pass a @ref StaticMemStreamWriter to a
+ * function that takes an @ref IStreamWriter. Each method of the @ref IStreamWriter interface is forwarded to the
+ * adapted stream. The adapted stream must not be destroyed or moved while it is referenced by an adapter.
+ *
+ * Closing the adapter closes the adapted stream.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * Not thread-safe.
+ *
+ * \tparam WRITER
+ * Type of the adapted stream writer.
+ */
+template<class WRITER>
+class StaticStreamWriterAdapter final: public IStreamWriter
+{
+  public:
+    StaticStreamWriterAdapter(void) = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * - - -
+     *
+     * __Exception safety:__\n
+     * No-throw guarantee.
+     *
+     * __Thread cancellation safety:__\n
+     * No cancellation point included.
+     *
+     * - - -
+     *
+     * \param _writer
+     * Stream writer that shall be exposed via the @ref IStreamWriter interface.\n
+     * The referenced object must live longer than the adapter.
+     */
+    explicit StaticStreamWriterAdapter(WRITER & _writer) noexcept : IStreamWriter(), writer(_writer) {}
+
+    StaticStreamWriterAdapter(StaticStreamWriterAdapter const &) = delete;
+    StaticStreamWriterAdapter(StaticStreamWriterAdapter &&) = delete;
+    ~StaticStreamWriterAdapter(void) = default;
+
+    StaticStreamWriterAdapter& operator=(StaticStreamWriterAdapter const &) = delete;
+    StaticStreamWriterAdapter& operator=(StaticStreamWriterAdapter &&) = delete;
+
+    // --> IStreamWriter
+    States GetState(void) const override { return writer.GetState(); }
+    Endian GetEndian(void) const override { return writer.GetEndian(); }
+
+    bool IsRemainingCapacitySupported(void) const override { return writer.IsRemainingCapacitySupported(); }
+    size_t RemainingCapacity(void) const override { return writer.RemainingCapacity(); }
+    uint_fast8_t GetNbOfCachedBits(void) const override { return writer.GetNbOfCachedBits(); }
+
+    void Close(void) override { writer.Close(); }
+
+    uint_fast8_t AlignToByteBoundary(bool const fillWithOnesNotZeros) override
+    {
+      return writer.AlignToByteBoundary(fillWithOnesNotZeros);
+    }
+    void FillBits(size_t n, bool const oneNotZero) override { writer.FillBits(n, oneNotZero); }
+    void FillBytes(size_t n, uint8_t const value) override { writer.FillBytes(n, value); }
+
+    void Write_uint8(uint8_t data)                       override { writer.Write_uint8(data);      }
+    void Write_uint8(uint8_t const * pData, size_t n)    override { writer.Write_uint8(pData, n);  }
+    void Write_uint16(uint16_t data)                     override { writer.Write_uint16(data);     }
+    void Write_uint16(uint16_t const * pData, size_t n)  override { writer.Write_uint16(pData, n); }
+    void Write_uint32(uint32_t data)                     override { writer.Write_uint32(data);     }
+    void Write_uint32(uint32_t const * pData, size_t n)  override { writer.Write_uint32(pData, n); }
+    void Write_uint64(uint64_t data)                     override { writer.Write_uint64(data);     }
+    void Write_uint64(uint64_t const * pData, size_t n)  override { writer.Write_uint64(pData, n); }
+    void Write_int8(int8_t data)                         override { writer.Write_int8(data);       }
+    void Write_int8(int8_t const * pData, size_t n)      override { writer.Write_int8(pData, n);   }
+    void Write_int16(int16_t data)                       override { writer.Write_int16(data);      }
+    void Write_int16(int16_t const * pData, size_t n)    override { writer.Write_int16(pData, n);  }
+    void Write_int32(int32_t data)                       override { writer.Write_int32(data);      }
+    void Write_int32(int32_t const * pData, size_t n)    override { writer.Write_int32(pData, n);  }
+    void Write_int64(int64_t data)                       override { writer.Write_int64(data);      }
+    void Write_int64(int64_t const * pData, size_t n)    override { writer.Write_int64(pData, n);  }
+    void Write_float(float data)                         override { writer.Write_float(data);      }
+    void Write_float(float const * pData, size_t n)      override { writer.Write_float(pData, n);  }
+    void Write_double(double data)                       override { writer.Write_double(data);     }
+    void Write_double(double const * pData, size_t n)    override { writer.Write_double(pData, n); }
+    void Write_bool(bool data)                           override { writer.Write_bool(data);       }
+    void Write_bool(bool const * pData, size_t n)        override { writer.Write_bool(pData, n);   }
+    void Write_Bit(bool data)                            override { writer.Write_Bit(data);        }
+    void Write_Bits(uint8_t bits, uint_fast8_t n)        override { writer.Write_Bits(bits, n);    }
+    void Write_Bits(uint8_t const * pData, size_t n)     override { writer.Write_Bits(pData, n);   }
+    void Write_char(char data)                           override { writer.Write_char(data);       }
+    void Write_char(char const * pData, size_t n)        override { writer.Write_char(pData, n);   }
+    void Write_string(std::string const & str)           override { writer.Write_string(str);      }
+    void Write_line(std::string const & str)             override { writer.Write_line(str);        }
+    // <-- IStreamWriter
+
+  private:
+    /// The adapted stream writer.
+    WRITER & writer;
+};
+
+} // namespace stream
+} // namespace gpcc
+
+#endif // STATICSTREAMWRITERADAPTER_HPP_202610162215
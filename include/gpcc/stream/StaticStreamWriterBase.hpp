@@ -0,0 +1,154 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#ifndef STATICSTREAMWRITERBASE_HPP_202610162215
+#define STATICSTREAMWRITERBASE_HPP_202610162215
+
+#include <gpcc/stream/internal/byte_order.hpp>
+#include <gpcc/stream/IStreamWriter.hpp>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+
+namespace gpcc   {
+namespace stream {
+
+/**
+ * \ingroup GPCC_STREAM
+ * \brief CRTP base class for stream writers whose write methods are resolved at compile time.
+ *
+ * This is the compile-time counterpart of @ref StreamWriterBase. It offers the same write methods and the same
+ * semantics as @ref IStreamWriter, but none of the methods is virtual. The endian of the data is a template parameter,
+ * so byte swapping is resolved at compile time, too. If the type of the stream is known at the call site, then all
+ * write methods can be inlined completely. This is intended for hot serialization paths with fixed record layouts.
+ *
+ * Subclasses must pass themselves as template parameter `DERIVED` and they must implement the following methods.
+ * The methods may be private if the subclass declares @ref StaticStreamWriterBase a friend:
+ * - `bool IsRemainingCapacitySupported(void) const`
+ * - `size_t RemainingCapacity(void) const`
+ * - `uint_fast8_t GetNbOfCachedBits(void) const`
+ * - `void Close(void)`
+ * - `void Push(char c)`
+ * - `void Push(void const * pData, size_t n)`
+ * - `void PushBits(uint8_t bits, uint_fast8_t n)`
+ *
+ * The semantics of `Push()` and `PushBits()` are identical to @ref StreamWriterBase::Push(char c),
+ * @ref StreamWriterBase::Push(void const * pData, size_t n), and @ref StreamWriterBase::PushBits().
+ *
+ * Use @ref StaticStreamWriterAdapter to pass a stream derived from this class to code that expects an
+ * @ref IStreamWriter.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * Not thread-safe.
+ *
+ * \tparam DERIVED
+ * Class derived from this class.
+ *
+ * \tparam ENDIAN
+ * Endian of the data written into the stream.
+ */
+template<class DERIVED, IStreamWriter::Endian ENDIAN>
+class StaticStreamWriterBase
+{
+  public:
+    using States = IStreamWriter::States;
+    using Endian = IStreamWriter::Endian;
+
+    /// Endian of the data written into the stream.
+    static constexpr Endian endian = ENDIAN;
+
+
+    inline DERIVED& operator<< (uint8_t     const   value) { Write_uint8(value);  return Derived(); }
+    inline DERIVED& operator<< (uint16_t    const   value) { Write_uint16(value); return Derived(); }
+    inline DERIVED& operator<< (uint32_t    const   value) { Write_uint32(value); return Derived(); }
+    inline DERIVED& operator<< (uint64_t    const   value) { Write_uint64(value); return Derived(); }
+    inline DERIVED& operator<< (int8_t      const   value) { Write_int8(value);   return Derived(); }
+    inline DERIVED& operator<< (int16_t     const   value) { Write_int16(value);  return Derived(); }
+    inline DERIVED& operator<< (int32_t     const   value) { Write_int32(value);  return Derived(); }
+    inline DERIVED& operator<< (int64_t     const   value) { Write_int64(value);  return Derived(); }
+    inline DERIVED& operator<< (float       const   value) { Write_float(value);  return Derived(); }
+    inline DERIVED& operator<< (double      const   value) { Write_double(value); return Derived(); }
+    inline DERIVED& operator<< (bool        const   value) { Write_bool(value);   return Derived(); }
+    inline DERIVED& operator<< (char        const   value) { Write_char(value);   return Derived(); }
+    inline DERIVED& operator<< (std::string const & value) { Write_string(value); return Derived(); }
+
+
+    States GetState(void) const noexcept;
+    constexpr Endian GetEndian(void) const noexcept { return ENDIAN; }
+
+    uint_fast8_t AlignToByteBoundary(bool const fillWithOnesNotZeros);
+    void FillBits(size_t n, bool const oneNotZero);
+    void FillBytes(size_t n, uint8_t const value);
+
+    void Write_uint8(uint8_t data);
+    void Write_uint8(uint8_t const * pData, size_t n);
+    void Write_uint16(uint16_t data);
+    void Write_uint16(uint16_t const * pData, size_t n);
+    void Write_uint32(uint32_t data);
+    void Write_uint32(uint32_t const * pData, size_t n);
+    void Write_uint64(uint64_t data);
+    void Write_uint64(uint64_t const * pData, size_t n);
+    void Write_int8(int8_t data);
+    void Write_int8(int8_t const * pData, size_t n);
+    void Write_int16(int16_t data);
+    void Write_int16(int16_t const * pData, size_t n);
+    void Write_int32(int32_t data);
+    void Write_int32(int32_t const * pData, size_t n);
+    void Write_int64(int64_t data);
+    void Write_int64(int64_t const * pData, size_t n);
+    void Write_float(float data);
+    void Write_float(float const * pData, size_t n);
+    void Write_double(double data);
+    void Write_double(double const * pData, size_t n);
+    void Write_bool(bool data);
+    void Write_bool(bool const * pData, size_t n);
+    void Write_Bit(bool data);
+    void Write_Bits(uint8_t bits, uint_fast8_t n);
+    void Write_Bits(uint8_t const * pData, size_t n);
+    void Write_char(char data);
+    void Write_char(char const * pData, size_t n);
+    void Write_string(std::string const & str);
+    void Write_line(std::string const & str);
+
+  protected:
+    /// Flag indicating if the byte order of the data inside the stream differs from the byte order of the host.
+    static constexpr bool byteSwapRequired = ((ENDIAN == Endian::Little) != internal::hostIsLittleEndian);
+
+    /// Current state of the stream writer.
+    States state;
+
+
+    StaticStreamWriterBase(void) = delete;
+    explicit StaticStreamWriterBase(States const _state) noexcept;
+    StaticStreamWriterBase(StaticStreamWriterBase const &) noexcept = default;
+    StaticStreamWriterBase(StaticStreamWriterBase &&) noexcept = default;
+    ~StaticStreamWriterBase(void) = default;
+
+    StaticStreamWriterBase& operator=(StaticStreamWriterBase const &) noexcept = default;
+    StaticStreamWriterBase& operator=(StaticStreamWriterBase &&) noexcept = default;
+
+  private:
+    inline DERIVED& Derived(void) noexcept { return *static_cast<DERIVED*>(this); }
+
+    template<typename T>
+    void PushSwapped(T data);
+
+    template<typename T>
+    void PushSwapped(void const * pData, size_t n);
+};
+
+} // namespace stream
+} // namespace gpcc
+
+#include "StaticStreamWriterBase.tcc"
+
+#endif // STATICSTREAMWRITERBASE_HPP_202610162215
@@ -0,0 +1,387 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#include "StaticStreamWriterBase.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace gpcc   {
+namespace stream {
+
+/// \copydoc IStreamWriter::GetState
+template<class DERIVED, IStreamWriter::Endian ENDIAN>
+inline IStreamWriter::States StaticStreamWriterBase<DERIVED, ENDIAN>::GetState(void) const noexcept
+{
+  return state;
+}
+
+/// \copydoc IStreamWriter::AlignToByteBoundary
+template<class DERIVED, IStreamWriter::Endian ENDIAN>
+inline uint_fast8_t StaticStreamWriterBase<DERIVED, ENDIAN>::AlignToByteBoundary(bool const fillWithOnesNotZeros)
+{
+  uint_fast8_t const nbOfBits = (8U - Derived().GetNbOfCachedBits()) % 8U;
+  FillBits(nbOfBits, fillWithOnesNotZeros);
+  return nbOfBits;
+}
+
+/// \copydoc IStreamWriter::FillBits
+template<class DERIVED, IStreamWriter::Endian ENDIAN>
+inline void StaticStreamWriterBase<DERIVED, ENDIAN>::FillBits(size_t n, bool const oneNotZero)
+{
+  uint8_t const val = oneNotZero ? 0xFFU : 0x00U;
+  while (n >= 8U)
+  {
+    Derived().PushBits(val, 8U);
+    n -= 8U;
+  }
+
+  if (n != 0U)
+    Derived().PushBits(val, n);
+}
+
+/// \copydoc IStreamWriter::FillBytes
+template<class DERIVED, IStreamWriter::Endian ENDIAN>
+void StaticStreamWriterBase<DERIVED, ENDIAN>::FillBytes(size_t n, uint8_t const value)
+{
+  unsigned char buffer[64];
+  memset(buffer, value, std::min(n, sizeof(buffer)));
+
+  while (n != 0U)
+  {
+    size_t const chunk = std::min(n, sizeof(buffer));
+    Derived().Push(buffer, chunk);
+    n -= chunk;
+  }
+}
+
+/// \copydoc IStreamWriter::Write_uint8(uint8_t)
+template<class DERIVED, IStreamWriter::Endian ENDIAN>
+inline void StaticStreamWriterBase<DERIVED, ENDIAN>::Write_uint8(uint8_t data)
+{
+  Derived().Push(static_cast<char>(data));
+}
+
+/// \copydoc IStreamWriter::Write_uint8(uint8_t const *,size_t)
+template<class DERIVED, IStreamWriter::Endian ENDIAN>
+inline void StaticStreamWriterBase<DERIVED, ENDIAN>::Write_uint8(uint8_t const * pData, size_t n)
+{
+  Derived().Push(pData, n);
+}
+
+/// \copydoc IStreamWriter::Write_uint16(uint16_t)
+template<class DERIVED, IStreamWriter::Endian ENDIAN>
+inline void StaticStreamWriterBase<DERIVED, ENDIAN>::Write_uint16(uint16_t data)
+{
+  PushSwapped(data);
+}
+
+/// \copydoc IStreamWriter::Write_uint16(uint16_t const *,size_t)
+template<class DERIVED, IStreamWriter::Endian ENDIAN>
+inline void StaticStreamWriterBase<DERIVED, ENDIAN>::Write_uint16(uint16_t const * pData, size_t n)
+{
+  PushSwapped<uint16_t>(pData, n);
+}
+
+/// \copydoc IStreamWriter::Write_uint32(uint32_t)
+template<class DERIVED, IStreamWriter::Endian ENDIAN>
+inline void StaticStreamWriterBase<DERIVED, ENDIAN>::Write_uint32(uint32_t data)
+{
+  PushSwapped(data);
+}
+
+/// \copydoc IStreamWriter::Write_uint32(uint32_t const *,size_t)
+template<class DERIVED, IStreamWriter::Endian ENDIAN>
+inline void StaticStreamWriterBase<DERIVED, ENDIAN>::Write_uint32(uint32_t const * pData, size_t n)
+{
+  PushSwapped<uint32_t>(pData, n);
+}
+
+/// \copydoc IStreamWriter::Write_uint64(uint64_t)
+template<class DERIVED, IStreamWriter::Endian ENDIAN>
+inline void StaticStreamWriterBase<DERIVED, ENDIAN>::Write_uint64(uint64_t data)
+{
+  PushSwapped(data);
+}
+
+/// \copydoc IStreamWriter::Write_uint64(uint64_t const *,size_t)
+template<class DERIVED, IStreamWriter::Endian ENDIAN>
+inline void StaticStreamWriterBase<DERIVED, ENDIAN>::Write_uint64(uint64_t const * pData, size_t n)
+{
+  PushSwapped<uint64_t>(pData, n);
+}
+
+/// \copydoc IStreamWriter::Write_int8(int8_t)
+template<class DERIVED, IStreamWriter::Endian ENDIAN>
+inline void StaticStreamWriterBase<DERIVED, ENDIAN>::Write_int8(int8_t data)
+{
+  Derived().Push(static_cast<char>(data));
+}
+
+/// \copydoc IStreamWriter::Write_int8(int8_t const *,size_t)
+template<class DERIVED, IStreamWriter::Endian ENDIAN>
+inline void StaticStreamWriterBase<DERIVED, ENDIAN>::Write_int8(int8_t const * pData, size_t n)
+{
+  Derived().Push(pData, n);
+}
+
+/// \copydoc IStreamWriter::Write_int16(int16_t)
+template<class DERIVED, IStreamWriter::Endian ENDIAN>
+inline void StaticStreamWriterBase<DERIVED, ENDIAN>::Write_int16(int16_t data)
+{
+  PushSwapped(static_cast<uint16_t>(data));
+}
+
+/// \copydoc IStreamWriter::Write_int16(int16_t const *,size_t)
+template<class DERIVED, IStreamWriter::Endian ENDIAN>
+inline void StaticStreamWriterBase<DERIVED, ENDIAN>::Write_int16(int16_t const * pData, size_t n)
+{
+  PushSwapped<uint16_t>(pData, n);
+}
+
+/// \copydoc IStreamWriter::Write_int32(int32_t)
+template<class DERIVED, IStreamWriter::Endian ENDIAN>
+inline void StaticStreamWriterBase<DERIVED, ENDIAN>::Write_int32(int32_t data)
+{
+  PushSwapped(static_cast<uint32_t>(data));
+}
+
+/// \copydoc IStreamWriter::Write_int32(int32_t const *,size_t)
+template<class DERIVED, IStreamWriter::Endian ENDIAN>
+inline void StaticStreamWriterBase<DERIVED, ENDIAN>::Write_int32(int32_t const * pData, size_t n)
+{
+  PushSwapped<uint32_t>(pData, n);
+}
+
+/// \copydoc IStreamWriter::Write_int64(int64_t)
+template<class DERIVED, IStreamWriter::Endian ENDIAN>
+inline void StaticStreamWriterBase<DERIVED, ENDIAN>::Write_int64(int64_t data)
+{
+  PushSwapped(static_cast<uint64_t>(data));
+}
+
+/// \copydoc IStreamWriter::Write_int64(int64_t const *,size_t)
+template<class DERIVED, IStreamWriter::Endian ENDIAN>
+inline void StaticStreamWriterBase<DERIVED, ENDIAN>::Write_int64(int64_t const * pData, size_t n)
+{
+  PushSwapped<uint64_t>(pData, n);
+}
+
+/// \copydoc IStreamWriter::Write_float(float)
+template<class DERIVED, IStreamWriter::Endian ENDIAN>
+inline void StaticStreamWriterBase<DERIVED, ENDIAN>::Write_float(float data)
+{
+  uint32_t tmp;
+  memcpy(&tmp, &data, sizeof(tmp));
+  PushSwapped(tmp);
+}
+
+/// \copydoc IStreamWriter::Write_float(float const *,size_t)
+template<class DERIVED, IStreamWriter::Endian ENDIAN>
+inline void StaticStreamWriterBase<DERIVED, ENDIAN>::Write_float(float const * pData, size_t n)
+{
+  PushSwapped<uint32_t>(pData, n);
+}
+
+/// \copydoc IStreamWriter::Write_double(double)
+template<class DERIVED, IStreamWriter::Endian ENDIAN>
+inline void StaticStreamWriterBase<DERIVED, ENDIAN>::Write_double(double data)
+{
+  uint64_t tmp;
+  memcpy(&tmp, &data, sizeof(tmp));
+  PushSwapped(tmp);
+}
+
+/// \copydoc IStreamWriter::Write_double(double const *,size_t)
+template<class DERIVED, IStreamWriter::Endian ENDIAN>
+inline void StaticStreamWriterBase<DERIVED, ENDIAN>::Write_double(double const * pData, size_t n)
+{
+  PushSwapped<uint64_t>(pData, n);
+}
+
+/// \copydoc IStreamWriter::Write_bool(bool)
+template<class DERIVED, IStreamWriter::Endian ENDIAN>
+inline void StaticStreamWriterBase<DERIVED, ENDIAN>::Write_bool(bool data)
+{
+  Derived().PushBits(data ? 1U : 0U, 1U);
+}
+
+/// \copydoc IStreamWriter::Write_bool(bool const *,size_t)
+template<class DERIVED, IStreamWriter::Endian ENDIAN>
+inline void StaticStreamWriterBase<DERIVED, ENDIAN>::Write_bool(bool const * pData, size_t n)
+{
+  while (n-- != 0U)
+    Derived().PushBits((*pData++) ? 1U : 0U, 1U);
+}
+
+/// \copydoc IStreamWriter::Write_Bit(bool)
+template<class DERIVED, IStreamWriter::Endian ENDIAN>
+inline void StaticStreamWriterBase<DERIVED, ENDIAN>::Write_Bit(bool data)
+{
+  Derived().PushBits(data ? 1U : 0U, 1U);
+}
+
+/// \copydoc IStreamWriter::Write_Bits(uint8_t,uint_fast8_t)
+template<class DERIVED, IStreamWriter::Endian ENDIAN>
+inline void StaticStreamWriterBase<DERIVED, ENDIAN>::Write_Bits(uint8_t bits, uint_fast8_t n)
+{
+  Derived().PushBits(bits, n);
+}
+
+/// \copydoc IStreamWriter::Write_Bits(uint8_t const *,size_t)
+template<class DERIVED, IStreamWriter::Endian ENDIAN>
+inline void StaticStreamWriterBase<DERIVED, ENDIAN>::Write_Bits(uint8_t const * pData, size_t n)
+{
+  while (n >= 8U)
+  {
+    Derived().PushBits(*pData++, 8U);
+    n -= 8U;
+  }
+
+  if (n != 0U)
+    Derived().PushBits(*pData, n);
+}
+
+/// \copydoc IStreamWriter::Write_char(char)
+template<class DERIVED, IStreamWriter::Endian ENDIAN>
+inline void StaticStreamWriterBase<DERIVED, ENDIAN>::Write_char(char data)
+{
+  Derived().Push(data);
+}
+
+/// \copydoc IStreamWriter::Write_char(char const *,size_t)
+template<class DERIVED, IStreamWriter::Endian ENDIAN>
+inline void StaticStreamWriterBase<DERIVED, ENDIAN>::Write_char(char const * pData, size_t n)
+{
+  Derived().Push(pData, n);
+}
+
+/// \copydoc IStreamWriter::Write_string(std::string const&)
+template<class DERIVED, IStreamWriter::Endian ENDIAN>
+inline void StaticStreamWriterBase<DERIVED, ENDIAN>::Write_string(std::string const & str)
+{
+  Derived().Push(str.c_str(), str.length() + 1U);
+}
+
+/// \copydoc IStreamWriter::Write_line(std::string const&)
+template<class DERIVED, IStreamWriter::Endian ENDIAN>
+inline void StaticStreamWriterBase<DERIVED, ENDIAN>::Write_line(std::string const & str)
+{
+  Derived().Push(str.c_str(), str.length());
+  Derived().Push('\n');
+}
+
+/**
+ * \brief Constructor.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \param _state
+ * Desired initial state for the stream.
+ */
+template<class DERIVED, IStreamWriter::Endian ENDIAN>
+StaticStreamWriterBase<DERIVED, ENDIAN>::StaticStreamWriterBase(States const _state) noexcept
+: state(_state)
+{
+}
+
+/**
+ * \brief Converts a multi-byte value from the host's endian to the stream's endian and pushes it onto the stream.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * The state of the object is modified. Concurrent accesses are not safe.
+ *
+ * __Exception safety:__\n
+ * Same as `DERIVED::Push(void const * pData, size_t n)`.
+ *
+ * __Thread cancellation safety:__\n
+ * Same as `DERIVED::Push(void const * pData, size_t n)`.
+ *
+ * - - -
+ *
+ * \tparam T
+ * Unsigned integer type of the value (`uint16_t`, `uint32_t`, or `uint64_t`).
+ *
+ * \param data
+ * Value that shall be written.
+ */
+template<class DERIVED, IStreamWriter::Endian ENDIAN>
+template<typename T>
+inline void StaticStreamWriterBase<DERIVED, ENDIAN>::PushSwapped(T data)
+{
+  if constexpr (byteSwapRequired)
+    data = internal::ByteSwap(data);
+  Derived().Push(&data, sizeof(data));
+}
+
+/**
+ * \brief Converts each element of an array of multi-byte values from the host's endian to the stream's endian and
+ *        pushes the array onto the stream.
+ *
+ * If byte swapping is required, then the array is processed in chunks using a small buffer on the stack.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * The state of the object is modified. Concurrent accesses are not safe.
+ *
+ * __Exception safety:__\n
+ * Same as `DERIVED::Push(void const * pData, size_t n)`.
+ *
+ * __Thread cancellation safety:__\n
+ * Same as `DERIVED::Push(void const * pData, size_t n)`.
+ *
+ * - - -
+ *
+ * \tparam T
+ * Unsigned integer type with the size of one element (`uint16_t`, `uint32_t`, or `uint64_t`).
+ *
+ * \param pData
+ * Pointer to the array.
+ *
+ * \param n
+ * Number of elements.
+ */
+template<class DERIVED, IStreamWriter::Endian ENDIAN>
+template<typename T>
+inline void StaticStreamWriterBase<DERIVED, ENDIAN>::PushSwapped(void const * pData, size_t n)
+{
+  if constexpr (byteSwapRequired)
+  {
+    size_t const elementsPerChunk = 256U / sizeof(T);
+    unsigned char buffer[elementsPerChunk * sizeof(T)];
+
+    unsigned char const * p = static_cast<unsigned char const*>(pData);
+    while (n != 0U)
+    {
+      size_t const chunk = std::min(n, elementsPerChunk);
+      internal::ByteSwapCopy<T>(buffer, p, chunk);
+      Derived().Push(buffer, chunk * sizeof(T));
+      p += chunk * sizeof(T);
+      n -= chunk;
+    }
+  }
+  else
+  {
+    Derived().Push(pData, n * sizeof(T));
+  }
+}
+
+} // namespace stream
+} // namespace gpcc
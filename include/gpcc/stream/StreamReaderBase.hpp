@@ -39,6 +39,10 @@ namespace stream
  * For performance reasons, the following methods should be reimplemented:
  * - @ref StreamReaderBase::Skip()
  * - @ref StreamReaderBase::Read_string()
+ *
+ * Multi-byte values and arrays of multi-byte values are read via one call to @ref Pop(void* p, size_t n). If the
+ * endian of the stream differs from the endian of the host, then the byte order is reversed in place afterwards.
+ * Subclasses should therefore implement @ref Pop(void* p, size_t n) efficiently.
  */
 class StreamReaderBase: public IStreamReader
 {
@@ -99,6 +103,8 @@ class StreamReaderBase: public IStreamReader
     StreamReaderBase& operator=(StreamReaderBase&&) noexcept = default;
 
 
+    bool IsByteSwapRequired(void) const noexcept;
+
     virtual unsigned char Pop(void) = 0;
     virtual void Pop(void* p, size_t n) = 0;
     virtual uint8_t PopBits(uint_fast8_t n) = 0;
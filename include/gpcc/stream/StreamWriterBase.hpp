@@ -27,6 +27,11 @@ namespace stream
  * \brief Convenient base class for all classes implementing @ref IStreamWriter.
  *
  * Subclasses just have to implement @ref Push() and @ref PushBits() to implement the @ref IStreamWriter interface.
+ *
+ * Multi-byte values and arrays of multi-byte values are written via @ref Push(void const * pData, size_t n). If the
+ * endian of the stream differs from the endian of the host, then the byte order is reversed before (arrays are
+ * processed in chunks using a small buffer on the stack). Subclasses should therefore implement
+ * @ref Push(void const * pData, size_t n) efficiently.
  */
 class StreamWriterBase: public IStreamWriter
 {
@@ -88,9 +93,15 @@ class StreamWriterBase: public IStreamWriter
     StreamWriterBase& operator=(StreamWriterBase&&) noexcept = default;
 
 
+    bool IsByteSwapRequired(void) const noexcept;
+
     virtual void Push(char c) = 0;
     virtual void Push(void const * pData, size_t n) = 0;
     virtual void PushBits(uint8_t bits, uint_fast8_t n) = 0;
+
+  private:
+    template<typename T>
+    void PushByteSwapped(void const * pData, size_t n);
 };
 
 /**
@@ -0,0 +1,153 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#ifndef BYTE_ORDER_HPP_202610162130
+#define BYTE_ORDER_HPP_202610162130
+
+#include <gpcc/compiler/builtins.hpp>
+#include <gpcc/compiler/definitions.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace gpcc   {
+namespace stream {
+namespace internal {
+
+/// Flag indicating if the byte order of the host is little endian (true) or big endian (false).
+constexpr bool hostIsLittleEndian = (GPCC_SYSTEMS_ENDIAN == GPCC_LITTLE);
+
+static_assert((GPCC_SYSTEMS_ENDIAN == GPCC_LITTLE) || (GPCC_SYSTEMS_ENDIAN == GPCC_BIG),
+              "Byte order of host is not supported.");
+
+/**
+ * \brief Reverses the byte order of an unsigned integer value.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \param v
+ * Value.
+ *
+ * \return
+ * `v` with reversed byte order.
+ */
+inline uint16_t ByteSwap(uint16_t const v) noexcept { return gpcc::compiler::ByteSwap16(v); }
+
+/// \copydoc ByteSwap(uint16_t const)
+inline uint32_t ByteSwap(uint32_t const v) noexcept { return gpcc::compiler::ByteSwap32(v); }
+
+/// \copydoc ByteSwap(uint16_t const)
+inline uint64_t ByteSwap(uint64_t const v) noexcept { return gpcc::compiler::ByteSwap64(v); }
+
+/**
+ * \brief Reverses the byte order of each element of an array in place.
+ *
+ * The memory is accessed via `memcpy()`, so there are no alignment requirements and there are no strict aliasing
+ * issues if the array contains e.g. floating point values. The loop can be vectorized by the compiler.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * The memory referenced by `p` is modified. Any concurrent accesses to it are not safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \tparam T
+ * Unsigned integer type with the size of one element (`uint16_t`, `uint32_t`, or `uint64_t`).
+ *
+ * \param p
+ * Pointer to the array.
+ *
+ * \param n
+ * Number of elements.
+ */
+template<typename T>
+void ByteSwapInPlace(void * const p, size_t const n) noexcept
+{
+  unsigned char * pc = static_cast<unsigned char*>(p);
+  for (size_t i = 0U; i < n; i++)
+  {
+    T v;
+    std::memcpy(&v, pc, sizeof(T));
+    v = ByteSwap(v);
+    std::memcpy(pc, &v, sizeof(T));
+    pc += sizeof(T);
+  }
+}
+
+/**
+ * \brief Copies an array and reverses the byte order of each element.
+ *
+ * The memory is accessed via `memcpy()`, so there are no alignment requirements and there are no strict aliasing
+ * issues if the array contains e.g. floating point values. The loop can be vectorized by the compiler.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * The memory referenced by `pDest` is modified. Any concurrent accesses to it are not safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \tparam T
+ * Unsigned integer type with the size of one element (`uint16_t`, `uint32_t`, or `uint64_t`).
+ *
+ * \param pDest
+ * Pointer to the destination array. It must not overlap with the source array.
+ *
+ * \param pSrc
+ * Pointer to the source array.
+ *
+ * \param n
+ * Number of elements.
+ */
+template<typename T>
+void ByteSwapCopy(void * const pDest, void const * const pSrc, size_t const n) noexcept
+{
+  unsigned char * pd = static_cast<unsigned char*>(pDest);
+  unsigned char const * ps = static_cast<unsigned char const*>(pSrc);
+  for (size_t i = 0U; i < n; i++)
+  {
+    T v;
+    std::memcpy(&v, ps, sizeof(T));
+    v = ByteSwap(v);
+    std::memcpy(pd, &v, sizeof(T));
+    pd += sizeof(T);
+    ps += sizeof(T);
+  }
+}
+
+} // namespace internal
+} // namespace stream
+} // namespace gpcc
+
+#endif // BYTE_ORDER_HPP_202610162130
@@ -43,6 +43,25 @@
 #define GPCC_RESTORE_WARN_SELFMOVE()                 \
   _Pragma("GCC diagnostic pop")
 
+/**
+ * \brief Disables compiler warnings related to mismatched `operator new` and `operator delete`.
+ *
+ * This is intended to be used around coroutines whose frame is allocated via a function template `operator new` of
+ * the promise type, e.g. [Task](@ref gpcc::execution::async::Task) coroutines taking `std::allocator_arg`. GCC 12
+ * wrongly reports the release of such a frame via the promise type's usual `operator delete` as a mismatch.
+ * Afterwards, the previous warning level shall be restored via @ref GPCC_RESTORE_WARN_MISMATCHED_NEW_DELETE().
+ */
+#define GPCC_DISABLE_WARN_MISMATCHED_NEW_DELETE()                  \
+  _Pragma("GCC diagnostic push")                                   \
+  _Pragma("GCC diagnostic ignored \"-Wmismatched-new-delete\"")  \
+
+/**
+ * \brief Restores the previous configuration for compiler warnings related to mismatched `operator new` and
+ *        `operator delete` before @ref GPCC_DISABLE_WARN_MISMATCHED_NEW_DELETE() was called.
+ */
+#define GPCC_RESTORE_WARN_MISMATCHED_NEW_DELETE()                  \
+  _Pragma("GCC diagnostic pop")
+
 /**@}*/
 
 #endif // WARNINGS_HPP_202410092045
@@ -60,6 +60,15 @@ DeferredWorkPackage::DeferredWorkPackage(void const * const _pOwnerObject,
 , tp(_tp)
 , pNext(nullptr)
 , pPrev(nullptr)
+, pHeapChild(nullptr)
+, pHeapNext(nullptr)
+, pHeapPrev(nullptr)
+, pQueue(nullptr)
+, seqNo(0U)
+, period_ns(0)
+, overrunPolicy(OverrunPolicy::skip)
+, nbOfOverruns(0U)
+, nbOfMissedPeriods(0U)
 , state(States::staticNotInQ)
 {
   if (!functor)
@@ -107,6 +116,15 @@ DeferredWorkPackage::DeferredWorkPackage(void const * const _pOwnerObject,
 , tp(_tp)
 , pNext(nullptr)
 , pPrev(nullptr)
+, pHeapChild(nullptr)
+, pHeapNext(nullptr)
+, pHeapPrev(nullptr)
+, pQueue(nullptr)
+, seqNo(0U)
+, period_ns(0)
+, overrunPolicy(OverrunPolicy::skip)
+, nbOfOverruns(0U)
+, nbOfMissedPeriods(0U)
 , state(States::staticNotInQ)
 {
   if (!functor)
@@ -152,6 +170,15 @@ DeferredWorkPackage::DeferredWorkPackage(void const * const _pOwnerObject,
 , tp(TimePoint::FromSystemClock(gpcc::osal::ConditionVariable::clockID) + delay)
 , pNext(nullptr)
 , pPrev(nullptr)
+, pHeapChild(nullptr)
+, pHeapNext(nullptr)
+, pHeapPrev(nullptr)
+, pQueue(nullptr)
+, seqNo(0U)
+, period_ns(0)
+, overrunPolicy(OverrunPolicy::skip)
+, nbOfOverruns(0U)
+, nbOfMissedPeriods(0U)
 , state(States::staticNotInQ)
 {
   if (!functor)
@@ -198,6 +225,15 @@ DeferredWorkPackage::DeferredWorkPackage(void const * const _pOwnerObject,
 , tp(TimePoint::FromSystemClock(gpcc::osal::ConditionVariable::clockID) + delay)
 , pNext(nullptr)
 , pPrev(nullptr)
+, pHeapChild(nullptr)
+, pHeapNext(nullptr)
+, pHeapPrev(nullptr)
+, pQueue(nullptr)
+, seqNo(0U)
+, period_ns(0)
+, overrunPolicy(OverrunPolicy::skip)
+, nbOfOverruns(0U)
+, nbOfMissedPeriods(0U)
 , state(States::staticNotInQ)
 {
   if (!functor)
@@ -239,6 +275,15 @@ DeferredWorkPackage::DeferredWorkPackage(void const * const _pOwnerObject,
 , tp()
 , pNext(nullptr)
 , pPrev(nullptr)
+, pHeapChild(nullptr)
+, pHeapNext(nullptr)
+, pHeapPrev(nullptr)
+, pQueue(nullptr)
+, seqNo(0U)
+, period_ns(0)
+, overrunPolicy(OverrunPolicy::skip)
+, nbOfOverruns(0U)
+, nbOfMissedPeriods(0U)
 , state(States::staticNotInQ)
 {
   if (!functor)
@@ -281,6 +326,15 @@ DeferredWorkPackage::DeferredWorkPackage(void const * const _pOwnerObject,
 , tp()
 , pNext(nullptr)
 , pPrev(nullptr)
+, pHeapChild(nullptr)
+, pHeapNext(nullptr)
+, pHeapPrev(nullptr)
+, pQueue(nullptr)
+, seqNo(0U)
+, period_ns(0)
+, overrunPolicy(OverrunPolicy::skip)
+, nbOfOverruns(0U)
+, nbOfMissedPeriods(0U)
 , state(States::staticNotInQ)
 {
   if (!functor)
@@ -554,6 +608,198 @@ void DeferredWorkPackage::SetTimeSpan(time::TimeSpan const & delay)
   tp = TimePoint::FromSystemClock(gpcc::osal::ConditionVariable::clockID) + delay;
 }
 
+/**
+ * \brief Configures the work package for periodic execution.
+ *
+ * After execution by a @ref DeferredWorkQueue, the work package will be enqueued again automatically. The point in
+ * time of the next execution is the point in time of the previous execution plus `_period`. The point in time of the
+ * first execution is configured via @ref SetTimePoint() or @ref SetTimeSpan() as usual.
+ *
+ * This method is only allowed to be called on _static_ work packages which are _currently not enqueued_ in any work
+ * queue. It may be called by the work package's functor in order to change the period.
+ *
+ * The periodic statistics (see @ref GetPeriodicStatistics()) are not affected.
+ *
+ * ---
+ *
+ * __Thread-safety:__\n
+ * The state of the object is modified. Any concurrent accesses are not safe.
+ *
+ * __Exception-safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread-cancellation-safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * ---
+ *
+ * \param _period
+ * Period. Must be larger than zero.
+ * \param _overrunPolicy
+ * Policy applied if the point in time of the next period has already been reached when execution has finished.
+ */
+void DeferredWorkPackage::SetPeriodic(time::TimeSpan const & _period, OverrunPolicy const _overrunPolicy)
+{
+  if ((state != States::staticNotInQ) && (state != States::staticExec))
+    throw std::logic_error("DeferredWorkPackage::SetPeriodic: Wrong state");
+
+  if (_period.ns() <= 0)
+    throw std::invalid_argument("DeferredWorkPackage::SetPeriodic: _period must be larger than zero");
+
+  period_ns = _period.ns();
+  overrunPolicy = _overrunPolicy;
+}
+
+/**
+ * \brief Ends periodic execution.
+ *
+ * This method is only allowed to be called on _static_ work packages which are _currently not enqueued_ in any work
+ * queue. If it is called by the work package's functor, then the work package will not be enqueued again after
+ * execution.
+ *
+ * ---
+ *
+ * __Thread-safety:__\n
+ * The state of the object is modified. Any concurrent accesses are not safe.
+ *
+ * __Exception-safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread-cancellation-safety:__\n
+ * Safe, no cancellation point included.
+ */
+void DeferredWorkPackage::SetNonPeriodic(void)
+{
+  if ((state != States::staticNotInQ) && (state != States::staticExec))
+    throw std::logic_error("DeferredWorkPackage::SetNonPeriodic: Wrong state");
+
+  period_ns = 0;
+}
+
+/**
+ * \brief Retrieves if the work package is configured for periodic execution.
+ *
+ * ---
+ *
+ * __Thread-safety:__\n
+ * Concurrent non-modifying accesses are safe.
+ *
+ * __Exception-safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread-cancellation-safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * ---
+ *
+ * \retval true   Work package is configured for periodic execution.
+ * \retval false  Work package is not configured for periodic execution.
+ */
+bool DeferredWorkPackage::IsPeriodic(void) const noexcept
+{
+  return (period_ns != 0);
+}
+
+/**
+ * \brief Retrieves the statistics of periodic execution.
+ *
+ * ---
+ *
+ * __Thread-safety:__\n
+ * This is thread-safe. It may be called while the work package is enqueued in a work queue or while it is executed.
+ *
+ * __Exception-safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread-cancellation-safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * ---
+ *
+ * \return
+ * Snapshot of the statistics.
+ */
+DeferredWorkPackage::PeriodicStatistics DeferredWorkPackage::GetPeriodicStatistics(void) const noexcept
+{
+  PeriodicStatistics stats;
+  stats.nbOfOverruns = nbOfOverruns.load(std::memory_order_relaxed);
+  stats.nbOfMissedPeriods = nbOfMissedPeriods.load(std::memory_order_relaxed);
+  return stats;
+}
+
+/**
+ * \brief Clears the statistics of periodic execution.
+ *
+ * ---
+ *
+ * __Thread-safety:__\n
+ * This is thread-safe. It may be called while the work package is enqueued in a work queue or while it is executed.
+ *
+ * __Exception-safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread-cancellation-safety:__\n
+ * Safe, no cancellation point included.
+ */
+void DeferredWorkPackage::ResetPeriodicStatistics(void) noexcept
+{
+  nbOfOverruns.store(0U, std::memory_order_relaxed);
+  nbOfMissedPeriods.store(0U, std::memory_order_relaxed);
+}
+
+/**
+ * \brief Class-specific allocation function.
+ *
+ * This places a tag of `alignof(std::max_align_t)` bytes in front of the work package, which allows
+ * `operator delete` to release both work packages allocated on the heap and work packages placed in a block of a
+ * @ref WorkPackagePool.
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * ---
+ *
+ * \param size
+ * Size of the object in bytes.
+ * \return
+ * Pointer to the allocated memory.
+ */
+void* DeferredWorkPackage::operator new(size_t const size)
+{
+  return WorkPackagePool::AllocateFromHeap(size);
+}
+
+/**
+ * \brief Class-specific deallocation function.
+ *
+ * If the work package has been placed in a block of a @ref WorkPackagePool, then the block will be returned to the
+ * pool. Otherwise the memory will be released to the heap.
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * ---
+ *
+ * \param p
+ * Pointer to the memory that shall be released.
+ */
+void DeferredWorkPackage::operator delete(void* const p) noexcept
+{
+  WorkPackagePool::Free(p);
+}
+
 } // namespace async
 } // namespace execution
 } // namespace gpcc
@@ -11,12 +11,16 @@
 #include <gpcc/execution/async/DeferredWorkQueue.hpp>
 #include <gpcc/execution/async/DeferredWorkPackage.hpp>
 #include <gpcc/execution/async/WorkPackage.hpp>
+#include <gpcc/execution/async/WorkQueueTelemetry.hpp>
 #include <gpcc/osal/AdvancedMutexLocker.hpp>
 #include <gpcc/osal/MutexLocker.hpp>
 #include <gpcc/osal/Panic.hpp>
 #include <gpcc/osal/Semaphore.hpp>
 #include <gpcc/raii/scope_guard.hpp>
+#include <gpcc/time/TimeSpan.hpp>
+#include <limits>
 #include <stdexcept>
+#include <utility>
 
 namespace gpcc {
 namespace execution {
@@ -26,7 +30,7 @@ using namespace gpcc::osal;
 using namespace gpcc::time;
 
 /**
- * \brief Constructor.
+ * \brief Constructor. Creates a work queue with one lane for non-deferred work packages.
  *
  * __Exception safety:__\n
  * Strong guarantee.
@@ -35,18 +39,60 @@ using namespace gpcc::time;
  * Deferred cancellation is safe.
  */
 DeferredWorkQueue::DeferredWorkQueue(void)
-: queueMutex()
+: DeferredWorkQueue(1U, 0U, 0U)
+{
+}
+
+/**
+ * \brief Constructor. Creates a work queue with multiple priority lanes for non-deferred work packages.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Deferred cancellation is safe.
+ *
+ * ---
+ *
+ * \param nbOfLanes
+ * Number of priority lanes for non-deferred work packages.\n
+ * Lane 0 has the highest priority. Lane `nbOfLanes - 1` has the lowest priority.\n
+ * Valid range: 1..@ref maxNbOfLanes
+ * \param _defaultLane
+ * Lane used by the methods of @ref IWorkQueue which do not allow to specify a lane, e.g. @ref Add(WorkPackage &).\n
+ * This must be less than `nbOfLanes`.
+ * \param _agingThreshold
+ * Aging threshold.\n
+ * If a non-empty lane has been bypassed by this number of consecutive selections in favour of a different lane, then
+ * the next work package will be taken from that lane, regardless of its priority.\n
+ * Zero disables aging. Lanes are then strictly served by priority.
+ */
+DeferredWorkQueue::DeferredWorkQueue(size_t const nbOfLanes, size_t const _defaultLane, uint32_t const _agingThreshold)
+: defaultLane(_defaultLane)
+, agingThreshold(_agingThreshold)
+, queueMutex()
 , flushMutex()
 , queueConVar()
-, pQueueFirst(nullptr)
-, pQueueLast(nullptr)
+, lanes()
+, nbOfEnqueuedWPs(0U)
+, pTelemetry(nullptr)
 , pDeferredQueueFirst(nullptr)
 , pDeferredQueueLast(nullptr)
+, pDeferredHeapRoot(nullptr)
+, nextDeferredSeqNo(0U)
 , terminate(false)
 , pOwnerOfCurrentExecutedWP(nullptr)
 , ownerChangedConVar()
 , pCurrentExecutedWP(nullptr)
+, pCurrentExecutedStaticDWP(nullptr)
 {
+  if ((nbOfLanes == 0U) || (nbOfLanes > maxNbOfLanes))
+    throw std::invalid_argument("DeferredWorkQueue::DeferredWorkQueue: nbOfLanes invalid");
+
+  if (_defaultLane >= nbOfLanes)
+    throw std::invalid_argument("DeferredWorkQueue::DeferredWorkQueue: _defaultLane invalid");
+
+  lanes.resize(nbOfLanes);
 }
 
 /**
@@ -69,12 +115,15 @@ DeferredWorkQueue::~DeferredWorkQueue(void)
   {
     MutexLocker queueMutexLocker(queueMutex);
 
-    auto pWP = pQueueFirst;
-    while (pWP != nullptr)
+    for (auto & lane : lanes)
     {
-      auto toBeReleased = pWP;
-      pWP = pWP->pNext;
-      Release(toBeReleased);
+      auto pWP = lane.pFirst;
+      while (pWP != nullptr)
+      {
+        auto toBeReleased = pWP;
+        pWP = pWP->pNext;
+        Release(toBeReleased);
+      }
     }
 
     auto pDWP = pDeferredQueueFirst;
@@ -95,70 +144,13 @@ DeferredWorkQueue::~DeferredWorkQueue(void)
 /// \copydoc IWorkQueue::Add(std::unique_ptr<WorkPackage> spWP)
 void DeferredWorkQueue::Add(std::unique_ptr<WorkPackage> spWP)
 {
-  if (!spWP)
-    throw std::invalid_argument("DeferredWorkQueue::Add: !spWP");
-
-  MutexLocker queueMutexLocker(queueMutex);
-
-  if (pQueueLast == nullptr)
-  {
-    // (queue empty)
-
-    queueConVar.Signal();
-
-    CheckStateAndSetToInQ_dynamic(*spWP);
-
-    spWP->pNext = nullptr;
-    spWP->pPrev = nullptr;
-
-    pQueueFirst = spWP.get();
-    pQueueLast  = spWP.release();
-  }
-  else
-  {
-    // (queue not empty)
-
-    CheckStateAndSetToInQ_dynamic(*spWP);
-
-    spWP->pPrev = pQueueLast;
-    spWP->pNext = nullptr;
-
-    pQueueLast->pNext = spWP.get();
-    pQueueLast = spWP.release();
-  }
+  Add(std::move(spWP), defaultLane);
 }
 
 /// \copydoc IWorkQueue::Add(WorkPackage & wp)
 void DeferredWorkQueue::Add(WorkPackage & wp)
 {
-  MutexLocker queueMutexLocker(queueMutex);
-
-  if (pQueueLast == nullptr)
-  {
-    // (queue empty)
-
-    queueConVar.Signal();
-
-    CheckStateAndSetToInQ_static(wp);
-
-    wp.pNext = nullptr;
-    wp.pPrev = nullptr;
-
-    pQueueFirst = &wp;
-    pQueueLast  = &wp;
-  }
-  else
-  {
-    // (queue not empty)
-
-    CheckStateAndSetToInQ_static(wp);
-
-    wp.pPrev = pQueueLast;
-    wp.pNext = nullptr;
-
-    pQueueLast->pNext = &wp;
-    pQueueLast = &wp;
-  }
+  Add(wp, defaultLane);
 }
 
 /// \copydoc IWorkQueue::InsertAtHeadOfList(std::unique_ptr<WorkPackage> spWP)
@@ -169,32 +161,11 @@ void DeferredWorkQueue::InsertAtHeadOfList(std::unique_ptr<WorkPackage> spWP)
 
   MutexLocker queueMutexLocker(queueMutex);
 
-  if (pQueueLast == nullptr)
-  {
-    // (queue empty)
-
+  if (IsNormalQueueEmpty())
     queueConVar.Signal();
 
-    CheckStateAndSetToInQ_dynamic(*spWP);
-
-    spWP->pNext = nullptr;
-    spWP->pPrev = nullptr;
-
-    pQueueFirst = spWP.get();
-    pQueueLast  = spWP.release();
-  }
-  else
-  {
-    // (queue not empty)
-
-    CheckStateAndSetToInQ_dynamic(*spWP);
-
-    spWP->pPrev = nullptr;
-    spWP->pNext = pQueueFirst;
-
-    pQueueFirst->pPrev = spWP.get();
-    pQueueFirst = spWP.release();
-  }
+  CheckStateAndSetToInQ_dynamic(*spWP);
+  PrependToLane(lanes.front(), *spWP.release());
 }
 
 /// \copydoc IWorkQueue::InsertAtHeadOfList(WorkPackage & wp)
@@ -202,32 +173,11 @@ void DeferredWorkQueue::InsertAtHeadOfList(WorkPackage & wp)
 {
   MutexLocker queueMutexLocker(queueMutex);
 
-  if (pQueueLast == nullptr)
-  {
-    // (queue empty)
-
+  if (IsNormalQueueEmpty())
     queueConVar.Signal();
 
-    CheckStateAndSetToInQ_static(wp);
-
-    wp.pNext = nullptr;
-    wp.pPrev = nullptr;
-
-    pQueueFirst = &wp;
-    pQueueLast  = &wp;
-  }
-  else
-  {
-    // (queue not empty)
-
-    CheckStateAndSetToInQ_static(wp);
-
-    wp.pPrev = nullptr;
-    wp.pNext = pQueueFirst;
-
-    pQueueFirst->pPrev = &wp;
-    pQueueFirst = &wp;
-  }
+  CheckStateAndSetToInQ_static(wp);
+  PrependToLane(lanes.front(), wp);
 }
 
 /// \copydoc IWorkQueue::Remove(WorkPackage & wp)
@@ -248,26 +198,20 @@ void DeferredWorkQueue::Remove(WorkPackage & wp)
   if (wp.state == WorkPackage::States::staticExec)
     return;
 
-  auto pWP = pQueueFirst;
-  while (pWP != nullptr)
+  for (auto & lane : lanes)
   {
-    if (pWP == &wp)
+    auto pWP = lane.pFirst;
+    while (pWP != nullptr)
     {
-      if (pWP->pPrev != nullptr)
-        pWP->pPrev->pNext = pWP->pNext;
-      else
-        pQueueFirst = pWP->pNext;
-
-      if (pWP->pNext != nullptr)
-        pWP->pNext->pPrev = pWP->pPrev;
+      if (pWP == &wp)
+      {
+        UnlinkFromLane(lane, *pWP);
+        Release(pWP);
+        return;
+      }
       else
-        pQueueLast = pWP->pPrev;
-
-      Release(pWP);
-      return;
+        pWP = pWP->pNext;
     }
-    else
-      pWP = pWP->pNext;
   }
 }
 
@@ -276,25 +220,21 @@ void DeferredWorkQueue::Remove(void const * const pOwnerObject)
 {
   MutexLocker queueMutexLocker(queueMutex);
 
+  // end periodic execution of the currently executed static deferred work package
+  if ((pCurrentExecutedStaticDWP != nullptr) && (pCurrentExecutedStaticDWP->pOwnerObject == pOwnerObject))
+    pCurrentExecutedStaticDWP = nullptr;
+
   // normal queue
+  for (auto & lane : lanes)
   {
-    auto pWP = pQueueFirst;
+    auto pWP = lane.pFirst;
     while (pWP != nullptr)
     {
       if (pWP->pOwnerObject == pOwnerObject)
       {
-        if (pWP->pPrev != nullptr)
-          pWP->pPrev->pNext = pWP->pNext;
-        else
-          pQueueFirst = pWP->pNext;
-
-        if (pWP->pNext != nullptr)
-          pWP->pNext->pPrev = pWP->pPrev;
-        else
-          pQueueLast = pWP->pPrev;
-
         auto toBeReleased = pWP;
         pWP = pWP->pNext;
+        UnlinkFromLane(lane, *toBeReleased);
         Release(toBeReleased);
       }
       else
@@ -310,28 +250,19 @@ void DeferredWorkQueue::Remove(void const * const pOwnerObject)
     {
       if (pDWP->pOwnerObject == pOwnerObject)
       {
-        if (pDWP->pPrev != nullptr)
-          pDWP->pPrev->pNext = pDWP->pNext;
-        else
-        {
-          pDeferredQueueFirst = pDWP->pNext;
+        if (pDWP == pDeferredHeapRoot)
           timeoutUpdateRequired = true;
-        }
-
-        if (pDWP->pNext != nullptr)
-          pDWP->pNext->pPrev = pDWP->pPrev;
-        else
-          pDeferredQueueLast = pDWP->pPrev;
 
         auto toBeReleased = pDWP;
         pDWP = pDWP->pNext;
+        Dequeue(*toBeReleased);
         Release(toBeReleased);
       }
       else
         pDWP = pDWP->pNext;
     }
 
-    if ((timeoutUpdateRequired) && (pDeferredQueueFirst != nullptr))
+    if ((timeoutUpdateRequired) && (pDeferredHeapRoot != nullptr))
       queueConVar.Signal();
   }
 }
@@ -341,25 +272,25 @@ void DeferredWorkQueue::Remove(void const * const pOwnerObject, uint32_t const o
 {
   MutexLocker queueMutexLocker(queueMutex);
 
+  // end periodic execution of the currently executed static deferred work package
+  if ((pCurrentExecutedStaticDWP != nullptr) &&
+      (pCurrentExecutedStaticDWP->pOwnerObject == pOwnerObject) &&
+      (pCurrentExecutedStaticDWP->ownerID == ownerID))
+  {
+    pCurrentExecutedStaticDWP = nullptr;
+  }
+
   // normal queue
+  for (auto & lane : lanes)
   {
-    auto pWP = pQueueFirst;
+    auto pWP = lane.pFirst;
     while (pWP != nullptr)
     {
       if ((pWP->pOwnerObject == pOwnerObject) && (pWP->ownerID == ownerID))
       {
-        if (pWP->pPrev != nullptr)
-          pWP->pPrev->pNext = pWP->pNext;
-        else
-          pQueueFirst = pWP->pNext;
-
-        if (pWP->pNext != nullptr)
-          pWP->pNext->pPrev = pWP->pPrev;
-        else
-          pQueueLast = pWP->pPrev;
-
         auto toBeReleased = pWP;
         pWP = pWP->pNext;
+        UnlinkFromLane(lane, *toBeReleased);
         Release(toBeReleased);
       }
       else
@@ -375,28 +306,19 @@ void DeferredWorkQueue::Remove(void const * const pOwnerObject, uint32_t const o
     {
       if ((pDWP->pOwnerObject == pOwnerObject) && (pDWP->ownerID == ownerID))
       {
-        if (pDWP->pPrev != nullptr)
-          pDWP->pPrev->pNext = pDWP->pNext;
-        else
-        {
-          pDeferredQueueFirst = pDWP->pNext;
+        if (pDWP == pDeferredHeapRoot)
           timeoutUpdateRequired = true;
-        }
-
-        if (pDWP->pNext != nullptr)
-          pDWP->pNext->pPrev = pDWP->pPrev;
-        else
-          pDeferredQueueLast = pDWP->pPrev;
 
         auto toBeReleased = pDWP;
         pDWP = pDWP->pNext;
+        Dequeue(*toBeReleased);
         Release(toBeReleased);
       }
       else
         pDWP = pDWP->pNext;
     }
 
-    if ((timeoutUpdateRequired) && (pDeferredQueueFirst != nullptr))
+    if ((timeoutUpdateRequired) && (pDeferredHeapRoot != nullptr))
       queueConVar.Signal();
   }
 }
@@ -419,8 +341,9 @@ bool DeferredWorkQueue::IsAnyInQueue(void const * const pOwnerObject) const
   MutexLocker queueMutexLocker(queueMutex);
 
   // normal queue
+  for (auto const & lane : lanes)
   {
-    auto pWP = pQueueFirst;
+    auto pWP = lane.pFirst;
     while (pWP != nullptr)
     {
       if (pWP->pOwnerObject == pOwnerObject)
@@ -447,11 +370,48 @@ bool DeferredWorkQueue::IsAnyInQueue(void const * const pOwnerObject) const
 void DeferredWorkQueue::FlushNonDeferredWorkPackages(void)
 {
   Semaphore s(0);
-  Add(WorkPackage::CreateDynamic(this, 0, std::bind(&Semaphore::Post, &s)));
+
+  // One flush work package is appended to each lane that is not empty. Each flush work package is treated like any
+  // other work package (incl. aging), so the flush completes in bounded time if aging is enabled. If all lanes are
+  // empty, then one flush work package is added to lane 0 to await completion of the currently executed work package.
+  std::vector<std::unique_ptr<WorkPackage>> spFlushWPs;
+  spFlushWPs.reserve(lanes.size());
+  for (size_t i = 0U; i < lanes.size(); i++)
+    spFlushWPs.push_back(WorkPackage::CreateDynamic(this, 0, std::bind(&Semaphore::Post, &s)));
+
+  size_t nbOfFlushWPs = 0U;
+  {
+    MutexLocker queueMutexLocker(queueMutex);
+
+    if (IsNormalQueueEmpty())
+    {
+      queueConVar.Signal();
+
+      CheckStateAndSetToInQ_dynamic(*spFlushWPs[0]);
+      AppendToLane(lanes[0], *spFlushWPs[0].release());
+      nbOfFlushWPs = 1U;
+    }
+    else
+    {
+      for (size_t i = 0U; i < lanes.size(); i++)
+      {
+        if (lanes[i].pFirst != nullptr)
+        {
+          CheckStateAndSetToInQ_dynamic(*spFlushWPs[i]);
+          AppendToLane(lanes[i], *spFlushWPs[i].release());
+          nbOfFlushWPs++;
+        }
+      }
+    }
+  }
 
   try
   {
-    s.Wait();
+    while (nbOfFlushWPs != 0U)
+    {
+      s.Wait();
+      nbOfFlushWPs--;
+    }
 
     // lock flushMutex to ensure that the invocation of the work package's functor is complete
     flushMutex.Lock();
@@ -460,8 +420,8 @@ void DeferredWorkQueue::FlushNonDeferredWorkPackages(void)
   catch (...)
   {
     // If s.Wait() or the mutex lock/unlock fails, then we would leave and "s" would be released.
-    // This is bad, because the work package referencing s.Post() is either still in the work queue or
-    // the execution of the work package's functor might not have been completed yet.
+    // This is bad, because the work packages referencing s.Post() are either still in the work queue or
+    // the execution of the work packages' functors might not have been completed yet.
     PANIC();
 
     // never returns, but makes compiler happy
@@ -479,73 +439,16 @@ void DeferredWorkQueue::Add(std::unique_ptr<DeferredWorkPackage> spDWP)
 
   MutexLocker queueMutexLocker(queueMutex);
 
-  // Note: The queue for deferred work packages (pDeferredQueueFirst and pDeferredQueueLast)
-  // is sorted by blocking time in ascending order.
-  // spDWP must be inserted at the proper position.
+  CheckStateAndSetToInQ_dynamic(*spDWP);
 
-  if (pDeferredQueueLast == nullptr)
-  {
-    // (queue empty)
+  Enqueue(*spDWP);
 
+  // If spDWP has become the next deferred work package, then queueConVar must be signaled in order to setup a new
+  // timeout. This is necessary because the current timeout (if any) is larger than the one required by spDWP.
+  if (pDeferredHeapRoot == spDWP.get())
     queueConVar.Signal();
 
-    CheckStateAndSetToInQ_dynamic(*spDWP);
-
-    spDWP->pNext = nullptr;
-    spDWP->pPrev = nullptr;
-
-    pDeferredQueueFirst = spDWP.get();
-    pDeferredQueueLast  = spDWP.release();
-  }
-  else
-  {
-    // (queue not empty)
-
-    // iterate to the deferred work package behind which spDWP must be inserted
-    auto pDWP = pDeferredQueueLast;
-    while ((pDWP != nullptr) && (pDWP->tp > spDWP->tp))
-      pDWP = pDWP->pPrev;
-
-    // insert in front of the first element?
-    if (pDWP == nullptr)
-    {
-      // Insert spDWP in front of the first element and signal queueConVar in order to
-      // setup a new timeout. This is necessary because the current timeout is larger
-      // than the one required by spDWP.
-
-      queueConVar.Signal();
-
-      CheckStateAndSetToInQ_dynamic(*spDWP);
-
-      spDWP->pNext = pDeferredQueueFirst;
-      spDWP->pPrev = nullptr;
-
-      pDeferredQueueFirst->pPrev = spDWP.get();
-      pDeferredQueueFirst = spDWP.release();
-    }
-    // ...insert at end of list?
-    else if (pDWP == pDeferredQueueLast)
-    {
-      CheckStateAndSetToInQ_dynamic(*spDWP);
-
-      spDWP->pNext = nullptr;
-      spDWP->pPrev = pDeferredQueueLast;
-
-      pDeferredQueueLast->pNext = spDWP.get();
-      pDeferredQueueLast = spDWP.release();
-    }
-    // ...insert somewhere in the list
-    else
-    {
-      CheckStateAndSetToInQ_dynamic(*spDWP);
-
-      spDWP->pNext = pDWP->pNext;
-      spDWP->pPrev = pDWP;
-
-      spDWP->pNext->pPrev = spDWP.get();
-      pDWP->pNext = spDWP.release();
-    }
-  }
+  spDWP.release();
 }
 
 /// \copydoc IDeferredWorkQueue::Add(DeferredWorkPackage & dwp)
@@ -553,73 +456,14 @@ void DeferredWorkQueue::Add(DeferredWorkPackage & dwp)
 {
   MutexLocker queueMutexLocker(queueMutex);
 
-  // Note: The queue for deferred work packages (pDeferredQueueFirst and pDeferredQueueLast)
-  // is sorted by blocking time in ascending order.
-  // spDWP must be inserted at the proper position.
+  CheckStateAndSetToInQ_static(dwp);
 
-  if (pDeferredQueueLast == nullptr)
-  {
-    // (queue empty)
+  Enqueue(dwp);
 
+  // If dwp has become the next deferred work package, then queueConVar must be signaled in order to setup a new
+  // timeout. This is necessary because the current timeout (if any) is larger than the one required by dwp.
+  if (pDeferredHeapRoot == &dwp)
     queueConVar.Signal();
-
-    CheckStateAndSetToInQ_static(dwp);
-
-    dwp.pNext = nullptr;
-    dwp.pPrev = nullptr;
-
-    pDeferredQueueFirst = &dwp;
-    pDeferredQueueLast  = &dwp;
-  }
-  else
-  {
-    // (queue not empty)
-
-    // iterate to the deferred work package behind which dwp must be inserted
-    auto pDWP = pDeferredQueueLast;
-    while ((pDWP != nullptr) && (pDWP->tp > dwp.tp))
-      pDWP = pDWP->pPrev;
-
-    // insert in front of the first element?
-    if (pDWP == nullptr)
-    {
-      // Insert dwp in front of the first element and signal queueConVar in order to
-      // setup a new timeout. This is necessary because the current timeout is larger
-      // than the one required by dwp.
-
-      queueConVar.Signal();
-
-      CheckStateAndSetToInQ_static(dwp);
-
-      dwp.pNext = pDeferredQueueFirst;
-      dwp.pPrev = nullptr;
-
-      pDeferredQueueFirst->pPrev = &dwp;
-      pDeferredQueueFirst = &dwp;
-    }
-    // ...insert at end of list?
-    else if (pDWP == pDeferredQueueLast)
-    {
-      CheckStateAndSetToInQ_static(dwp);
-
-      dwp.pNext = nullptr;
-      dwp.pPrev = pDeferredQueueLast;
-
-      pDeferredQueueLast->pNext = &dwp;
-      pDeferredQueueLast = &dwp;
-    }
-    // ...insert somewhere in the list
-    else
-    {
-      CheckStateAndSetToInQ_static(dwp);
-
-      dwp.pNext = pDWP->pNext;
-      dwp.pPrev = pDWP;
-
-      dwp.pNext->pPrev = &dwp;
-      pDWP->pNext = &dwp;
-    }
-  }
 }
 
 /// \copydoc IDeferredWorkQueue::Remove(DeferredWorkPackage & dwp)
@@ -637,127 +481,515 @@ void DeferredWorkQueue::Remove(DeferredWorkPackage & dwp)
 
   MutexLocker queueMutexLocker(queueMutex);
 
-  if (dwp.state == DeferredWorkPackage::States::staticExec)
+  // end periodic execution if dwp is currently executed
+  if (pCurrentExecutedStaticDWP == &dwp)
+    pCurrentExecutedStaticDWP = nullptr;
+
+  DeferredWorkPackage::States const currState = dwp.state;
+  if ((currState != DeferredWorkPackage::States::staticInQ) &&
+      (currState != DeferredWorkPackage::States::staticExecInQ))
     return;
 
-  auto pDWP = pDeferredQueueFirst;
-  bool timeoutUpdateRequired = false;
-  while (pDWP != nullptr)
-  {
-    if (pDWP == &dwp)
-    {
-      if (pDWP->pPrev != nullptr)
-        pDWP->pPrev->pNext = pDWP->pNext;
-      else
-      {
-        pDeferredQueueFirst = pDWP->pNext;
-        timeoutUpdateRequired = true;
-      }
+  // enqueued in a different work queue?
+  if (dwp.pQueue != this)
+    return;
 
-      if (pDWP->pNext != nullptr)
-        pDWP->pNext->pPrev = pDWP->pPrev;
-      else
-        pDeferredQueueLast = pDWP->pPrev;
+  bool const timeoutUpdateRequired = (pDeferredHeapRoot == &dwp);
 
-      Release(pDWP);
-      if ((timeoutUpdateRequired) && (pDeferredQueueFirst != nullptr))
-        queueConVar.Signal();
-      return;
-    }
-    else
-      pDWP = pDWP->pNext;
-  }
+  Dequeue(dwp);
+  Release(&dwp);
+
+  if ((timeoutUpdateRequired) && (pDeferredHeapRoot != nullptr))
+    queueConVar.Signal();
 }
 // <--
 
 /**
- * \brief Executes work packages until termination is requested.
+ * \brief Adds a dynamic work package to a specific lane of the work queue.
  *
- * If there is a pending request for termination when this is invoked (see @ref RequestTermination()), then the request
- * will be consumed and this method will return immediately.
+ * Work packages from lanes with higher priority (smaller lane index) are executed first. Work packages in the same
+ * lane are executed in FIFO order. Aging (if enabled) may lead to the execution of a work package from a lane with
+ * lower priority, see @ref DeferredWorkQueue(size_t const, size_t const, uint32_t const).
  *
- * If termination is requested while a thread is inside this method, then the request will be consumed and this method
- * will either return immediately or it will return after execution of the current work package has finished.
+ * Apart from the lane, this behaves like @ref Add(std::unique_ptr<WorkPackage> spWP).
  *
  * - - -
  *
  * __Thread safety:__\n
- * There must be no more than one thread executing this method at any time.
+ * This is thread-safe.
  *
  * __Exception safety:__\n
- * Basic guarantee:
- * - If a work package throws, then the exception will propagate out of this method.
- * - If a work package throws, then the work queue will treat the work package as if it has completed with no error.
- *   For example a dynamic work package will be released.
- * - If a static work package has enqueued itself again before it throws, then the enqueue operation will not be undone.
- * - A pending termination request (see @ref RequestTermination()) may not be consumed.
+ * Strong guarantee.
  *
  * __Thread cancellation safety:__\n
- * Basic guarantee:
- * - The work queue's thread will be cancelled if it hits a cancellation point inside the work package.
- * - The work queue will treat the work package as if it has completed regulary. For example a dynamic work package
- *   will be released.
- * - If a static work package has enqueued itself again before cancellation takes place, then the enqueue operation will
- *   not be undone.
- * - A pending termination request (see @ref RequestTermination()) may not be consumed.
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param spWP
+ * Work package that shall be added. Ownership moves to the work queue.
+ * \param lane
+ * Lane into which the work package shall be added. This must be less than @ref GetNbOfLanes().
  */
-void DeferredWorkQueue::Work(void)
+void DeferredWorkQueue::Add(std::unique_ptr<WorkPackage> spWP, size_t const lane)
 {
-  AdvancedMutexLocker queueMutexLocker(queueMutex);
+  if (!spWP)
+    throw std::invalid_argument("DeferredWorkQueue::Add: !spWP");
 
-  ON_SCOPE_EXIT(reset_pOwnerOfCurrentExecutedWP)
-  {
-    // this will also unblock threads in WaitUntilCurrentWorkPackageHasBeenExecuted()
-    if (pOwnerOfCurrentExecutedWP != nullptr)
-    {
-      ownerChangedConVar.Broadcast();
-      pOwnerOfCurrentExecutedWP = nullptr;
-    }
-  };
+  if (lane >= lanes.size())
+    throw std::invalid_argument("DeferredWorkQueue::Add: Invalid lane");
 
-  while (true)
-  {
-    bool timeout = false;
+  MutexLocker queueMutexLocker(queueMutex);
 
-    // deferred queue empty?
-    if (pDeferredQueueFirst == nullptr)
-    {
-      // clear pOwnerOfCurrentExecutedWP if non-deferred queue is empty
-      if ((pOwnerOfCurrentExecutedWP != nullptr) && (pQueueFirst == nullptr))
-      {
-        ownerChangedConVar.Broadcast();
-        pOwnerOfCurrentExecutedWP = nullptr;
-      }
+  if (IsNormalQueueEmpty())
+    queueConVar.Signal();
 
-      // wait for a work package (deferred and normal) or a termination request
-      while ((pQueueFirst == nullptr) && (pDeferredQueueFirst == nullptr) && (!terminate))
-        queueConVar.Wait(queueMutex);
-    }
-    else
-    {
-      // deferred work packages ready for execution shall have priority above normal work packages
-      if ((pQueueFirst != nullptr) &&
-          (pDeferredQueueFirst->tp <= TimePoint::FromSystemClock(gpcc::osal::ConditionVariable::clockID)))
-        timeout = true;
+  CheckStateAndSetToInQ_dynamic(*spWP);
+  AppendToLane(lanes[lane], *spWP.release());
+}
 
-      // Clear pOwnerOfCurrentExecutedWP if non-deferred queue is empty and if deferred work package
-      // has not yet reached its timeout.
-      if ((pOwnerOfCurrentExecutedWP != nullptr) && (pQueueFirst == nullptr) && (!timeout))
-      {
-        ownerChangedConVar.Broadcast();
+/**
+ * \brief Adds a static work package to a specific lane of the work queue.
+ *
+ * Work packages from lanes with higher priority (smaller lane index) are executed first. Work packages in the same
+ * lane are executed in FIFO order. Aging (if enabled) may lead to the execution of a work package from a lane with
+ * lower priority, see @ref DeferredWorkQueue(size_t const, size_t const, uint32_t const).
+ *
+ * Apart from the lane, this behaves like @ref Add(WorkPackage & wp).
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param wp
+ * Work package that shall be added.
+ * \param lane
+ * Lane into which the work package shall be added. This must be less than @ref GetNbOfLanes().
+ */
+void DeferredWorkQueue::Add(WorkPackage & wp, size_t const lane)
+{
+  if (lane >= lanes.size())
+    throw std::invalid_argument("DeferredWorkQueue::Add: Invalid lane");
+
+  MutexLocker queueMutexLocker(queueMutex);
+
+  if (IsNormalQueueEmpty())
+    queueConVar.Signal();
+
+  CheckStateAndSetToInQ_static(wp);
+  AppendToLane(lanes[lane], wp);
+}
+
+/**
+ * \brief Adds multiple dynamic work packages to the default lane of the work queue.
+ *
+ * This is equivalent to @ref Add(std::vector<std::unique_ptr<WorkPackage>> & spWPs, size_t const lane) with the
+ * default lane specified at construction.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param spWPs
+ * Work packages that shall be added. Ownership moves to the work queue.\n
+ * The vector will be cleared if this method succeeds. It will not be modified if this method fails.
+ */
+void DeferredWorkQueue::Add(std::vector<std::unique_ptr<WorkPackage>> & spWPs)
+{
+  Add(spWPs, defaultLane);
+}
+
+/**
+ * \brief Adds multiple dynamic work packages to a specific lane of the work queue.
+ *
+ * All work packages are added atomically in the order in which they are stored in `spWPs`:
+ * The work queue's mutex is locked only once and the work queue's thread is signaled no more than once.\n
+ * Other work packages added to the same lane concurrently will not be placed in between the work packages of the
+ * batch.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param spWPs
+ * Work packages that shall be added. Ownership moves to the work queue. An empty vector is allowed.\n
+ * The vector will be cleared if this method succeeds. It will not be modified if this method fails.
+ * \param lane
+ * Lane into which the work packages shall be added. This must be less than @ref GetNbOfLanes().
+ */
+void DeferredWorkQueue::Add(std::vector<std::unique_ptr<WorkPackage>> & spWPs, size_t const lane)
+{
+  if (lane >= lanes.size())
+    throw std::invalid_argument("DeferredWorkQueue::Add: Invalid lane");
+
+  if (spWPs.empty())
+    return;
+
+  for (auto const & spWP : spWPs)
+  {
+    if (!spWP)
+      throw std::invalid_argument("DeferredWorkQueue::Add: spWPs contains nullptr");
+  }
+
+  MutexLocker queueMutexLocker(queueMutex);
+
+  if (IsNormalQueueEmpty())
+    queueConVar.Signal();
+
+  for (auto & spWP : spWPs)
+  {
+    CheckStateAndSetToInQ_dynamic(*spWP);
+    AppendToLane(lanes[lane], *spWP.release());
+  }
+
+  spWPs.clear();
+}
+
+/**
+ * \brief Adds multiple static work packages to the default lane of the work queue.
+ *
+ * This is equivalent to @ref Add(WorkPackage* const * const ppWPs, size_t const n, size_t const lane) with the
+ * default lane specified at construction.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param ppWPs
+ * Pointer to an array of pointers to the work packages that shall be added.\n
+ * nullptr is allowed, if `n` is zero.
+ * \param n
+ * Number of entries in the array referenced by `ppWPs`.
+ */
+void DeferredWorkQueue::Add(WorkPackage* const * const ppWPs, size_t const n)
+{
+  Add(ppWPs, n, defaultLane);
+}
+
+/**
+ * \brief Adds multiple static work packages to a specific lane of the work queue.
+ *
+ * All work packages are added atomically in the order in which they are stored in the array referenced by `ppWPs`:
+ * The work queue's mutex is locked only once and the work queue's thread is signaled no more than once.\n
+ * Other work packages added to the same lane concurrently will not be placed in between the work packages of the
+ * batch.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.\n
+ * If any of the work packages is in a bad state, then none of the work packages will be added.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param ppWPs
+ * Pointer to an array of pointers to the work packages that shall be added.\n
+ * Each work package must not be contained in the array more than once.\n
+ * nullptr is allowed, if `n` is zero.
+ * \param n
+ * Number of entries in the array referenced by `ppWPs`.
+ * \param lane
+ * Lane into which the work packages shall be added. This must be less than @ref GetNbOfLanes().
+ */
+void DeferredWorkQueue::Add(WorkPackage* const * const ppWPs, size_t const n, size_t const lane)
+{
+  if (lane >= lanes.size())
+    throw std::invalid_argument("DeferredWorkQueue::Add: Invalid lane");
+
+  if (n == 0U)
+    return;
+
+  if (ppWPs == nullptr)
+    throw std::invalid_argument("DeferredWorkQueue::Add: !ppWPs");
+
+  for (size_t i = 0U; i < n; i++)
+  {
+    if (ppWPs[i] == nullptr)
+      throw std::invalid_argument("DeferredWorkQueue::Add: ppWPs contains nullptr");
+  }
+
+  MutexLocker queueMutexLocker(queueMutex);
+
+  CheckStateAndSetToInQ_static(ppWPs, n);
+
+  if (IsNormalQueueEmpty())
+    queueConVar.Signal();
+
+  for (size_t i = 0U; i < n; i++)
+    AppendToLane(lanes[lane], *ppWPs[i]);
+}
+
+/**
+ * \brief Adds multiple dynamic deferred work packages to the work queue.
+ *
+ * All deferred work packages are added atomically: The work queue's mutex is locked only once and the work queue's
+ * thread is signaled no more than once.\n
+ * Deferred work packages with equal points in time are executed in the order in which they are stored in `spDWPs`.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param spDWPs
+ * Deferred work packages that shall be added. Ownership moves to the work queue. An empty vector is allowed.\n
+ * The vector will be cleared if this method succeeds. It will not be modified if this method fails.
+ */
+void DeferredWorkQueue::Add(std::vector<std::unique_ptr<DeferredWorkPackage>> & spDWPs)
+{
+  if (spDWPs.empty())
+    return;
+
+  for (auto const & spDWP : spDWPs)
+  {
+    if (!spDWP)
+      throw std::invalid_argument("DeferredWorkQueue::Add: spDWPs contains nullptr");
+  }
+
+  MutexLocker queueMutexLocker(queueMutex);
+
+  DeferredWorkPackage const * const pPrevHeapRoot = pDeferredHeapRoot;
+
+  for (auto & spDWP : spDWPs)
+  {
+    CheckStateAndSetToInQ_dynamic(*spDWP);
+    Enqueue(*spDWP.release());
+  }
+
+  // If one of the new deferred work packages has become the next deferred work package, then queueConVar must be
+  // signaled in order to setup a new timeout.
+  if (pDeferredHeapRoot != pPrevHeapRoot)
+    queueConVar.Signal();
+
+  spDWPs.clear();
+}
+
+/**
+ * \brief Adds multiple static deferred work packages to the work queue.
+ *
+ * All deferred work packages are added atomically: The work queue's mutex is locked only once and the work queue's
+ * thread is signaled no more than once.\n
+ * Deferred work packages with equal points in time are executed in the order in which they are stored in the array
+ * referenced by `ppDWPs`.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.\n
+ * If any of the deferred work packages is in a bad state, then none of the deferred work packages will be added.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param ppDWPs
+ * Pointer to an array of pointers to the deferred work packages that shall be added.\n
+ * Each deferred work package must not be contained in the array more than once.\n
+ * nullptr is allowed, if `n` is zero.
+ * \param n
+ * Number of entries in the array referenced by `ppDWPs`.
+ */
+void DeferredWorkQueue::Add(DeferredWorkPackage* const * const ppDWPs, size_t const n)
+{
+  if (n == 0U)
+    return;
+
+  if (ppDWPs == nullptr)
+    throw std::invalid_argument("DeferredWorkQueue::Add: !ppDWPs");
+
+  for (size_t i = 0U; i < n; i++)
+  {
+    if (ppDWPs[i] == nullptr)
+      throw std::invalid_argument("DeferredWorkQueue::Add: ppDWPs contains nullptr");
+  }
+
+  MutexLocker queueMutexLocker(queueMutex);
+
+  CheckStateAndSetToInQ_static(ppDWPs, n);
+
+  DeferredWorkPackage const * const pPrevHeapRoot = pDeferredHeapRoot;
+
+  for (size_t i = 0U; i < n; i++)
+    Enqueue(*ppDWPs[i]);
+
+  // If one of the new deferred work packages has become the next deferred work package, then queueConVar must be
+  // signaled in order to setup a new timeout.
+  if (pDeferredHeapRoot != pPrevHeapRoot)
+    queueConVar.Signal();
+}
+
+/**
+ * \brief Retrieves the statistics of a lane.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param lane
+ * Index of the lane. This must be less than @ref GetNbOfLanes().
+ * \return
+ * Snapshot of the lane's statistics.
+ */
+DeferredWorkQueue::LaneStatistics DeferredWorkQueue::GetLaneStatistics(size_t const lane) const
+{
+  if (lane >= lanes.size())
+    throw std::invalid_argument("DeferredWorkQueue::GetLaneStatistics: Invalid lane");
+
+  MutexLocker queueMutexLocker(queueMutex);
+  return lanes[lane].stats;
+}
+
+/**
+ * \brief Executes work packages until termination is requested.
+ *
+ * If there is a pending request for termination when this is invoked (see @ref RequestTermination()), then the request
+ * will be consumed and this method will return immediately.
+ *
+ * If termination is requested while a thread is inside this method, then the request will be consumed and this method
+ * will either return immediately or it will return after execution of the current work package has finished.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * There must be no more than one thread executing this method at any time.
+ *
+ * __Exception safety:__\n
+ * Basic guarantee:
+ * - If a work package throws, then the exception will propagate out of this method.
+ * - If a work package throws, then the work queue will treat the work package as if it has completed with no error.
+ *   For example a dynamic work package will be released.
+ * - If a static work package has enqueued itself again before it throws, then the enqueue operation will not be undone.
+ * - A pending termination request (see @ref RequestTermination()) may not be consumed.
+ *
+ * __Thread cancellation safety:__\n
+ * Basic guarantee:
+ * - The work queue's thread will be cancelled if it hits a cancellation point inside the work package.
+ * - The work queue will treat the work package as if it has completed regulary. For example a dynamic work package
+ *   will be released.
+ * - If a static work package has enqueued itself again before cancellation takes place, then the enqueue operation will
+ *   not be undone.
+ * - A pending termination request (see @ref RequestTermination()) may not be consumed.
+ */
+void DeferredWorkQueue::Work(void)
+{
+  AdvancedMutexLocker queueMutexLocker(queueMutex);
+
+  ON_SCOPE_EXIT(reset_pOwnerOfCurrentExecutedWP)
+  {
+    // this will also unblock threads in WaitUntilCurrentWorkPackageHasBeenExecuted()
+    if (pOwnerOfCurrentExecutedWP != nullptr)
+    {
+      ownerChangedConVar.Broadcast();
+      pOwnerOfCurrentExecutedWP = nullptr;
+    }
+  };
+
+  while (true)
+  {
+    bool timeout = false;
+
+    // deferred queue empty?
+    if (pDeferredHeapRoot == nullptr)
+    {
+      // clear pOwnerOfCurrentExecutedWP if non-deferred queue is empty
+      if ((pOwnerOfCurrentExecutedWP != nullptr) && (IsNormalQueueEmpty()))
+      {
+        ownerChangedConVar.Broadcast();
+        pOwnerOfCurrentExecutedWP = nullptr;
+      }
+
+      // wait for a work package (deferred and normal) or a termination request
+      while ((IsNormalQueueEmpty()) && (pDeferredHeapRoot == nullptr) && (!terminate))
+        queueConVar.Wait(queueMutex);
+    }
+    else
+    {
+      // deferred work packages ready for execution shall have priority above normal work packages
+      if ((!IsNormalQueueEmpty()) &&
+          (pDeferredHeapRoot->tp <= TimePoint::FromSystemClock(gpcc::osal::ConditionVariable::clockID)))
+        timeout = true;
+
+      // Clear pOwnerOfCurrentExecutedWP if non-deferred queue is empty and if deferred work package
+      // has not yet reached its timeout.
+      if ((pOwnerOfCurrentExecutedWP != nullptr) && (IsNormalQueueEmpty()) && (!timeout))
+      {
+        ownerChangedConVar.Broadcast();
         pOwnerOfCurrentExecutedWP = nullptr;
       }
 
       // wait for a normal work package, or timeout of deferred work package or a termination request
-      while ((!timeout) && (pQueueFirst == nullptr) && (pDeferredQueueFirst != nullptr) && (!terminate))
+      while ((!timeout) && (IsNormalQueueEmpty()) && (pDeferredHeapRoot != nullptr) && (!terminate))
       {
-        timeout = queueConVar.TimeLimitedWait(queueMutex, pDeferredQueueFirst->tp);
+        timeout = queueConVar.TimeLimitedWait(queueMutex, pDeferredHeapRoot->tp);
 
         // "timeout" is part of the convar's predicate we are waiting for. Double check is required
-        // because pDeferredQueueFirst may have changed while waiting.
+        // because pDeferredHeapRoot may have changed while waiting.
         if ((timeout) &&
-            (pDeferredQueueFirst != nullptr) &&
-            (pDeferredQueueFirst->tp > TimePoint::FromSystemClock(gpcc::osal::ConditionVariable::clockID)))
+            (pDeferredHeapRoot != nullptr) &&
+            (pDeferredHeapRoot->tp > TimePoint::FromSystemClock(gpcc::osal::ConditionVariable::clockID)))
           timeout = false;
       }
     }
@@ -769,17 +1001,18 @@ void DeferredWorkQueue::Work(void)
       return;
     }
 
-    // fetch a work package from queue, but do not remove it yet
+    // fetch a work package from queue
+    // (a non-deferred work package is removed from its lane by FetchNextWP(), a deferred one is removed below)
     DeferredWorkPackage* pDWP = nullptr;
     WorkPackage* pWP = nullptr;
-    if ((timeout) && (pDeferredQueueFirst != nullptr))
+    if ((timeout) && (pDeferredHeapRoot != nullptr))
     {
-      pDWP = pDeferredQueueFirst;
+      pDWP = pDeferredHeapRoot;
     }
     else
     {
-      if (pQueueFirst != nullptr)
-        pWP = pQueueFirst;
+      if (!IsNormalQueueEmpty())
+        pWP = FetchNextWP();
       else
       {
         // We have been woken up to setup a new timeout or there was only one deferred work package
@@ -795,33 +1028,31 @@ void DeferredWorkQueue::Work(void)
       pOwnerOfCurrentExecutedWP = pDWP->pOwnerObject;
     ownerChangedConVar.Broadcast();
 
+    // (a static work package may be enqueued again during execution, which would modify the timestamp / time point)
+    uint64_t enqueueTimestamp_ns = 0U;
+    TimePoint tp;
+
     if (pWP != nullptr)
     {
-      // remove work package from normal queue
-      pQueueFirst = pWP->pNext;
-      if (pQueueFirst != nullptr)
-        pQueueFirst->pPrev = nullptr;
-      else
-        pQueueLast = nullptr;
-
       // update work package's state and prepare for execution
       if (pWP->state == WorkPackage::States::staticInQ)
         pWP->state = WorkPackage::States::staticExec;
       pCurrentExecutedWP = pWP;
+      enqueueTimestamp_ns = pWP->enqueueTimestamp_ns;
     }
     else
     {
       // remove work package from deferred queue
-      pDeferredQueueFirst = pDWP->pNext;
-      if (pDeferredQueueFirst != nullptr)
-        pDeferredQueueFirst->pPrev = nullptr;
-      else
-        pDeferredQueueLast = nullptr;
+      Dequeue(*pDWP);
 
       // update work package's state and prepare for execution
       if (pDWP->state == DeferredWorkPackage::States::staticInQ)
+      {
         pDWP->state = DeferredWorkPackage::States::staticExec;
+        pCurrentExecutedStaticDWP = pDWP;
+      }
       pCurrentExecutedWP = pDWP;
+      tp = pDWP->tp;
     }
 
     queueMutexLocker.Unlock();
@@ -836,6 +1067,9 @@ void DeferredWorkQueue::Work(void)
       PANIC();
     }
 
+    // flushMutex is locked, so the telemetry object cannot be detached until execution is complete
+    WorkQueueTelemetry* const pTel = pTelemetry;
+
     // finally execute the work package
     if (pWP != nullptr)
     {
@@ -847,7 +1081,17 @@ void DeferredWorkQueue::Work(void)
         pCurrentExecutedWP = nullptr;
       };
 
-      pWP->functor();
+      if (pTel == nullptr)
+      {
+        pWP->functor();
+      }
+      else
+      {
+        uint64_t const startTimestamp_ns = WorkQueueTelemetry::GetTimestamp_ns();
+        pWP->functor();
+        pTel->RecordExecution(pWP->pOwnerObject, pWP->ownerID, enqueueTimestamp_ns,
+                              startTimestamp_ns, WorkQueueTelemetry::GetTimestamp_ns());
+      }
     }
     else
     {
@@ -857,9 +1101,21 @@ void DeferredWorkQueue::Work(void)
         queueMutexLocker.Relock();
         Finish(pDWP);
         pCurrentExecutedWP = nullptr;
+        pCurrentExecutedStaticDWP = nullptr;
       };
 
-      pDWP->functor();
+      if (pTel == nullptr)
+      {
+        pDWP->functor();
+      }
+      else
+      {
+        int64_t const lateStart_ns = (TimePoint::FromSystemClock(gpcc::osal::ConditionVariable::clockID) - tp).ns();
+        uint64_t const startTimestamp_ns = WorkQueueTelemetry::GetTimestamp_ns();
+        pDWP->functor();
+        pTel->RecordDeferredExecution(pDWP->pOwnerObject, pDWP->ownerID, lateStart_ns,
+                                      startTimestamp_ns, WorkQueueTelemetry::GetTimestamp_ns());
+      }
     }
   } // while (true)
 }
@@ -883,22 +1139,319 @@ void DeferredWorkQueue::Work(void)
  * __Exception safety:__\n
  * No-throw guarantee.
  *
- * __Thread cancellation safety:__\n
- * No cancellation point included.
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ */
+void DeferredWorkQueue::RequestTermination(void) noexcept
+{
+  try
+  {
+    MutexLocker queueMutexLocker(queueMutex);
+
+    queueConVar.Signal();
+    terminate = true;
+  }
+  catch (...)
+  {
+    PANIC();
+  }
+}
+
+/**
+ * \brief Attaches a @ref WorkQueueTelemetry instance to the work queue or detaches it.
+ *
+ * While a @ref WorkQueueTelemetry instance is attached, the work queue records the queue latency of non-deferred work
+ * packages, the late start of deferred work packages, the execution time of each executed work package and the
+ * maximum number of enqueued non-deferred work packages.
+ *
+ * Non-deferred work packages that have been added to the work queue before the @ref WorkQueueTelemetry instance was
+ * attached will not contribute to the queue latency.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.\n
+ * This must not be invoked from within a work package executed by this work queue.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param _pTelemetry
+ * Pointer to the @ref WorkQueueTelemetry instance that shall be attached.\n
+ * nullptr = detach.\n
+ * After this method has returned, a previously attached @ref WorkQueueTelemetry instance is no longer accessed by the
+ * work queue. An attached @ref WorkQueueTelemetry instance must be detached before it is destroyed.
+ */
+void DeferredWorkQueue::SetTelemetry(WorkQueueTelemetry* const _pTelemetry)
+{
+  MutexLocker flushMutexLocker(flushMutex);
+  MutexLocker queueMutexLocker(queueMutex);
+
+  pTelemetry = _pTelemetry;
+}
+
+/**
+ * \brief Checks if all lanes for non-deferred work packages are empty.
+ *
+ * __Thread-safety:__\n
+ * @ref queueMutex must be locked.
+ *
+ * __Exception-safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread-cancellation-safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * ---
+ *
+ * \retval true   All lanes are empty.
+ * \retval false  At least one lane contains a work package.
+ */
+bool DeferredWorkQueue::IsNormalQueueEmpty(void) const noexcept
+{
+  for (auto const & lane : lanes)
+  {
+    if (lane.pFirst != nullptr)
+      return false;
+  }
+
+  return true;
+}
+
+/**
+ * \brief Appends a @ref WorkPackage to the end of a lane.
+ *
+ * __Thread-safety:__\n
+ * @ref queueMutex must be locked.
+ *
+ * __Exception-safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread-cancellation-safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * ---
+ *
+ * \param lane
+ * Lane to which the work package shall be appended.
+ * \param wp
+ * Work package. Its state must have been set to the proper "in-Q" state already.
+ */
+void DeferredWorkQueue::AppendToLane(Lane & lane, WorkPackage & wp) noexcept
+{
+  wp.pPrev = lane.pLast;
+  wp.pNext = nullptr;
+
+  if (lane.pLast == nullptr)
+    lane.pFirst = &wp;
+  else
+    lane.pLast->pNext = &wp;
+
+  lane.pLast = &wp;
+
+  OnAddedToLane(wp);
+}
+
+/**
+ * \brief Inserts a @ref WorkPackage at the head of a lane.
+ *
+ * __Thread-safety:__\n
+ * @ref queueMutex must be locked.
+ *
+ * __Exception-safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread-cancellation-safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * ---
+ *
+ * \param lane
+ * Lane into which the work package shall be inserted.
+ * \param wp
+ * Work package. Its state must have been set to the proper "in-Q" state already.
+ */
+void DeferredWorkQueue::PrependToLane(Lane & lane, WorkPackage & wp) noexcept
+{
+  wp.pPrev = nullptr;
+  wp.pNext = lane.pFirst;
+
+  if (lane.pFirst == nullptr)
+    lane.pLast = &wp;
+  else
+    lane.pFirst->pPrev = &wp;
+
+  lane.pFirst = &wp;
+
+  OnAddedToLane(wp);
+}
+
+/**
+ * \brief Removes a @ref WorkPackage from a lane.
+ *
+ * If the lane becomes empty, then the lane's counter for consecutive bypasses is reset.
+ *
+ * __Thread-safety:__\n
+ * @ref queueMutex must be locked.
+ *
+ * __Exception-safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread-cancellation-safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * ---
+ *
+ * \param lane
+ * Lane containing the work package.
+ * \param wp
+ * Work package that shall be removed. Its state is not modified.
+ */
+void DeferredWorkQueue::UnlinkFromLane(Lane & lane, WorkPackage & wp) noexcept
+{
+  if (wp.pPrev != nullptr)
+    wp.pPrev->pNext = wp.pNext;
+  else
+    lane.pFirst = wp.pNext;
+
+  if (wp.pNext != nullptr)
+    wp.pNext->pPrev = wp.pPrev;
+  else
+    lane.pLast = wp.pPrev;
+
+  if (lane.pFirst == nullptr)
+    lane.consecutiveBypasses = 0U;
+
+  nbOfEnqueuedWPs--;
+}
+
+/**
+ * \brief Updates the number of enqueued work packages and the telemetry data after a @ref WorkPackage has been added
+ *        to a lane.
+ *
+ * If a @ref WorkQueueTelemetry instance is attached, then the current time will be stored in the work package.
+ * Otherwise the timestamp of the work package will be cleared.
+ *
+ * __Thread-safety:__\n
+ * @ref queueMutex must be locked.
+ *
+ * __Exception-safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread-cancellation-safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * ---
+ *
+ * \param wp
+ * Work package that has been added to a lane.
+ */
+void DeferredWorkQueue::OnAddedToLane(WorkPackage & wp) noexcept
+{
+  nbOfEnqueuedWPs++;
+
+  if (pTelemetry == nullptr)
+  {
+    wp.enqueueTimestamp_ns = 0U;
+    return;
+  }
+
+  try
+  {
+    wp.enqueueTimestamp_ns = WorkQueueTelemetry::GetTimestamp_ns();
+  }
+  catch (...)
+  {
+    PANIC();
+  }
+
+  pTelemetry->RecordQueueDepth(nbOfEnqueuedWPs);
+}
+
+/**
+ * \brief Selects the next non-deferred work package for execution and removes it from its lane.
+ *
+ * The work package is taken from the non-empty lane with the highest priority, unless aging is enabled and a
+ * non-empty lane with lower priority has been bypassed @ref agingThreshold times in a row. In this case the work
+ * package is taken from that lane (if there are multiple such lanes, then the one with the highest priority is
+ * chosen).
+ *
+ * The statistics of all lanes are updated.
+ *
+ * __Thread-safety:__\n
+ * @ref queueMutex must be locked.
+ *
+ * __Exception-safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread-cancellation-safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * ---
+ *
+ * \pre    At least one lane contains a work package.
+ *
+ * ---
+ *
+ * \return
+ * Pointer to the selected work package. The work package has been removed from its lane, but its state has not been
+ * modified.
  */
-void DeferredWorkQueue::RequestTermination(void) noexcept
+WorkPackage* DeferredWorkQueue::FetchNextWP(void) noexcept
 {
-  try
-  {
-    MutexLocker queueMutexLocker(queueMutex);
+  size_t const nbOfLanes = lanes.size();
 
-    queueConVar.Signal();
-    terminate = true;
+  // select the non-empty lane with the highest priority
+  size_t selected = 0U;
+  while (lanes[selected].pFirst == nullptr)
+    selected++;
+
+  // aging: select a lane with lower priority that has been bypassed too often
+  bool aged = false;
+  if (agingThreshold != 0U)
+  {
+    for (size_t i = selected + 1U; i < nbOfLanes; i++)
+    {
+      Lane const & lane = lanes[i];
+      if ((lane.pFirst != nullptr) && (lane.consecutiveBypasses >= agingThreshold))
+      {
+        selected = i;
+        aged = true;
+        break;
+      }
+    }
   }
-  catch (...)
+
+  // update statistics
+  for (size_t i = 0U; i < nbOfLanes; i++)
   {
-    PANIC();
+    Lane & lane = lanes[i];
+    if (i == selected)
+    {
+      lane.consecutiveBypasses = 0U;
+      lane.stats.nbOfExecutedWPs++;
+      if (aged)
+        lane.stats.nbOfAgingPromotions++;
+    }
+    else if (lane.pFirst != nullptr)
+    {
+      if (lane.consecutiveBypasses != std::numeric_limits<uint32_t>::max())
+        lane.consecutiveBypasses++;
+
+      lane.stats.nbOfBypasses++;
+      if (lane.consecutiveBypasses > lane.stats.maxConsecutiveBypasses)
+        lane.stats.maxConsecutiveBypasses = lane.consecutiveBypasses;
+    }
   }
+
+  WorkPackage* const pWP = lanes[selected].pFirst;
+  UnlinkFromLane(lanes[selected], *pWP);
+  return pWP;
 }
 
 /**
@@ -1019,6 +1572,429 @@ void DeferredWorkQueue::CheckStateAndSetToInQ_dynamic(DeferredWorkPackage& dwp)
     Panic("DeferredWorkQueue::CheckStateAndSetToInQ_dynamic: Bad DWP state");
 }
 
+/**
+ * \brief Checks the states of multiple @ref WorkPackage instances (static), which shall be enqueued into the
+ * work queue and sets the states of the work packages to the proper "in-Q" state.
+ *
+ * Either the states of all work packages are set, or none.
+ *
+ * __Thread-safety:__\n
+ * @ref queueMutex must be locked.
+ *
+ * __Exception-safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread-cancellation-safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * ---
+ *
+ * \param ppWPs
+ * Pointer to an array of pointers to the work packages. None of the pointers must be nullptr.
+ * \param n
+ * Number of entries in the array referenced by `ppWPs`.
+ */
+void DeferredWorkQueue::CheckStateAndSetToInQ_static(WorkPackage* const * const ppWPs, size_t const n) const
+{
+  size_t i = 0U;
+  try
+  {
+    while (i < n)
+    {
+      CheckStateAndSetToInQ_static(*ppWPs[i]);
+      i++;
+    }
+  }
+  catch (...)
+  {
+    // roll back the work packages whose state has already been set
+    while (i != 0U)
+    {
+      i--;
+      WorkPackage & wp = *ppWPs[i];
+      if (wp.state == WorkPackage::States::staticExecInQ)
+        wp.state = WorkPackage::States::staticExec;
+      else
+        wp.state = WorkPackage::States::staticNotInQ;
+    }
+
+    throw;
+  }
+}
+
+/**
+ * \brief Checks the states of multiple @ref DeferredWorkPackage instances (static), which shall be enqueued into the
+ * work queue and sets the states of the deferred work packages to the proper "in-Q" state.
+ *
+ * Either the states of all deferred work packages are set, or none.
+ *
+ * __Thread-safety:__\n
+ * @ref queueMutex must be locked.
+ *
+ * __Exception-safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread-cancellation-safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * ---
+ *
+ * \param ppDWPs
+ * Pointer to an array of pointers to the deferred work packages. None of the pointers must be nullptr.
+ * \param n
+ * Number of entries in the array referenced by `ppDWPs`.
+ */
+void DeferredWorkQueue::CheckStateAndSetToInQ_static(DeferredWorkPackage* const * const ppDWPs, size_t const n) const
+{
+  size_t i = 0U;
+  try
+  {
+    while (i < n)
+    {
+      CheckStateAndSetToInQ_static(*ppDWPs[i]);
+      i++;
+    }
+  }
+  catch (...)
+  {
+    // roll back the deferred work packages whose state has already been set
+    while (i != 0U)
+    {
+      i--;
+      DeferredWorkPackage & dwp = *ppDWPs[i];
+      if (dwp.state == DeferredWorkPackage::States::staticExecInQ)
+        dwp.state = DeferredWorkPackage::States::staticExec;
+      else
+        dwp.state = DeferredWorkPackage::States::staticNotInQ;
+    }
+
+    throw;
+  }
+}
+
+/**
+ * \brief Adds a @ref DeferredWorkPackage to the list of deferred work packages and to the pairing heap.
+ *
+ * The state of the deferred work package is not modified.
+ *
+ * Complexity: O(1)
+ *
+ * __Thread-safety:__\n
+ * @ref queueMutex must be locked.
+ *
+ * __Exception-safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread-cancellation-safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * ---
+ *
+ * \param dwp
+ * Reference to the deferred work package that shall be enqueued.
+ */
+void DeferredWorkQueue::Enqueue(DeferredWorkPackage& dwp) noexcept
+{
+  // append to list
+  dwp.pNext = nullptr;
+  dwp.pPrev = pDeferredQueueLast;
+  if (pDeferredQueueLast != nullptr)
+    pDeferredQueueLast->pNext = &dwp;
+  else
+    pDeferredQueueFirst = &dwp;
+  pDeferredQueueLast = &dwp;
+
+  // insert into pairing heap
+  dwp.pQueue = this;
+  dwp.seqNo = nextDeferredSeqNo++;
+  dwp.pHeapChild = nullptr;
+  dwp.pHeapNext = nullptr;
+  dwp.pHeapPrev = nullptr;
+
+  if (pDeferredHeapRoot == nullptr)
+    pDeferredHeapRoot = &dwp;
+  else
+    pDeferredHeapRoot = HeapMeld(pDeferredHeapRoot, &dwp);
+}
+
+/**
+ * \brief Removes a @ref DeferredWorkPackage from the list of deferred work packages and from the pairing heap.
+ *
+ * The state of the deferred work package is not modified.
+ *
+ * Complexity: O(log n) amortized
+ *
+ * __Thread-safety:__\n
+ * @ref queueMutex must be locked.
+ *
+ * __Exception-safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread-cancellation-safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * ---
+ *
+ * \param dwp
+ * Reference to the deferred work package that shall be removed.\n
+ * The deferred work package must be enqueued in this work queue.
+ */
+void DeferredWorkQueue::Dequeue(DeferredWorkPackage& dwp) noexcept
+{
+  // remove from list
+  if (dwp.pPrev != nullptr)
+    dwp.pPrev->pNext = dwp.pNext;
+  else
+    pDeferredQueueFirst = dwp.pNext;
+
+  if (dwp.pNext != nullptr)
+    dwp.pNext->pPrev = dwp.pPrev;
+  else
+    pDeferredQueueLast = dwp.pPrev;
+
+  // remove from pairing heap
+  if (&dwp == pDeferredHeapRoot)
+  {
+    pDeferredHeapRoot = HeapMergePairs(dwp.pHeapChild);
+  }
+  else
+  {
+    // cut dwp and its sub-heap from the pairing heap
+    if (dwp.pHeapPrev->pHeapChild == &dwp)
+      dwp.pHeapPrev->pHeapChild = dwp.pHeapNext;
+    else
+      dwp.pHeapPrev->pHeapNext = dwp.pHeapNext;
+
+    if (dwp.pHeapNext != nullptr)
+      dwp.pHeapNext->pHeapPrev = dwp.pHeapPrev;
+
+    // merge the children of dwp and meld them into the pairing heap
+    auto const pSubHeap = HeapMergePairs(dwp.pHeapChild);
+    if (pSubHeap != nullptr)
+      pDeferredHeapRoot = HeapMeld(pDeferredHeapRoot, pSubHeap);
+  }
+
+  dwp.pHeapChild = nullptr;
+  dwp.pHeapNext = nullptr;
+  dwp.pHeapPrev = nullptr;
+  dwp.pQueue = nullptr;
+}
+
+/**
+ * \brief Enqueues a periodic static @ref DeferredWorkPackage again after its execution has finished.
+ *
+ * The next point in time is calculated from the previous point in time and the period. If the next point in time has
+ * already been reached (overrun), then the work package's overrun policy is applied and the work package's statistics
+ * are updated.
+ *
+ * __Thread-safety:__\n
+ * @ref queueMutex must be locked.
+ *
+ * __Exception-safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread-cancellation-safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * ---
+ *
+ * \param dwp
+ * Reference to the periodic static deferred work package. It must be in state `staticNotInQ`.
+ */
+void DeferredWorkQueue::Reschedule(DeferredWorkPackage& dwp) noexcept
+{
+  TimePoint now;
+  try
+  {
+    now = TimePoint::FromSystemClock(gpcc::osal::ConditionVariable::clockID);
+  }
+  catch (...)
+  {
+    PANIC();
+  }
+
+  TimePoint next = dwp.tp + TimeSpan::ns(dwp.period_ns);
+  if (next <= now)
+  {
+    // number of periods whose point in time has been reached (at least one)
+    int64_t const n = (now - dwp.tp).ns() / dwp.period_ns;
+
+    dwp.nbOfOverruns.fetch_add(1U, std::memory_order_relaxed);
+
+    switch (dwp.overrunPolicy)
+    {
+      case DeferredWorkPackage::OverrunPolicy::skip:
+        next = dwp.tp + TimeSpan::ns((n + 1) * dwp.period_ns);
+        dwp.nbOfMissedPeriods.fetch_add(static_cast<uint64_t>(n), std::memory_order_relaxed);
+        break;
+
+      case DeferredWorkPackage::OverrunPolicy::catchUp:
+        break;
+
+      case DeferredWorkPackage::OverrunPolicy::coalesce:
+        next = dwp.tp + TimeSpan::ns(n * dwp.period_ns);
+        dwp.nbOfMissedPeriods.fetch_add(static_cast<uint64_t>(n - 1), std::memory_order_relaxed);
+        break;
+    }
+  }
+
+  dwp.tp = next;
+  dwp.state = DeferredWorkPackage::States::staticInQ;
+  Enqueue(dwp);
+}
+
+/**
+ * \brief Determines if a @ref DeferredWorkPackage shall be executed before another one.
+ *
+ * __Thread-safety:__\n
+ * @ref queueMutex must be locked.
+ *
+ * __Exception-safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread-cancellation-safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * ---
+ *
+ * \param a
+ * Reference to the first deferred work package. It must be enqueued in this work queue.
+ * \param b
+ * Reference to the second deferred work package. It must be enqueued in this work queue.
+ * \return
+ * true  = `a` shall be executed before `b`.\n
+ * false = `b` shall be executed before `a`.
+ */
+bool DeferredWorkQueue::IsBefore(DeferredWorkPackage const & a, DeferredWorkPackage const & b) noexcept
+{
+  if (a.tp < b.tp)
+    return true;
+  else if (a.tp == b.tp)
+    return (a.seqNo < b.seqNo);
+  else
+    return false;
+}
+
+/**
+ * \brief Melds two pairing heaps.
+ *
+ * Complexity: O(1)
+ *
+ * __Thread-safety:__\n
+ * @ref queueMutex must be locked.
+ *
+ * __Exception-safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread-cancellation-safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * ---
+ *
+ * \param pA
+ * Root of the first pairing heap. nullptr is not allowed.\n
+ * The root must have no siblings and no parent.
+ * \param pB
+ * Root of the second pairing heap. nullptr is not allowed.\n
+ * The root must have no siblings and no parent.
+ * \return
+ * Root of the resulting pairing heap.
+ */
+DeferredWorkPackage* DeferredWorkQueue::HeapMeld(DeferredWorkPackage* const pA,
+                                                 DeferredWorkPackage* const pB) noexcept
+{
+  DeferredWorkPackage* pParent;
+  DeferredWorkPackage* pChild;
+  if (IsBefore(*pB, *pA))
+  {
+    pParent = pB;
+    pChild  = pA;
+  }
+  else
+  {
+    pParent = pA;
+    pChild  = pB;
+  }
+
+  // make pChild the first child of pParent
+  pChild->pHeapPrev = pParent;
+  pChild->pHeapNext = pParent->pHeapChild;
+  if (pParent->pHeapChild != nullptr)
+    pParent->pHeapChild->pHeapPrev = pChild;
+  pParent->pHeapChild = pChild;
+
+  return pParent;
+}
+
+/**
+ * \brief Merges a list of sibling pairing heaps into one pairing heap using the two-pass pairing approach.
+ *
+ * Complexity: O(log n) amortized
+ *
+ * __Thread-safety:__\n
+ * @ref queueMutex must be locked.
+ *
+ * __Exception-safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread-cancellation-safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * ---
+ *
+ * \param pFirst
+ * First pairing heap in the list of siblings (linked via pHeapNext). nullptr is allowed.
+ * \return
+ * Root of the resulting pairing heap.\n
+ * nullptr if `pFirst` is nullptr.
+ */
+DeferredWorkPackage* DeferredWorkQueue::HeapMergePairs(DeferredWorkPackage* pFirst) noexcept
+{
+  // First pass: Meld pairs from left to right. The results are pushed on a stack linked via pHeapNext.
+  DeferredWorkPackage* pStack = nullptr;
+  while (pFirst != nullptr)
+  {
+    auto const pA = pFirst;
+    auto const pB = pA->pHeapNext;
+
+    pA->pHeapNext = nullptr;
+    pA->pHeapPrev = nullptr;
+
+    DeferredWorkPackage* pMelded;
+    if (pB != nullptr)
+    {
+      pFirst = pB->pHeapNext;
+      pB->pHeapNext = nullptr;
+      pB->pHeapPrev = nullptr;
+      pMelded = HeapMeld(pA, pB);
+    }
+    else
+    {
+      pFirst = nullptr;
+      pMelded = pA;
+    }
+
+    pMelded->pHeapNext = pStack;
+    pStack = pMelded;
+  }
+
+  // Second pass: Meld the pairs from right to left.
+  DeferredWorkPackage* pResult = nullptr;
+  while (pStack != nullptr)
+  {
+    auto const pHeap = pStack;
+    pStack = pStack->pHeapNext;
+    pHeap->pHeapNext = nullptr;
+
+    if (pResult == nullptr)
+      pResult = pHeap;
+    else
+      pResult = HeapMeld(pResult, pHeap);
+  }
+
+  return pResult;
+}
+
 /**
  * \brief Releases a @ref WorkPackage instance which is enqueued in the work queue.
  *
@@ -1168,6 +2144,10 @@ void DeferredWorkQueue::Finish(DeferredWorkPackage* const pDWP) noexcept
   {
     case DeferredWorkPackage::States::staticExec:
       pDWP->state = DeferredWorkPackage::States::staticNotInQ;
+
+      // periodic and not removed during execution?
+      if ((pDWP == pCurrentExecutedStaticDWP) && (pDWP->IsPeriodic()))
+        Reschedule(*pDWP);
       break;
 
     case DeferredWorkPackage::States::staticExecInQ:
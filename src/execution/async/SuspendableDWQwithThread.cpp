@@ -43,6 +43,42 @@ SuspendableDWQwithThread::SuspendableDWQwithThread(std::string const & threadNam
 {
 }
 
+/**
+ * \brief Constructor. The encapsulated @ref DeferredWorkQueue will use multiple priority lanes for normal work
+ *        packages.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Strong guarantee.
+ *
+ * - - -
+ *
+ * \param threadName
+ * Name for the thread that will run the work queue.
+ * \param nbOfLanes
+ * Number of priority lanes. See @ref DeferredWorkQueue::DeferredWorkQueue(size_t const, size_t const, uint32_t const).
+ * \param defaultLane
+ * Default lane. See @ref DeferredWorkQueue::DeferredWorkQueue(size_t const, size_t const, uint32_t const).
+ * \param agingThreshold
+ * Aging threshold. See @ref DeferredWorkQueue::DeferredWorkQueue(size_t const, size_t const, uint32_t const).
+ */
+SuspendableDWQwithThread::SuspendableDWQwithThread(std::string const & threadName,
+                                                   size_t const nbOfLanes,
+                                                   size_t const defaultLane,
+                                                   uint32_t const agingThreshold)
+: dwq(nbOfLanes, defaultLane, agingThreshold)
+, thread(threadName)
+, apiMutex()
+, mutex()
+, cvCtrlStatEvent()
+, ctrlStat(CtrlStat::noThread)
+{
+}
+
 /**
  * \brief Destructor.
  *
@@ -47,6 +47,7 @@ WorkPackage::WorkPackage(void const * const _pOwnerObject, uint32_t const _owner
 , functor(_functor)
 , pNext(nullptr)
 , pPrev(nullptr)
+, enqueueTimestamp_ns(0U)
 , state(States::staticNotInQ)
 {
   if (!functor)
@@ -85,6 +86,7 @@ WorkPackage::WorkPackage(void const * const _pOwnerObject, uint32_t const _owner
 , functor(std::move(_functor))
 , pNext(nullptr)
 , pPrev(nullptr)
+, enqueueTimestamp_ns(0U)
 , state(States::staticNotInQ)
 {
   if (!functor)
@@ -188,6 +190,59 @@ std::unique_ptr<WorkPackage> WorkPackage::CreateDynamic(void const * const _pOwn
   return std::unique_ptr<WorkPackage>(pWP);
 }
 
+/**
+ * \brief Class-specific allocation function.
+ *
+ * This places a tag of `alignof(std::max_align_t)` bytes in front of the work package, which allows
+ * `operator delete` to release both work packages allocated on the heap and work packages placed in a block of a
+ * @ref WorkPackagePool.
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * ---
+ *
+ * \param size
+ * Size of the object in bytes.
+ * \return
+ * Pointer to the allocated memory.
+ */
+void* WorkPackage::operator new(size_t const size)
+{
+  return WorkPackagePool::AllocateFromHeap(size);
+}
+
+/**
+ * \brief Class-specific deallocation function.
+ *
+ * If the work package has been placed in a block of a @ref WorkPackagePool, then the block will be returned to the
+ * pool. Otherwise the memory will be released to the heap.
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * ---
+ *
+ * \param p
+ * Pointer to the memory that shall be released.
+ */
+void WorkPackage::operator delete(void* const p) noexcept
+{
+  WorkPackagePool::Free(p);
+}
+
 } // namespace async
 } // namespace execution
 } // namespace gpcc
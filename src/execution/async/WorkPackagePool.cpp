@@ -0,0 +1,407 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#include <gpcc/execution/async/WorkPackagePool.hpp>
+#include <gpcc/execution/async/DeferredWorkPackage.hpp>
+#include <gpcc/execution/async/WorkPackage.hpp>
+#include <gpcc/osal/MutexLocker.hpp>
+#include <gpcc/osal/Panic.hpp>
+#include <algorithm>
+#include <new>
+#include <stdexcept>
+#include <cstddef>
+
+namespace gpcc      {
+namespace execution {
+namespace async     {
+
+using namespace gpcc::osal;
+
+namespace {
+
+/// Rounds up a size to a multiple of `alignof(std::max_align_t)`.
+constexpr size_t RoundUpToMaxAlign(size_t const s) noexcept
+{
+  return ((s + alignof(std::max_align_t) - 1U) / alignof(std::max_align_t)) * alignof(std::max_align_t);
+}
+
+} // anonymous namespace
+
+size_t const WorkPackagePool::objectSize = RoundUpToMaxAlign(std::max(sizeof(WorkPackage),
+                                                                      sizeof(DeferredWorkPackage)));
+
+/**
+ * \brief Constructor.
+ *
+ * All memory required by the pool is allocated here.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Deferred cancellation is safe.
+ *
+ * - - -
+ *
+ * \param nbOfBlocks
+ * Number of blocks. Each block can host one dynamic work package.\n
+ * Zero is not allowed.
+ * \param inlineFunctorSize
+ * Size of the storage for the callable inside each block in bytes.\n
+ * The value will be rounded up to a multiple of `alignof(std::max_align_t)`.
+ */
+WorkPackagePool::WorkPackagePool(size_t const nbOfBlocks, size_t const inlineFunctorSize)
+: inlineFunctorSize(RoundUpToMaxAlign(inlineFunctorSize))
+, blockSize(sizeof(BlockHeader) + objectSize + this->inlineFunctorSize)
+, nbOfBlocks(nbOfBlocks)
+, spStorage()
+, mutex()
+, pFirstFree(nullptr)
+, stats{nbOfBlocks, nbOfBlocks, nbOfBlocks, 0U, 0U, 0U}
+{
+  // The object placed in a block must directly follow the block header's tag, like an object allocated on the heap.
+  static_assert(offsetof(BlockHeader, tag) + sizeof(ObjectTag) == sizeof(BlockHeader),
+                "ObjectTag must be the last element of BlockHeader");
+
+  if (nbOfBlocks == 0U)
+    throw std::invalid_argument("WorkPackagePool::WorkPackagePool: nbOfBlocks is zero");
+
+  spStorage.reset(new std::max_align_t[((blockSize * nbOfBlocks) + sizeof(std::max_align_t) - 1U) /
+                                       sizeof(std::max_align_t)]);
+
+  // setup list of free blocks
+  unsigned char* const pStorage = reinterpret_cast<unsigned char*>(spStorage.get());
+  for (size_t i = nbOfBlocks; i != 0U; i--)
+  {
+    BlockHeader* const pHeader = new (pStorage + ((i - 1U) * blockSize)) BlockHeader;
+    pHeader->pNextFree          = pFirstFree;
+    pHeader->pFunctorDestructor = nullptr;
+    pHeader->tag.pPool          = this;
+    pFirstFree = pHeader;
+  }
+}
+
+/**
+ * \brief Destructor.
+ *
+ * \pre   All blocks must have been returned to the pool.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ */
+WorkPackagePool::~WorkPackagePool(void)
+{
+  try
+  {
+    // Blocks may have been returned by other threads. The mutex ensures that their updates are visible here.
+    MutexLocker mutexLocker(mutex);
+
+    if (stats.nbOfFreeBlocks != nbOfBlocks)
+      Panic("WorkPackagePool::~WorkPackagePool: Blocks still in use");
+  }
+  catch (...)
+  {
+    Panic("WorkPackagePool::~WorkPackagePool: Failed");
+  }
+}
+
+/**
+ * \brief Retrieves the statistics of the pool.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \return
+ * Snapshot of the pool's statistics.
+ */
+WorkPackagePool::Statistics WorkPackagePool::GetStatistics(void) const
+{
+  MutexLocker mutexLocker(mutex);
+  return stats;
+}
+
+/**
+ * \brief Allocates a block from the pool.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param functorSize
+ * Size of the callable that shall be placed in the block's inline functor storage.
+ * \param functorAlignment
+ * Alignment requirement of the callable that shall be placed in the block's inline functor storage.
+ * \return
+ * Pointer to the storage for the work package inside the allocated block.\n
+ * nullptr, if the pool is exhausted or if the callable does not fit into the inline functor storage.
+ */
+void* WorkPackagePool::Allocate(size_t const functorSize, size_t const functorAlignment) noexcept
+{
+  try
+  {
+    MutexLocker mutexLocker(mutex);
+
+    if ((functorSize > inlineFunctorSize) || (functorAlignment > alignof(std::max_align_t)))
+    {
+      stats.nbOfOversizedFunctors++;
+      return nullptr;
+    }
+
+    BlockHeader* const pHeader = pFirstFree;
+    if (pHeader == nullptr)
+    {
+      stats.nbOfExhaustions++;
+      return nullptr;
+    }
+
+    pFirstFree = pHeader->pNextFree;
+    pHeader->pNextFree = nullptr;
+    pHeader->pFunctorDestructor = nullptr;
+
+    stats.nbOfAllocations++;
+    stats.nbOfFreeBlocks--;
+    if (stats.nbOfFreeBlocks < stats.minNbOfFreeBlocks)
+      stats.minNbOfFreeBlocks = stats.nbOfFreeBlocks;
+
+    return &pHeader->tag + 1;
+  }
+  catch (...)
+  {
+    Panic("WorkPackagePool::Allocate: Failed");
+  }
+}
+
+/**
+ * \brief Returns a block to the pool.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param pHeader
+ * Pointer to the header of the block. The block must belong to this pool.
+ */
+void WorkPackagePool::ReturnBlock(BlockHeader* const pHeader) noexcept
+{
+  try
+  {
+    MutexLocker mutexLocker(mutex);
+
+    pHeader->pNextFree = pFirstFree;
+    pFirstFree = pHeader;
+    stats.nbOfFreeBlocks++;
+  }
+  catch (...)
+  {
+    Panic("WorkPackagePool::ReturnBlock: Failed");
+  }
+}
+
+/**
+ * \brief Retrieves a pointer to the header of the block an object allocated via @ref Allocate() is placed in.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param pObject
+ * Pointer returned by @ref Allocate().
+ * \return
+ * Pointer to the header of the block.
+ */
+WorkPackagePool::BlockHeader* WorkPackagePool::GetBlockHeader(void* const pObject) noexcept
+{
+  return reinterpret_cast<BlockHeader*>(static_cast<unsigned char*>(pObject) - sizeof(BlockHeader));
+}
+
+/**
+ * \brief Retrieves a pointer to the inline functor storage of a block allocated via @ref Allocate().
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param pObject
+ * Pointer returned by @ref Allocate().
+ * \return
+ * Pointer to the inline functor storage of the block. It is aligned to `alignof(std::max_align_t)`.
+ */
+void* WorkPackagePool::GetFunctorStorage(void* const pObject) noexcept
+{
+  return static_cast<unsigned char*>(pObject) + objectSize;
+}
+
+/**
+ * \brief Registers a function which destroys the callable placed in the inline functor storage of a block.
+ *
+ * The function will be invoked when the object placed in the block is released via @ref Free().
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * The block must not be accessed concurrently.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param pObject
+ * Pointer returned by @ref Allocate().
+ * \param pFunctorDestructor
+ * Function that destroys the callable. It receives a pointer to the inline functor storage.
+ */
+void WorkPackagePool::SetFunctorDestructor(void* const pObject, void (*pFunctorDestructor)(void*)) noexcept
+{
+  GetBlockHeader(pObject)->pFunctorDestructor = pFunctorDestructor;
+}
+
+/**
+ * \brief Allocates memory for an object on the heap. The memory can be released via @ref Free().
+ *
+ * This is used by the class-specific `operator new` of @ref WorkPackage and @ref DeferredWorkPackage.\n
+ * Only an @ref ObjectTag (`alignof(std::max_align_t)` bytes) is placed in front of the object, not a complete
+ * @ref BlockHeader.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param size
+ * Size of the object in bytes.
+ * \return
+ * Pointer to the memory for the object.
+ */
+void* WorkPackagePool::AllocateFromHeap(size_t const size)
+{
+  void* const pMem = ::operator new(sizeof(ObjectTag) + size);
+
+  ObjectTag* const pTag = new (pMem) ObjectTag;
+  pTag->pPool = nullptr;
+
+  return pTag + 1;
+}
+
+/**
+ * \brief Releases memory allocated via @ref Allocate() or @ref AllocateFromHeap().
+ *
+ * This is used by the class-specific `operator delete` of @ref WorkPackage and @ref DeferredWorkPackage.\n
+ * The object must have been destroyed before. If a callable has been placed in the block's inline functor storage,
+ * then the callable will be destroyed here.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param pObject
+ * Pointer to the memory that shall be released. nullptr is allowed.
+ */
+void WorkPackagePool::Free(void* const pObject) noexcept
+{
+  if (pObject == nullptr)
+    return;
+
+  ObjectTag* const pTag = static_cast<ObjectTag*>(pObject) - 1;
+  WorkPackagePool* const pPool = pTag->pPool;
+
+  if (pPool == nullptr)
+  {
+    ::operator delete(pTag);
+    return;
+  }
+
+  BlockHeader* const pHeader = GetBlockHeader(pObject);
+
+  if (pHeader->pFunctorDestructor != nullptr)
+  {
+    pHeader->pFunctorDestructor(GetFunctorStorage(pObject));
+    pHeader->pFunctorDestructor = nullptr;
+  }
+
+  pPool->ReturnBlock(pHeader);
+}
+
+} // namespace async
+} // namespace execution
+} // namespace gpcc
@@ -10,6 +10,7 @@
 
 #include <gpcc/execution/async/WorkQueue.hpp>
 #include <gpcc/execution/async/WorkPackage.hpp>
+#include <gpcc/execution/async/WorkQueueTelemetry.hpp>
 #include <gpcc/osal/AdvancedMutexLocker.hpp>
 #include <gpcc/osal/MutexLocker.hpp>
 #include <gpcc/osal/Panic.hpp>
@@ -33,11 +34,34 @@ using namespace gpcc::osal;
  * Deferred cancellation is safe.
  */
 WorkQueue::WorkQueue(void)
-: queueMutex()
+: WorkQueue(IngressMode::locked)
+{
+}
+
+/**
+ * \brief Constructor. Allows to select the ingress mode.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Deferred cancellation is safe.
+ *
+ * ---
+ *
+ * \param _ingressMode
+ * Mode used by @ref Add() to put work packages into the work queue. See @ref IngressMode for details.
+ */
+WorkQueue::WorkQueue(IngressMode const _ingressMode)
+: ingressMode(_ingressMode)
+, ingressHead(nullptr)
+, queueMutex()
 , flushMutex()
 , queueConVar()
 , pQueueFirst(nullptr)
 , pQueueLast(nullptr)
+, nbOfEnqueuedWPs(0U)
+, pTelemetry(nullptr)
 , terminate(false)
 , pOwnerOfCurrentExecutedWP(nullptr)
 , ownerChangedConVar()
@@ -65,6 +89,8 @@ WorkQueue::~WorkQueue(void)
   {
     MutexLocker queueMutexLocker(queueMutex);
 
+    DrainIngress();
+
     auto pWP = pQueueFirst;
     while (pWP != nullptr)
     {
@@ -86,6 +112,14 @@ void WorkQueue::Add(std::unique_ptr<WorkPackage> spWP)
   if (!spWP)
     throw std::invalid_argument("WorkQueue::Add: !spWP");
 
+  if (ingressMode == IngressMode::lockFree)
+  {
+    CheckStateAndSetToInQ_dynamic(*spWP);
+    StampEnqueueTime(*spWP);
+    PushToIngress(*spWP.release());
+    return;
+  }
+
   MutexLocker queueMutexLocker(queueMutex);
 
   if (pQueueLast == nullptr)
@@ -95,6 +129,8 @@ void WorkQueue::Add(std::unique_ptr<WorkPackage> spWP)
     queueConVar.Signal();
 
     CheckStateAndSetToInQ_dynamic(*spWP);
+    StampEnqueueTime(*spWP);
+    IncrementDepth(1U);
 
     spWP->pNext = nullptr;
     spWP->pPrev = nullptr;
@@ -107,6 +143,8 @@ void WorkQueue::Add(std::unique_ptr<WorkPackage> spWP)
     // (queue not empty)
 
     CheckStateAndSetToInQ_dynamic(*spWP);
+    StampEnqueueTime(*spWP);
+    IncrementDepth(1U);
 
     spWP->pPrev = pQueueLast;
     spWP->pNext = nullptr;
@@ -119,6 +157,22 @@ void WorkQueue::Add(std::unique_ptr<WorkPackage> spWP)
 /// \copydoc IWorkQueue::Add(WorkPackage & wp)
 void WorkQueue::Add(WorkPackage & wp)
 {
+  if (ingressMode == IngressMode::lockFree)
+  {
+    auto expected = WorkPackage::States::staticNotInQ;
+    if (!wp.state.compare_exchange_strong(expected, WorkPackage::States::staticInQ))
+    {
+      // The work package is either executed by this work queue or it is in a bad state. Both cases are handled by
+      // CheckStateAndSetToInQ_static(), which requires queueMutex to be locked.
+      MutexLocker queueMutexLocker(queueMutex);
+      CheckStateAndSetToInQ_static(wp);
+    }
+
+    StampEnqueueTime(wp);
+    PushToIngress(wp);
+    return;
+  }
+
   MutexLocker queueMutexLocker(queueMutex);
 
   if (pQueueLast == nullptr)
@@ -128,6 +182,8 @@ void WorkQueue::Add(WorkPackage & wp)
     queueConVar.Signal();
 
     CheckStateAndSetToInQ_static(wp);
+    StampEnqueueTime(wp);
+    IncrementDepth(1U);
 
     wp.pNext = nullptr;
     wp.pPrev = nullptr;
@@ -140,6 +196,8 @@ void WorkQueue::Add(WorkPackage & wp)
     // (queue not empty)
 
     CheckStateAndSetToInQ_static(wp);
+    StampEnqueueTime(wp);
+    IncrementDepth(1U);
 
     wp.pPrev = pQueueLast;
     wp.pNext = nullptr;
@@ -164,6 +222,8 @@ void WorkQueue::InsertAtHeadOfList(std::unique_ptr<WorkPackage> spWP)
     queueConVar.Signal();
 
     CheckStateAndSetToInQ_dynamic(*spWP);
+    StampEnqueueTime(*spWP);
+    IncrementDepth(1U);
 
     spWP->pNext = nullptr;
     spWP->pPrev = nullptr;
@@ -176,6 +236,8 @@ void WorkQueue::InsertAtHeadOfList(std::unique_ptr<WorkPackage> spWP)
     // (queue not empty)
 
     CheckStateAndSetToInQ_dynamic(*spWP);
+    StampEnqueueTime(*spWP);
+    IncrementDepth(1U);
 
     spWP->pPrev = nullptr;
     spWP->pNext = pQueueFirst;
@@ -197,6 +259,8 @@ void WorkQueue::InsertAtHeadOfList(WorkPackage & wp)
     queueConVar.Signal();
 
     CheckStateAndSetToInQ_static(wp);
+    StampEnqueueTime(wp);
+    IncrementDepth(1U);
 
     wp.pNext = nullptr;
     wp.pPrev = nullptr;
@@ -209,6 +273,8 @@ void WorkQueue::InsertAtHeadOfList(WorkPackage & wp)
     // (queue not empty)
 
     CheckStateAndSetToInQ_static(wp);
+    StampEnqueueTime(wp);
+    IncrementDepth(1U);
 
     wp.pPrev = nullptr;
     wp.pNext = pQueueFirst;
@@ -233,6 +299,8 @@ void WorkQueue::Remove(WorkPackage & wp)
 
   MutexLocker queueMutexLocker(queueMutex);
 
+  DrainIngress();
+
   if (wp.state == WorkPackage::States::staticExec)
     return;
 
@@ -264,6 +332,8 @@ void WorkQueue::Remove(void const * const pOwnerObject)
 {
   MutexLocker queueMutexLocker(queueMutex);
 
+  DrainIngress();
+
   auto pWP = pQueueFirst;
   while (pWP != nullptr)
   {
@@ -293,6 +363,8 @@ void WorkQueue::Remove(void const * const pOwnerObject, uint32_t const ownerID)
 {
   MutexLocker queueMutexLocker(queueMutex);
 
+  DrainIngress();
+
   auto pWP = pQueueFirst;
   while (pWP != nullptr)
   {
@@ -342,6 +414,16 @@ bool WorkQueue::IsAnyInQueue(void const * const pOwnerObject) const
     pWP = pWP->pNext;
   }
 
+  // Work packages on the ingress list cannot be removed without queueMutex being locked, so the list can be
+  // examined safely. Concurrently added work packages are pushed in front of the loaded head and are not examined.
+  pWP = ingressHead.load(std::memory_order_acquire);
+  while (pWP != nullptr)
+  {
+    if (pWP->pOwnerObject == pOwnerObject)
+      return true;
+    pWP = pWP->pNext;
+  }
+
   return false;
 }
 
@@ -372,6 +454,131 @@ void WorkQueue::FlushNonDeferredWorkPackages(void)
 }
 // <--
 
+/**
+ * \brief Adds multiple _dynamic_ work packages to the work queue.
+ *
+ * All work packages are added atomically in the order in which they are stored in `spWPs`:
+ * The work queue's mutex is locked only once and the work queue's thread is signaled no more than once.\n
+ * Other work packages added concurrently will not be placed in between the work packages of the batch.
+ *
+ * This also applies if @ref IngressMode::lockFree is used. Work packages that have been pushed onto the lock-free
+ * ingress list before will be executed before the work packages of the batch.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.\n
+ * No memory/resource allocation related errors possible.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param spWPs
+ * Work packages that shall be added to the work queue. An empty vector is allowed.\n
+ * _All work packages must be dynamic work packages._\n
+ * _This means that ownership moves from the caller to the work queue,_
+ * _and the work queue will finally release the work packages._\n
+ * The vector will be cleared if this method succeeds. It will not be modified if this method fails.
+ */
+void WorkQueue::Add(std::vector<std::unique_ptr<WorkPackage>> & spWPs)
+{
+  if (spWPs.empty())
+    return;
+
+  for (auto const & spWP : spWPs)
+  {
+    if (!spWP)
+      throw std::invalid_argument("WorkQueue::Add: spWPs contains nullptr");
+  }
+
+  MutexLocker queueMutexLocker(queueMutex);
+
+  if (ingressMode == IngressMode::lockFree)
+    DrainIngress();
+
+  if (pQueueLast == nullptr)
+    queueConVar.Signal();
+
+  for (auto & spWP : spWPs)
+  {
+    CheckStateAndSetToInQ_dynamic(*spWP);
+    AppendToQueue(*spWP.release());
+  }
+
+  IncrementDepth(spWPs.size());
+  spWPs.clear();
+}
+
+/**
+ * \brief Adds multiple _static_ work packages to the work queue.
+ *
+ * All work packages are added atomically in the order in which they are stored in the array referenced by `ppWPs`:
+ * The work queue's mutex is locked only once and the work queue's thread is signaled no more than once.\n
+ * Other work packages added concurrently will not be placed in between the work packages of the batch.
+ *
+ * This also applies if @ref IngressMode::lockFree is used. Work packages that have been pushed onto the lock-free
+ * ingress list before will be executed before the work packages of the batch.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.\n
+ * No memory/resource allocation related errors possible.\n
+ * If any of the work packages is in a bad state, then none of the work packages will be added.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param ppWPs
+ * Pointer to an array of pointers to the work packages that shall be added to the work queue.\n
+ * _All work packages must be static work packages._\n
+ * _This means that ownership remains at the caller,_
+ * _and the caller will finally release the work packages._\n
+ * Each work package must not be contained in the array more than once.\n
+ * nullptr is allowed, if `n` is zero.
+ * \param n
+ * Number of entries in the array referenced by `ppWPs`.
+ */
+void WorkQueue::Add(WorkPackage* const * const ppWPs, size_t const n)
+{
+  if (n == 0U)
+    return;
+
+  if (ppWPs == nullptr)
+    throw std::invalid_argument("WorkQueue::Add: !ppWPs");
+
+  for (size_t i = 0U; i < n; i++)
+  {
+    if (ppWPs[i] == nullptr)
+      throw std::invalid_argument("WorkQueue::Add: ppWPs contains nullptr");
+  }
+
+  MutexLocker queueMutexLocker(queueMutex);
+
+  CheckStateAndSetToInQ_static(ppWPs, n);
+
+  if (ingressMode == IngressMode::lockFree)
+    DrainIngress();
+
+  if (pQueueLast == nullptr)
+    queueConVar.Signal();
+
+  for (size_t i = 0U; i < n; i++)
+    AppendToQueue(*ppWPs[i]);
+
+  IncrementDepth(n);
+}
+
 /**
  * \brief Executes work packages until termination is requested.
  *
@@ -419,6 +626,8 @@ void WorkQueue::Work(void)
 
   while (true)
   {
+    DrainIngress();
+
     // clear pOwnerOfCurrentExecutedWP if queue is empty
     if ((pOwnerOfCurrentExecutedWP != nullptr) && (pQueueFirst == nullptr))
     {
@@ -428,7 +637,10 @@ void WorkQueue::Work(void)
 
     // wait for a work package or a termination request
     while ((pQueueFirst == nullptr) && (!terminate))
+    {
       queueConVar.Wait(queueMutex);
+      DrainIngress();
+    }
 
     // terminate?
     if (terminate)
@@ -450,12 +662,16 @@ void WorkQueue::Work(void)
       pQueueFirst->pPrev = nullptr;
     else
       pQueueLast = nullptr;
+    nbOfEnqueuedWPs--;
 
     // update work package's state and prepare for execution
     if (pWP->state == WorkPackage::States::staticInQ)
       pWP->state = WorkPackage::States::staticExec;
     pCurrentExecutedWP = pWP;
 
+    // (a static work package may be enqueued again during execution, which would modify the timestamp)
+    uint64_t const enqueueTimestamp_ns = pWP->enqueueTimestamp_ns;
+
     queueMutexLocker.Unlock();
 
     try
@@ -477,7 +693,19 @@ void WorkQueue::Work(void)
       pCurrentExecutedWP = nullptr;
     };
 
-    pWP->functor();
+    // flushMutex is locked, so the telemetry object cannot be detached until execution is complete
+    WorkQueueTelemetry* const pTel = pTelemetry.load(std::memory_order_relaxed);
+    if (pTel == nullptr)
+    {
+      pWP->functor();
+    }
+    else
+    {
+      uint64_t const startTimestamp_ns = WorkQueueTelemetry::GetTimestamp_ns();
+      pWP->functor();
+      pTel->RecordExecution(pWP->pOwnerObject, pWP->ownerID, enqueueTimestamp_ns,
+                            startTimestamp_ns, WorkQueueTelemetry::GetTimestamp_ns());
+    }
   } // while (true)
 }
 
@@ -518,6 +746,208 @@ void WorkQueue::RequestTermination(void) noexcept
   }
 }
 
+/**
+ * \brief Attaches a @ref WorkQueueTelemetry instance to the work queue or detaches it.
+ *
+ * While a @ref WorkQueueTelemetry instance is attached, the work queue records the queue latency and execution time
+ * of each executed work package and the maximum number of enqueued work packages.
+ *
+ * Work packages that have been added to the work queue before the @ref WorkQueueTelemetry instance was attached will
+ * not contribute to the queue latency.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.\n
+ * This must not be invoked from within a work package executed by this work queue.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param _pTelemetry
+ * Pointer to the @ref WorkQueueTelemetry instance that shall be attached.\n
+ * nullptr = detach.\n
+ * After this method has returned, a previously attached @ref WorkQueueTelemetry instance is no longer accessed by the
+ * work queue. An attached @ref WorkQueueTelemetry instance must be detached before it is destroyed.
+ */
+void WorkQueue::SetTelemetry(WorkQueueTelemetry* const _pTelemetry)
+{
+  MutexLocker flushMutexLocker(flushMutex);
+  MutexLocker queueMutexLocker(queueMutex);
+
+  pTelemetry.store(_pTelemetry, std::memory_order_relaxed);
+}
+
+/**
+ * \brief Pushes a work package onto the lock-free ingress list (@ref ingressHead).
+ *
+ * If the ingress list was empty, then the thread executing @ref Work() will be signaled.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.\n
+ * @ref queueMutex must __not__ be locked by the caller.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * ---
+ *
+ * \param wp
+ * Reference to the work package. The work package's state must have been set to the proper "in-Q" state already.
+ */
+void WorkQueue::PushToIngress(WorkPackage& wp) noexcept
+{
+  WorkPackage* pOldHead = ingressHead.load(std::memory_order_relaxed);
+  do
+  {
+    wp.pNext = pOldHead;
+  }
+  while (!ingressHead.compare_exchange_weak(pOldHead, &wp, std::memory_order_release, std::memory_order_relaxed));
+
+  // Only the thread that pushes to an empty list has to signal. The thread executing Work() drains the list with
+  // queueMutex locked before it waits for queueConVar, so the signal cannot get lost.
+  if (pOldHead == nullptr)
+  {
+    try
+    {
+      MutexLocker queueMutexLocker(queueMutex);
+      queueConVar.Signal();
+    }
+    catch (...)
+    {
+      Panic("WorkQueue::PushToIngress: Failed to signal");
+    }
+  }
+}
+
+/**
+ * \brief Moves all work packages from the lock-free ingress list (@ref ingressHead) to the end of the work queue.
+ *
+ * The order in which the work packages have been pushed onto the ingress list is maintained.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * @ref queueMutex must be locked.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ */
+void WorkQueue::DrainIngress(void) noexcept
+{
+  WorkPackage* pWP = ingressHead.exchange(nullptr, std::memory_order_acquire);
+  if (pWP == nullptr)
+    return;
+
+  // The ingress list is in LIFO order. Reverse it and setup the pPrev-pointers.
+  WorkPackage* pFirst = nullptr;
+  WorkPackage* const pLast = pWP;
+  size_t n = 0U;
+  while (pWP != nullptr)
+  {
+    n++;
+    WorkPackage* const pNext = pWP->pNext;
+    pWP->pNext = pFirst;
+    if (pFirst != nullptr)
+      pFirst->pPrev = pWP;
+    pFirst = pWP;
+    pWP = pNext;
+  }
+
+  // append to queue
+  pFirst->pPrev = pQueueLast;
+  if (pQueueLast == nullptr)
+    pQueueFirst = pFirst;
+  else
+    pQueueLast->pNext = pFirst;
+  pQueueLast = pLast;
+
+  IncrementDepth(n);
+}
+
+/**
+ * \brief Sets up the timestamp of a work package that is about to be added to the work queue.
+ *
+ * If a @ref WorkQueueTelemetry instance is attached, then the current time will be stored in the work package.
+ * Otherwise the timestamp of the work package will be cleared.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.\n
+ * The work package must not be accessed concurrently.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * ---
+ *
+ * \param wp
+ * Reference to the work package.
+ */
+void WorkQueue::StampEnqueueTime(WorkPackage& wp) const noexcept
+{
+  if (pTelemetry.load(std::memory_order_relaxed) == nullptr)
+  {
+    wp.enqueueTimestamp_ns = 0U;
+    return;
+  }
+
+  try
+  {
+    wp.enqueueTimestamp_ns = WorkQueueTelemetry::GetTimestamp_ns();
+  }
+  catch (...)
+  {
+    PANIC();
+  }
+}
+
+/**
+ * \brief Increments @ref nbOfEnqueuedWPs and records the new value at the attached @ref WorkQueueTelemetry instance
+ *        (if any).
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * @ref queueMutex must be locked by the caller.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * ---
+ *
+ * \param n
+ * Number of work packages that have been added to the queue.
+ */
+void WorkQueue::IncrementDepth(size_t const n) noexcept
+{
+  nbOfEnqueuedWPs += n;
+
+  WorkQueueTelemetry* const pTel = pTelemetry.load(std::memory_order_relaxed);
+  if (pTel != nullptr)
+    pTel->RecordQueueDepth(nbOfEnqueuedWPs);
+}
+
 /**
  * \brief Checks the state of an @ref WorkPackage (static), which shall be enqueued into the
  * work queue and sets the work package's state to the proper "in-Q" state.
@@ -577,6 +1007,96 @@ void WorkQueue::CheckStateAndSetToInQ_dynamic(WorkPackage& wp) const noexcept
     Panic("WorkQueue::CheckStateAndSetToInQ_dynamic: Bad WP state");
 }
 
+/**
+ * \brief Checks the states of multiple @ref WorkPackage instances (static), which shall be enqueued into the work
+ * queue and sets the states of the work packages to the proper "in-Q" state.
+ *
+ * This is the batch-version of @ref CheckStateAndSetToInQ_static(WorkPackage&) const. Either the states of all work
+ * packages are set, or none.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * @ref queueMutex must be locked.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * ---
+ *
+ * \param ppWPs
+ * Pointer to an array of pointers to the work packages. None of the pointers must be nullptr.
+ * \param n
+ * Number of entries in the array referenced by `ppWPs`.
+ */
+void WorkQueue::CheckStateAndSetToInQ_static(WorkPackage* const * const ppWPs, size_t const n) const
+{
+  size_t i = 0U;
+  try
+  {
+    while (i < n)
+    {
+      CheckStateAndSetToInQ_static(*ppWPs[i]);
+      i++;
+    }
+  }
+  catch (...)
+  {
+    // roll back the work packages whose state has already been set
+    while (i != 0U)
+    {
+      i--;
+      WorkPackage & wp = *ppWPs[i];
+      if (wp.state == WorkPackage::States::staticExecInQ)
+        wp.state = WorkPackage::States::staticExec;
+      else
+        wp.state = WorkPackage::States::staticNotInQ;
+    }
+
+    throw;
+  }
+}
+
+/**
+ * \brief Appends a work package to the end of the work queue and sets up its timestamp.
+ *
+ * The number of enqueued work packages (@ref nbOfEnqueuedWPs) is not updated. The caller has to use
+ * @ref IncrementDepth() afterwards.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * @ref queueMutex must be locked.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * ---
+ *
+ * \param wp
+ * Reference to the work package. The work package's state must have been set to the proper "in-Q" state already.
+ */
+void WorkQueue::AppendToQueue(WorkPackage& wp) noexcept
+{
+  StampEnqueueTime(wp);
+
+  wp.pNext = nullptr;
+  wp.pPrev = pQueueLast;
+
+  if (pQueueLast == nullptr)
+    pQueueFirst = &wp;
+  else
+    pQueueLast->pNext = &wp;
+
+  pQueueLast = &wp;
+}
+
 /**
  * \brief Releases a @ref WorkPackage instance which is enqueued in the work queue.
  *
@@ -596,6 +1116,8 @@ void WorkQueue::CheckStateAndSetToInQ_dynamic(WorkPackage& wp) const noexcept
  */
 void WorkQueue::Release(WorkPackage* const pWP) noexcept
 {
+  nbOfEnqueuedWPs--;
+
   switch (pWP->state)
   {
     case WorkPackage::States::staticInQ:
@@ -0,0 +1,936 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#include <gpcc/execution/async/WorkQueuePool.hpp>
+#include <gpcc/execution/async/WorkPackage.hpp>
+#include <gpcc/osal/AdvancedMutexLocker.hpp>
+#include <gpcc/osal/MutexLocker.hpp>
+#include <gpcc/osal/Panic.hpp>
+#include <gpcc/osal/Semaphore.hpp>
+#include <gpcc/raii/scope_guard.hpp>
+#include <functional>
+#include <stdexcept>
+
+namespace gpcc      {
+namespace execution {
+namespace async     {
+
+using namespace gpcc::osal;
+
+/**
+ * \brief Constructor.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Deferred cancellation is safe.
+ *
+ * - - -
+ *
+ * \param threadName
+ * Name for the worker thread.
+ */
+WorkQueuePool::Worker::Worker(std::string const & threadName)
+: thread(threadName)
+, pCurrentExecutedWP(nullptr)
+, pOwnerOfCurrentExecutedWP(nullptr)
+{
+}
+
+/**
+ * \brief Constructor.
+ *
+ * The threads are not started yet. Use @ref Start() to start the threads.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Deferred cancellation is safe.
+ *
+ * - - -
+ *
+ * \param threadNamePrefix
+ * Prefix for the names of the threads. The name of each thread will be composed of the prefix and the index of the
+ * thread, separated by an underscore. Example: "MyPool_0", "MyPool_1", ...
+ *
+ * \param nbOfThreads
+ * Number of threads that shall execute work packages.\n
+ * Zero is not allowed.
+ */
+WorkQueuePool::WorkQueuePool(std::string const & threadNamePrefix, size_t const nbOfThreads)
+: IWorkQueue()
+, startStopMutex()
+, running(false)
+, queueMutex()
+, queueConVar()
+, pQueueFirst(nullptr)
+, pQueueLast(nullptr)
+, terminate(false)
+, nbOfBusyWorkers(0U)
+, ownerChangedConVar()
+, workers()
+{
+  if (nbOfThreads == 0U)
+    throw std::invalid_argument("WorkQueuePool::WorkQueuePool: nbOfThreads is zero");
+
+  workers.reserve(nbOfThreads);
+  for (size_t i = 0U; i < nbOfThreads; ++i)
+    workers.emplace_back(std::make_unique<Worker>(threadNamePrefix + "_" + std::to_string(i)));
+}
+
+/**
+ * \brief Destructor.
+ *
+ * Any dynamic work packages that are still enqueued will be released.\n
+ * Any static work packages that are still enqueued will be removed from the work queue.
+ *
+ * \pre   The threads must not be running. If required, use @ref Stop() to stop the threads.
+ *
+ * - - -
+ *
+ * __Exception-safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread-cancellation-safety:__\n
+ * Safe, no cancellation point included.
+ */
+WorkQueuePool::~WorkQueuePool(void)
+{
+  try
+  {
+    MutexLocker startStopMutexLocker(startStopMutex);
+
+    if (running)
+      Panic("WorkQueuePool::~WorkQueuePool: Not stopped");
+
+    MutexLocker queueMutexLocker(queueMutex);
+
+    auto pWP = pQueueFirst;
+    while (pWP != nullptr)
+    {
+      auto toBeReleased = pWP;
+      pWP = pWP->pNext;
+      Release(toBeReleased);
+    }
+  }
+  catch (...)
+  {
+    PANIC();
+  }
+}
+
+// --> Interface required by IWorkQueue
+/// \copydoc IWorkQueue::Add(std::unique_ptr<WorkPackage> spWP)
+void WorkQueuePool::Add(std::unique_ptr<WorkPackage> spWP)
+{
+  if (!spWP)
+    throw std::invalid_argument("WorkQueuePool::Add: !spWP");
+
+  MutexLocker queueMutexLocker(queueMutex);
+
+  CheckStateAndSetToInQ_dynamic(*spWP);
+
+  // Note: Other than WorkQueue, we signal each time. Idle workers may wait even though the queue is not empty,
+  // because all enqueued work packages may belong to owners whose work packages are currently executed.
+  queueConVar.Signal();
+
+  spWP->pPrev = pQueueLast;
+  spWP->pNext = nullptr;
+
+  if (pQueueLast == nullptr)
+    pQueueFirst = spWP.get();
+  else
+    pQueueLast->pNext = spWP.get();
+
+  pQueueLast = spWP.release();
+}
+
+/// \copydoc IWorkQueue::Add(WorkPackage & wp)
+void WorkQueuePool::Add(WorkPackage & wp)
+{
+  MutexLocker queueMutexLocker(queueMutex);
+
+  CheckStateAndSetToInQ_static(wp);
+
+  queueConVar.Signal();
+
+  wp.pPrev = pQueueLast;
+  wp.pNext = nullptr;
+
+  if (pQueueLast == nullptr)
+    pQueueFirst = &wp;
+  else
+    pQueueLast->pNext = &wp;
+
+  pQueueLast = &wp;
+}
+
+/// \copydoc IWorkQueue::InsertAtHeadOfList(std::unique_ptr<WorkPackage> spWP)
+void WorkQueuePool::InsertAtHeadOfList(std::unique_ptr<WorkPackage> spWP)
+{
+  if (!spWP)
+    throw std::invalid_argument("WorkQueuePool::InsertAtHeadOfList: !spWP");
+
+  MutexLocker queueMutexLocker(queueMutex);
+
+  CheckStateAndSetToInQ_dynamic(*spWP);
+
+  queueConVar.Signal();
+
+  spWP->pPrev = nullptr;
+  spWP->pNext = pQueueFirst;
+
+  if (pQueueFirst == nullptr)
+    pQueueLast = spWP.get();
+  else
+    pQueueFirst->pPrev = spWP.get();
+
+  pQueueFirst = spWP.release();
+}
+
+/// \copydoc IWorkQueue::InsertAtHeadOfList(WorkPackage & wp)
+void WorkQueuePool::InsertAtHeadOfList(WorkPackage & wp)
+{
+  MutexLocker queueMutexLocker(queueMutex);
+
+  CheckStateAndSetToInQ_static(wp);
+
+  queueConVar.Signal();
+
+  wp.pPrev = nullptr;
+  wp.pNext = pQueueFirst;
+
+  if (pQueueFirst == nullptr)
+    pQueueLast = &wp;
+  else
+    pQueueFirst->pPrev = &wp;
+
+  pQueueFirst = &wp;
+}
+
+/// \copydoc IWorkQueue::Remove(WorkPackage & wp)
+void WorkQueuePool::Remove(WorkPackage & wp)
+{
+  // ensure that wp is a static work package
+  {
+    WorkPackage::States const currState = wp.state;
+    if ((currState != WorkPackage::States::staticNotInQ) &&
+        (currState != WorkPackage::States::staticInQ) &&
+        (currState != WorkPackage::States::staticExec) &&
+        (currState != WorkPackage::States::staticExecInQ))
+      throw std::invalid_argument("WorkQueuePool::Remove: &wp is dynamic");
+  }
+
+  MutexLocker queueMutexLocker(queueMutex);
+
+  if (wp.state == WorkPackage::States::staticExec)
+    return;
+
+  auto pWP = pQueueFirst;
+  while (pWP != nullptr)
+  {
+    if (pWP == &wp)
+    {
+      Unlink(*pWP);
+      Release(pWP);
+      return;
+    }
+    else
+      pWP = pWP->pNext;
+  }
+}
+
+/// \copydoc IWorkQueue::Remove(void const * const pOwnerObject)
+void WorkQueuePool::Remove(void const * const pOwnerObject)
+{
+  MutexLocker queueMutexLocker(queueMutex);
+
+  auto pWP = pQueueFirst;
+  while (pWP != nullptr)
+  {
+    if (pWP->pOwnerObject == pOwnerObject)
+    {
+      auto toBeReleased = pWP;
+      pWP = pWP->pNext;
+      Unlink(*toBeReleased);
+      Release(toBeReleased);
+    }
+    else
+      pWP = pWP->pNext;
+  }
+}
+
+/// \copydoc IWorkQueue::Remove(void const * const pOwnerObject, uint32_t const ownerID)
+void WorkQueuePool::Remove(void const * const pOwnerObject, uint32_t const ownerID)
+{
+  MutexLocker queueMutexLocker(queueMutex);
+
+  auto pWP = pQueueFirst;
+  while (pWP != nullptr)
+  {
+    if ((pWP->pOwnerObject == pOwnerObject) && (pWP->ownerID == ownerID))
+    {
+      auto toBeReleased = pWP;
+      pWP = pWP->pNext;
+      Unlink(*toBeReleased);
+      Release(toBeReleased);
+    }
+    else
+      pWP = pWP->pNext;
+  }
+}
+
+/**
+ * \brief Blocks the calling thread until no work package of a specific owner is executed by any of the pool's
+ *        threads.
+ *
+ * \copydetails IWorkQueue::WaitUntilCurrentWorkPackageHasBeenExecuted
+ */
+void WorkQueuePool::WaitUntilCurrentWorkPackageHasBeenExecuted(void const * const pOwnerObject) const
+{
+  if (pOwnerObject == nullptr)
+    throw std::invalid_argument("WorkQueuePool::WaitUntilCurrentWorkPackageHasBeenExecuted: !pOwnerObject");
+
+  MutexLocker queueMutexLocker(queueMutex);
+
+  while (IsOwnerBusy(pOwnerObject))
+    ownerChangedConVar.Wait(queueMutex);
+}
+
+/// \copydoc IWorkQueue::IsAnyInQueue
+bool WorkQueuePool::IsAnyInQueue(void const * const pOwnerObject) const
+{
+  MutexLocker queueMutexLocker(queueMutex);
+
+  auto pWP = pQueueFirst;
+  while (pWP != nullptr)
+  {
+    if (pWP->pOwnerObject == pOwnerObject)
+      return true;
+    pWP = pWP->pNext;
+  }
+
+  return false;
+}
+
+/// \copydoc IWorkQueue::FlushNonDeferredWorkPackages
+void WorkQueuePool::FlushNonDeferredWorkPackages(void)
+{
+  // The flush marker is a work package owned by "this". It is not started before it is the first work package in
+  // the queue and before all workers have finished their current work package. See FetchNext() for details.
+  Semaphore s(0);
+  Add(WorkPackage::CreateDynamic(this, 0, std::bind(&Semaphore::Post, &s)));
+
+  try
+  {
+    s.Wait();
+
+    // wait until the invocation of the flush marker's functor is complete
+    WaitUntilCurrentWorkPackageHasBeenExecuted(this);
+  }
+  catch (...)
+  {
+    // If s.Wait() or WaitUntilCurrentWorkPackageHasBeenExecuted() fails, then we would leave and "s" would be
+    // released. This is bad, because the work package referencing s.Post() is either still in the work queue or
+    // the execution of the work package's functor might not have been completed yet.
+    PANIC();
+
+    // never returns, but makes compiler happy
+    throw;
+  }
+}
+// <--
+
+/**
+ * \brief Starts the threads.
+ *
+ * \pre   The threads are not running.
+ *
+ * \post  The threads are running and process work packages from the work queue.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Deferred cancellation is not allowed.
+ *
+ * - - -
+ *
+ * \param schedPolicy
+ * [Scheduling policy](@ref gpcc::osal::Thread::SchedPolicy) that shall be applied to the threads.
+ *
+ * \param priority
+ * Priority level for the threads: 0 (low) .. 31 (high)\n
+ * This is only relevant for the scheduling policies [SchedPolicy::Fifo](@ref gpcc::osal::Thread::SchedPolicy::Fifo)
+ * and [SchedPolicy::RR](@ref gpcc::osal::Thread::SchedPolicy::RR).\n
+ * _For the other scheduling policies this parameter is not relevant and must be zero._
+ *
+ * \param stackSize
+ * Size of the stack of each thread in byte.\n
+ * _This must be a multiple of_ @ref gpcc::osal::Thread::GetStackAlign(). \n
+ * _This must be equal to or larger than_ @ref gpcc::osal::Thread::GetMinStackSize(). \n
+ * On some platforms the final stack size might be larger than this, e.g. due to interrupt handling requirements.
+ */
+void WorkQueuePool::Start(gpcc::osal::Thread::SchedPolicy const schedPolicy,
+                          gpcc::osal::Thread::priority_t const priority,
+                          size_t const stackSize)
+{
+  MutexLocker startStopMutexLocker(startStopMutex);
+
+  if (running)
+    throw std::logic_error("WorkQueuePool::Start: Already started.");
+
+  size_t nbOfStartedThreads = 0U;
+
+  ON_SCOPE_EXIT(stopThreads)
+  {
+    // Stop threads that have already been started if starting any of the other threads failed.
+    if (nbOfStartedThreads != 0U)
+    {
+      AdvancedMutexLocker queueMutexLocker(queueMutex);
+      terminate = true;
+      queueConVar.Broadcast();
+      queueMutexLocker.Unlock();
+
+      for (size_t i = 0U; i < nbOfStartedThreads; ++i)
+        workers[i]->thread.Join();
+
+      queueMutexLocker.Relock();
+      terminate = false;
+    }
+  };
+
+  for (auto & spWorker : workers)
+  {
+    Worker & worker = *spWorker;
+    worker.thread.Start(std::bind(&WorkQueuePool::ThreadEntry, this, std::ref(worker)),
+                        schedPolicy, priority, stackSize);
+    ++nbOfStartedThreads;
+  }
+
+  ON_SCOPE_EXIT_DISMISS(stopThreads);
+  running = true;
+}
+
+/**
+ * \brief Stops the threads.
+ *
+ * If work packages are in progress, then the threads will be stopped after the work packages have completed. If the
+ * work queue is empty, then the threads will stop immediately.
+ *
+ * Enqueued work packages, that have not been processed yet remain in the work queue and are not removed by the
+ * stop operation.
+ *
+ * \pre   The threads are running.
+ *
+ * \post  The threads are not running.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.\n
+ * This must not be invoked in the context of this work queue instance.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Deferred cancellation is not allowed.
+ */
+void WorkQueuePool::Stop(void) noexcept
+{
+  try
+  {
+    MutexLocker startStopMutexLocker(startStopMutex);
+
+    if (!running)
+      throw std::logic_error("Not running");
+
+    {
+      MutexLocker queueMutexLocker(queueMutex);
+      terminate = true;
+      queueConVar.Broadcast();
+    }
+
+    for (auto & spWorker : workers)
+      spWorker->thread.Join();
+
+    {
+      MutexLocker queueMutexLocker(queueMutex);
+      terminate = false;
+    }
+
+    running = false;
+  }
+  catch (std::exception const & e)
+  {
+    gpcc::osal::Panic("WorkQueuePool::Stop: Failed: ", e);
+  }
+  catch (...)
+  {
+    PANIC();
+  }
+}
+
+/**
+ * \brief Entry function for the worker threads.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * Program logic ensures that there is no more than one thread per worker executing this.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.\n
+ * If a work package throws, then this will panic.
+ *
+ * __Thread cancellation safety:__\n
+ * Deferred cancellation is disabled.
+ *
+ * - - -
+ *
+ * \param worker
+ * Reference to the worker whose thread is executing this.
+ *
+ * \return
+ * Always nullptr.
+ */
+void* WorkQueuePool::ThreadEntry(Worker & worker)
+{
+  (void)worker.thread.SetCancelabilityEnabled(false);
+
+  try
+  {
+    Work(worker);
+  }
+  catch (std::exception const & e)
+  {
+    gpcc::osal::Panic("WorkQueuePool::ThreadEntry: A work package threw: ", e);
+  }
+  catch (...)
+  {
+    gpcc::osal::Panic("WorkQueuePool::ThreadEntry: Caught an unknown exception thrown by a work package.");
+  }
+
+  return nullptr;
+}
+
+/**
+ * \brief Executes work packages until termination is requested.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * There must be no more than one thread per worker executing this method at any time.
+ *
+ * __Exception safety:__\n
+ * Basic guarantee:
+ * - If a work package throws, then the exception will propagate out of this method.
+ * - If a work package throws, then the work queue will treat the work package as if it has completed with no error.
+ *   For example a dynamic work package will be released.
+ *
+ * __Thread cancellation safety:__\n
+ * Deferred cancellation is not allowed.
+ *
+ * - - -
+ *
+ * \param worker
+ * Reference to the worker whose thread is executing this.
+ */
+void WorkQueuePool::Work(Worker & worker)
+{
+  AdvancedMutexLocker queueMutexLocker(queueMutex);
+
+  while (true)
+  {
+    // wait for a work package that is ready for execution or a termination request
+    WorkPackage* pWP = nullptr;
+    while ((!terminate) && ((pWP = FetchNext()) == nullptr))
+      queueConVar.Wait(queueMutex);
+
+    // terminate?
+    if (terminate)
+      return;
+
+    // remove work package from queue
+    Unlink(*pWP);
+
+    // update work package's state and prepare for execution
+    if (pWP->state == WorkPackage::States::staticInQ)
+      pWP->state = WorkPackage::States::staticExec;
+
+    worker.pCurrentExecutedWP = pWP;
+    worker.pOwnerOfCurrentExecutedWP = pWP->pOwnerObject;
+    ++nbOfBusyWorkers;
+
+    queueMutexLocker.Unlock();
+
+    // finally execute the work package
+    ON_SCOPE_EXIT(afterExecWP)
+    {
+      queueMutexLocker.Relock();
+
+      void const * const pOwner = worker.pOwnerOfCurrentExecutedWP;
+      Finish(pWP);
+      worker.pCurrentExecutedWP = nullptr;
+      worker.pOwnerOfCurrentExecutedWP = nullptr;
+      --nbOfBusyWorkers;
+
+      // this will unblock threads in WaitUntilCurrentWorkPackageHasBeenExecuted()
+      if (pOwner != nullptr)
+        ownerChangedConVar.Broadcast();
+
+      // Work packages of the owner may have become ready for execution. We will look for work in the next cycle,
+      // but there might be more than one work package ready for execution now.
+      if (pQueueFirst != nullptr)
+        queueConVar.Signal();
+    };
+
+    pWP->functor();
+  } // while (true)
+}
+
+/**
+ * \brief Determines the next work package that is ready for execution.
+ *
+ * A work package is ready for execution, if there is no work package of the same owner currently executed.
+ *
+ * The flush marker enqueued by @ref FlushNonDeferredWorkPackages() is treated as a barrier:
+ * - Work packages located behind the flush marker are never ready for execution.
+ * - The flush marker itself is only ready for execution if it is the first work package in the queue and if no
+ *   worker is currently executing a work package.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * @ref queueMutex must be locked.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \return
+ * Pointer to the next work package that shall be executed.\n
+ * nullptr if there is no work package ready for execution.\n
+ * The work package is still enqueued.
+ */
+WorkPackage* WorkQueuePool::FetchNext(void) const noexcept
+{
+  auto pWP = pQueueFirst;
+  while (pWP != nullptr)
+  {
+    if (IsFlushMarker(*pWP))
+    {
+      if ((pWP == pQueueFirst) && (nbOfBusyWorkers == 0U))
+        return pWP;
+      else
+        return nullptr;
+    }
+
+    if (!IsOwnerBusy(pWP->pOwnerObject))
+      return pWP;
+
+    pWP = pWP->pNext;
+  }
+
+  return nullptr;
+}
+
+/**
+ * \brief Checks if a work package of a specific owner is currently executed by any worker.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * @ref queueMutex must be locked.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param pOwnerObject
+ * Owner object. nullptr (anonymous owner) is allowed.
+ *
+ * \retval true   A work package of the owner is currently executed.
+ * \retval false  No work package of the owner is currently executed.
+ */
+bool WorkQueuePool::IsOwnerBusy(void const * const pOwnerObject) const noexcept
+{
+  if (nbOfBusyWorkers == 0U)
+    return false;
+
+  for (auto const & spWorker : workers)
+  {
+    if ((spWorker->pCurrentExecutedWP != nullptr) && (spWorker->pOwnerOfCurrentExecutedWP == pOwnerObject))
+      return true;
+  }
+
+  return false;
+}
+
+/**
+ * \brief Checks if a work package is currently executed by any worker.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * @ref queueMutex must be locked.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param wp
+ * Work package that shall be checked.
+ *
+ * \retval true   `wp` is currently executed.
+ * \retval false  `wp` is not executed.
+ */
+bool WorkQueuePool::IsExecuted(WorkPackage const & wp) const noexcept
+{
+  for (auto const & spWorker : workers)
+  {
+    if (spWorker->pCurrentExecutedWP == &wp)
+      return true;
+  }
+
+  return false;
+}
+
+/**
+ * \brief Checks if a work package is a flush marker enqueued by @ref FlushNonDeferredWorkPackages().
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * @ref queueMutex must be locked.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param wp
+ * Work package that shall be checked.
+ *
+ * \retval true   `wp` is a flush marker.
+ * \retval false  `wp` is not a flush marker.
+ */
+bool WorkQueuePool::IsFlushMarker(WorkPackage const & wp) const noexcept
+{
+  return (wp.pOwnerObject == this);
+}
+
+/**
+ * \brief Removes a work package from the queue.
+ *
+ * The state of the work package is not modified.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * @ref queueMutex must be locked.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param wp
+ * Work package that shall be removed from the queue. It must be enqueued.
+ */
+void WorkQueuePool::Unlink(WorkPackage & wp) noexcept
+{
+  if (wp.pPrev != nullptr)
+    wp.pPrev->pNext = wp.pNext;
+  else
+    pQueueFirst = wp.pNext;
+
+  if (wp.pNext != nullptr)
+    wp.pNext->pPrev = wp.pPrev;
+  else
+    pQueueLast = wp.pPrev;
+}
+
+/**
+ * \brief Checks the state of an @ref WorkPackage (static), which shall be enqueued into the
+ * work queue and sets the work package's state to the proper "in-Q" state.
+ *
+ * __Thread-safety:__\n
+ * @ref queueMutex must be locked.
+ *
+ * __Exception-safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread-cancellation-safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * ---
+ *
+ * \param wp
+ * Reference to the work package.
+ */
+void WorkQueuePool::CheckStateAndSetToInQ_static(WorkPackage& wp) const
+{
+  if (!IsExecuted(wp))
+  {
+    auto expected = WorkPackage::States::staticNotInQ;
+    if (!wp.state.compare_exchange_strong(expected, WorkPackage::States::staticInQ))
+      throw std::logic_error("WorkQueuePool::CheckStateAndSetToInQ_static: Bad WP state");
+  }
+  else
+  {
+    auto expected = WorkPackage::States::staticExec;
+    if (!wp.state.compare_exchange_strong(expected, WorkPackage::States::staticExecInQ))
+      throw std::logic_error("WorkQueuePool::CheckStateAndSetToInQ_static: Bad WP state");
+  }
+}
+
+/**
+ * \brief Checks the state of an @ref WorkPackage (dynamic), which shall be enqueued into the
+ * work queue and sets the work package's state to the proper "in-Q" state.
+ *
+ * __Thread-safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception-safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread-cancellation-safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * ---
+ *
+ * \param wp
+ * Reference to the work package.
+ */
+void WorkQueuePool::CheckStateAndSetToInQ_dynamic(WorkPackage& wp) const noexcept
+{
+  auto expected = WorkPackage::States::dynamicNotInQ;
+  if (!wp.state.compare_exchange_strong(expected, WorkPackage::States::dynamicInQ))
+    Panic("WorkQueuePool::CheckStateAndSetToInQ_dynamic: Bad WP state");
+}
+
+/**
+ * \brief Releases a @ref WorkPackage instance which is enqueued in the work queue.
+ *
+ * __Thread-safety:__\n
+ * @ref queueMutex must be locked.
+ *
+ * __Exception-safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread-cancellation-safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * ---
+ *
+ * \param pWP
+ * Pointer to the @ref WorkPackage that shall be released.
+ */
+void WorkQueuePool::Release(WorkPackage* const pWP) noexcept
+{
+  switch (pWP->state)
+  {
+    case WorkPackage::States::staticInQ:
+      pWP->state = WorkPackage::States::staticNotInQ;
+      break;
+
+    case WorkPackage::States::staticExecInQ:
+      pWP->state = WorkPackage::States::staticExec;
+      break;
+
+    case WorkPackage::States::dynamicInQ:
+      pWP->state = WorkPackage::States::dynamicNotInQ;
+      delete pWP;
+      break;
+
+    // case WorkPackage::States::staticNotInQ:
+    // case WorkPackage::States::staticExec:
+    // case WorkPackage::States::dynamicNotInQ:
+    default:
+      Panic("WorkQueuePool::Release: Bad WP state");
+  };
+}
+
+/**
+ * \brief Releases a @ref WorkPackage instance after execution.
+ *
+ * __Thread-safety:__\n
+ * @ref queueMutex must be locked.
+ *
+ * __Exception-safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread-cancellation-safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * ---
+ *
+ * \param pWP
+ * Pointer to the @ref WorkPackage that shall be released.
+ */
+void WorkQueuePool::Finish(WorkPackage* const pWP) noexcept
+{
+  switch (pWP->state)
+  {
+    case WorkPackage::States::staticExec:
+      pWP->state = WorkPackage::States::staticNotInQ;
+      break;
+
+    case WorkPackage::States::staticExecInQ:
+      pWP->state = WorkPackage::States::staticInQ;
+      break;
+
+    case WorkPackage::States::dynamicInQ:
+      pWP->state = WorkPackage::States::dynamicNotInQ;
+      delete pWP;
+      break;
+
+    // case WorkPackage::States::staticNotInQ:
+    // case WorkPackage::States::staticInQ:
+    // case WorkPackage::States::dynamicNotInQ:
+    default:
+      Panic("WorkQueuePool::Finish: Bad WP state");
+  };
+}
+
+} // namespace async
+} // namespace execution
+} // namespace gpcc
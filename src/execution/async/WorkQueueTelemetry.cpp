@@ -0,0 +1,672 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#include <gpcc/execution/async/WorkQueueTelemetry.hpp>
+#include <gpcc/time/TimePoint.hpp>
+#include <limits>
+#include <stdexcept>
+
+namespace gpcc      {
+namespace execution {
+namespace async     {
+
+/**
+ * \brief Calculates the arithmetic mean of all recorded values.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \return
+ * Arithmetic mean of all recorded values in ns.\n
+ * Zero, if no value has been recorded.
+ */
+uint64_t WorkQueueTelemetry::Histogram::Snapshot::GetAverage_ns(void) const noexcept
+{
+  if (count == 0U)
+    return 0U;
+
+  return sum_ns / count;
+}
+
+/**
+ * \brief Estimates a percentile of the recorded values.
+ *
+ * The estimate is the upper limit of the bucket containing the percentile, but not more than the maximum recorded
+ * value.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param percent
+ * Percentile (1..100). Values above 100 are treated as 100.
+ *
+ * \return
+ * Estimated upper limit of the percentile in ns.\n
+ * Zero, if no value has been recorded.
+ */
+uint64_t WorkQueueTelemetry::Histogram::Snapshot::GetPercentile_ns(uint8_t const percent) const noexcept
+{
+  uint64_t total = 0U;
+  for (auto const n : buckets)
+    total += n;
+
+  if (total == 0U)
+    return 0U;
+
+  uint64_t const p = (percent > 100U) ? 100U : percent;
+  uint64_t threshold = ((total * p) + 99U) / 100U;
+  if (threshold == 0U)
+    threshold = 1U;
+
+  uint64_t cumulative = 0U;
+  for (size_t i = 0U; i < nbOfBuckets; i++)
+  {
+    cumulative += buckets[i];
+    if (cumulative >= threshold)
+    {
+      uint64_t const limit = GetBucketUpperLimit_ns(i);
+      return (limit < max_ns) ? limit : max_ns;
+    }
+  }
+
+  return max_ns;
+}
+
+/**
+ * \brief Constructor. Creates an empty histogram.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ */
+WorkQueueTelemetry::Histogram::Histogram(void) noexcept
+: count(0U)
+, sum_ns(0U)
+, max_ns(0U)
+, buckets()
+{
+  for (auto & b : buckets)
+    b.store(0U, std::memory_order_relaxed);
+}
+
+/**
+ * \brief Records a value.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param value_ns
+ * Value that shall be recorded in ns.
+ */
+void WorkQueueTelemetry::Histogram::Record(uint64_t const value_ns) noexcept
+{
+  buckets[ValueToBucket(value_ns)].fetch_add(1U, std::memory_order_relaxed);
+  sum_ns.fetch_add(value_ns, std::memory_order_relaxed);
+
+  uint64_t currentMax = max_ns.load(std::memory_order_relaxed);
+  while ((value_ns > currentMax) &&
+         (!max_ns.compare_exchange_weak(currentMax, value_ns, std::memory_order_relaxed)))
+  {
+  }
+
+  count.fetch_add(1U, std::memory_order_relaxed);
+}
+
+/**
+ * \brief Retrieves a snapshot of the histogram's content.
+ *
+ * If values are recorded concurrently, then the snapshot may be slightly inconsistent (e.g. the sum of all buckets
+ * may not match the count).
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \return
+ * Snapshot of the histogram's content.
+ */
+WorkQueueTelemetry::Histogram::Snapshot WorkQueueTelemetry::Histogram::GetSnapshot(void) const noexcept
+{
+  Snapshot s;
+  s.count  = count.load(std::memory_order_relaxed);
+  s.sum_ns = sum_ns.load(std::memory_order_relaxed);
+  s.max_ns = max_ns.load(std::memory_order_relaxed);
+  for (size_t i = 0U; i < nbOfBuckets; i++)
+    s.buckets[i] = buckets[i].load(std::memory_order_relaxed);
+
+  return s;
+}
+
+/**
+ * \brief Clears the histogram.
+ *
+ * Values recorded concurrently may be partially lost.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ */
+void WorkQueueTelemetry::Histogram::Reset(void) noexcept
+{
+  count.store(0U, std::memory_order_relaxed);
+  sum_ns.store(0U, std::memory_order_relaxed);
+  max_ns.store(0U, std::memory_order_relaxed);
+  for (auto & b : buckets)
+    b.store(0U, std::memory_order_relaxed);
+}
+
+/**
+ * \brief Determines the bucket of a value.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param value_ns
+ * Value in ns.
+ *
+ * \return
+ * Index of the bucket counting the value.
+ */
+size_t WorkQueueTelemetry::Histogram::ValueToBucket(uint64_t const value_ns) noexcept
+{
+  uint64_t v = value_ns / 1000U;
+
+  size_t bucket = 0U;
+  while ((v != 0U) && (bucket < (nbOfBuckets - 1U)))
+  {
+    v >>= 1U;
+    bucket++;
+  }
+
+  return bucket;
+}
+
+/**
+ * \brief Retrieves the upper limit of a bucket.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param bucket
+ * Index of the bucket.
+ *
+ * \return
+ * Upper limit (exclusive) of the values counted by the bucket in ns.\n
+ * The last bucket has no upper limit. In this case the maximum value of `uint64_t` is returned.
+ */
+uint64_t WorkQueueTelemetry::Histogram::GetBucketUpperLimit_ns(size_t const bucket) noexcept
+{
+  if (bucket >= (nbOfBuckets - 1U))
+    return std::numeric_limits<uint64_t>::max();
+
+  return (static_cast<uint64_t>(1U) << bucket) * 1000U;
+}
+
+/**
+ * \brief Constructor of struct @ref Entry.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ */
+WorkQueueTelemetry::Entry::Entry(void) noexcept
+: state(EntryStates::free)
+, pOwnerObject(nullptr)
+, ownerID(0U)
+, latency()
+, execution()
+, lateStart()
+{
+}
+
+/**
+ * \brief Constructor.
+ *
+ * All memory required by the object is allocated here.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Deferred cancellation is safe.
+ *
+ * - - -
+ *
+ * \param _maxNbOfOwners
+ * Maximum number of different work package owners (`pOwnerObject` and `ownerID`) that shall be recorded
+ * separately.\n
+ * Zero is not allowed.
+ */
+WorkQueueTelemetry::WorkQueueTelemetry(size_t const _maxNbOfOwners)
+: maxNbOfOwners(_maxNbOfOwners)
+, spEntries()
+, others()
+, maxQueueDepth(0U)
+{
+  if (maxNbOfOwners == 0U)
+    throw std::invalid_argument("WorkQueueTelemetry::WorkQueueTelemetry: _maxNbOfOwners is zero");
+
+  spEntries.reset(new Entry[maxNbOfOwners]);
+}
+
+/**
+ * \brief Retrieves a snapshot of all recorded data.
+ *
+ * If data is recorded concurrently, then the snapshot may be slightly inconsistent.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \return
+ * Snapshot of all recorded data.\n
+ * Owners that have not recorded any data since creation of the object or since the last call to @ref Reset() are
+ * not contained in the snapshot. If present, the record of the owners that did not fit into the table of owners is
+ * the last one.
+ */
+WorkQueueTelemetry::Snapshot WorkQueueTelemetry::GetSnapshot(void) const
+{
+  Snapshot s;
+  s.maxQueueDepth = maxQueueDepth.load(std::memory_order_relaxed);
+
+  for (size_t i = 0U; i < maxNbOfOwners; i++)
+  {
+    Entry const & e = spEntries[i];
+    if (e.state.load(std::memory_order_acquire) == EntryStates::used)
+      AppendRecord(s.owners, e, false);
+  }
+
+  AppendRecord(s.owners, others, true);
+
+  return s;
+}
+
+/**
+ * \brief Clears all recorded data.
+ *
+ * The assignment of owners to the entries of the table of owners is kept.\n
+ * Data recorded concurrently may be partially lost.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ */
+void WorkQueueTelemetry::Reset(void) noexcept
+{
+  maxQueueDepth.store(0U, std::memory_order_relaxed);
+
+  for (size_t i = 0U; i < maxNbOfOwners; i++)
+  {
+    Entry & e = spEntries[i];
+    e.latency.Reset();
+    e.execution.Reset();
+    e.lateStart.Reset();
+  }
+
+  others.latency.Reset();
+  others.execution.Reset();
+  others.lateStart.Reset();
+}
+
+/**
+ * \brief Retrieves a timestamp that can be passed to the `RecordXYZ(...)`-methods.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \return
+ * Current value of the precise monotonic clock in ns. The value is never zero.
+ */
+uint64_t WorkQueueTelemetry::GetTimestamp_ns(void)
+{
+  auto const now = gpcc::time::TimePoint::FromSystemClock(gpcc::time::Clocks::monotonicPrecise);
+  uint64_t const ts = (static_cast<uint64_t>(now.Get_sec()) * 1000000000ULL) + static_cast<uint64_t>(now.Get_nsec());
+
+  // zero is used by work queues to indicate "no timestamp"
+  return (ts != 0U) ? ts : 1U;
+}
+
+/**
+ * \brief Records the current number of non-deferred work packages enqueued in the work queue.
+ *
+ * This is intended to be invoked by work queues each time a work package has been added.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param depth
+ * Current number of enqueued non-deferred work packages.
+ */
+void WorkQueueTelemetry::RecordQueueDepth(size_t const depth) noexcept
+{
+  size_t currentMax = maxQueueDepth.load(std::memory_order_relaxed);
+  while ((depth > currentMax) &&
+         (!maxQueueDepth.compare_exchange_weak(currentMax, depth, std::memory_order_relaxed)))
+  {
+  }
+}
+
+/**
+ * \brief Records the execution of a non-deferred work package.
+ *
+ * This is intended to be invoked by work queues after execution of a work package.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param pOwnerObject
+ * Owner object of the work package.
+ *
+ * \param ownerID
+ * ID assigned by the owner of the work package.
+ *
+ * \param enqueueTimestamp_ns
+ * Timestamp (see @ref GetTimestamp_ns()) when the work package has been added to the work queue.\n
+ * Zero, if unknown. In this case no queue latency will be recorded.
+ *
+ * \param startTimestamp_ns
+ * Timestamp (see @ref GetTimestamp_ns()) when execution of the work package has started.
+ *
+ * \param endTimestamp_ns
+ * Timestamp (see @ref GetTimestamp_ns()) when execution of the work package has finished.
+ */
+void WorkQueueTelemetry::RecordExecution(void const * const pOwnerObject,
+                                         uint32_t const ownerID,
+                                         uint64_t const enqueueTimestamp_ns,
+                                         uint64_t const startTimestamp_ns,
+                                         uint64_t const endTimestamp_ns) noexcept
+{
+  Entry & e = GetEntry(pOwnerObject, ownerID);
+
+  if ((enqueueTimestamp_ns != 0U) && (startTimestamp_ns >= enqueueTimestamp_ns))
+    e.latency.Record(startTimestamp_ns - enqueueTimestamp_ns);
+
+  if (endTimestamp_ns >= startTimestamp_ns)
+    e.execution.Record(endTimestamp_ns - startTimestamp_ns);
+}
+
+/**
+ * \brief Records the execution of a deferred work package.
+ *
+ * This is intended to be invoked by work queues after execution of a deferred work package.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param pOwnerObject
+ * Owner object of the deferred work package.
+ *
+ * \param ownerID
+ * ID assigned by the owner of the deferred work package.
+ *
+ * \param lateStart_ns
+ * Time between the point in time specified by the deferred work package and start of its execution in ns.\n
+ * Negative values are recorded as zero.
+ *
+ * \param startTimestamp_ns
+ * Timestamp (see @ref GetTimestamp_ns()) when execution of the deferred work package has started.
+ *
+ * \param endTimestamp_ns
+ * Timestamp (see @ref GetTimestamp_ns()) when execution of the deferred work package has finished.
+ */
+void WorkQueueTelemetry::RecordDeferredExecution(void const * const pOwnerObject,
+                                                 uint32_t const ownerID,
+                                                 int64_t const lateStart_ns,
+                                                 uint64_t const startTimestamp_ns,
+                                                 uint64_t const endTimestamp_ns) noexcept
+{
+  Entry & e = GetEntry(pOwnerObject, ownerID);
+
+  e.lateStart.Record((lateStart_ns > 0) ? static_cast<uint64_t>(lateStart_ns) : 0U);
+
+  if (endTimestamp_ns >= startTimestamp_ns)
+    e.execution.Record(endTimestamp_ns - startTimestamp_ns);
+}
+
+/**
+ * \brief Retrieves the entry of an owner from the table of owners. If the owner is not yet in the table, then a new
+ *        entry will be assigned.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param pOwnerObject
+ * Owner object.
+ *
+ * \param ownerID
+ * ID assigned by the owner.
+ *
+ * \return
+ * Reference to the entry of the owner.\n
+ * If the table of owners is full, then @ref others will be returned.
+ */
+WorkQueueTelemetry::Entry& WorkQueueTelemetry::GetEntry(void const * const pOwnerObject,
+                                                        uint32_t const ownerID) noexcept
+{
+  uint64_t hash = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(pOwnerObject) >> 3U);
+  hash ^= static_cast<uint64_t>(ownerID) * 0x9E3779B97F4A7C15ULL;
+  hash ^= (hash >> 29U);
+
+  size_t idx = static_cast<size_t>(hash % maxNbOfOwners);
+  for (size_t i = 0U; i < maxNbOfOwners; i++)
+  {
+    Entry & e = spEntries[idx];
+
+    EntryStates s = e.state.load(std::memory_order_acquire);
+
+    if (s == EntryStates::free)
+    {
+      if (e.state.compare_exchange_strong(s, EntryStates::claiming, std::memory_order_acquire))
+      {
+        e.pOwnerObject = pOwnerObject;
+        e.ownerID      = ownerID;
+        e.state.store(EntryStates::used, std::memory_order_release);
+        return e;
+      }
+    }
+
+    // Another thread is just assigning the entry. This takes only two stores, so spinning is acceptable.
+    while (s == EntryStates::claiming)
+      s = e.state.load(std::memory_order_acquire);
+
+    if ((e.pOwnerObject == pOwnerObject) && (e.ownerID == ownerID))
+      return e;
+
+    if (++idx == maxNbOfOwners)
+      idx = 0U;
+  }
+
+  return others;
+}
+
+/**
+ * \brief Appends an @ref OwnerRecord created from an @ref Entry to a vector, if the entry contains any data.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param v
+ * Vector to which the record shall be appended.
+ *
+ * \param e
+ * Entry. The entry must be assigned to an owner or it must be @ref others.
+ *
+ * \param isOthers
+ * Indicates if `e` is @ref others.
+ */
+void WorkQueueTelemetry::AppendRecord(std::vector<OwnerRecord> & v, Entry const & e, bool const isOthers)
+{
+  OwnerRecord r;
+  r.pOwnerObject = isOthers ? nullptr : e.pOwnerObject;
+  r.ownerID      = isOthers ? 0U : e.ownerID;
+  r.others       = isOthers;
+  r.latency      = e.latency.GetSnapshot();
+  r.execution    = e.execution.GetSnapshot();
+  r.lateStart    = e.lateStart.GetSnapshot();
+
+  if ((r.latency.count != 0U) || (r.execution.count != 0U) || (r.lateStart.count != 0U))
+    v.push_back(r);
+}
+
+} // namespace async
+} // namespace execution
+} // namespace gpcc
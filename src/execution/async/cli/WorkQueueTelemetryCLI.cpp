@@ -0,0 +1,166 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#include <gpcc/execution/async/cli/WorkQueueTelemetryCLI.hpp>
+#include <gpcc/cli/CLI.hpp>
+#include <gpcc/cli/exceptions.hpp>
+#include <gpcc/execution/async/WorkQueueTelemetry.hpp>
+#include <gpcc/string/tools.hpp>
+#include <iomanip>
+#include <sstream>
+
+namespace gpcc      {
+namespace execution {
+namespace async     {
+
+namespace {
+
+/**
+ * \brief Creates one line of the table printed by @ref CliCmdPrintWorkQueueTelemetry().
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param name
+ * Name of the metric.
+ *
+ * \param h
+ * Snapshot of the histogram of the metric.
+ *
+ * \return
+ * Line of text.
+ */
+std::string HistogramToLine(char const * const name, WorkQueueTelemetry::Histogram::Snapshot const & h)
+{
+  std::ostringstream s;
+  s << "  " << std::left << std::setw(12) << name << std::right << std::setw(9) << h.count;
+
+  if (h.count == 0U)
+  {
+    s << std::setw(9) << '-' << std::setw(9) << '-' << std::setw(9) << '-' << std::setw(9) << '-';
+  }
+  else
+  {
+    s << std::setw(9) << (h.GetAverage_ns() / 1000U)
+      << std::setw(9) << (h.GetPercentile_ns(50U) / 1000U)
+      << std::setw(9) << (h.GetPercentile_ns(99U) / 1000U)
+      << std::setw(9) << (h.max_ns / 1000U);
+  }
+
+  return s.str();
+}
+
+} // anonymous namespace
+
+/**
+ * \ingroup GPCC_EXECUTION_ASYNC_CLI
+ * \brief [CLI](@ref gpcc::cli::CLI) command for printing the data recorded by a @ref WorkQueueTelemetry instance.
+ *
+ * The command prints the maximum queue depth and a table for each work package owner. The table contains the number
+ * of recorded values, the average, the 50th and 99th percentile (estimated upper limit) and the maximum of the queue
+ * latency, the execution time and the late start of deferred work packages. All times are printed in us.
+ *
+ * If the argument "reset" is passed to the command, then the recorded data will be cleared.
+ *
+ * Usage example:
+ * ~~~{.cpp}
+ * using gpcc::cli::Command;
+ * cli.AddCommand(Command::Create("wqtelemetry", " [reset]\n"\
+ *                                               "Prints the telemetry data of the work queue.\n"\
+ *                                               "\"reset\" clears the telemetry data.",
+ *                                std::bind(&gpcc::execution::async::CliCmdPrintWorkQueueTelemetry,
+ *                                          std::placeholders::_1,
+ *                                          std::placeholders::_2,
+ *                                          &myTelemetry)));
+ * ~~~
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * Basic guarantee:\n
+ * - content of terminal's screen maybe incomplete
+ *
+ * __Thread cancellation safety:__\n
+ * Basic guarantee:
+ * - content of terminal's screen maybe incomplete
+ *
+ * - - -
+ *
+ * \param restOfLine
+ * Arguments passed to the CLI command.
+ *
+ * \param cli
+ * `gpcc::cli::CLI` instance executing this.
+ *
+ * \param pTelemetry
+ * Pointer to the @ref WorkQueueTelemetry instance accessed through this command handler.
+ */
+void CliCmdPrintWorkQueueTelemetry(std::string const & restOfLine,
+                                   gpcc::cli::CLI & cli,
+                                   WorkQueueTelemetry* const pTelemetry)
+{
+  std::string const args = gpcc::string::Trim(restOfLine);
+
+  if (args == "reset")
+  {
+    pTelemetry->Reset();
+    cli.WriteLine("Telemetry data cleared.");
+    return;
+  }
+  else if (!args.empty())
+  {
+    throw gpcc::cli::UserEnteredInvalidArgsError();
+  }
+
+  auto const snapshot = pTelemetry->GetSnapshot();
+
+  cli.WriteLine("Max. queue depth: " + std::to_string(snapshot.maxQueueDepth));
+
+  if (snapshot.owners.empty())
+  {
+    cli.WriteLine("No work packages recorded.");
+    return;
+  }
+
+  for (auto const & r : snapshot.owners)
+  {
+    std::ostringstream s;
+    if (r.others)
+      s << "Other owners:";
+    else if (r.pOwnerObject == nullptr)
+      s << "Owner (anonymous) ID " << r.ownerID << ':';
+    else
+      s << "Owner 0x" << std::hex << reinterpret_cast<uintptr_t>(r.pOwnerObject) << std::dec
+        << " ID " << r.ownerID << ':';
+
+    cli.WriteLine(s.str());
+    cli.WriteLine("  Metric          Count  Avg[us]  P50[us]  P99[us]  Max[us]");
+    cli.WriteLine(HistogramToLine("Latency", r.latency));
+    cli.WriteLine(HistogramToLine("Execution", r.execution));
+    cli.WriteLine(HistogramToLine("Late start", r.lateStart));
+  }
+}
+
+} // namespace async
+} // namespace execution
+} // namespace gpcc
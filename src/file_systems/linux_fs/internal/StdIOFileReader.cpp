@@ -23,6 +23,7 @@
 #include <stdexcept>
 #include <system_error>
 #include <cerrno>
+#include <cstdint>
 
 namespace gpcc         {
 namespace file_systems {
@@ -170,18 +171,75 @@ StdIOFileReader::~StdIOFileReader(void)
 /// \copydoc gpcc::stream::IStreamReader::IsRemainingBytesSupported(void) const
 bool StdIOFileReader::IsRemainingBytesSupported(void) const
 {
-  return false;
+  return true;
 }
 
-/// \copydoc gpcc::stream::IStreamReader::RemainingBytes(void) const
+/**
+ * \brief Retrieves the number of bytes that could be read until the stream or the storage behind it becomes empty.
+ *
+ * The number of bytes is determined from the size of the file (`fstat()`) and the current read position (`ftell()`).
+ *
+ * \pre   The stream must be in state [States::open](@ref gpcc::stream::IStreamReader::States::open) or
+ *        [States::empty](@ref gpcc::stream::IStreamReader::States::empty).
+ *
+ * \pre   The file is not modified by anyone else while it is read.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * The state of the object is not modified. Concurrent accesses are safe.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * \throws ClosedError          Stream is already closed ([details](@ref gpcc::stream::ClosedError)).
+ *
+ * \throws ErrorStateError      Stream is in error state ([details](@ref gpcc::stream::ErrorStateError)).
+ *
+ * \throws std::overflow_error  Number of remaining bytes exceeds the range of `size_t`.
+ *
+ * \throws std::system_error    Querying the size of the file or the read position has failed.
+ *
+ * __Thread cancellation safety:__\n
+ * Deferred cancellation is safe.
+ *
+ * - - -
+ *
+ * \return
+ * Number of bytes that could be read from the stream until the stream becomes empty.\n
+ * If zero is returned, then up to 7 bits could still be left to be read.
+ */
 size_t StdIOFileReader::RemainingBytes(void) const
 {
   switch (state)
   {
     case States::open:
-      // intentional fall-through
+    {
+      // only bits left?
+      if (feof(fd) != 0)
+        return 0U;
+
+      struct stat s;
+      if (fstat(fileno(fd), &s) != 0)
+        throw std::system_error(errno, std::generic_category(), "StdIOFileReader::RemainingBytes: \"fstat\" failed");
+
+      long const pos = ftell(fd);
+      if (pos < 0)
+        throw std::system_error(errno, std::generic_category(), "StdIOFileReader::RemainingBytes: \"ftell\" failed");
+
+      // Note: "nextByte" has been read ahead from the file already
+      uint64_t remaining = 1U;
+      if (static_cast<uint64_t>(s.st_size) > static_cast<uint64_t>(pos))
+        remaining += static_cast<uint64_t>(s.st_size) - static_cast<uint64_t>(pos);
+
+      if (remaining > std::numeric_limits<size_t>::max())
+        throw std::overflow_error("StdIOFileReader::RemainingBytes: Exceeds range of size_t");
+
+      return static_cast<size_t>(remaining);
+    }
+
     case States::empty:
-      throw std::logic_error("StdIOFileReader::RemainingBytes: Operation not supported");
+      return 0U;
 
     case States::closed:
       throw stream::ClosedError();
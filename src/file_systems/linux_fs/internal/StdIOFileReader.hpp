@@ -33,7 +33,8 @@ namespace internal     {
  * This class offers read access via @ref gpcc::stream::IStreamReader and manages all read accesses to the storage.
  * All read accesses are done using buffered I/O operations. Finally this class takes care for unlocking of the
  * opened file at the @ref FileStorage instance.
- * [IStreamReader::RemainingBytes()](@ref gpcc::stream::IStreamReader::RemainingBytes()) is not supported.
+ * [IStreamReader::RemainingBytes()](@ref gpcc::stream::IStreamReader::RemainingBytes()) is supported. It is based on
+ * the size of the file and on the current read position.
  *
  * After construction, the object is ready to read data from the file via the @ref gpcc::stream::IStreamWriter
  * interface.
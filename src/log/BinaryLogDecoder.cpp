@@ -0,0 +1,490 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#include <gpcc/log/BinaryLogDecoder.hpp>
+#include <gpcc/log/backends/Backend_Binary.hpp>
+#include <gpcc/log/log_tools.hpp>
+#include <gpcc/stream/IStreamReader.hpp>
+#include <gpcc/string/tools.hpp>
+#include <gpcc/time/TimePoint.hpp>
+#include <memory>
+#include <stdexcept>
+#include <cstring>
+
+namespace gpcc {
+namespace log  {
+
+/**
+ * \brief Constructor. The header of the binary log is read and checked.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * \throws InvalidVersionError   Version of binary log is not supported ([details](@ref gpcc::log::InvalidVersionError)).
+ *
+ * \throws std::runtime_error    The stream does not contain a binary log.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param _reader
+ * Stream from which the binary log shall be read. The stream must be configured for little endian.\n
+ * The referenced object must not be accessed by anyone else and it must not be released while this object exists.
+ */
+BinaryLogDecoder::BinaryLogDecoder(gpcc::stream::IStreamReader & _reader)
+: reader(_reader)
+, srcNames()
+, fmtStrings()
+{
+  if (reader.GetEndian() != gpcc::stream::IStreamReader::Endian::Little)
+    throw std::invalid_argument("BinaryLogDecoder::BinaryLogDecoder: _reader must use little endian");
+
+  char magic[sizeof(Backend_Binary::magic)];
+  reader.Read_char(magic, sizeof(magic));
+  if (memcmp(magic, Backend_Binary::magic, sizeof(magic)) != 0)
+    throw std::runtime_error("BinaryLogDecoder::BinaryLogDecoder: Not a binary log");
+
+  if (reader.Read_uint8() != Backend_Binary::version)
+    throw InvalidVersionError();
+}
+
+/**
+ * \brief Decodes the next log message.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * The state of the object is modified. Any concurrent accesses are not safe.
+ *
+ * __Exception safety:__\n
+ * Basic guarantee:
+ * - The stream may have been read partially. Decoding cannot be continued.
+ *
+ * \throws std::runtime_error   Inconsistent data.
+ *
+ * \throws EmptyError           Unexpected end of stream ([details](@ref gpcc::stream::EmptyError)).
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param msg
+ * The decoded log message text string is written into the referenced object, if this returns true.
+ *
+ * \param type
+ * The type of the decoded log message is written into the referenced object, if this returns true.
+ *
+ * \retval true   Success. `msg` and `type` have been written.
+ * \retval false  End of stream. There are no more log messages.
+ */
+bool BinaryLogDecoder::Next(std::string & msg, LogType & type)
+{
+  while (reader.GetState() == gpcc::stream::IStreamReader::States::open)
+  {
+    switch (static_cast<Backend_Binary::RecordTags>(reader.Read_uint8()))
+    {
+      case Backend_Binary::RecordTags::srcNameDef:
+        ReadDefinition(srcNames);
+        break;
+
+      case Backend_Binary::RecordTags::fmtStringDef:
+        ReadDefinition(fmtStrings);
+        break;
+
+      case Backend_Binary::RecordTags::message:
+        type = ReadLogType();
+        msg = DecodeMessage(type);
+        return true;
+
+      case Backend_Binary::RecordTags::textMessage:
+        type = ReadLogType();
+        msg = reader.Read_string();
+        return true;
+
+      default:
+        throw std::runtime_error("BinaryLogDecoder::Next: Invalid record tag");
+    }
+  }
+
+  return false;
+}
+
+/**
+ * \brief Reads a @ref LogType from the stream.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * The state of the object is modified. Any concurrent accesses are not safe.
+ *
+ * __Exception safety:__\n
+ * Basic guarantee:
+ * - The stream may have been read partially.
+ *
+ * \throws std::runtime_error   Invalid value.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \return
+ * @ref LogType read from the stream.
+ */
+LogType BinaryLogDecoder::ReadLogType(void)
+{
+  uint8_t const v = reader.Read_uint8();
+  if (v > static_cast<uint8_t>(LogType::Fatal))
+    throw std::runtime_error("BinaryLogDecoder::ReadLogType: Invalid log type");
+
+  return static_cast<LogType>(v);
+}
+
+/**
+ * \brief Reads the ID and the string of a definition record from the stream and adds the string to a list.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * The state of the object is modified. Any concurrent accesses are not safe.
+ *
+ * __Exception safety:__\n
+ * Basic guarantee:
+ * - The stream may have been read partially.
+ *
+ * \throws std::runtime_error   Unexpected ID.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param v
+ * List to which the string shall be added. IDs are assigned in ascending order, so the ID must be equal to the size of
+ * the list.
+ */
+void BinaryLogDecoder::ReadDefinition(std::vector<std::string> & v)
+{
+  uint32_t const id = reader.Read_uint32();
+  if (id != v.size())
+    throw std::runtime_error("BinaryLogDecoder::ReadDefinition: Unexpected ID");
+
+  v.push_back(reader.Read_string());
+}
+
+/**
+ * \brief Reads the remaining part of a @ref Backend_Binary::RecordTags::message record from the stream and builds
+ *        the log message text string.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * The state of the object is modified. Any concurrent accesses are not safe.
+ *
+ * __Exception safety:__\n
+ * Basic guarantee:
+ * - The stream may have been read partially.
+ *
+ * \throws std::runtime_error   Inconsistent data.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param type
+ * Type of the log message.
+ *
+ * \return
+ * Log message text string.
+ */
+std::string BinaryLogDecoder::DecodeMessage(LogType const type)
+{
+  uint32_t const srcNameID = reader.Read_uint32();
+  if (srcNameID >= srcNames.size())
+    throw std::runtime_error("BinaryLogDecoder::DecodeMessage: Unknown source name ID");
+
+  uint8_t const flags = reader.Read_uint8();
+  std::string timestamp;
+  if ((flags & 0x01U) != 0U)
+  {
+    int64_t const sec = reader.Read_int64();
+    int32_t const nsec = reader.Read_int32();
+    if ((nsec < 0) || (nsec >= 1000000000L))
+      throw std::runtime_error("BinaryLogDecoder::DecodeMessage: Invalid timestamp");
+
+    timestamp = gpcc::time::TimePoint(static_cast<time_t>(sec), nsec).ToString();
+  }
+
+  uint32_t const fmtStringID = reader.Read_uint32();
+  if (fmtStringID >= fmtStrings.size())
+    throw std::runtime_error("BinaryLogDecoder::DecodeMessage: Unknown format string ID");
+
+  uint_fast8_t nbOfArgs = reader.Read_uint8();
+  std::vector<Arg> args;
+  args.reserve(nbOfArgs);
+  while (nbOfArgs-- != 0U)
+    args.push_back(ReadArg());
+
+  std::string s = LogType2LogMsgHeader(type);
+  s += ' ';
+  s += srcNames[srcNameID];
+  s += ": ";
+  if (!timestamp.empty())
+  {
+    s += '(';
+    s += timestamp;
+    s += ") ";
+  }
+  s += Format(fmtStrings[fmtStringID], args);
+
+  string::InsertIndention(s, logMsgHeaderLength + 1U);
+
+  return s;
+}
+
+/**
+ * \brief Reads an argument of a log message from the stream.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * The state of the object is modified. Any concurrent accesses are not safe.
+ *
+ * __Exception safety:__\n
+ * Basic guarantee:
+ * - The stream may have been read partially.
+ *
+ * \throws std::runtime_error   Invalid type code.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \return
+ * Argument read from the stream.
+ */
+BinaryLogDecoder::Arg BinaryLogDecoder::ReadArg(void)
+{
+  Arg arg = {};
+  arg.code = static_cast<char>(reader.Read_uint8());
+
+  switch (arg.code)
+  {
+    case 'c': arg.i = reader.Read_int8();   break;
+    case 'C': arg.u = reader.Read_uint8();  break;
+    case 'h': arg.i = reader.Read_int16();  break;
+    case 'H': arg.u = reader.Read_uint16(); break;
+    case 'i': arg.i = reader.Read_int32();  break;
+    case 'I': arg.u = reader.Read_uint32(); break;
+    case 'l': arg.i = reader.Read_int64();  break;
+    case 'L': arg.u = reader.Read_uint64(); break;
+    case 'd': arg.d = reader.Read_double(); break;
+    case 's': arg.s = reader.Read_string(); break;
+    case 'p': arg.u = reader.Read_uint64(); break;
+
+    default:
+      throw std::runtime_error("BinaryLogDecoder::ReadArg: Invalid type code");
+  }
+
+  return arg;
+}
+
+/**
+ * \brief Formats the arguments of a log message according to a printf-style format string.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param fmt
+ * printf-style format string.
+ *
+ * \param args
+ * Arguments.
+ *
+ * \return
+ * Formatted text.
+ */
+std::string BinaryLogDecoder::Format(std::string const & fmt, std::vector<Arg> const & args)
+{
+  std::string out;
+  size_t nextArg = 0U;
+  size_t i = 0U;
+  size_t const n = fmt.size();
+
+  while (i < n)
+  {
+    if (fmt[i] != '%')
+    {
+      out += fmt[i++];
+      continue;
+    }
+
+    if ((i + 1U < n) && (fmt[i + 1U] == '%'))
+    {
+      out += '%';
+      i += 2U;
+      continue;
+    }
+
+    // collect flags, field width and precision, drop length modifiers
+    std::string spec("%");
+    bool star = false;
+    ++i;
+    while ((i < n) && (strchr("-+ #0'", fmt[i]) != nullptr))
+      spec += fmt[i++];
+    while ((i < n) && (((fmt[i] >= '0') && (fmt[i] <= '9')) || (fmt[i] == '.') || (fmt[i] == '*')))
+    {
+      if (fmt[i] == '*')
+        star = true;
+      spec += fmt[i++];
+    }
+    while ((i < n) && (strchr("hljztLq", fmt[i]) != nullptr))
+      ++i;
+
+    if (i == n)
+    {
+      out += "<?>";
+      break;
+    }
+
+    char const conv = fmt[i++];
+    if ((star) || (nextArg == args.size()))
+      out += "<?>";
+    else
+      out += FormatArg(spec, conv, args[nextArg++]);
+  }
+
+  return out;
+}
+
+/**
+ * \brief Formats one argument according to a conversion specification.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param spec
+ * Conversion specification without length modifier and without conversion specifier, e.g. "%-8.3".
+ *
+ * \param conv
+ * Conversion specifier, e.g. 'd' or 'f'.
+ *
+ * \param arg
+ * Argument.
+ *
+ * \return
+ * Formatted argument.\n
+ * "<?>", if the conversion specifier is not supported or if it does not match the type of the argument.
+ */
+std::string BinaryLogDecoder::FormatArg(std::string const & spec, char const conv, Arg const & arg)
+{
+  bool const intConv   = (strchr("diouxXc", conv) != nullptr);
+  bool const floatConv = (strchr("fFeEgGaA", conv) != nullptr);
+
+  std::unique_ptr<char[]> spText;
+  switch (arg.code)
+  {
+    case 'c':
+    case 'h':
+    case 'i':
+      if (intConv)
+        spText = gpcc::string::ASPrintf((spec + conv).c_str(), static_cast<int>(arg.i));
+      break;
+
+    case 'C':
+    case 'H':
+    case 'I':
+      if (intConv)
+        spText = gpcc::string::ASPrintf((spec + conv).c_str(), static_cast<unsigned int>(arg.u));
+      break;
+
+    case 'l':
+      if (conv == 'c')
+        spText = gpcc::string::ASPrintf((spec + conv).c_str(), static_cast<int>(arg.i));
+      else if (intConv)
+        spText = gpcc::string::ASPrintf((spec + "ll" + conv).c_str(), static_cast<long long>(arg.i));
+      break;
+
+    case 'L':
+      if (conv == 'c')
+        spText = gpcc::string::ASPrintf((spec + conv).c_str(), static_cast<int>(arg.u));
+      else if (intConv)
+        spText = gpcc::string::ASPrintf((spec + "ll" + conv).c_str(), static_cast<unsigned long long>(arg.u));
+      break;
+
+    case 'd':
+      if (floatConv)
+        spText = gpcc::string::ASPrintf((spec + conv).c_str(), arg.d);
+      break;
+
+    case 's':
+      if (conv == 's')
+        spText = gpcc::string::ASPrintf((spec + conv).c_str(), arg.s.c_str());
+      break;
+
+    case 'p':
+      if (conv == 'p')
+      {
+        // Format like glibc's %p: "(nil)" for a null pointer, otherwise like %#llx.
+        // Flags other than '-' are not applicable to "(nil)". '#' must precede the width.
+        if (arg.u == 0U)
+        {
+          std::string nilSpec;
+          for (char const c : spec)
+          {
+            if (strchr("0+ #", c) == nullptr)
+              nilSpec += c;
+          }
+          spText = gpcc::string::ASPrintf((nilSpec + 's').c_str(), "(nil)");
+        }
+        else
+        {
+          spText = gpcc::string::ASPrintf(("%#" + spec.substr(1U) + "llx").c_str(),
+                                          static_cast<unsigned long long>(arg.u));
+        }
+      }
+      break;
+  }
+
+  if (!spText)
+    return "<?>";
+
+  return spText.get();
+}
+
+} // namespace log
+} // namespace gpcc
@@ -13,8 +13,11 @@
 #include <gpcc/osal/Panic.hpp>
 #include <gpcc/raii/scope_guard.hpp>
 #include <gpcc/string/tools.hpp>
+#include <gpcc/time/TimeSpan.hpp>
 #include "internal/CStringLogMessage.hpp"
 #include "internal/CStringLogMessageTS.hpp"
+#include "internal/DeferredFormatLogMessage.hpp"
+#include "internal/DeferredFormatLogMessageTS.hpp"
 #include "internal/RomConstExceptionLogMessage.hpp"
 #include "internal/RomConstExceptionLogMessageTS.hpp"
 #include "internal/RomConstLogMessage.hpp"
@@ -57,8 +60,10 @@ Logger::Logger(std::string const & _srcName)
 , level(LogLevel::InfoOrAbove)
 , mutex()
 , pLogFacility(nullptr)
-, pNext(nullptr)
-, pPrev(nullptr)
+, rateLimitInterval_ns(0)
+, rateLimitCapacity_ns(0)
+, rateLimitBudget_ns(0)
+, rateLimitLastRefill()
 {
   if ((_srcName.length() == 0U) ||
       (_srcName.find_first_of(' ') != std::string::npos) ||
@@ -170,6 +175,63 @@ ILogFacility* Logger::GetLogFacility(void) const noexcept
   return pLogFacility;
 }
 
+/**
+ * \brief Configures rate limiting for log messages emitted by this @ref Logger instance.
+ *
+ * Rate limiting is disabled by default. See chapter "Rate limiting" in the documentation of class @ref Logger for
+ * details.
+ *
+ * The token bucket is filled completely by this.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \param maxMsgsPerSec
+ * Maximum number of log messages per second on average.\n
+ * Zero disables rate limiting.
+ *
+ * \param burstSize
+ * Maximum number of log messages that can be emitted in a burst without any delay.\n
+ * This must not be zero, if `maxMsgsPerSec` is not zero.
+ */
+void Logger::SetRateLimit(uint32_t const maxMsgsPerSec, uint16_t const burstSize)
+{
+  if ((maxMsgsPerSec != 0U) && (burstSize == 0U))
+    throw std::invalid_argument("Logger::SetRateLimit: burstSize invalid");
+
+  time::TimePoint const now = time::TimePoint::FromSystemClock(time::Clocks::monotonicPrecise);
+
+  osal::MutexLocker locker(mutex);
+
+  if (maxMsgsPerSec == 0U)
+  {
+    rateLimitInterval_ns = 0;
+    rateLimitCapacity_ns = 0;
+    rateLimitBudget_ns   = 0;
+  }
+  else
+  {
+    rateLimitInterval_ns = 1000000000LL / static_cast<int64_t>(maxMsgsPerSec);
+    if (rateLimitInterval_ns == 0)
+      rateLimitInterval_ns = 1;
+
+    rateLimitCapacity_ns = rateLimitInterval_ns * static_cast<int64_t>(burstSize);
+    rateLimitBudget_ns   = rateLimitCapacity_ns;
+  }
+
+  rateLimitLastRefill = now;
+}
+
 /**
  * \brief Logs a message. Message type: null-terminated c-string located in ROM/code memory.
  *
@@ -204,6 +266,9 @@ void Logger::Log(LogType const type, char const * const pMsg) noexcept
   {
     try
     {
+      if (!PassRateLimit(type))
+        return;
+
       auto spLM = std::make_unique<RomConstLogMessage>(srcName, type, pMsg);
       pLogFacility->Log(std::move(spLM));
     }
@@ -279,6 +344,9 @@ void Logger::Log(LogType const type, char const * const pMsg, std::exception_ptr
   {
     try
     {
+      if (!PassRateLimit(type))
+        return;
+
       auto spLM = std::make_unique<RomConstExceptionLogMessage>(srcName, type, pMsg, ePtr);
       pLogFacility->Log(std::move(spLM));
     }
@@ -323,6 +391,9 @@ void Logger::Log(LogType const type, std::string const & msg) noexcept
   {
     try
     {
+      if (!PassRateLimit(type))
+        return;
+
       auto spLM = std::make_unique<StringLogMessage>(srcName, type, msg);
       pLogFacility->Log(std::move(spLM));
     }
@@ -367,6 +438,9 @@ void Logger::Log(LogType const type, std::string && msg) noexcept
   {
     try
     {
+      if (!PassRateLimit(type))
+        return;
+
       auto spLM = std::make_unique<StringLogMessage>(srcName, type, std::move(msg));
       pLogFacility->Log(std::move(spLM));
     }
@@ -454,6 +528,9 @@ void Logger::Log(LogType const type, std::string const & msg, std::exception_ptr
   {
     try
     {
+      if (!PassRateLimit(type))
+        return;
+
       auto spLM = std::make_unique<StringExceptionLogMessage>(srcName, type, msg, ePtr);
       pLogFacility->Log(std::move(spLM));
     }
@@ -541,6 +618,9 @@ void Logger::Log(LogType const type, std::string && msg, std::exception_ptr cons
   {
     try
     {
+      if (!PassRateLimit(type))
+        return;
+
       auto spLM = std::make_unique<StringExceptionLogMessage>(srcName, type, std::move(msg), ePtr);
       pLogFacility->Log(std::move(spLM));
     }
@@ -620,6 +700,9 @@ void Logger::LogV(LogType const type, char const * const pFmt, ...) noexcept
   {
     try
     {
+      if (!PassRateLimit(type))
+        return;
+
       auto spLM = std::make_unique<CStringLogMessage>(srcName, type, gpcc::string::VASPrintf(pFmt, args));
       pLogFacility->Log(std::move(spLM));
     }
@@ -664,6 +747,9 @@ void Logger::LogTS(LogType const type, char const * const pMsg) noexcept
   {
     try
     {
+      if (!PassRateLimit(type))
+        return;
+
       auto spLM = std::make_unique<RomConstLogMessageTS>(srcName, type, pMsg);
       pLogFacility->Log(std::move(spLM));
     }
@@ -739,6 +825,9 @@ void Logger::LogTS(LogType const type, char const * const pMsg, std::exception_p
   {
     try
     {
+      if (!PassRateLimit(type))
+        return;
+
       auto spLM = std::make_unique<RomConstExceptionLogMessageTS>(srcName, type, pMsg, ePtr);
       pLogFacility->Log(std::move(spLM));
     }
@@ -783,6 +872,9 @@ void Logger::LogTS(LogType const type, std::string const & msg) noexcept
   {
     try
     {
+      if (!PassRateLimit(type))
+        return;
+
       auto spLM = std::make_unique<StringLogMessageTS>(srcName, type, msg);
       pLogFacility->Log(std::move(spLM));
     }
@@ -827,6 +919,9 @@ void Logger::LogTS(LogType const type, std::string && msg) noexcept
   {
     try
     {
+      if (!PassRateLimit(type))
+        return;
+
       auto spLM = std::make_unique<StringLogMessageTS>(srcName, type, std::move(msg));
       pLogFacility->Log(std::move(spLM));
     }
@@ -914,6 +1009,9 @@ void Logger::LogTS(LogType const type, std::string const & msg, std::exception_p
   {
     try
     {
+      if (!PassRateLimit(type))
+        return;
+
       auto spLM = std::make_unique<StringExceptionLogMessageTS>(srcName, type, msg, ePtr);
       pLogFacility->Log(std::move(spLM));
     }
@@ -1001,6 +1099,9 @@ void Logger::LogTS(LogType const type, std::string && msg, std::exception_ptr co
   {
     try
     {
+      if (!PassRateLimit(type))
+        return;
+
       auto spLM = std::make_unique<StringExceptionLogMessageTS>(srcName, type, std::move(msg), ePtr);
       pLogFacility->Log(std::move(spLM));
     }
@@ -1081,6 +1182,9 @@ void Logger::LogVTS(LogType const type, char const * const pFmt, ...) noexcept
   {
     try
     {
+      if (!PassRateLimit(type))
+        return;
+
       auto spLM = std::make_unique<CStringLogMessageTS>(srcName, type, gpcc::string::VASPrintf(pFmt, args));
       pLogFacility->Log(std::move(spLM));
     }
@@ -1116,5 +1220,114 @@ void Logger::LogFailed(void) noexcept
     pLogFacility->ReportLogMessageCreationFailed();
 }
 
+/**
+ * \brief Refills the token bucket and tries to consume one token.
+ *
+ * If there is no token available, then the log message is reported as dropped to the log facility.
+ *
+ * Log messages of type @ref LogType::Error and @ref LogType::Fatal are not affected by rate limiting. They always pass
+ * and they do not consume any token.
+ *
+ * \pre   @ref pLogFacility is not nullptr.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * @ref mutex must be locked.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \param type
+ * Type of the log message.
+ *
+ * \retval true   The log message shall be logged.
+ * \retval false  The log message shall be dropped. It has already been reported to the log facility.
+ */
+bool Logger::PassRateLimit(LogType const type)
+{
+  if ((rateLimitInterval_ns == 0) || (type == LogType::Error) || (type == LogType::Fatal))
+    return true;
+
+  time::TimePoint const now = time::TimePoint::FromSystemClock(time::Clocks::monotonicPrecise);
+  int64_t const elapsed_ns = (now - rateLimitLastRefill).ns();
+
+  rateLimitLastRefill = now;
+  if (elapsed_ns >= rateLimitCapacity_ns - rateLimitBudget_ns)
+    rateLimitBudget_ns = rateLimitCapacity_ns;
+  else if (elapsed_ns > 0)
+    rateLimitBudget_ns += elapsed_ns;
+
+  if (rateLimitBudget_ns < rateLimitInterval_ns)
+  {
+    pLogFacility->ReportLogMessageDropped();
+    return false;
+  }
+
+  rateLimitBudget_ns -= rateLimitInterval_ns;
+  return true;
+}
+
+/**
+ * \brief Creates a log message containing a format string and captured arguments and passes it to the log facility.
+ *
+ * This is the non-template part of @ref LogD() and @ref LogDTS().
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \param type
+ * Type of log message. The caller has already checked it against the log level.
+ *
+ * \param pFmt
+ * Pointer to a null-terminated c-string located in ROM/code memory containing the log message text and printf-style
+ * conversion specifications.
+ *
+ * \param args
+ * Captured values of the arguments.
+ *
+ * \param timestamp
+ * Controls if the log message shall contain a timestamp.
+ */
+void Logger::LogDeferred(LogType const type, char const * const pFmt, DeferredFormatArgs const & args, bool const timestamp) noexcept
+{
+  osal::MutexLocker locker(mutex);
+  if (pLogFacility != nullptr)
+  {
+    try
+    {
+      if (!PassRateLimit(type))
+        return;
+
+      std::unique_ptr<LogMessage> spLM;
+      if (timestamp)
+        spLM = std::make_unique<DeferredFormatLogMessageTS>(srcName, type, pFmt, args);
+      else
+        spLM = std::make_unique<DeferredFormatLogMessage>(srcName, type, pFmt, args);
+
+      pLogFacility->Log(std::move(spLM));
+    }
+    catch (std::exception const &)
+    {
+      pLogFacility->ReportLogMessageCreationFailed();
+    }
+  }
+}
+
 } // namespace log
 } // namespace gpcc
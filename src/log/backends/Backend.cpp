@@ -9,6 +9,7 @@
 */
 
 #include <gpcc/log/backends/Backend.hpp>
+#include <stdexcept>
 
 namespace gpcc {
 namespace log  {
@@ -30,5 +31,39 @@ Backend::Backend(void) noexcept
 {
 }
 
+/**
+ * \brief Queries if the back-end is a structured back-end.
+ *
+ * Log facilities offer log messages to structured back-ends via @ref ProcessRecord(), if the log message is available
+ * in unformatted form.\n
+ * The default implementation returns false.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \retval true   The back-end is a structured back-end.
+ * \retval false  The back-end processes log messages in text form only.
+ */
+bool Backend::IsStructured(void) const noexcept
+{
+  return false;
+}
+
+void Backend::ProcessRecord(LogRecord const & record)
+{
+  (void)record;
+  throw std::logic_error("Backend::ProcessRecord: Not supported");
+}
+
 } // namespace log
 } // namespace gpcc
@@ -0,0 +1,295 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#include <gpcc/log/backends/Backend_Binary.hpp>
+#include <gpcc/log/backends/LogRecord.hpp>
+#include <gpcc/log/DeferredFormatArgs.hpp>
+#include <gpcc/stream/IStreamWriter.hpp>
+#include <limits>
+#include <stdexcept>
+#include <cstring>
+
+namespace gpcc {
+namespace log  {
+
+namespace
+{
+  /**
+   * \brief Loads a value of type `T` from a buffer without any alignment requirements.
+   *
+   * - - -
+   *
+   * __Thread safety:__\n
+   * This is thread-safe.
+   *
+   * __Exception safety:__\n
+   * No-throw guarantee.
+   *
+   * __Thread cancellation safety:__\n
+   * No cancellation point included.
+   *
+   * - - -
+   *
+   * \tparam T
+   * Type of the value.
+   *
+   * \param p
+   * Pointer to the value. The pointer is advanced by `sizeof(T)`.
+   *
+   * \return
+   * Value.
+   */
+  template <typename T>
+  T Load(unsigned char const * & p) noexcept
+  {
+    T value;
+    std::memcpy(&value, p, sizeof(T));
+    p += sizeof(T);
+    return value;
+  }
+}
+
+/**
+ * \brief Constructor. The header of the binary format is written to the stream.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * Basic guarantee:
+ * - The header may have been written to the stream partially.
+ *
+ * __Thread cancellation safety:__\n
+ * Basic guarantee:
+ * - The header may have been written to the stream partially.
+ *
+ * - - -
+ *
+ * \param _writer
+ * Stream into which the binary log shall be written.\n
+ * The stream must be configured for little endian.\n
+ * The referenced object must not be accessed by anyone else and it must not be released while this object exists.
+ */
+Backend_Binary::Backend_Binary(gpcc::stream::IStreamWriter & _writer)
+: Backend()
+, writer(_writer)
+, srcNameIDs()
+, fmtStringIDs()
+{
+  if (writer.GetEndian() != gpcc::stream::IStreamWriter::Endian::Little)
+    throw std::invalid_argument("Backend_Binary::Backend_Binary: _writer must use little endian");
+
+  writer.Write_char(magic, sizeof(magic));
+  writer.Write_uint8(version);
+}
+
+/// \copydoc Backend::Process
+void Backend_Binary::Process(std::string const & msg, LogType const type)
+{
+  writer.Write_uint8(static_cast<uint8_t>(RecordTags::textMessage));
+  writer.Write_uint8(static_cast<uint8_t>(type));
+  writer.Write_string(msg);
+}
+
+/// \copydoc Backend::IsStructured
+bool Backend_Binary::IsStructured(void) const noexcept
+{
+  return true;
+}
+
+/// \copydoc Backend::ProcessRecord
+void Backend_Binary::ProcessRecord(LogRecord const & record)
+{
+  uint32_t const srcNameID = GetSrcNameID(*record.pSrcName);
+  uint32_t const fmtStringID = GetFmtStringID(record.pFmt);
+
+  writer.Write_uint8(static_cast<uint8_t>(RecordTags::message));
+  writer.Write_uint8(static_cast<uint8_t>(record.type));
+  writer.Write_uint32(srcNameID);
+
+  if (record.hasTimestamp)
+  {
+    writer.Write_uint8(1U);
+    writer.Write_int64(static_cast<int64_t>(record.timestamp.Get_sec()));
+    writer.Write_int32(record.timestamp.Get_nsec());
+  }
+  else
+  {
+    writer.Write_uint8(0U);
+  }
+
+  writer.Write_uint32(fmtStringID);
+  WriteArgs(record);
+}
+
+/**
+ * \brief Retrieves the ID of a source name. If the source name is used for the first time, then a new ID is
+ *        assigned and a definition record is written to the stream.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * The state of the object is modified. Any concurrent accesses are not safe.
+ *
+ * __Exception safety:__\n
+ * Basic guarantee:
+ * - The definition record may have been written to the stream partially. The ID will not be used.
+ *
+ * __Thread cancellation safety:__\n
+ * Basic guarantee:
+ * - The definition record may have been written to the stream partially. The ID will not be used.
+ *
+ * - - -
+ *
+ * \param srcName
+ * Source name.
+ *
+ * \return
+ * ID of the source name.
+ */
+uint32_t Backend_Binary::GetSrcNameID(std::string const & srcName)
+{
+  auto const it = srcNameIDs.find(srcName);
+  if (it != srcNameIDs.end())
+    return it->second;
+
+  if (srcNameIDs.size() >= std::numeric_limits<uint32_t>::max())
+    throw std::runtime_error("Backend_Binary::GetSrcNameID: No more IDs");
+
+  uint32_t const id = static_cast<uint32_t>(srcNameIDs.size());
+
+  writer.Write_uint8(static_cast<uint8_t>(RecordTags::srcNameDef));
+  writer.Write_uint32(id);
+  writer.Write_string(srcName);
+
+  srcNameIDs.emplace(srcName, id);
+  return id;
+}
+
+/**
+ * \brief Retrieves the ID of a format string. If the format string is used for the first time, then a new ID is
+ *        assigned and a definition record is written to the stream.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * The state of the object is modified. Any concurrent accesses are not safe.
+ *
+ * __Exception safety:__\n
+ * Basic guarantee:
+ * - The definition record may have been written to the stream partially. The ID will not be used.
+ *
+ * __Thread cancellation safety:__\n
+ * Basic guarantee:
+ * - The definition record may have been written to the stream partially. The ID will not be used.
+ *
+ * - - -
+ *
+ * \param pFmt
+ * Format string located in ROM/code memory.
+ *
+ * \return
+ * ID of the format string.
+ */
+uint32_t Backend_Binary::GetFmtStringID(char const * const pFmt)
+{
+  auto const it = fmtStringIDs.find(pFmt);
+  if (it != fmtStringIDs.end())
+    return it->second;
+
+  if (fmtStringIDs.size() >= std::numeric_limits<uint32_t>::max())
+    throw std::runtime_error("Backend_Binary::GetFmtStringID: No more IDs");
+
+  uint32_t const id = static_cast<uint32_t>(fmtStringIDs.size());
+
+  writer.Write_uint8(static_cast<uint8_t>(RecordTags::fmtStringDef));
+  writer.Write_uint32(id);
+  writer.Write_string(pFmt);
+
+  fmtStringIDs.emplace(pFmt, id);
+  return id;
+}
+
+/**
+ * \brief Writes the number of arguments and the arguments of a log message to the stream.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * The state of the object is modified. Any concurrent accesses are not safe.
+ *
+ * __Exception safety:__\n
+ * Basic guarantee:
+ * - The arguments may have been written to the stream partially.
+ *
+ * __Thread cancellation safety:__\n
+ * Basic guarantee:
+ * - The arguments may have been written to the stream partially.
+ *
+ * - - -
+ *
+ * \param record
+ * Log message whose arguments shall be written.
+ */
+void Backend_Binary::WriteArgs(LogRecord const & record)
+{
+  char const * const pSig = record.pArgs->GetTypeSignature();
+  unsigned char const * pData = record.pArgs->GetStorage();
+
+  writer.Write_uint8(static_cast<uint8_t>(strlen(pSig)));
+
+  for (char const * p = pSig; *p != 0; ++p)
+  {
+    switch (*p)
+    {
+      case 'c': writer.Write_uint8('c'); writer.Write_int8(Load<int8_t>(pData));    break;
+      case 'C': writer.Write_uint8('C'); writer.Write_uint8(Load<uint8_t>(pData));  break;
+      case 'h': writer.Write_uint8('h'); writer.Write_int16(Load<int16_t>(pData));  break;
+      case 'H': writer.Write_uint8('H'); writer.Write_uint16(Load<uint16_t>(pData)); break;
+      case 'i': writer.Write_uint8('i'); writer.Write_int32(Load<int32_t>(pData));  break;
+      case 'I': writer.Write_uint8('I'); writer.Write_uint32(Load<uint32_t>(pData)); break;
+      case 'l': writer.Write_uint8('l'); writer.Write_int64(Load<int64_t>(pData));  break;
+      case 'L': writer.Write_uint8('L'); writer.Write_uint64(Load<uint64_t>(pData)); break;
+
+      case 'f':
+        writer.Write_uint8('d');
+        writer.Write_double(static_cast<double>(Load<float>(pData)));
+        break;
+
+      case 'd':
+        writer.Write_uint8('d');
+        writer.Write_double(Load<double>(pData));
+        break;
+
+      case 'e':
+        writer.Write_uint8('d');
+        writer.Write_double(static_cast<double>(Load<long double>(pData)));
+        break;
+
+      case 's':
+      {
+        char const * const pStr = Load<char const *>(pData);
+        writer.Write_uint8('s');
+        writer.Write_string((pStr != nullptr) ? pStr : "(null)");
+        break;
+      }
+
+      case 'p':
+        writer.Write_uint8('p');
+        writer.Write_uint64(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(Load<void const *>(pData))));
+        break;
+
+      default:
+        throw std::logic_error("Backend_Binary::WriteArgs: Unknown type code");
+    }
+  }
+}
+
+} // namespace log
+} // namespace gpcc
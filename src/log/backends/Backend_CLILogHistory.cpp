@@ -14,11 +14,13 @@
 #include <gpcc/cli/Command.hpp>
 #include <gpcc/osal/MutexLocker.hpp>
 #include <gpcc/osal/Panic.hpp>
-#include <gpcc/raii/scope_guard.hpp>
 #include <gpcc/stream/IStreamWriter.hpp>
 #include <gpcc/string/tools.hpp>
+#include <algorithm>
+#include <limits>
 #include <stdexcept>
 #include <vector>
+#include <cstring>
 
 namespace gpcc {
 namespace log  {
@@ -26,6 +28,9 @@ namespace log  {
 /**
  * \brief Constructor.
  *
+ * The ring buffer for the recorded log messages is allocated by this. Its size is `maxTotalSize` plus a small header
+ * per log message for up to `_maxNbOfMessages` log messages.
+ *
  * \post  The CLI command "LogHistory" is registered at the given CLI (if any given via _pCLI).
  *
  * - - -
@@ -60,14 +65,20 @@ Backend_CLILogHistory::Backend_CLILogHistory(gpcc::cli::CLI* const _pCLI, uint16
 , mutex()
 , pCLI(_pCLI)
 , maxNbOfMessages(_maxNbOfMessages)
-, nbOfDroppedMessages(0U)
+, ringSize(maxTotalSize + (_maxNbOfMessages * headerSize))
+, spRing()
 , oldMessagesRemoved(false)
 , remainingStorage(maxTotalSize)
-, messages()
+, nbOfMessages(0U)
+, readPos(0U)
+, writePos(0U)
 {
-  if ((maxNbOfMessages == 0U) || (remainingStorage < 128U))
+  if ((maxNbOfMessages == 0U) || (remainingStorage < 128U) ||
+      (maxTotalSize > std::numeric_limits<size_t>::max() / 2U - (_maxNbOfMessages * headerSize)))
     throw std::invalid_argument("Backend_CLILogHistory::Backend_CLILogHistory: Invalid argument(s)");
 
+  spRing.reset(new char[ringSize]);
+
   if (pCLI != nullptr)
   {
     pCLI->AddCommand(gpcc::cli::Command::Create("LogHistory",
@@ -168,19 +179,28 @@ void Backend_CLILogHistory::Export(gpcc::stream::IStreamWriter& output, bool con
   if (oldMessagesRemoved)
     output.Write_line("Note: At least one old log message has been removed from the buffer.");
 
-  if (messages.empty())
+  if (nbOfMessages == 0U)
   {
     output.Write_line("Log history empty.");
   }
   else
   {
-    for (auto const & msg: messages)
-      output.Write_line(msg.second);
-  }
+    // The text is written directly from the ring buffer. A record may wrap around the end of the ring buffer.
+    size_t pos = readPos;
+    for (uint_fast16_t i = 0U; i < nbOfMessages; ++i)
+    {
+      LogType type;
+      size_t length;
+      pos = ReadHeader(pos, type, length);
 
+      size_t const firstPart = std::min(length, ringSize - pos);
+      output.Write_char(&spRing[pos], firstPart);
+      output.Write_char(&spRing[0], length - firstPart);
+      output.Write_char('\n');
 
-  if (nbOfDroppedMessages != 0U)
-    output.Write_line(BuildWarningForDroppedMessages());
+      pos = Wrap(pos + length);
+    }
+  }
 
   if (clearAfterExport)
     UnprotectedClear();
@@ -193,43 +213,34 @@ void Backend_CLILogHistory::Process(std::string const & msg, LogType const type)
 {
   gpcc::osal::MutexLocker mutexLocker(mutex);
 
-  // increment counter for dropped messages if anything goes wrong
-  ON_SCOPE_EXIT(incErrorCnt)
-  {
-    if (nbOfDroppedMessages != 255U)
-      nbOfDroppedMessages++;
-  };
-
   // remove oldest message if maximum allowed number of messages would be exceeded by recording the new message
-  if (messages.size() == maxNbOfMessages)
+  if (nbOfMessages == maxNbOfMessages)
     RemoveMessage();
 
   // remove old messages until "remainingStorage" is sufficient to record the new message
   RemoveMessages(msg.length());
 
-  // enough storage available?
-  if (remainingStorage >= msg.length())
+  // If the size of the message exceeds the maximum storage size configured at the constructor, then we trim the
+  // message and append "...".
+  bool const trim = (remainingStorage < msg.length());
+  size_t const length = trim ? remainingStorage : msg.length();
+
+  // Write the record. There is always enough space in the ring buffer for the header and the text.
+  uint8_t const typeByte = static_cast<uint8_t>(type);
+  WriteToRing(&typeByte, 1U);
+  WriteToRing(&length, sizeof(length));
+  if (trim)
   {
-    // yes, record the message
-    messages.emplace_back(type, msg);
-    remainingStorage -= msg.length();
+    WriteToRing(msg.data(), length - 3U);
+    WriteToRing("...", 3U);
   }
   else
   {
-    // No. The size of the message exceeds the maximum storage size configured at the constructor.
-    // We trim the message and append "...".
-    std::string trimmedMsg = msg.substr(0, remainingStorage - 3U) + "...";
-
-    // quick health check
-    if (remainingStorage != trimmedMsg.length())
-      PANIC();
-
-    messages.emplace_back(type, std::move(trimmedMsg));
-    remainingStorage = 0U;
+    WriteToRing(msg.data(), length);
   }
 
-  // success
-  ON_SCOPE_EXIT_DISMISS(incErrorCnt);
+  remainingStorage -= length;
+  ++nbOfMessages;
 }
 
 // --> Backend
@@ -250,10 +261,10 @@ void Backend_CLILogHistory::Process(std::string const & msg, LogType const type)
  */
 void Backend_CLILogHistory::UnprotectedClear(void) noexcept
 {
-  while (!messages.empty())
-    RemoveMessage();
-
-  nbOfDroppedMessages = 0U;
+  remainingStorage = ringSize - (maxNbOfMessages * headerSize);
+  nbOfMessages = 0U;
+  readPos = 0U;
+  writePos = 0U;
   oldMessagesRemoved = false;
 }
 
@@ -277,10 +288,15 @@ void Backend_CLILogHistory::UnprotectedClear(void) noexcept
  */
 void Backend_CLILogHistory::RemoveMessage(void) noexcept
 {
-  if (!messages.empty())
+  if (nbOfMessages != 0U)
   {
-    remainingStorage += messages.front().second.size();
-    messages.pop_front();
+    LogType type;
+    size_t length;
+    size_t const textPos = ReadHeader(readPos, type, length);
+
+    readPos = Wrap(textPos + length);
+    remainingStorage += length;
+    --nbOfMessages;
     oldMessagesRemoved = true;
   }
 }
@@ -315,14 +331,48 @@ void Backend_CLILogHistory::RemoveMessage(void) noexcept
  */
 void Backend_CLILogHistory::RemoveMessages(size_t const requiredRemainingStorage) noexcept
 {
-  while ((!messages.empty()) && (remainingStorage < requiredRemainingStorage))
+  while ((nbOfMessages != 0U) && (remainingStorage < requiredRemainingStorage))
     RemoveMessage();
 }
 
 /**
- * \brief Creates a std::string containing a warning about dropped messages.
+ * \brief Wraps a position that may exceed the end of the ring buffer around to the beginning of the ring buffer.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \param pos
+ * Position that shall be wrapped.\n
+ * Range: 0..(2 * @ref ringSize) - 1
+ *
+ * \return
+ * Wrapped position.\n
+ * Range: 0..@ref ringSize - 1
+ */
+size_t Backend_CLILogHistory::Wrap(size_t const pos) const noexcept
+{
+  if (pos >= ringSize)
+    return pos - ringSize;
+
+  return pos;
+}
+
+/**
+ * \brief Writes data into the ring buffer at @ref writePos and advances @ref writePos.
  *
- * Note: The created string makes no sense if @ref nbOfDroppedMessages is zero.
+ * The data may wrap around the end of the ring buffer.
+ *
+ * \pre   There is sufficient free space in the ring buffer.
  *
  * - - -
  *
@@ -330,33 +380,102 @@ void Backend_CLILogHistory::RemoveMessages(size_t const requiredRemainingStorage
  * @ref mutex must be locked.
  *
  * __Exception safety:__\n
- * Strong guarantee.
+ * No-throw guarantee.
  *
- * \throws std::bad_alloc   Out of memory.
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \param pData
+ * Pointer to the data that shall be written.
+ *
+ * \param n
+ * Number of bytes that shall be written.
+ */
+void Backend_CLILogHistory::WriteToRing(void const * const pData, size_t const n) noexcept
+{
+  size_t const firstPart = std::min(n, ringSize - writePos);
+  std::memcpy(&spRing[writePos], pData, firstPart);
+  std::memcpy(&spRing[0], static_cast<char const *>(pData) + firstPart, n - firstPart);
+
+  writePos = Wrap(writePos + n);
+}
+
+/**
+ * \brief Reads data from the ring buffer.
+ *
+ * The data may wrap around the end of the ring buffer.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * @ref mutex must be locked.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
  *
  * __Thread cancellation safety:__\n
  * No cancellation point included.
  *
  * - - -
  *
- * \return
- * String containing a warning about dropped messages.
+ * \param pos
+ * Position inside the ring buffer where reading shall start.
+ *
+ * \param pData
+ * Pointer to a buffer into which the data shall be written.
+ *
+ * \param n
+ * Number of bytes that shall be read.
  */
-std::string Backend_CLILogHistory::BuildWarningForDroppedMessages(void) const
+void Backend_CLILogHistory::ReadFromRing(size_t const pos, void * const pData, size_t const n) const noexcept
 {
-  std::string s("Warning: ");
-  if (nbOfDroppedMessages == 255U)
-    s += "At least 255";
-  else
-    s += std::to_string(static_cast<uint32_t>(nbOfDroppedMessages));
+  size_t const firstPart = std::min(n, ringSize - pos);
+  std::memcpy(pData, &spRing[pos], firstPart);
+  std::memcpy(static_cast<char*>(pData) + firstPart, &spRing[0], n - firstPart);
+}
 
-  s += " message(s) were not recorded due to errors! (e.g. out of memory)";
+/**
+ * \brief Reads the header of a record from the ring buffer.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * @ref mutex must be locked.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \param pos
+ * Position of the record inside the ring buffer.
+ *
+ * \param type
+ * The log type of the record is written into the referenced object.
+ *
+ * \param length
+ * The length of the text of the record is written into the referenced object.
+ *
+ * \return
+ * Position of the text of the record inside the ring buffer.
+ */
+size_t Backend_CLILogHistory::ReadHeader(size_t const pos, LogType & type, size_t & length) const noexcept
+{
+  uint8_t typeByte;
+  ReadFromRing(pos, &typeByte, 1U);
+  ReadFromRing(Wrap(pos + 1U), &length, sizeof(length));
+  type = static_cast<LogType>(typeByte);
 
-  return s;
+  return Wrap(pos + headerSize);
 }
 
 /**
- * \brief Prints a @ref tBufferItem to a CLI.
+ * \brief Prints a record from the ring buffer to a CLI.
  *
  * Output format (example):\n
  * History -n: [ERROR] SomeObj: Got an error
@@ -364,7 +483,7 @@ std::string Backend_CLILogHistory::BuildWarningForDroppedMessages(void) const
  * - - -
  *
  * __Thread safety:__\n
- * This is thread-safe.
+ * @ref mutex must be locked.
  *
  * __Exception safety:__\n
  * Basic guarantee:
@@ -382,43 +501,51 @@ std::string Backend_CLILogHistory::BuildWarningForDroppedMessages(void) const
  * Number of the history buffer item.\n
  * This is build into the output (see example above).
  *
- * \param item
- * Reference to the @ref tBufferItem that shall be printed.
+ * \param pos
+ * Position of the record inside the ring buffer.
  *
  * \param cli
- * Reference to the CLI to which the @ref tBufferItem shall be printed.
+ * Reference to the CLI to which the record shall be printed.
  */
-void Backend_CLILogHistory::PrintBufferItem(uint_fast16_t const n, tBufferItem const & item, gpcc::cli::CLI & cli)
+void Backend_CLILogHistory::PrintRecord(uint_fast16_t const n, size_t const pos, gpcc::cli::CLI & cli) const
 {
+  LogType type;
+  size_t length;
+  size_t const textPos = ReadHeader(pos, type, length);
+
+  // (the CLI requires a null-terminated string and the record may wrap around the end of the ring buffer)
+  std::string text(length, '\0');
+  ReadFromRing(textPos, &text[0], length);
+
   std::string const lineHead(CLI_BOLD_LIGHT_CYAN "History -" + std::to_string(n) + ": " CLI_STD);
 
   char const * fragments[4];
-  switch (item.first)
+  switch (type)
   {
     case LogType::Warning:
       fragments[0] = lineHead.c_str();
       fragments[1] = CLI_BOLD_YELLOW;
-      fragments[2] = item.second.c_str();
+      fragments[2] = text.c_str();
       fragments[3] = nullptr;
       break;
 
     case LogType::Error:
       fragments[0] = lineHead.c_str();
       fragments[1] = CLI_RED;
-      fragments[2] = item.second.c_str();
+      fragments[2] = text.c_str();
       fragments[3] = nullptr;
       break;
 
     case LogType::Fatal:
       fragments[0] = lineHead.c_str();
       fragments[1] = CLI_BOLD_LIGHT_RED;
-      fragments[2] = item.second.c_str();
+      fragments[2] = text.c_str();
       fragments[3] = nullptr;
       break;
 
     default:
       fragments[0] = lineHead.c_str();
-      fragments[1] = item.second.c_str();
+      fragments[1] = text.c_str();
       fragments[2] = nullptr;
       fragments[3] = nullptr; // (unused but makes compiler and code analyzers happy)
       break;
@@ -457,17 +584,8 @@ void Backend_CLILogHistory::CLICMD_LogHistory(std::string const & restOfLine, gp
 
   gpcc::osal::MutexLocker mutexLocker(mutex);
 
-#if 0
-  // Use this to generate a "dropped message" output message
-  if (restOfLine == "Test")
-  {
-    nbOfDroppedMessages++;
-    return;
-  }
-#endif
-
   // examine arguments and overwrite defaults for "n" and "clear" if any args are given
-  uint32_t n = messages.size();
+  uint32_t n = nbOfMessages;
   bool nEntered = false;
   bool nZeroEntered = false;
   bool clear = false;
@@ -484,8 +602,8 @@ void Backend_CLILogHistory::CLICMD_LogHistory(std::string const & restOfLine, gp
       if (n == 0U)
         nZeroEntered = true;
 
-      if (n > messages.size())
-        n = messages.size();
+      if (n > nbOfMessages)
+        n = nbOfMessages;
 
       ++it;
     }
@@ -524,9 +642,9 @@ void Backend_CLILogHistory::CLICMD_LogHistory(std::string const & restOfLine, gp
   if (n != 0U)
   {
     // Guarantee:
-    // n is equal to or less than messages.size() and messages,size() is equal to or less than maxNbOfMessages
+    // n is equal to or less than nbOfMessages and nbOfMessages is equal to or less than maxNbOfMessages
 
-    uint_fast16_t const skippedRecords = messages.size() - n;
+    uint_fast16_t const skippedRecords = nbOfMessages - n;
     if (skippedRecords == 0U)
     {
       if (oldMessagesRemoved)
@@ -537,23 +655,28 @@ void Backend_CLILogHistory::CLICMD_LogHistory(std::string const & restOfLine, gp
       cli.WriteLine(CLI_BOLD_LIGHT_CYAN "History: " CLI_STD "Skipping " + std::to_string(skippedRecords) + " record(s).");
     }
 
-    // We use a reverse iterator to iterate over the latest n recorded log messages.
-    // Note that it is safe and allowed to decrement the end/rend-iterator of std::list containters.
-    auto rev_it = messages.crbegin();
-    std::advance(rev_it, n);
+    // skip the oldest records
+    size_t pos = readPos;
+    for (uint_fast16_t i = 0U; i < skippedRecords; ++i)
+    {
+      LogType type;
+      size_t length;
+      pos = Wrap(ReadHeader(pos, type, length) + length);
+    }
 
+    // print the latest n records
     do
     {
       cli.TestTermination();
 
-      --rev_it;
-      PrintBufferItem(static_cast<uint_fast16_t>(n), *rev_it, cli);
+      PrintRecord(static_cast<uint_fast16_t>(n), pos, cli);
+
+      LogType type;
+      size_t length;
+      pos = Wrap(ReadHeader(pos, type, length) + length);
       n--;
     }
-    while (rev_it != messages.crbegin());
-
-    if (clear && (nbOfDroppedMessages != 0U))
-      cli.WriteLine(CLI_BOLD_YELLOW + BuildWarningForDroppedMessages());
+    while (n != 0U);
   }
   else if ((!nEntered) || ((nEntered) && (!nZeroEntered)))
   {
@@ -561,9 +684,6 @@ void Backend_CLILogHistory::CLICMD_LogHistory(std::string const & restOfLine, gp
     //    OR Buffer is empty and user entered "n" and user did not enter zero
 
     cli.WriteLine("Log history empty.");
-
-    if (clear && (nbOfDroppedMessages != 0U))
-      cli.WriteLine(CLI_BOLD_YELLOW + BuildWarningForDroppedMessages());
   }
   else
   {
@@ -578,10 +698,7 @@ void Backend_CLILogHistory::CLICMD_LogHistory(std::string const & restOfLine, gp
   }
   else
   {
-    if (nbOfDroppedMessages != 0U)
-      cli.WriteLine(CLI_BOLD_YELLOW + BuildWarningForDroppedMessages());
-
-    cli.WriteLine("Remaining capacity: " + std::to_string(maxNbOfMessages - messages.size()) + " entries or " +
+    cli.WriteLine("Remaining capacity: " + std::to_string(maxNbOfMessages - nbOfMessages) + " entries or " +
                    std::to_string(remainingStorage) + " bytes.");
   }
 }
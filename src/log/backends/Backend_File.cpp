@@ -0,0 +1,587 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#include <gpcc/log/backends/Backend_File.hpp>
+#include <gpcc/file_systems/IFileStorage.hpp>
+#include <gpcc/osal/AdvancedMutexLocker.hpp>
+#include <gpcc/osal/MutexLocker.hpp>
+#include <gpcc/osal/Panic.hpp>
+#include <gpcc/stream/IStreamWriter.hpp>
+#include <gpcc/time/TimePoint.hpp>
+#include <gpcc/time/TimeSpan.hpp>
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <list>
+#include <stdexcept>
+#include <cstdio>
+
+namespace gpcc {
+namespace log  {
+
+/**
+ * \brief Constructor.
+ *
+ * The back-end's thread is not started. Use @ref Start() to start it. Log messages passed to @ref Process() before
+ * the back-end's thread is started are buffered (as far as the buffers allow) and written after the back-end has been
+ * started.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param _fs
+ * File storage where the log files shall be located.\n
+ * The referenced object must not be released before this object is released.
+ *
+ * \param _baseName
+ * Name of the current log file. Older log files will have ".1", ".2", ... appended.\n
+ * The name must be a valid file name for `_fs`.
+ *
+ * \param _bufferSize
+ * Size of each of the two buffers in bytes.\n
+ * Minimum value: 64
+ *
+ * \param _flushInterval_ms
+ * Interval in ms after which buffered log messages are written to the file latest.\n
+ * Zero is not allowed.
+ *
+ * \param _maxFileSize
+ * Maximum size of a log file in bytes. If writing a chunk of log messages would let the current log file exceed this
+ * size, then the log files are rotated before the chunk is written.\n
+ * A log file may exceed this size if a single chunk of log messages (plus a note about dropped log messages) is
+ * larger than this. This must not be less than `_bufferSize`.
+ *
+ * \param _maxNbOfFiles
+ * Maximum number of log files (current log file plus older log files).\n
+ * Minimum value: 1
+ *
+ * \param pThreadName
+ * Pointer to a null-terminated c-string with the name that shall be assigned to the back-end's thread.
+ */
+Backend_File::Backend_File(gpcc::file_systems::IFileStorage & _fs,
+                           std::string const & _baseName,
+                           size_t const _bufferSize,
+                           uint32_t const _flushInterval_ms,
+                           size_t const _maxFileSize,
+                           uint8_t const _maxNbOfFiles,
+                           char const * const pThreadName)
+: Backend()
+, fs(_fs)
+, baseName(_baseName)
+, bufferSize(_bufferSize)
+, flushInterval_ms(_flushInterval_ms)
+, maxFileSize(_maxFileSize)
+, maxNbOfFiles(_maxNbOfFiles)
+, mutex()
+, workCV()
+, writtenCV()
+, running(false)
+, activeBuffer()
+, activeBufferNbOfMsgs(0U)
+, writeBuffer()
+, writeBufferNbOfMsgs(0U)
+, writeBufferDroppedMsgs(0U)
+, flushRequested(false)
+, droppedMessages(0U)
+, nbOfSwaps(0U)
+, nbOfWrittenChunks(0U)
+, spFile()
+, currentFileSize(0U)
+, thread(pThreadName)
+{
+  if ((_baseName.empty()) || (_bufferSize < 64U) || (_flushInterval_ms == 0U) || (_maxFileSize < _bufferSize) ||
+      (_maxNbOfFiles == 0U))
+    throw std::invalid_argument("Backend_File::Backend_File: Invalid args");
+
+  activeBuffer.reserve(_bufferSize);
+  writeBuffer.reserve(_bufferSize);
+}
+
+/**
+ * \brief Destructor.
+ *
+ * Log messages which have not been written to the file yet are discarded.
+ *
+ * \pre   The back-end's thread is not running.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ */
+Backend_File::~Backend_File(void)
+{
+  gpcc::osal::MutexLocker mutexLocker(mutex);
+  if (running)
+    gpcc::osal::Panic("Backend_File::~Backend_File: Still running");
+}
+
+/**
+ * \brief Starts the back-end's thread.
+ *
+ * The existing log files are rotated and a new log file is created by the back-end's thread.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe, but it must not be invoked concurrently with @ref Stop().
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Strong guarantee.
+ *
+ * - - -
+ *
+ * \param schedPolicy
+ * Scheduling policy that shall be used for the back-end's thread.\n
+ * See @ref gpcc::osal::Thread::Start() for details.
+ *
+ * \param priority
+ * Priority level (0 (low) .. 31 (high)) that shall be used for the back-end's thread.\n
+ * This is only relevant for the scheduling policies `SchedPolicy::Fifo` and `SchedPolicy::RR`.\n
+ * _For the other scheduling policies this must be zero._\n
+ * See @ref gpcc::osal::Thread::Start() for details.
+ *
+ * \param stackSize
+ * Size of the stack in byte that shall be allocated for the back-end's thread.\n
+ * _This must be a multiple of_ @ref gpcc::osal::Thread::GetStackAlign(). \n
+ * _This must be equal to or larger than_ @ref gpcc::osal::Thread::GetMinStackSize(). \n
+ * See @ref gpcc::osal::Thread::Start() for details.
+ */
+void Backend_File::Start(gpcc::osal::Thread::SchedPolicy const schedPolicy,
+                         gpcc::osal::Thread::priority_t const priority,
+                         size_t const stackSize)
+{
+  gpcc::osal::MutexLocker mutexLocker(mutex);
+
+  if (running)
+    throw std::logic_error("Backend_File::Start: Already running");
+
+  thread.Start(std::bind(&Backend_File::InternalThreadEntry, this), schedPolicy, priority, stackSize);
+  running = true;
+}
+
+/**
+ * \brief Stops the back-end's thread and blocks until it has terminated.
+ *
+ * Before the back-end's thread terminates, all buffered log messages are written to the file and the file is closed.
+ *
+ * If the back-end's thread is not running, then this method has no effect.
+ *
+ * After this has returned, it is safe to restart the back-end via @ref Start().
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe, but it must not be invoked concurrently with @ref Start() or @ref Stop().
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Deferred cancellation is not allowed.
+ */
+void Backend_File::Stop(void) noexcept
+{
+  {
+    gpcc::osal::MutexLocker mutexLocker(mutex);
+
+    if (!running)
+      return;
+
+    thread.Cancel();
+    workCV.Signal();
+  }
+
+  (void)thread.Join();
+
+  gpcc::osal::MutexLocker mutexLocker(mutex);
+  running = false;
+}
+
+/**
+ * \brief Blocks the calling thread until all log messages passed to @ref Process() before have been written to the
+ *        file.
+ *
+ * Note that the file is not closed. Data may still be buffered by the file system.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, but the log messages may not have been written yet if the calling thread is cancelled.
+ */
+void Backend_File::Flush(void)
+{
+  gpcc::osal::MutexLocker mutexLocker(mutex);
+
+  if (!running)
+    throw std::logic_error("Backend_File::Flush: Not running");
+
+  uint64_t target = nbOfSwaps;
+  if (!activeBuffer.empty())
+  {
+    ++target;
+    flushRequested = true;
+    workCV.Signal();
+  }
+
+  while (nbOfWrittenChunks < target)
+    writtenCV.Wait(mutex);
+}
+
+/// \copydoc Backend::Process
+void Backend_File::Process(std::string const & msg, LogType const type)
+{
+  (void)type;
+
+  size_t const length = std::min(msg.size(), bufferSize - 1U);
+
+  gpcc::osal::MutexLocker mutexLocker(mutex);
+
+  if (activeBuffer.size() + length + 1U > bufferSize)
+  {
+    // The back-end's thread is still busy? Then drop the message. We never block the log facility here.
+    if (nbOfWrittenChunks != nbOfSwaps)
+    {
+      if (droppedMessages != std::numeric_limits<decltype(droppedMessages)>::max())
+        ++droppedMessages;
+      return;
+    }
+
+    SwapBuffers();
+    workCV.Signal();
+  }
+
+  // (no allocation, capacity has been reserved by the constructor)
+  activeBuffer.append(msg, 0U, length);
+  activeBuffer.push_back('\n');
+  ++activeBufferNbOfMsgs;
+}
+
+/**
+ * \brief Swaps the active buffer and the buffer that is written to the file by the back-end's thread.
+ *
+ * \pre   @ref mutex is locked.
+ *
+ * \pre   The back-end's thread has finished writing the content of @ref writeBuffer
+ *        (@ref nbOfWrittenChunks equals @ref nbOfSwaps).
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * @ref mutex must be locked.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ */
+void Backend_File::SwapBuffers(void) noexcept
+{
+  activeBuffer.swap(writeBuffer);
+
+  writeBufferNbOfMsgs = activeBufferNbOfMsgs;
+  activeBufferNbOfMsgs = 0U;
+
+  writeBufferDroppedMsgs = droppedMessages;
+  droppedMessages = 0U;
+
+  flushRequested = false;
+  ++nbOfSwaps;
+}
+
+/**
+ * \brief Writes the content of @ref writeBuffer and a note about dropped log messages (if any) to the current log
+ *        file.
+ *
+ * If there is no open log file, or if the current log file would exceed the maximum file size, then the log files are
+ * rotated and a new log file is created before the chunk is written.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This must be invoked by the back-end's thread only. @ref mutex must not be locked.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.\n
+ * Errors related to the file system are caught by this method.
+ *
+ * __Thread cancellation safety:__\n
+ * Cancellation must be disabled.
+ *
+ * - - -
+ *
+ * \return
+ * Number of log messages which have been lost due to an error.
+ */
+uint32_t Backend_File::WriteChunk(void)
+{
+  char note[64];
+  int noteLength = 0;
+  if (writeBufferDroppedMsgs != 0U)
+  {
+    noteLength = snprintf(note, sizeof(note), "*** Backend_File: %lu message(s) dropped ***\n",
+                          static_cast<unsigned long>(writeBufferDroppedMsgs));
+    if (noteLength < 0)
+      noteLength = 0;
+    else if (static_cast<size_t>(noteLength) >= sizeof(note))
+      noteLength = sizeof(note) - 1U;
+  }
+
+  size_t const chunkSize = writeBuffer.size() + static_cast<size_t>(noteLength);
+
+  try
+  {
+    if ((spFile) && (currentFileSize != 0U) && (currentFileSize + chunkSize > maxFileSize))
+      CloseFile();
+
+    if (!spFile)
+      OpenNewFile();
+
+    spFile->Write_char(writeBuffer.data(), writeBuffer.size());
+    spFile->Write_char(note, static_cast<size_t>(noteLength));
+    currentFileSize += chunkSize;
+  }
+  catch (std::exception const &)
+  {
+    // A new log file will be created upon the next write attempt.
+    CloseFile();
+
+    uint32_t const maxLost = std::numeric_limits<uint32_t>::max();
+    if (writeBufferNbOfMsgs > maxLost - writeBufferDroppedMsgs)
+      return maxLost;
+    return writeBufferNbOfMsgs + writeBufferDroppedMsgs;
+  }
+
+  return 0U;
+}
+
+/**
+ * \brief Rotates the log files and creates a new current log file.
+ *
+ * \pre   There is no open log file (@ref spFile is nullptr).
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This must be invoked by the back-end's thread only.
+ *
+ * __Exception safety:__\n
+ * Basic guarantee:
+ * - Some log files may have been rotated already.
+ *
+ * __Thread cancellation safety:__\n
+ * Cancellation must be disabled.
+ */
+void Backend_File::OpenNewFile(void)
+{
+  std::list<std::string> const files = fs.Enumerate();
+  auto exists = [&files](std::string const & name) -> bool
+  {
+    return (std::find(files.begin(), files.end(), name) != files.end());
+  };
+
+  // delete the oldest log file, if the maximum number of log files is reached
+  std::string const oldest = BuildFileName(maxNbOfFiles - 1U);
+  if (exists(oldest))
+    fs.Delete(oldest);
+
+  // rename the other log files (oldest first)
+  for (uint_fast8_t i = maxNbOfFiles - 1U; i != 0U; --i)
+  {
+    std::string const currName = BuildFileName(i - 1U);
+    if (exists(currName))
+      fs.Rename(currName, BuildFileName(i));
+  }
+
+  spFile = fs.Create(baseName, true);
+  currentFileSize = 0U;
+}
+
+/**
+ * \brief Closes the current log file (if any).
+ *
+ * Errors are ignored.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This must be invoked by the back-end's thread only.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Cancellation must be disabled.
+ */
+void Backend_File::CloseFile(void) noexcept
+{
+  if (!spFile)
+    return;
+
+  try
+  {
+    spFile->Close();
+  }
+  catch (std::exception const &)
+  {
+    // The stream is closed, even if an error has occurred. There is nothing more we can do.
+  }
+
+  spFile.reset();
+}
+
+/**
+ * \brief Builds the name of a log file.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \param index
+ * Index of the log file. Zero refers to the current log file, larger values refer to older log files.
+ *
+ * \return
+ * Name of the log file.
+ */
+std::string Backend_File::BuildFileName(uint_fast8_t const index) const
+{
+  if (index == 0U)
+    return baseName;
+
+  return baseName + "." + std::to_string(static_cast<unsigned int>(index));
+}
+
+/**
+ * \brief Entry function for the back-end's thread.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is executed by @ref thread only.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Cancellation is disabled by this method. Cancellation requests are recognized and processed.
+ *
+ * - - -
+ *
+ * \return
+ * Always nullptr.
+ */
+void* Backend_File::InternalThreadEntry(void) noexcept
+{
+  using gpcc::time::TimePoint;
+  using gpcc::time::TimeSpan;
+
+  try
+  {
+    (void)thread.SetCancelabilityEnabled(false);
+
+    try
+    {
+      OpenNewFile();
+    }
+    catch (std::exception const &)
+    {
+      // Creating the log file will be retried upon the first write.
+      CloseFile();
+    }
+
+    gpcc::osal::AdvancedMutexLocker mutexLocker(mutex);
+
+    TimePoint nextFlush = TimePoint::FromSystemClock(gpcc::osal::ConditionVariable::clockID) +
+                          TimeSpan::ms(flushInterval_ms);
+
+    while (true)
+    {
+      if (nbOfWrittenChunks == nbOfSwaps)
+      {
+        // nothing to write, check if the active buffer shall be written
+        bool const stop = thread.IsCancellationPending();
+
+        TimePoint const now = TimePoint::FromSystemClock(gpcc::osal::ConditionVariable::clockID);
+        bool const intervalExpired = (now >= nextFlush);
+        if (intervalExpired)
+          nextFlush = now + TimeSpan::ms(flushInterval_ms);
+
+        if ((!activeBuffer.empty()) && ((stop) || (flushRequested) || (intervalExpired)))
+        {
+          SwapBuffers();
+        }
+        else
+        {
+          if (stop)
+            break;
+
+          (void)workCV.TimeLimitedWait(mutex, nextFlush);
+          continue;
+        }
+      }
+
+      // write without mutex locked
+      mutexLocker.Unlock();
+      uint32_t const lost = WriteChunk();
+      writeBuffer.clear();
+      mutexLocker.Relock();
+
+      if (droppedMessages > std::numeric_limits<uint32_t>::max() - lost)
+        droppedMessages = std::numeric_limits<uint32_t>::max();
+      else
+        droppedMessages += lost;
+
+      ++nbOfWrittenChunks;
+      writtenCV.Broadcast();
+    }
+
+    mutexLocker.Unlock();
+    CloseFile();
+  }
+  catch (...)
+  {
+    // note: cancelability is disabled, so catch (...) will not interfere with deferred thread cancellation
+    PANIC();
+  }
+
+  return nullptr;
+}
+
+} // namespace log
+} // namespace gpcc
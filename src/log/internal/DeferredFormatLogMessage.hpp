@@ -0,0 +1,66 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#ifndef DEFERREDFORMATLOGMESSAGE_HPP_202610161000
+#define DEFERREDFORMATLOGMESSAGE_HPP_202610161000
+
+#include "LogMessage.hpp"
+#include <gpcc/log/DeferredFormatArgs.hpp>
+
+namespace gpcc     {
+namespace log      {
+namespace internal {
+
+/**
+ * \ingroup GPCC_LOG_INTERNAL
+ * \class DeferredFormatLogMessage DeferredFormatLogMessage.hpp "src/log/internal/DeferredFormatLogMessage.hpp"
+ * \brief Container for the ingredients of a log message composed of a printf-style format string located in
+ *        ROM/code memory and the raw values of the arguments.
+ *
+ * The log message text is formatted by @ref BuildText(), which is executed by the log facility.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * Not thread safe, but non-modifying concurrent access is safe.
+ */
+class DeferredFormatLogMessage final : public LogMessage
+{
+  public:
+    DeferredFormatLogMessage(void) = delete;
+    DeferredFormatLogMessage(string::SharedString const & _srcName,
+                             LogType const _type,
+                             char const * const _pFmt,
+                             DeferredFormatArgs const & _args);
+    DeferredFormatLogMessage(DeferredFormatLogMessage const &) = delete;
+    DeferredFormatLogMessage(DeferredFormatLogMessage &&) = delete;
+    ~DeferredFormatLogMessage(void) override = default;
+
+    DeferredFormatLogMessage& operator=(DeferredFormatLogMessage const &) = delete;
+    DeferredFormatLogMessage& operator=(DeferredFormatLogMessage &&) = delete;
+
+
+    std::string BuildText(void) const override;
+    bool GetRecord(LogRecord & record) const noexcept override;
+
+  private:
+    /// Format string.
+    /** This points to a null-terminated c-string located in ROM/code memory. */
+    char const * const pFmt;
+
+    /// Values of the arguments.
+    DeferredFormatArgs const args;
+};
+
+} // namespace internal
+} // namespace log
+} // namespace gpcc
+
+#endif // DEFERREDFORMATLOGMESSAGE_HPP_202610161000
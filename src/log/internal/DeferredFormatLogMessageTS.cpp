@@ -0,0 +1,97 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#include "DeferredFormatLogMessageTS.hpp"
+#include <gpcc/log/backends/LogRecord.hpp>
+#include <gpcc/string/tools.hpp>
+#include <stdexcept>
+#include <cstring>
+
+namespace gpcc     {
+namespace log      {
+namespace internal {
+
+/**
+ * \brief Constructor.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \param _srcName
+ * Name of the source of the log message.
+ *
+ * \param _type
+ * Type of log message.
+ *
+ * \param _pFmt
+ * Pointer to a null-terminated c-string containing the log message text and printf-style conversion specifications.\n
+ * The referenced c-string must be located in ROM/code memory and must not change.\n
+ * nullptr is not allowed.
+ *
+ * \param _args
+ * Values of the arguments. The number and types of the arguments must match the conversion specifications embedded
+ * in `_pFmt`.
+ */
+DeferredFormatLogMessageTS::DeferredFormatLogMessageTS(string::SharedString const & _srcName,
+                                                       LogType const _type,
+                                                       char const * const _pFmt,
+                                                       DeferredFormatArgs const & _args)
+: LogMessage(_srcName, _type)
+, pFmt(_pFmt)
+, args(_args)
+, timestamp(gpcc::time::TimePoint::FromSystemClock(gpcc::time::Clocks::realtimeCoarse))
+{
+  if (pFmt == nullptr)
+    throw std::invalid_argument("DeferredFormatLogMessageTS::DeferredFormatLogMessageTS: !_pFmt");
+}
+
+/// \copydoc LogMessage::BuildText
+std::string DeferredFormatLogMessageTS::BuildText(void) const
+{
+  auto const spText = args.Format(pFmt);
+
+  std::string s;
+  s.reserve(logMsgHeaderLength + 1U + srcName.GetStr().size() + 3U + gpcc::time::TimePoint::stringLength + 2U + strlen(spText.get()));
+
+  s = LogType2LogMsgHeader(static_cast<LogType>(type));
+  s += ' ';
+  s += srcName.GetStr();
+  s += ": (";
+  s += timestamp.ToString();
+  s += ") ";
+  s += spText.get();
+
+  string::InsertIndention(s, logMsgHeaderLength + 1U);
+
+  return s;
+}
+
+/// \copydoc LogMessage::GetRecord
+bool DeferredFormatLogMessageTS::GetRecord(LogRecord & record) const noexcept
+{
+  record.pSrcName     = &srcName.GetStr();
+  record.type         = static_cast<LogType>(type);
+  record.hasTimestamp = true;
+  record.timestamp    = timestamp;
+  record.pFmt         = pFmt;
+  record.pArgs        = &args;
+  return true;
+}
+
+} // namespace internal
+} // namespace log
+} // namespace gpcc
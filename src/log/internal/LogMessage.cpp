@@ -40,6 +40,37 @@ LogMessage::LogMessage(string::SharedString const & _srcName, LogType const _typ
 {
 };
 
+/**
+ * \brief Retrieves the unformatted ingredients of the log message, if available.
+ *
+ * The default implementation returns false.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * The state of the object is not modified. Concurrent accesses are safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \param record
+ * The ingredients are written into the referenced object, if this returns true.\n
+ * The pointers inside the @ref LogRecord refer to this object and are valid until this object is released.
+ *
+ * \retval true   Success. `record` has been written.
+ * \retval false  The log message is not available in unformatted form. `record` has not been modified.
+ */
+bool LogMessage::GetRecord(LogRecord & record) const noexcept
+{
+  (void)record;
+  return false;
+}
+
 } // namespace internal
 } // namespace log
 } // namespace gpcc
@@ -20,6 +20,7 @@ namespace gpcc {
 namespace log  {
 
 class ThreadedLogFacility;
+struct LogRecord;
 
 namespace internal {
 
@@ -53,6 +54,9 @@ namespace internal {
  *
  * To build the log message string from the ingredients, log facilities shall invoke @ref BuildText().
  *
+ * Sub-classes whose ingredients are a format string plus raw argument values may in addition offer their ingredients
+ * via @ref GetRecord(). Log facilities use this to pass log messages to structured back-ends without formatting.
+ *
  * - - -
  *
  * __Thread safety:__\n
@@ -74,6 +78,7 @@ class LogMessage
 
     LogType GetLogType(void) const noexcept;
     virtual std::string BuildText(void) const = 0;
+    virtual bool GetRecord(LogRecord & record) const noexcept;
 
   protected:
     /// Name of the source of the log message.
@@ -0,0 +1,423 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#include "LogStagingBuffer.hpp"
+#include "LogMessage.hpp"
+#include <limits>
+#include <stdexcept>
+
+namespace gpcc     {
+namespace log      {
+namespace internal {
+
+/**
+ * \brief Constructor.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \param _nbOfSlots
+ * Number of slots. This must be a power of two.
+ *
+ * \param _capacity
+ * Maximum number of slots that can be occupied by log messages which are not @ref LogType::Error or
+ * @ref LogType::Fatal.\n
+ * Range: 1.._nbOfSlots
+ */
+LogStagingBuffer::LogStagingBuffer(size_t const _nbOfSlots, size_t const _capacity)
+: mask(_nbOfSlots - 1U)
+, capacity(_capacity)
+, spSlots()
+, writePos(0U)
+, readPos(0U)
+, drainEnd(0U)
+, dropped(0U)
+, producerTerminated(false)
+, consumerReleased(false)
+{
+  if ((_nbOfSlots == 0U) || ((_nbOfSlots & mask) != 0U) || (_capacity == 0U) || (_capacity > _nbOfSlots))
+    throw std::invalid_argument("LogStagingBuffer::LogStagingBuffer: Invalid args");
+
+  spSlots.reset(new Slot[_nbOfSlots]);
+}
+
+/**
+ * \brief Destructor. Log messages that are still contained in the buffer are released.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ */
+LogStagingBuffer::~LogStagingBuffer(void)
+{
+  size_t const end = writePos.load(std::memory_order_acquire);
+  for (size_t pos = readPos.load(std::memory_order_relaxed); pos != end; ++pos)
+    delete spSlots[pos & mask].pMsg;
+}
+
+/**
+ * \brief Adds a log message to the buffer.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * Producer only.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \param pMsg
+ * Pointer to the log message.\n
+ * If this returns true, then ownership moves to the buffer.
+ *
+ * \param timestamp
+ * Timestamp of the log message.\n
+ * The timestamps of subsequent log messages must not decrease.
+ *
+ * \param wentNonEmpty
+ * Only written if this returns true.\n
+ * true = The buffer was empty. This is evaluated after a full memory barrier following publication of the log
+ * message.\n
+ * false = The buffer was not empty.
+ *
+ * \retval true   Success.
+ * \retval false  The buffer is full. Ownership remains at the caller.
+ */
+bool LogStagingBuffer::Push(LogMessage* const pMsg, gpcc::time::TimePoint const & timestamp, bool & wentNonEmpty) noexcept
+{
+  LogType const type = pMsg->GetLogType();
+  size_t const limit = ((type == LogType::Error) || (type == LogType::Fatal)) ? (mask + 1U) : capacity;
+
+  size_t const wp = writePos.load(std::memory_order_relaxed);
+  if ((wp - readPos.load(std::memory_order_acquire)) >= limit)
+    return false;
+
+  Slot & slot = spSlots[wp & mask];
+  slot.timestamp = timestamp;
+  slot.pMsg = pMsg;
+  writePos.store(wp + 1U, std::memory_order_release);
+
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  wentNonEmpty = (readPos.load(std::memory_order_relaxed) == wp);
+
+  return true;
+}
+
+/**
+ * \brief Increments the number of dropped log messages and stops at the maximum value to prevent overflow.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * Producer only.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \retval true   The number of dropped log messages was zero before.
+ * \retval false  The number of dropped log messages was not zero before.
+ */
+bool LogStagingBuffer::IncDropped(void) noexcept
+{
+  uint8_t d = dropped.load(std::memory_order_relaxed);
+  do
+  {
+    if (d == std::numeric_limits<uint8_t>::max())
+      return false;
+  }
+  while (!dropped.compare_exchange_weak(d, d + 1U, std::memory_order_relaxed, std::memory_order_relaxed));
+
+  return (d == 0U);
+}
+
+/**
+ * \brief Marks that the producer thread has terminated and will not access the buffer any more.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * Producer only.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ */
+void LogStagingBuffer::MarkProducerTerminated(void) noexcept
+{
+  producerTerminated.store(true, std::memory_order_release);
+}
+
+/**
+ * \brief Queries if the consumer has released the buffer.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * Producer only.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \retval true   The consumer has released the buffer. The producer shall not push any more log messages.
+ * \retval false  The consumer has not released the buffer yet.
+ */
+bool LogStagingBuffer::IsConsumerReleased(void) const noexcept
+{
+  return consumerReleased.load(std::memory_order_acquire);
+}
+
+/**
+ * \brief Starts a drain cycle.
+ *
+ * All log messages pushed before this call can be removed via @ref Pop() while @ref IsDrainPending() returns true.
+ * Log messages pushed after this call are not part of the drain cycle.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * Consumer only.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ */
+void LogStagingBuffer::BeginDrain(void) noexcept
+{
+  drainEnd = writePos.load(std::memory_order_acquire);
+}
+
+/**
+ * \brief Queries if there is at least one log message left in the current drain cycle.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * Consumer only.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \retval true   There is at least one log message left in the current drain cycle.
+ * \retval false  The current drain cycle is complete.
+ */
+bool LogStagingBuffer::IsDrainPending(void) const noexcept
+{
+  return (readPos.load(std::memory_order_relaxed) != drainEnd);
+}
+
+/**
+ * \brief Retrieves the timestamp of the next log message of the current drain cycle.
+ *
+ * \pre   @ref IsDrainPending() returns true.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * Consumer only.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \return
+ * Unmodifiable reference to the timestamp.\n
+ * The reference is valid until @ref Pop() is invoked.
+ */
+gpcc::time::TimePoint const & LogStagingBuffer::FrontTimestamp(void) const noexcept
+{
+  return spSlots[readPos.load(std::memory_order_relaxed) & mask].timestamp;
+}
+
+/**
+ * \brief Removes the next log message of the current drain cycle from the buffer.
+ *
+ * \pre   @ref IsDrainPending() returns true.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * Consumer only.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \return
+ * Pointer to the log message. Ownership moves to the caller.
+ */
+LogMessage* LogStagingBuffer::Pop(void) noexcept
+{
+  size_t const rp = readPos.load(std::memory_order_relaxed);
+  LogMessage* const pMsg = spSlots[rp & mask].pMsg;
+  readPos.store(rp + 1U, std::memory_order_release);
+  return pMsg;
+}
+
+/**
+ * \brief Queries if the buffer is empty.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * Consumer only.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \retval true   The buffer is empty.
+ * \retval false  The buffer contains at least one log message.
+ */
+bool LogStagingBuffer::IsEmpty(void) const noexcept
+{
+  return (writePos.load(std::memory_order_acquire) == readPos.load(std::memory_order_relaxed));
+}
+
+/**
+ * \brief Queries if any log message has been dropped since the last call to @ref FetchDropped().
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * Consumer only.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \retval true   At least one log message has been dropped.
+ * \retval false  No log message has been dropped.
+ */
+bool LogStagingBuffer::HasDropped(void) const noexcept
+{
+  return (dropped.load(std::memory_order_relaxed) != 0U);
+}
+
+/**
+ * \brief Retrieves and clears the number of dropped log messages.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * Consumer only.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \return
+ * Number of log messages dropped since the last call to this. The value saturates at 255.
+ */
+uint8_t LogStagingBuffer::FetchDropped(void) noexcept
+{
+  return dropped.exchange(0U, std::memory_order_relaxed);
+}
+
+/**
+ * \brief Queries if the producer thread has terminated.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * Consumer only.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \retval true   The producer thread has terminated. If the buffer is empty, then it can be released.
+ * \retval false  The producer thread has not terminated yet.
+ */
+bool LogStagingBuffer::IsProducerTerminated(void) const noexcept
+{
+  return producerTerminated.load(std::memory_order_acquire);
+}
+
+/**
+ * \brief Marks that the consumer has released the buffer and will not access the buffer any more.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * Consumer only.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ */
+void LogStagingBuffer::MarkConsumerReleased(void) noexcept
+{
+  consumerReleased.store(true, std::memory_order_release);
+}
+
+} // namespace internal
+} // namespace log
+} // namespace gpcc
@@ -0,0 +1,128 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#ifndef LOGSTAGINGBUFFER_HPP_202610161730
+#define LOGSTAGINGBUFFER_HPP_202610161730
+
+#include <gpcc/time/TimePoint.hpp>
+#include <atomic>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+
+namespace gpcc {
+namespace log  {
+namespace internal {
+
+class LogMessage;
+
+/**
+ * \ingroup GPCC_LOG_INTERNAL
+ * \brief Single-producer single-consumer staging buffer for log messages of one thread.
+ *
+ * Used by @ref ThreadedLogFacility in mode
+ * [IntakeMode::perThreadBuffers](@ref ThreadedLogFacility::IntakeMode::perThreadBuffers).
+ *
+ * Each entry contains a pointer to a log message and a timestamp that is used by the consumer to merge the contents
+ * of multiple staging buffers in timestamp order. The buffer has a fixed number of slots. Messages of type
+ * @ref LogType::Error and @ref LogType::Fatal may occupy all slots. Messages of any other type may only occupy up to
+ * `capacity` slots. Messages that do not fit into the buffer are counted as dropped messages.
+ *
+ * Producer side:
+ * - @ref Push()
+ * - @ref IncDropped()
+ * - @ref MarkProducerTerminated()
+ * - @ref IsConsumerReleased()
+ *
+ * Consumer side:
+ * - @ref BeginDrain(), @ref IsDrainPending(), @ref FrontTimestamp(), @ref Pop()
+ * - @ref IsEmpty(), @ref HasDropped(), @ref FetchDropped()
+ * - @ref IsProducerTerminated()
+ * - @ref MarkConsumerReleased()
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * There must be no more than one producer thread and one consumer thread at any time.
+ */
+class LogStagingBuffer final
+{
+  public:
+    LogStagingBuffer(void) = delete;
+    LogStagingBuffer(size_t const _nbOfSlots, size_t const _capacity);
+    LogStagingBuffer(LogStagingBuffer const &) = delete;
+    LogStagingBuffer(LogStagingBuffer &&) = delete;
+    ~LogStagingBuffer(void);
+
+    LogStagingBuffer& operator=(LogStagingBuffer const &) = delete;
+    LogStagingBuffer& operator=(LogStagingBuffer &&) = delete;
+
+    // producer
+    bool Push(LogMessage* const pMsg, gpcc::time::TimePoint const & timestamp, bool & wentNonEmpty) noexcept;
+    bool IncDropped(void) noexcept;
+    void MarkProducerTerminated(void) noexcept;
+    bool IsConsumerReleased(void) const noexcept;
+
+    // consumer
+    void BeginDrain(void) noexcept;
+    bool IsDrainPending(void) const noexcept;
+    gpcc::time::TimePoint const & FrontTimestamp(void) const noexcept;
+    LogMessage* Pop(void) noexcept;
+    bool IsEmpty(void) const noexcept;
+    bool HasDropped(void) const noexcept;
+    uint8_t FetchDropped(void) noexcept;
+    bool IsProducerTerminated(void) const noexcept;
+    void MarkConsumerReleased(void) noexcept;
+
+  private:
+    /// One slot of the buffer.
+    struct Slot
+    {
+      /// Timestamp of the log message.
+      gpcc::time::TimePoint timestamp;
+
+      /// Log message.
+      LogMessage* pMsg;
+    };
+
+    /// Number of slots minus one. The number of slots is a power of two.
+    size_t const mask;
+
+    /// Maximum number of slots that can be occupied by log messages which are not @ref LogType::Error or
+    /// @ref LogType::Fatal.
+    size_t const capacity;
+
+    /// Slots.
+    std::unique_ptr<Slot[]> spSlots;
+
+    /// Next position that will be written by the producer.
+    std::atomic<size_t> writePos;
+
+    /// Next position that will be read by the consumer.
+    std::atomic<size_t> readPos;
+
+    /// End of the current drain cycle. Consumer only. See @ref BeginDrain().
+    size_t drainEnd;
+
+    /// Number of dropped log messages (saturating).
+    std::atomic<uint8_t> dropped;
+
+    /// Flag indicating that the producer thread has terminated.
+    std::atomic<bool> producerTerminated;
+
+    /// Flag indicating that the consumer (the log facility) has released the buffer.
+    std::atomic<bool> consumerReleased;
+};
+
+} // namespace internal
+} // namespace log
+} // namespace gpcc
+
+#endif // LOGSTAGINGBUFFER_HPP_202610161730
@@ -10,12 +10,17 @@
 
 #include <gpcc/log/logfacilities/ThreadedLogFacility.hpp>
 #include <gpcc/log/backends/Backend.hpp>
+#include <gpcc/log/backends/LogRecord.hpp>
+#include <gpcc/log/log_levels.hpp>
 #include <gpcc/log/Logger.hpp>
 #include <gpcc/osal/AdvancedMutexLocker.hpp>
 #include <gpcc/osal/MutexLocker.hpp>
 #include <gpcc/osal/Panic.hpp>
 #include <gpcc/raii/scope_guard.hpp>
+#include <gpcc/string/tools.hpp>
+#include <gpcc/time/TimePoint.hpp>
 #include "src/log/internal/LogMessage.hpp"
+#include "src/log/internal/LogStagingBuffer.hpp"
 #include <algorithm>
 #include <limits>
 #include <stdexcept>
@@ -23,8 +28,93 @@
 namespace gpcc {
 namespace log  {
 
+namespace {
+
+/**
+ * \brief Calculates the number of slots of the ring buffer used in @ref ThreadedLogFacility::IntakeMode::lockFreeRing.
+ *
+ * The number of slots is the smallest power of two that is equal to or larger than `capacity + capacity / 4`.
+ * The headroom is intended for @ref LogType::Error and @ref LogType::Fatal messages, which are not affected by the
+ * limitation.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \param capacity
+ * Capacity passed to the constructor of class @ref ThreadedLogFacility.
+ *
+ * \return
+ * Number of slots.
+ */
+size_t CalcNbOfRingSlots(size_t const capacity)
+{
+  if (capacity > (std::numeric_limits<size_t>::max() / 4U))
+    throw std::invalid_argument("ThreadedLogFacility::ThreadedLogFacility: invalid capacity");
+
+  size_t const required = capacity + (capacity / 4U);
+  size_t n = 1U;
+  while (n < required)
+    n <<= 1U;
+
+  return n;
+}
+
+// IntakeMode::perThreadBuffers requires thread_local objects with non-trivial destructors.
+// These are only available on the Linux-based platforms.
+#if (defined(OS_LINUX_ARM) || defined(OS_LINUX_ARM_TFC) || defined(OS_LINUX_X64) || defined(OS_LINUX_X64_TFC))
+/**
+ * \brief Staging buffers of the current thread (@ref ThreadedLogFacility::IntakeMode::perThreadBuffers).
+ *
+ * There is one instance per thread. The destructor notifies the log facilities that the thread has terminated.
+ */
+struct ThreadStagingBuffers
+{
+  /// Reference to a staging buffer of the current thread.
+  struct Entry
+  {
+    /// ID of the log facility (@ref ThreadedLogFacility::instanceId).
+    uint64_t facilityId;
+
+    /// The staging buffer.
+    std::shared_ptr<internal::LogStagingBuffer> spBuffer;
+  };
+
+  /// Staging buffers of the current thread, one per log facility.
+  std::vector<Entry> entries;
+
+  ThreadStagingBuffers(void) = default;
+  ThreadStagingBuffers(ThreadStagingBuffers const &) = delete;
+  ThreadStagingBuffers(ThreadStagingBuffers &&) = delete;
+
+  ~ThreadStagingBuffers(void)
+  {
+    for (auto & e : entries)
+      e.spBuffer->MarkProducerTerminated();
+  }
+
+  ThreadStagingBuffers& operator=(ThreadStagingBuffers const &) = delete;
+  ThreadStagingBuffers& operator=(ThreadStagingBuffers &&) = delete;
+};
+
+thread_local ThreadStagingBuffers threadStagingBuffers;
+#endif // #if (defined(OS_LINUX_ARM) || defined(OS_LINUX_ARM_TFC) || defined(OS_LINUX_X64) || defined(OS_LINUX_X64_TFC))
+
+} // anonymous namespace
+
+std::atomic<uint64_t> ThreadedLogFacility::nextInstanceId(1U);
+
 /**
- * \brief Constructor.
+ * \brief Constructor. Log messages are passed to the log facility in @ref IntakeMode::locked.
  *
  * After instantiation, consider using @ref SetDefaultSettings() to setup default log levels for
  * the @ref Logger instances that will be registered at this log facility.
@@ -52,27 +142,95 @@ namespace log  {
  * Minimum value: 8
  */
 ThreadedLogFacility::ThreadedLogFacility(char const * const pThreadName, size_t const capacity)
+: ThreadedLogFacility(pThreadName, capacity, IntakeMode::locked)
+{
+}
+
+/**
+ * \brief Constructor. Allows to select the intake mode.
+ *
+ * After instantiation, consider using @ref SetDefaultSettings() to setup default log levels for
+ * the @ref Logger instances that will be registered at this log facility.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Strong guarantee.
+ *
+ * - - -
+ *
+ * \param pThreadName
+ * Pointer to a null-terminated c-string with the name that shall be assigned to the log facilities' thread.
+ * The referenced string must not change during the lifetime of the @ref ThreadedLogFacility instance.\n
+ * Usually you will use a string located in ROM or code memory.
+ *
+ * \param capacity
+ * The maximum number of enqueued debug/OK/info/warn-messages is limited to this value.\n
+ * If the contingent of debug/OK/info/warn-messages is exhausted, then new log messages of these types will
+ * be dropped.\n
+ * The limitation is not applied to error- and fatal-messages.\n
+ * Minimum value: 8
+ *
+ * \param _intakeMode
+ * Mode used by @ref Log() to pass log messages to the log facility. See @ref IntakeMode for details.\n
+ * @ref IntakeMode::perThreadBuffers is only supported on Linux-based platforms.
+ */
+ThreadedLogFacility::ThreadedLogFacility(char const * const pThreadName, size_t const capacity, IntakeMode const _intakeMode)
 : ILogFacility()
 , ILogFacilityCtrl()
+, intakeMode(_intakeMode)
+, instanceId(nextInstanceId++)
 , mutex()
 , msgListMutex()
-, pLoggerList(nullptr)
+, loggers()
 , pBackendList(nullptr)
 , defaultSettingsPresent(false)
 , defaultSettings()
+, defaultSettingsIndex()
 , notProperlyDeliveredMessages(0)
+, duplicateSuppression(false)
+, lastDeliveredMsg()
+, lastDeliveredType(LogType::Debug)
+, repeatCount(0U)
 , messageCreationFailureCnt(0)
 , droppedMessages(0)
+, ringDroppedMessages(0)
 , remainingCapacity(capacity)
+, stagingBufferCapacity(capacity)
 , msgListNotEmptyCV()
 , busy(false)
 , notBusyAndEmptyCV()
 , pMsgQueueHead(nullptr)
 , pMsgQueueTail(nullptr)
+, ringMask((_intakeMode != IntakeMode::locked) ? (CalcNbOfRingSlots(capacity) - 1U) : 0U)
+, spRing()
+, ringEnqueuePos(0U)
+, ringDequeuePos(0U)
+, ringOverflow(false)
+, logThreadIdle(false)
+, stagingBuffers()
 , thread(pThreadName)
 {
   if (capacity < 8U)
     throw std::invalid_argument("ThreadedLogFacility::ThreadedLogFacility: invalid capacity");
+
+#if !(defined(OS_LINUX_ARM) || defined(OS_LINUX_ARM_TFC) || defined(OS_LINUX_X64) || defined(OS_LINUX_X64_TFC))
+  if (intakeMode == IntakeMode::perThreadBuffers)
+    throw std::invalid_argument("ThreadedLogFacility::ThreadedLogFacility: unsupported intake mode");
+#endif
+
+  if (intakeMode == IntakeMode::lockFreeRing)
+  {
+    spRing.reset(new RingSlot[ringMask + 1U]);
+    for (size_t i = 0U; i <= ringMask; ++i)
+    {
+      spRing[i].seq.store(i, std::memory_order_relaxed);
+      spRing[i].pMsg = nullptr;
+    }
+  }
 }
 
 /**
@@ -94,14 +252,23 @@ ThreadedLogFacility::~ThreadedLogFacility(void)
 {
   // ensure, that there is not any Logger or Backend still registered here
   gpcc::osal::MutexLocker mutexLocker(mutex);
-  if ((pLoggerList != nullptr) || (pBackendList != nullptr))
+  if ((!loggers.empty()) || (pBackendList != nullptr))
     PANIC();
 
   // release any queued message
   gpcc::osal::MutexLocker msgListMutexLocker(msgListMutex);
+  if (intakeMode == IntakeMode::lockFreeRing)
+    DrainRing();
+  else if (intakeMode == IntakeMode::perThreadBuffers)
+    MergeStagingBuffers();
   ReleaseMessages(pMsgQueueHead);
   pMsgQueueHead = nullptr;
   pMsgQueueTail = nullptr;
+
+  // release staging buffers (threads may still refer to them)
+  for (auto & spBuffer : stagingBuffers)
+    spBuffer->MarkConsumerReleased();
+  stagingBuffers.clear();
 }
 
 /**
@@ -171,6 +338,35 @@ void ThreadedLogFacility::Stop(void) noexcept
   thread.Join();
 }
 
+/**
+ * \brief Enables or disables suppression of consecutive duplicate log messages.
+ *
+ * See chapter "Duplicate suppression" in the class' documentation for details.\n
+ * Duplicate suppression is disabled by default.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param enable
+ * true  = enable duplicate suppression\n
+ * false = disable duplicate suppression
+ */
+void ThreadedLogFacility::SetDuplicateSuppression(bool const enable)
+{
+  gpcc::osal::MutexLocker mutexLocker(mutex);
+  duplicateSuppression = enable;
+}
+
 /**
  * \brief Blocks the calling thread until all log messages are processed.
  *
@@ -190,7 +386,7 @@ void ThreadedLogFacility::Stop(void) noexcept
 void ThreadedLogFacility::Flush(void)
 {
   gpcc::osal::MutexLocker msgListMutexLocker(msgListMutex);
-  while ((busy) || (pMsgQueueHead != nullptr) || (messageCreationFailureCnt != 0U) || (droppedMessages != 0U))
+  while ((busy) || (IsAnythingPending()))
     notBusyAndEmptyCV.Wait(msgListMutex);
 }
 
@@ -207,75 +403,31 @@ void ThreadedLogFacility::Register(Logger& logger)
 
     gpcc::osal::MutexLocker mutexLocker(mutex);
 
-    // retrieve default log level for the new logger
-    auto defaultSettingsIterator = defaultSettings.end();
+    // look for a default log level for the new logger
+    // (if there are multiple entries for the log source, then the first one in the list is used)
+    auto defaultSettingsIterator = defaultSettingsIndex.end();
     if (defaultSettingsPresent)
     {
-      complainNoDefaultLogLevel = true;
-      for (defaultSettingsIterator = defaultSettings.begin(); defaultSettingsIterator != defaultSettings.end(); ++defaultSettingsIterator)
+      auto const range = defaultSettingsIndex.equal_range(logger.srcName.GetStr());
+      for (auto it = range.first; it != range.second; ++it)
       {
-        if ((*defaultSettingsIterator).first == logger.srcName.GetStr())
-        {
-          complainNoDefaultLogLevel = false;
-          break;
-        }
+        if ((defaultSettingsIterator == defaultSettingsIndex.end()) || (it->second < defaultSettingsIterator->second))
+          defaultSettingsIterator = it;
       }
-    }
-
-    // logger-list empty?
-    if (pLoggerList == nullptr)
-    {
-      logger.pNext        = nullptr;
-      logger.pPrev        = nullptr;
-      logger.pLogFacility = this;
-
-      pLoggerList = &logger;
-    } // if (pLoggerList == nullptr)
-    else
-    {
-      Logger* p = pLoggerList;
 
-      while (true)
-      {
-        auto const cmpResult = logger.srcName.GetStr().compare(p->srcName.GetStr());
-        if (cmpResult < 0)
-        {
-          // insert the new logger in front of "p"
-          logger.pPrev = p->pPrev;
-          logger.pNext = p;
-          p->pPrev = &logger;
-          if (logger.pPrev != nullptr)
-            logger.pPrev->pNext = &logger;
-          else
-            pLoggerList = &logger;
-          break;
-        }
-        else if (cmpResult == 0)
-          throw std::logic_error("ThreadedLogFacility::Register: There is already a Logger with the same name");
+      complainNoDefaultLogLevel = (defaultSettingsIterator == defaultSettingsIndex.end());
+    }
 
-        // end of list not yet reached?
-        if (p->pNext != nullptr)
-        {
-          p = p->pNext;
-        }
-        else
-        {
-          // end of list reached, insert the new logger after "p"
-          logger.pPrev = p;
-          logger.pNext = nullptr;
-          p->pNext = &logger;
-          break;
-        }
-      }
+    if (!loggers.emplace(logger.srcName.GetStr(), &logger).second)
+      throw std::logic_error("ThreadedLogFacility::Register: There is already a Logger with the same name");
 
-      logger.pLogFacility = this;
-    } // if (pLoggerList == nullptr)... else...
+    logger.pLogFacility = this;
 
     // consume and apply default settings if necessary
-    if (defaultSettingsIterator != defaultSettings.end())
+    if (defaultSettingsIterator != defaultSettingsIndex.end())
     {
-      logger.level = (*defaultSettingsIterator).second;
-      defaultSettings.erase(defaultSettingsIterator);
+      logger.level = defaultSettings[defaultSettingsIterator->second].second;
+      defaultSettingsIndex.erase(defaultSettingsIterator);
     }
   }
 
@@ -293,14 +445,7 @@ void ThreadedLogFacility::Unregister(Logger& logger)
 
   gpcc::osal::MutexLocker mutexLocker(mutex);
 
-  if (logger.pPrev != nullptr)
-   logger.pPrev->pNext = logger.pNext;
-  if (logger.pNext != nullptr)
-    logger.pNext->pPrev = logger.pPrev;
-
-  if (&logger == pLoggerList)
-    pLoggerList = logger.pNext;
-
+  loggers.erase(logger.srcName.GetStr());
   logger.pLogFacility = nullptr;
 }
 
@@ -354,6 +499,86 @@ void ThreadedLogFacility::Log(std::unique_ptr<internal::LogMessage> spMsg)
   if (spMsg->pNext != nullptr)
     throw std::logic_error("ThreadedLogFacility::Log: Bad spMsg->pNext");
 
+#if (defined(OS_LINUX_ARM) || defined(OS_LINUX_ARM_TFC) || defined(OS_LINUX_X64) || defined(OS_LINUX_X64_TFC))
+  if (intakeMode == IntakeMode::perThreadBuffers)
+  {
+    internal::LogStagingBuffer & buffer = GetStagingBuffer();
+    auto const timestamp = gpcc::time::TimePoint::FromSystemClock(gpcc::time::Clocks::monotonicPrecise);
+
+    bool wentNonEmpty;
+    if (!buffer.Push(spMsg.get(), timestamp, wentNonEmpty))
+    {
+      if (buffer.IncDropped())
+      {
+        gpcc::osal::MutexLocker msgListMutexLocker(msgListMutex);
+        msgListNotEmptyCV.Signal();
+      }
+      return;
+    }
+    spMsg.release();
+
+    // Only signal if the staging buffer went non-empty while the log facility's thread is idle.
+    // See InternalThreadEntry() for the counterpart of the fence included in Push().
+    if ((wentNonEmpty) && (logThreadIdle.load(std::memory_order_relaxed)))
+    {
+      try
+      {
+        gpcc::osal::MutexLocker msgListMutexLocker(msgListMutex);
+        msgListNotEmptyCV.Signal();
+      }
+      catch (...)
+      {
+        gpcc::osal::Panic("ThreadedLogFacility::Log: Failed to signal");
+      }
+    }
+
+    return;
+  }
+#endif // #if (defined(OS_LINUX_ARM) || defined(OS_LINUX_ARM_TFC) || defined(OS_LINUX_X64) || defined(OS_LINUX_X64_TFC))
+
+  if (intakeMode == IntakeMode::lockFreeRing)
+  {
+    bool const limited = ((static_cast<LogType>(spMsg->type) != LogType::Error) &&
+                          (static_cast<LogType>(spMsg->type) != LogType::Fatal));
+
+    if ((limited) && (!TryConsumeCapacity()))
+    {
+      IncRingDroppedMessages();
+      return;
+    }
+
+    ON_SCOPE_EXIT(returnCapacity) { if (limited) ++remainingCapacity; };
+
+    // fast path
+    if ((!ringOverflow.load(std::memory_order_acquire)) && (PushToRing(spMsg.get())))
+    {
+      ON_SCOPE_EXIT_DISMISS(returnCapacity);
+      spMsg.release();
+      return;
+    }
+
+    // Ring is full or there are still messages in the mutex-protected queue. Enqueue in the mutex-protected queue.
+    gpcc::osal::MutexLocker msgListMutexLocker(msgListMutex);
+    ON_SCOPE_EXIT_DISMISS(returnCapacity);
+
+    ringOverflow.store(true, std::memory_order_relaxed);
+
+    if (pMsgQueueTail == nullptr)
+    {
+      msgListNotEmptyCV.Signal();
+
+      pMsgQueueHead = spMsg.get();
+      pMsgQueueTail = spMsg.release();
+    }
+    else
+    {
+      pMsgQueueTail->pNext = spMsg.get();
+      pMsgQueueTail = spMsg.release();
+    }
+
+    return;
+  }
+
   gpcc::osal::MutexLocker msgListMutexLocker(msgListMutex);
 
   if ((remainingCapacity != 0U) ||
@@ -407,31 +632,44 @@ void ThreadedLogFacility::ReportLogMessageCreationFailed(void) noexcept
   }
 }
 
-/// \copydoc ILogFacilityCtrl::EnumerateLogSources
-std::vector<ILogFacilityCtrl::tLogSrcConfig> ThreadedLogFacility::EnumerateLogSources(void) const
+/// \copydoc ILogFacility::ReportLogMessageDropped
+void ThreadedLogFacility::ReportLogMessageDropped(void) noexcept
 {
-  gpcc::osal::MutexLocker mutexLocker(mutex);
+  try
+  {
+    gpcc::osal::MutexLocker msgListMutexLocker(msgListMutex);
 
-  // determine number of registered Logger instances
-  size_t n = 0U;
-  Logger* p = pLoggerList;
-  while (p != nullptr)
+    if (droppedMessages == 0U)
+      msgListNotEmptyCV.Signal();
+
+    if (droppedMessages != std::numeric_limits<decltype(droppedMessages)>::max())
+      droppedMessages++;
+  }
+  catch (std::exception const &)
+  {
+    // intentionally empty
+  }
+  catch (...)
   {
-    n++;
-    p = p->pNext;
+    PANIC();
   }
+}
+
+/// \copydoc ILogFacilityCtrl::EnumerateLogSources
+std::vector<ILogFacilityCtrl::tLogSrcConfig> ThreadedLogFacility::EnumerateLogSources(void) const
+{
+  gpcc::osal::MutexLocker mutexLocker(mutex);
 
-  // prepare vector
   std::vector<ILogFacilityCtrl::tLogSrcConfig> v;
-  v.reserve(n);
+  v.reserve(loggers.size());
 
-  // fill vector
-  p = pLoggerList;
-  while (p != nullptr)
-  {
-    v.push_back(ILogFacilityCtrl::tLogSrcConfig(p->srcName.GetStr(), p->GetLogLevel()));
-    p = p->pNext;
-  }
+  for (auto const & e : loggers)
+    v.push_back(ILogFacilityCtrl::tLogSrcConfig(e.second->srcName.GetStr(), e.second->GetLogLevel()));
+
+  // sort by name (upper-case before lower-case)
+  std::sort(v.begin(), v.end(),
+            [](ILogFacilityCtrl::tLogSrcConfig const & a, ILogFacilityCtrl::tLogSrcConfig const & b)
+            { return (a.first < b.first); });
 
   return v;
 }
@@ -487,11 +725,38 @@ bool ThreadedLogFacility::RaiseLogLevel(std::string const & srcName, LogLevel co
   return true;
 }
 
+/// \copydoc ILogFacilityCtrl::SetLogLevelByPattern
+size_t ThreadedLogFacility::SetLogLevelByPattern(std::string const & pattern, LogLevel const level)
+{
+  gpcc::osal::MutexLocker mutexLocker(mutex);
+
+  // Determine the matching loggers first. An invalid pattern shall not result in a partial modification.
+  std::vector<Logger*> matches;
+  for (auto const & e : loggers)
+  {
+    if (gpcc::string::TestSimplePatternMatch(e.second->srcName.GetStr(), pattern.c_str(), true))
+      matches.push_back(e.second);
+  }
+
+  for (auto const p : matches)
+    p->SetLogLevel(level);
+
+  return matches.size();
+}
+
 /// \copydoc ILogFacilityCtrl::SetDefaultSettings
 void ThreadedLogFacility::SetDefaultSettings(std::vector<tLogSrcConfig> _defaultSettings)
 {
+  // Build the index before locking the mutex. The keys refer to the strings inside _defaultSettings. They remain
+  // valid when the content of _defaultSettings is moved into defaultSettings.
+  std::unordered_multimap<std::string_view, size_t> newIndex;
+  newIndex.reserve(_defaultSettings.size());
+  for (size_t i = 0U; i < _defaultSettings.size(); i++)
+    newIndex.emplace(_defaultSettings[i].first, i);
+
   gpcc::osal::MutexLocker mutexLocker(mutex);
 
+  defaultSettingsIndex = std::move(newIndex);
   defaultSettings = std::move(_defaultSettings);
   defaultSettingsPresent = true;
 }
@@ -501,15 +766,32 @@ std::vector<ILogFacilityCtrl::tLogSrcConfig> ThreadedLogFacility::RemoveDefaultS
 {
   gpcc::osal::MutexLocker mutexLocker(mutex);
 
-  if (!defaultSettingsPresent)
-    defaultSettings.clear();
+  std::vector<tLogSrcConfig> remainingSettings;
+
+  if (defaultSettingsPresent)
+  {
+    // collect the entries that have not been consumed yet, preserving their order
+    std::vector<bool> notConsumed(defaultSettings.size(), false);
+    for (auto const & e : defaultSettingsIndex)
+      notConsumed[e.second] = true;
+
+    remainingSettings.reserve(defaultSettingsIndex.size());
+    for (size_t i = 0U; i < defaultSettings.size(); i++)
+    {
+      if (notConsumed[i])
+        remainingSettings.push_back(std::move(defaultSettings[i]));
+    }
+  }
 
+  defaultSettingsIndex.clear();
+  defaultSettings.clear();
   defaultSettingsPresent = false;
-  return std::move(defaultSettings);
+
+  return remainingSettings;
 }
 
 /**
- * \brief Retrieves a logger from the list of registered loggers based on the log source name.
+ * \brief Retrieves a registered logger based on the log source name.
  *
  * - - -
  *
@@ -533,50 +815,486 @@ std::vector<ILogFacilityCtrl::tLogSrcConfig> ThreadedLogFacility::RemoveDefaultS
  */
 Logger* ThreadedLogFacility::FindLogger(std::string const & srcName) const noexcept
 {
-  Logger* p = pLoggerList;
+  auto const it = loggers.find(srcName);
+  if (it == loggers.end())
+    return nullptr;
+
+  return it->second;
+}
 
-  while ((p != nullptr) && (p->srcName.GetStr() != srcName))
-    p = p->pNext;
+/**
+ * \brief Decrements @ref remainingCapacity without any mutex, if it is not zero.
+ *
+ * This is used in @ref IntakeMode::lockFreeRing only.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \retval true   @ref remainingCapacity has been decremented.
+ * \retval false  @ref remainingCapacity is zero. The message must be dropped.
+ */
+bool ThreadedLogFacility::TryConsumeCapacity(void) noexcept
+{
+  size_t rc = remainingCapacity.load(std::memory_order_relaxed);
+  do
+  {
+    if (rc == 0U)
+      return false;
+  }
+  while (!remainingCapacity.compare_exchange_weak(rc, rc - 1U, std::memory_order_relaxed, std::memory_order_relaxed));
 
-  return p;
+  return true;
 }
 
 /**
- * \brief Entry function for the log facilities' thread.
+ * \brief Pushes a log message into the lock-free ring buffer (@ref spRing).
+ *
+ * If the log facility's thread is idle and the ring buffer went non-empty, then the log facility's thread will be
+ * signaled. In any other case, no mutex is locked and no signaling takes place.
  *
  * - - -
  *
  * __Thread safety:__\n
- * Not applicable. Program logic ensures that there can only be one thread at any time.
+ * This is thread-safe.\n
+ * @ref msgListMutex must __not__ be locked by the caller.
  *
  * __Exception safety:__\n
  * No-throw guarantee.
  *
  * __Thread cancellation safety:__\n
- * Disabled.
+ * Safe, no cancellation point included.
  *
  * - - -
  *
- * \return
- * Always `nullptr`.
+ * \param pMsg
+ * Pointer to the log message.\n
+ * If this returns true, then ownership moves to the ring buffer.
+ *
+ * \retval true   The log message has been pushed into the ring buffer.
+ * \retval false  The ring buffer is full. Ownership remains at the caller.
  */
-void* ThreadedLogFacility::InternalThreadEntry(void) noexcept
+bool ThreadedLogFacility::PushToRing(internal::LogMessage* const pMsg) noexcept
 {
-  try
+  // claim a slot
+  RingSlot* pSlot;
+  size_t pos = ringEnqueuePos.load(std::memory_order_relaxed);
+  while (true)
   {
-    (void)thread.SetCancelabilityEnabled(false);
+    pSlot = &spRing[pos & ringMask];
+    size_t const seq = pSlot->seq.load(std::memory_order_acquire);
+    auto const diff = static_cast<std::ptrdiff_t>(seq - pos);
 
-    gpcc::osal::AdvancedMutexLocker msgListMutexLocker(msgListMutex);
-    while (!thread.IsCancellationPending())
+    if (diff == 0)
     {
-      // wait for something to log
-      while ((pMsgQueueHead == nullptr) && (messageCreationFailureCnt == 0U) && (droppedMessages == 0U))
-      {
-        msgListNotEmptyCV.Wait(msgListMutex);
+      if (ringEnqueuePos.compare_exchange_weak(pos, pos + 1U, std::memory_order_relaxed, std::memory_order_relaxed))
+        break;
+    }
+    else if (diff < 0)
+    {
+      return false;
+    }
+    else
+    {
+      pos = ringEnqueuePos.load(std::memory_order_relaxed);
+    }
+  }
 
-        if (thread.IsCancellationPending())
-          return nullptr;
+  // publish
+  pSlot->pMsg = pMsg;
+  pSlot->seq.store(pos + 1U, std::memory_order_release);
+
+  // Only the producer that makes the ring go non-empty while the log facility's thread is idle has to signal.
+  // See InternalThreadEntry() for the counterpart of the fence.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if ((logThreadIdle.load(std::memory_order_relaxed)) && (ringDequeuePos.load(std::memory_order_relaxed) == pos))
+  {
+    try
+    {
+      gpcc::osal::MutexLocker msgListMutexLocker(msgListMutex);
+      msgListNotEmptyCV.Signal();
+    }
+    catch (...)
+    {
+      gpcc::osal::Panic("ThreadedLogFacility::PushToRing: Failed to signal");
+    }
+  }
+
+  return true;
+}
+
+/**
+ * \brief Increments @ref ringDroppedMessages without any mutex and stops at maximum value to prevent overflow.
+ *
+ * If @ref ringDroppedMessages was zero, then the log facility's thread will be signaled.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.\n
+ * @ref msgListMutex must __not__ be locked by the caller.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ */
+void ThreadedLogFacility::IncRingDroppedMessages(void) noexcept
+{
+  uint8_t dropped = ringDroppedMessages.load(std::memory_order_relaxed);
+  do
+  {
+    if (dropped == std::numeric_limits<uint8_t>::max())
+      return;
+  }
+  while (!ringDroppedMessages.compare_exchange_weak(dropped, dropped + 1U, std::memory_order_relaxed, std::memory_order_relaxed));
+
+  if (dropped == 0U)
+  {
+    try
+    {
+      gpcc::osal::MutexLocker msgListMutexLocker(msgListMutex);
+      msgListNotEmptyCV.Signal();
+    }
+    catch (...)
+    {
+      gpcc::osal::Panic("ThreadedLogFacility::IncRingDroppedMessages: Failed to signal");
+    }
+  }
+}
+
+/**
+ * \brief Checks if the lock-free ring buffer (@ref spRing) contains any published log message.
+ *
+ * Slots that have been claimed by a producer, but which have not been published yet, are not recognized.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * @ref msgListMutex must be locked.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \retval true   The ring buffer contains no published log message.
+ * \retval false  The ring buffer contains at least one log message.
+ */
+bool ThreadedLogFacility::IsRingEmpty(void) const noexcept
+{
+  size_t const pos = ringDequeuePos.load(std::memory_order_relaxed);
+  return (spRing[pos & ringMask].seq.load(std::memory_order_acquire) != (pos + 1U));
+}
+
+/**
+ * \brief Moves all published log messages from the lock-free ring buffer (@ref spRing) to the front of the
+ *        mutex-protected queue (@ref pMsgQueueHead).
+ *
+ * The order of the log messages is maintained. The log messages from the ring buffer are placed in front of the
+ * messages in the mutex-protected queue, because messages are only added to the mutex-protected queue while
+ * @ref ringOverflow is set. @ref ringOverflow is cleared by this.
+ *
+ * The caller shall fetch the mutex-protected queue before releasing @ref msgListMutex.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * @ref msgListMutex must be locked.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ */
+void ThreadedLogFacility::DrainRing(void) noexcept
+{
+  internal::LogMessage* pFirst = nullptr;
+  internal::LogMessage* pLast  = nullptr;
+
+  size_t pos = ringDequeuePos.load(std::memory_order_relaxed);
+  while (true)
+  {
+    RingSlot & slot = spRing[pos & ringMask];
+    if (slot.seq.load(std::memory_order_acquire) != (pos + 1U))
+      break;
+
+    internal::LogMessage* const pMsg = slot.pMsg;
+    slot.pMsg = nullptr;
+    slot.seq.store(pos + ringMask + 1U, std::memory_order_release);
+    ++pos;
+
+    if (pLast == nullptr)
+      pFirst = pMsg;
+    else
+      pLast->pNext = pMsg;
+    pLast = pMsg;
+  }
+  ringDequeuePos.store(pos, std::memory_order_relaxed);
+
+  if (pFirst != nullptr)
+  {
+    pLast->pNext = pMsgQueueHead;
+    pMsgQueueHead = pFirst;
+    if (pMsgQueueTail == nullptr)
+      pMsgQueueTail = pLast;
+  }
+
+  ringOverflow.store(false, std::memory_order_relaxed);
+}
+
+#if (defined(OS_LINUX_ARM) || defined(OS_LINUX_ARM_TFC) || defined(OS_LINUX_X64) || defined(OS_LINUX_X64_TFC))
+/**
+ * \brief Retrieves the staging buffer of the calling thread. If the calling thread has no staging buffer yet,
+ *        then a staging buffer will be created and registered.
+ *
+ * This is used in @ref IntakeMode::perThreadBuffers only.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.\n
+ * @ref msgListMutex must __not__ be locked by the caller.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \return
+ * Reference to the staging buffer of the calling thread.\n
+ * The referenced object is valid until the calling thread terminates.
+ */
+internal::LogStagingBuffer& ThreadedLogFacility::GetStagingBuffer(void)
+{
+  auto & entries = threadStagingBuffers.entries;
+
+  for (auto const & e : entries)
+  {
+    if (e.facilityId == instanceId)
+      return *e.spBuffer;
+  }
+
+  // Not found. Remove entries referring to log facilities that have been destroyed in the meantime.
+  entries.erase(std::remove_if(entries.begin(), entries.end(),
+                               [](ThreadStagingBuffers::Entry const & e) { return e.spBuffer->IsConsumerReleased(); }),
+                entries.end());
+
+  entries.reserve(entries.size() + 1U);
+  auto spBuffer = std::make_shared<internal::LogStagingBuffer>(ringMask + 1U, stagingBufferCapacity);
+
+  {
+    gpcc::osal::MutexLocker msgListMutexLocker(msgListMutex);
+    stagingBuffers.push_back(spBuffer);
+  }
+
+  entries.push_back(ThreadStagingBuffers::Entry{instanceId, std::move(spBuffer)});
+  return *entries.back().spBuffer;
+}
+#endif // #if (defined(OS_LINUX_ARM) || defined(OS_LINUX_ARM_TFC) || defined(OS_LINUX_X64) || defined(OS_LINUX_X64_TFC))
+
+/**
+ * \brief Merges all log messages from the staging buffers (@ref stagingBuffers) in timestamp order and appends
+ *        them to the mutex-protected queue (@ref pMsgQueueHead).
+ *
+ * The numbers of dropped log messages of the staging buffers are added to @ref droppedMessages.\n
+ * Staging buffers whose producer threads have terminated are removed from @ref stagingBuffers once they are
+ * empty.
+ *
+ * If there are log messages with equal timestamps in multiple staging buffers, then the messages from the staging
+ * buffer that has been registered first are taken first.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * @ref msgListMutex must be locked.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ */
+void ThreadedLogFacility::MergeStagingBuffers(void) noexcept
+{
+  for (auto & spBuffer : stagingBuffers)
+    spBuffer->BeginDrain();
+
+  while (true)
+  {
+    // find the staging buffer with the oldest log message
+    internal::LogStagingBuffer* pOldest = nullptr;
+    for (auto & spBuffer : stagingBuffers)
+    {
+      if ((spBuffer->IsDrainPending()) &&
+          ((pOldest == nullptr) || (spBuffer->FrontTimestamp() < pOldest->FrontTimestamp())))
+      {
+        pOldest = spBuffer.get();
       }
+    }
+
+    if (pOldest == nullptr)
+      break;
+
+    internal::LogMessage* const pMsg = pOldest->Pop();
+    if (pMsgQueueTail == nullptr)
+      pMsgQueueHead = pMsg;
+    else
+      pMsgQueueTail->pNext = pMsg;
+    pMsgQueueTail = pMsg;
+  }
+
+  // collect dropped messages and remove staging buffers of terminated threads
+  auto const maxDropped = std::numeric_limits<decltype(droppedMessages)>::max();
+  auto it = stagingBuffers.begin();
+  while (it != stagingBuffers.end())
+  {
+    internal::LogStagingBuffer & buffer = **it;
+
+    // note: producerTerminated must be read before the buffer is checked for being empty
+    bool const terminated = buffer.IsProducerTerminated();
+
+    droppedMessages = static_cast<uint8_t>(std::min(static_cast<unsigned int>(droppedMessages) + buffer.FetchDropped(),
+                                                    static_cast<unsigned int>(maxDropped)));
+
+    if ((terminated) && (buffer.IsEmpty()))
+      it = stagingBuffers.erase(it);
+    else
+      ++it;
+  }
+}
+
+/**
+ * \brief Checks if any staging buffer (@ref stagingBuffers) contains log messages or dropped messages.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * @ref msgListMutex must be locked.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \retval true   At least one staging buffer contains log messages or dropped messages.
+ * \retval false  All staging buffers are empty and no messages have been dropped.
+ */
+bool ThreadedLogFacility::IsAnyStagingBufferPending(void) const noexcept
+{
+  for (auto const & spBuffer : stagingBuffers)
+  {
+    if ((!spBuffer->IsEmpty()) || (spBuffer->HasDropped()))
+      return true;
+  }
+
+  return false;
+}
+
+/**
+ * \brief Checks if there is anything for the log facility's thread to do.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * @ref msgListMutex must be locked.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \retval true   There are log messages to be delivered, or messages have been dropped, or creation of log
+ *                messages has failed.
+ * \retval false  There is nothing to do.
+ */
+bool ThreadedLogFacility::IsAnythingPending(void) const noexcept
+{
+  if ((pMsgQueueHead != nullptr) || (messageCreationFailureCnt != 0U) || (droppedMessages != 0U))
+    return true;
+
+  if (intakeMode == IntakeMode::lockFreeRing)
+    return ((!IsRingEmpty()) || (ringDroppedMessages.load(std::memory_order_relaxed) != 0U));
+  else if (intakeMode == IntakeMode::perThreadBuffers)
+    return IsAnyStagingBufferPending();
+
+  return false;
+}
+
+/**
+ * \brief Entry function for the log facilities' thread.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * Not applicable. Program logic ensures that there can only be one thread at any time.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Disabled.
+ *
+ * - - -
+ *
+ * \return
+ * Always `nullptr`.
+ */
+void* ThreadedLogFacility::InternalThreadEntry(void) noexcept
+{
+  try
+  {
+    (void)thread.SetCancelabilityEnabled(false);
+
+    gpcc::osal::AdvancedMutexLocker msgListMutexLocker(msgListMutex);
+    while (!thread.IsCancellationPending())
+    {
+      // wait for something to log
+      while (!IsAnythingPending())
+      {
+        // Announce that we are idle. Producers using the lock-free ring or staging buffers check this after
+        // publishing a message.
+        // The fences ensure that either the producer sees the flag, or we see the message.
+        logThreadIdle.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (IsAnythingPending())
+          break;
+
+        msgListNotEmptyCV.Wait(msgListMutex);
+
+        if (thread.IsCancellationPending())
+          return nullptr;
+      }
+      logThreadIdle.store(false, std::memory_order_relaxed);
+
+      // move messages from the ring or the staging buffers (if any) to the front of the mutex-protected queue
+      if (intakeMode == IntakeMode::lockFreeRing)
+        DrainRing();
+      else if (intakeMode == IntakeMode::perThreadBuffers)
+        MergeStagingBuffers();
 
       // fetch messages, messageCreationFailureCnt and droppedMessages into local variables
       auto pMessages = pMsgQueueHead;
@@ -586,9 +1304,16 @@ void* ThreadedLogFacility::InternalThreadEntry(void) noexcept
       auto const local_messageCreationFailureCnt = messageCreationFailureCnt;
       messageCreationFailureCnt = 0U;
 
-      auto const local_droppedMessages = droppedMessages;
+      auto local_droppedMessages = droppedMessages;
       droppedMessages = 0U;
 
+      if (intakeMode == IntakeMode::lockFreeRing)
+      {
+        auto const maxDropped = std::numeric_limits<decltype(droppedMessages)>::max();
+        local_droppedMessages = static_cast<uint8_t>(std::min(static_cast<unsigned int>(local_droppedMessages) + ringDroppedMessages.exchange(0U, std::memory_order_relaxed),
+                                                             static_cast<unsigned int>(maxDropped)));
+      }
+
       // process
       busy = true;
       msgListMutexLocker.Unlock();
@@ -599,7 +1324,7 @@ void* ThreadedLogFacility::InternalThreadEntry(void) noexcept
       busy = false;
 
       // wake up potential threads in Flush(), if there is nothing more to do
-      if ((pMsgQueueHead == nullptr) && (messageCreationFailureCnt == 0U) && (droppedMessages == 0U))
+      if (!IsAnythingPending())
         notBusyAndEmptyCV.Broadcast();
     }
   }
@@ -641,7 +1366,8 @@ void ThreadedLogFacility::ReleaseMessages(internal::LogMessage* pMessages) noexc
   {
     auto pNext = pMessages->pNext;
 
-    if ((static_cast<LogType>(pMessages->type) != LogType::Error) &&
+    if ((intakeMode != IntakeMode::perThreadBuffers) &&
+        (static_cast<LogType>(pMessages->type) != LogType::Error) &&
         (static_cast<LogType>(pMessages->type) != LogType::Fatal))
     {
       ++remainingCapacity;
@@ -659,6 +1385,9 @@ void ThreadedLogFacility::ReleaseMessages(internal::LogMessage* pMessages) noexc
  * Delivery encompasses:
  * - building the log message text string
  * - passing the log message text string to each registered back-end
+ * - passing the unformatted ingredients of the log message (if available) to structured back-ends (see
+ *   @ref Backend::IsStructured()) instead of the log message text string. The log message text string is not build,
+ *   if it is not required by any back-end or by duplicate suppression.
  *
  * If an error occurs during building the log message text string, then the counter for not properly delivered
  * log messages (@ref notProperlyDeliveredMessages) will be incremented.
@@ -675,6 +1404,11 @@ void ThreadedLogFacility::ReleaseMessages(internal::LogMessage* pMessages) noexc
  * @ref notProperlyDeliveredMessages will be incremented by @ref Deliver() and there will be another attempt to
  * create and deliver a error log message at a later point in time.
  *
+ * If duplicate suppression is enabled (@ref duplicateSuppression), then log messages whose type and text are equal
+ * to the type and text of the previously delivered log message are not passed to the back-ends. Instead
+ * @ref repeatCount is incremented. A summary is delivered via @ref DeliverRepeatSummary() before the next different
+ * log message and at the end of the batch.
+ *
  * - - -
  *
  * __Thread safety:__\n
@@ -723,13 +1457,25 @@ void ThreadedLogFacility::DeliverMessages(internal::LogMessage* pMessages, uint8
   notProperlyDeliveredMessages = std::min(static_cast<size_t>(dropped) + notProperlyDeliveredMessages,
                                           static_cast<size_t>(std::numeric_limits<decltype(notProperlyDeliveredMessages)>::max()));
 
+  // check if there are text and/or structured back-ends
+  bool anyTextBackend = false;
+  bool anyStructuredBackend = false;
+  for (Backend* pBackend = pBackendList; pBackend != nullptr; pBackend = pBackend->pNext)
+  {
+    if (pBackend->IsStructured())
+      anyStructuredBackend = true;
+    else
+      anyTextBackend = true;
+  }
+
   while (pMessages != nullptr)
   {
     // fetch one message from list
     std::unique_ptr<internal::LogMessage> spMsg(pMessages);
     pMessages = pMessages->pNext;
 
-    if ((static_cast<LogType>(spMsg->type) != LogType::Error) &&
+    if ((intakeMode != IntakeMode::perThreadBuffers) &&
+        (static_cast<LogType>(spMsg->type) != LogType::Error) &&
         (static_cast<LogType>(spMsg->type) != LogType::Fatal))
     {
       ++remainingCapacity;
@@ -737,16 +1483,41 @@ void ThreadedLogFacility::DeliverMessages(internal::LogMessage* pMessages, uint8
 
     try
     {
-      // get message type and build message text
-      LogType type;
+      // get message type, unformatted ingredients (if required), and build message text (if required)
+      LogType const type = spMsg->GetLogType();
+
+      LogRecord record;
+      bool const structured = (anyStructuredBackend) && (spMsg->GetRecord(record));
+
       std::string message;
+      if ((!structured) || (anyTextBackend) || (duplicateSuppression))
+        message = spMsg->BuildText();
 
-      type    = spMsg->GetLogType();
-      message = spMsg->BuildText();
-      spMsg.reset();
+      if (duplicateSuppression)
+      {
+        if ((!lastDeliveredMsg.empty()) && (type == lastDeliveredType) && (message == lastDeliveredMsg))
+        {
+          if (repeatCount != std::numeric_limits<decltype(repeatCount)>::max())
+            ++repeatCount;
+          continue;
+        }
+
+        DeliverRepeatSummary();
+      }
 
       // deliver to back-ends
-      Deliver(message, type);
+      if (structured)
+        DeliverRecord(record, message);
+      else
+        Deliver(message, type);
+
+      spMsg.reset();
+
+      if (duplicateSuppression)
+      {
+        lastDeliveredMsg.swap(message);
+        lastDeliveredType = type;
+      }
     }
     catch (std::exception const &)
     {
@@ -756,6 +1527,17 @@ void ThreadedLogFacility::DeliverMessages(internal::LogMessage* pMessages, uint8
 
   ON_SCOPE_EXIT_DISMISS(releaseMessages);
 
+  // deliver a summary of suppressed duplicates and forget the last delivered message
+  try
+  {
+    DeliverRepeatSummary();
+  }
+  catch (std::exception const &)
+  {
+    IncNotProperlyDeliveredMessages();
+  }
+  lastDeliveredMsg.clear();
+
   // create an additional error message if any message has been dropped or not properly processed
   if (notProperlyDeliveredMessages != 0U)
   {
@@ -853,6 +1635,97 @@ void ThreadedLogFacility::Deliver(std::string const & msg, LogType const type)
     IncNotProperlyDeliveredMessages();
 }
 
+/**
+ * \brief Delivers a log message available in unformatted form to all registered back-ends.
+ *
+ * Structured back-ends receive the unformatted ingredients of the log message. All other back-ends receive the log
+ * message text string.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * @ref mutex must be locked.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * Exceptions thrown by back-ends will be properly caught and handled by this.\n
+ * In case of any error, @ref notProperlyDeliveredMessages will be incremented.
+ *
+ * __Thread cancellation safety:__\n
+ * Basic guarantee:
+ * - the log message may not have been delivered to all registered back-ends
+ * - a back-end may have processed only parts of the log message
+ *
+ * - - -
+ *
+ * \param record
+ * Unformatted ingredients of the log message.
+ *
+ * \param msg
+ * Log message text string.\n
+ * This may be empty, if there is no back-end which is not a structured back-end.
+ */
+void ThreadedLogFacility::DeliverRecord(LogRecord const & record, std::string const & msg)
+{
+  Backend* pBackend = pBackendList;
+  bool error = false;
+  while (pBackend != nullptr)
+  {
+    try
+    {
+      if (pBackend->IsStructured())
+        pBackend->ProcessRecord(record);
+      else
+        pBackend->Process(msg, record.type);
+    }
+    catch (std::exception const &)
+    {
+      error = true;
+    }
+
+    pBackend = pBackend->pNext;
+  }
+
+  if (error)
+    IncNotProperlyDeliveredMessages();
+}
+
+/**
+ * \brief Delivers a log message summarizing suppressed duplicates to all registered back-ends, if
+ *        @ref repeatCount is not zero.
+ *
+ * @ref repeatCount is cleared by this.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * @ref mutex must be locked.
+ *
+ * __Exception safety:__\n
+ * Basic guarantee:
+ * - The summary may not have been delivered. @ref repeatCount is cleared anyway.
+ *
+ * __Thread cancellation safety:__\n
+ * Basic guarantee:
+ * - the summary may not have been delivered to all registered back-ends
+ */
+void ThreadedLogFacility::DeliverRepeatSummary(void)
+{
+  if (repeatCount == 0U)
+    return;
+
+  auto const n = repeatCount;
+  repeatCount = 0U;
+
+  std::string message(LogType2LogMsgHeader(lastDeliveredType));
+  message += " *** Logger: Last message repeated ";
+  message += std::to_string(n);
+  message += " time(s) ***";
+
+  Deliver(message, lastDeliveredType);
+}
+
 /**
  * \brief Increments @ref notProperlyDeliveredMessages and stops at maximum value to prevent overflow.
  *
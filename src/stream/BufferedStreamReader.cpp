@@ -0,0 +1,731 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#include <gpcc/stream/BufferedStreamReader.hpp>
+#include <gpcc/osal/Panic.hpp>
+#include <gpcc/stream/stream_errors.hpp>
+#include <algorithm>
+#include <stdexcept>
+#include <cstring>
+
+namespace gpcc   {
+namespace stream {
+
+/**
+ * \brief Constructor.
+ *
+ * \pre   The decorated stream must be in state [States::open](@ref gpcc::stream::IStreamReader::States::open) or
+ *        [States::empty](@ref gpcc::stream::IStreamReader::States::empty).
+ *
+ * \pre   There must be no bits of a partially read byte left in the decorated stream.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * \throws ClosedError             The decorated stream is closed ([details](@ref gpcc::stream::ClosedError)).
+ *
+ * \throws ErrorStateError         The decorated stream is in error state
+ *                                 ([details](@ref gpcc::stream::ErrorStateError)).
+ *
+ * \throws std::invalid_argument   `bufferSize` is zero.
+ *
+ * \throws std::bad_alloc          Out of memory.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param _underlyingStream
+ * Stream that shall be decorated.\n
+ * The stream must not be accessed by anyone else and it must not be released before this object.
+ *
+ * \param bufferSize
+ * Size of the buffer in bytes.\n
+ * Zero is not allowed.
+ */
+BufferedStreamReader::BufferedStreamReader(IStreamReader & _underlyingStream, size_t const bufferSize)
+: StreamReaderBase(_underlyingStream.GetState(), _underlyingStream.GetEndian())
+, underlyingStream(_underlyingStream)
+, remainingBytesSupported(_underlyingStream.IsRemainingBytesSupported())
+, buffer()
+, readIdx(0U)
+, fillLevel(0U)
+, underlyingEmpty(state == States::empty)
+, nbOfBitsInBitData(0U)
+, bitData(0U)
+{
+  if (state == States::closed)
+    throw ClosedError();
+  else if (state == States::error)
+    throw ErrorStateError();
+
+  if (bufferSize == 0U)
+    throw std::invalid_argument("BufferedStreamReader::BufferedStreamReader: bufferSize is zero");
+
+  buffer.resize(bufferSize);
+}
+
+// --> IStreamReader
+
+/// \copydoc IStreamReader::IsRemainingBytesSupported
+bool BufferedStreamReader::IsRemainingBytesSupported(void) const
+{
+  return remainingBytesSupported;
+}
+
+/// \copydoc IStreamReader::RemainingBytes
+size_t BufferedStreamReader::RemainingBytes(void) const
+{
+  switch (state)
+  {
+    case States::open:
+    case States::empty:
+    {
+      if (!remainingBytesSupported)
+        throw std::logic_error("BufferedStreamReader::RemainingBytes: Operation not supported");
+
+      size_t n = fillLevel - readIdx;
+      if (!underlyingEmpty)
+        n += underlyingStream.RemainingBytes();
+
+      return n;
+    }
+
+    case States::closed:
+      throw ClosedError();
+
+    case States::error:
+      throw ErrorStateError();
+  }
+
+  PANIC();
+}
+
+/// \copydoc IStreamReader::EnsureAllDataConsumed
+void BufferedStreamReader::EnsureAllDataConsumed(RemainingNbOfBits const expectation) const
+{
+  switch (state)
+  {
+    case States::open:
+    case States::empty:
+      {
+        bool const noBytesLeft = ((readIdx == fillLevel) && (underlyingEmpty));
+
+        switch (expectation)
+        {
+          case RemainingNbOfBits::sevenOrLess:
+          {
+            if (!noBytesLeft)
+              throw RemainingBitsError();
+            break;
+          }
+
+          case RemainingNbOfBits::moreThanSeven:
+          {
+            if (noBytesLeft)
+              throw RemainingBitsError();
+            break;
+          }
+
+          case RemainingNbOfBits::any:
+          {
+            break;
+          }
+
+          default:
+          {
+            // (0..7)
+
+            if ((!noBytesLeft) || (nbOfBitsInBitData != static_cast<uint8_t>(expectation)))
+              throw RemainingBitsError();
+            break;
+          }
+        } // switch (expectation)
+
+        break;
+      } // case States::open / States::empty
+
+    case States::closed:
+      throw ClosedError();
+
+    case States::error:
+      throw ErrorStateError();
+  } // switch (state)
+}
+
+/**
+ * \brief Closes the stream if it is not yet closed.
+ *
+ * The decorated stream is not closed. Any data read ahead from the decorated stream is discarded.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * The state of the object is modified. Any concurrent accesses are not safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ */
+void BufferedStreamReader::Close(void) noexcept
+{
+  readIdx = 0U;
+  fillLevel = 0U;
+  state = States::closed;
+}
+
+/// \copydoc IStreamReader::Skip
+void BufferedStreamReader::Skip(size_t nBits)
+{
+  if (nBits == 0U)
+    return;
+
+  switch (state)
+  {
+    case States::open:
+    {
+      // are there any bits that have not been read yet? -> skip them first
+      if (nbOfBitsInBitData != 0U)
+      {
+        // will all bits be skipped or will at least one bit be left?
+        if (nBits < nbOfBitsInBitData)
+        {
+          // (at least one bit will be left to be read after skip)
+
+          bitData >>= nBits;
+          nbOfBitsInBitData -= nBits;
+
+          // Finished. The desired number of bits has been skipped.
+          return;
+        }
+        else
+        {
+          // (all bits are skipped)
+
+          nBits -= nbOfBitsInBitData;
+          DiscardBits();
+          UpdateEmptyState();
+
+          // finished?
+          if (nBits == 0U)
+            return;
+        }
+      }
+
+      // at this point program logic guarantees, that "nbOfBitsInBitData" is zero and "nBits" is not zero
+
+      size_t       nBytes = nBits / 8U;
+      uint_fast8_t const nRemainingBits = nBits % 8U;
+
+      // skip bytes in buffer
+      size_t const nBytesInBuffer = std::min(nBytes, fillLevel - readIdx);
+      readIdx += nBytesInBuffer;
+      nBytes  -= nBytesInBuffer;
+
+      // skip bytes in decorated stream
+      if (nBytes != 0U)
+      {
+        if (underlyingEmpty)
+        {
+          state = States::error;
+          throw EmptyError();
+        }
+
+        try
+        {
+          underlyingStream.Skip(nBytes * 8U);
+          underlyingEmpty = (underlyingStream.GetState() == States::empty);
+        }
+        catch (...)
+        {
+          state = States::error;
+          throw;
+        }
+      }
+
+      UpdateEmptyState();
+
+      // skip bits
+      if (nRemainingBits != 0U)
+        (void)PopBits(nRemainingBits);
+
+      break;
+    } // case States::open
+
+    case States::empty:
+    {
+      state = States::error;
+      throw EmptyError();
+    }
+
+    case States::closed:
+      throw ClosedError();
+
+    case States::error:
+      throw ErrorStateError();
+  } // switch (state)
+}
+
+/// \copydoc IStreamReader::Read_string
+std::string BufferedStreamReader::Read_string(void)
+{
+  DiscardBits();
+
+  switch (state)
+  {
+    case States::open:
+    {
+      try
+      {
+        std::string str;
+        while (true)
+        {
+          if (readIdx == fillLevel)
+            FetchBlock();
+
+          char const * const pBegin = reinterpret_cast<char const *>(buffer.data() + readIdx);
+          size_t const n = fillLevel - readIdx;
+
+          // look for null-terminator
+          char const * const pNUL = static_cast<char const *>(memchr(pBegin, 0x00, n));
+          if (pNUL != nullptr)
+          {
+            size_t const len = static_cast<size_t>(pNUL - pBegin);
+            str.append(pBegin, len);
+            readIdx += len + 1U;
+            break;
+          }
+
+          str.append(pBegin, n);
+          readIdx = fillLevel;
+        }
+
+        UpdateEmptyState();
+        return str;
+      }
+      catch (...)
+      {
+        state = States::error;
+        throw;
+      }
+    }
+
+    case States::empty:
+    {
+      state = States::error;
+      throw EmptyError();
+    }
+
+    case States::closed:
+      throw ClosedError();
+
+    case States::error:
+      throw ErrorStateError();
+  } // switch (state)
+
+  PANIC();
+}
+
+/// \copydoc IStreamReader::Read_line
+std::string BufferedStreamReader::Read_line(void)
+{
+  DiscardBits();
+
+  switch (state)
+  {
+    case States::open:
+    {
+      try
+      {
+        if (readIdx == fillLevel)
+          FetchBlock();
+
+        auto const isEOL = [](char const c) -> bool { return ((c == '\n') || (c == '\r') || (c == 0x00)); };
+
+        std::string str;
+        char terminator = 'x';
+        while (true)
+        {
+          char const * const pBegin = reinterpret_cast<char const *>(buffer.data() + readIdx);
+          char const * const pEnd   = reinterpret_cast<char const *>(buffer.data() + fillLevel);
+
+          char const * const pEOL = std::find_if(pBegin, pEnd, isEOL);
+          size_t const len = static_cast<size_t>(pEOL - pBegin);
+          str.append(pBegin, len);
+          readIdx += len;
+
+          if (pEOL != pEnd)
+          {
+            // consume NUL, '\r', or '\n'
+            terminator = *pEOL;
+            readIdx++;
+            break;
+          }
+
+          // end of stream?
+          if (underlyingEmpty)
+            break;
+
+          FetchBlock();
+        }
+
+        // '\r\n'?
+        if (terminator == '\r')
+        {
+          if ((readIdx == fillLevel) && (!underlyingEmpty))
+            FetchBlock();
+
+          if ((readIdx != fillLevel) && (buffer[readIdx] == '\n'))
+            readIdx++;
+        }
+
+        UpdateEmptyState();
+        return str;
+      }
+      catch (...)
+      {
+        state = States::error;
+        throw;
+      }
+    }
+
+    case States::empty:
+    {
+      state = States::error;
+      throw EmptyError();
+    }
+
+    case States::closed:
+      throw ClosedError();
+
+    case States::error:
+      throw ErrorStateError();
+  } // switch (state)
+
+  PANIC();
+}
+
+// <-- IStreamReader
+
+// --> StreamReaderBase
+
+/// \copydoc StreamReaderBase::Pop(void)
+unsigned char BufferedStreamReader::Pop(void)
+{
+  DiscardBits();
+
+  switch (state)
+  {
+    case States::open:
+    {
+      if (readIdx == fillLevel)
+        FetchBlock();
+
+      unsigned char const c = buffer[readIdx++];
+      UpdateEmptyState();
+      return c;
+    }
+
+    case States::empty:
+    {
+      state = States::error;
+      throw EmptyError();
+    }
+
+    case States::closed:
+      throw ClosedError();
+
+    case States::error:
+      throw ErrorStateError();
+  } // switch (state)
+
+  PANIC();
+}
+
+/// \copydoc StreamReaderBase::Pop(void* p, size_t n)
+void BufferedStreamReader::Pop(void* p, size_t n)
+{
+  if (n == 0U)
+    return;
+
+  DiscardBits();
+
+  switch (state)
+  {
+    case States::open:
+    {
+      unsigned char* pDest = static_cast<unsigned char*>(p);
+
+      // read from buffer first
+      size_t chunkSize = std::min(n, fillLevel - readIdx);
+      memcpy(pDest, buffer.data() + readIdx, chunkSize);
+      readIdx += chunkSize;
+      pDest   += chunkSize;
+      n       -= chunkSize;
+
+      if (n >= buffer.size())
+      {
+        // (large read: bypass buffer)
+        ReadDirect(pDest, n);
+      }
+      else
+      {
+        while (n != 0U)
+        {
+          FetchBlock();
+
+          chunkSize = std::min(n, fillLevel);
+          memcpy(pDest, buffer.data(), chunkSize);
+          readIdx  = chunkSize;
+          pDest   += chunkSize;
+          n       -= chunkSize;
+        }
+      }
+
+      UpdateEmptyState();
+      break;
+    }
+
+    case States::empty:
+    {
+      state = States::error;
+      throw EmptyError();
+    }
+
+    case States::closed:
+      throw ClosedError();
+
+    case States::error:
+      throw ErrorStateError();
+  } // switch (state)
+}
+
+/// \copydoc StreamReaderBase::PopBits
+uint8_t BufferedStreamReader::PopBits(uint_fast8_t n)
+{
+  if (n == 0U)
+    return 0U;
+
+  if (n > 8U)
+    throw std::invalid_argument("BufferedStreamReader::PopBits: n must be [0..8].");
+
+  switch (state)
+  {
+    case States::open:
+    {
+      // fetch next 8 bits required?
+      if (n > nbOfBitsInBitData)
+      {
+        if (readIdx == fillLevel)
+          FetchBlock();
+
+        // append read byte to bitData
+        bitData |= static_cast<uint16_t>(buffer[readIdx++]) << nbOfBitsInBitData;
+        nbOfBitsInBitData += 8U;
+      }
+
+      // read bits
+      uint8_t const bits = bitData & ((1U << n) - 1U);
+      bitData >>= n;
+      nbOfBitsInBitData -= n;
+
+      UpdateEmptyState();
+      return bits;
+    }
+
+    case States::empty:
+    {
+      state = States::error;
+      throw EmptyError();
+    }
+
+    case States::closed:
+      throw ClosedError();
+
+    case States::error:
+      throw ErrorStateError();
+  } // switch (state)
+
+  PANIC();
+}
+
+// <-- StreamReaderBase
+
+/**
+ * \brief Reads the next block of data from the decorated stream into the buffer.
+ *
+ * \pre   The stream is in state @ref States::open.
+ *
+ * \pre   The buffer is empty.
+ *
+ * \post  The buffer contains at least one byte.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * The state of the object is modified. Any concurrent accesses are not safe.
+ *
+ * __Exception safety:__\n
+ * Basic guarantee:
+ * - the stream enters state @ref States::error
+ *
+ * \throws EmptyError   The decorated stream is empty ([details](@ref gpcc::stream::EmptyError)).
+ *
+ * Any exception thrown by the decorated stream is passed to the caller.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, if the decorated stream is safe. The stream enters state @ref States::error in case of cancellation.
+ */
+void BufferedStreamReader::FetchBlock(void)
+{
+  readIdx = 0U;
+  fillLevel = 0U;
+
+  if (underlyingEmpty)
+  {
+    state = States::error;
+    throw EmptyError();
+  }
+
+  try
+  {
+    if (remainingBytesSupported)
+    {
+      size_t const n = std::min(buffer.size(), underlyingStream.RemainingBytes());
+
+      // (zero is only possible if the precondition of the constructor has been violated)
+      if (n == 0U)
+        throw EmptyError();
+
+      underlyingStream.Read_uint8(buffer.data(), n);
+      fillLevel = n;
+    }
+    else
+    {
+      // The decorated stream cannot tell how many bytes are left. It must not be read beyond its end.
+      do
+      {
+        buffer[fillLevel] = underlyingStream.Read_uint8();
+        fillLevel++;
+      }
+      while ((fillLevel != buffer.size()) && (underlyingStream.GetState() == States::open));
+    }
+
+    underlyingEmpty = (underlyingStream.GetState() == States::empty);
+  }
+  catch (...)
+  {
+    readIdx = 0U;
+    fillLevel = 0U;
+    state = States::error;
+    throw;
+  }
+}
+
+/**
+ * \brief Reads data directly from the decorated stream, bypassing the buffer.
+ *
+ * \pre   The stream is in state @ref States::open.
+ *
+ * \pre   The buffer is empty.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * The state of the object is modified. Any concurrent accesses are not safe.
+ *
+ * __Exception safety:__\n
+ * Basic guarantee:
+ * - the stream enters state @ref States::error
+ *
+ * \throws EmptyError   Not enough data in the decorated stream ([details](@ref gpcc::stream::EmptyError)).
+ *
+ * Any exception thrown by the decorated stream is passed to the caller.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, if the decorated stream is safe. The stream enters state @ref States::error in case of cancellation.
+ *
+ * - - -
+ *
+ * \param p
+ * Pointer to the destination.
+ *
+ * \param n
+ * Number of bytes to be read.
+ */
+void BufferedStreamReader::ReadDirect(void* const p, size_t const n)
+{
+  if (underlyingEmpty)
+  {
+    state = States::error;
+    throw EmptyError();
+  }
+
+  try
+  {
+    underlyingStream.Read_uint8(static_cast<uint8_t*>(p), n);
+    underlyingEmpty = (underlyingStream.GetState() == States::empty);
+  }
+  catch (...)
+  {
+    state = States::error;
+    throw;
+  }
+}
+
+/**
+ * \brief Discards any bits of the last read byte that have not yet been read.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * The state of the object is modified. Any concurrent accesses are not safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ */
+void BufferedStreamReader::DiscardBits(void) noexcept
+{
+  nbOfBitsInBitData = 0U;
+  bitData = 0U;
+}
+
+/**
+ * \brief Switches the stream to @ref States::empty if there is no more data left to be read.
+ *
+ * \pre   The stream is in state @ref States::open.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * The state of the object is modified. Any concurrent accesses are not safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ */
+void BufferedStreamReader::UpdateEmptyState(void) noexcept
+{
+  if ((readIdx == fillLevel) && (nbOfBitsInBitData == 0U) && (underlyingEmpty))
+    state = States::empty;
+}
+
+} // namespace stream
+} // namespace gpcc
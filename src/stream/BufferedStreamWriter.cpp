@@ -0,0 +1,544 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#include <gpcc/stream/BufferedStreamWriter.hpp>
+#include <gpcc/osal/Panic.hpp>
+#include <gpcc/raii/scope_guard.hpp>
+#include <gpcc/stream/stream_errors.hpp>
+#include <algorithm>
+#include <stdexcept>
+#include <cstring>
+
+namespace gpcc   {
+namespace stream {
+
+/**
+ * \brief Constructor.
+ *
+ * \pre   The decorated stream must be in state [States::open](@ref gpcc::stream::IStreamWriter::States::open) or
+ *        [States::full](@ref gpcc::stream::IStreamWriter::States::full).
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * \throws ClosedError             The decorated stream is closed ([details](@ref gpcc::stream::ClosedError)).
+ *
+ * \throws ErrorStateError         The decorated stream is in error state
+ *                                 ([details](@ref gpcc::stream::ErrorStateError)).
+ *
+ * \throws std::invalid_argument   `bufferSize` is zero or the decorated stream contains cached bits.
+ *
+ * \throws std::bad_alloc          Out of memory.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param _underlyingStream
+ * Stream that shall be decorated.\n
+ * The stream must not be accessed by anyone else and it must not be released before this object.
+ *
+ * \param bufferSize
+ * Size of the buffer in bytes.\n
+ * Zero is not allowed.
+ */
+BufferedStreamWriter::BufferedStreamWriter(IStreamWriter & _underlyingStream, size_t const bufferSize)
+: StreamWriterBase(_underlyingStream.GetState(), _underlyingStream.GetEndian())
+, underlyingStream(_underlyingStream)
+, remainingCapacitySupported(_underlyingStream.IsRemainingCapacitySupported())
+, buffer()
+, fillLevel(0U)
+, remainingCapacity(0U)
+, nbOfBitsWritten(0U)
+, bitData(0U)
+{
+  if (state == States::closed)
+    throw ClosedError();
+  else if (state == States::error)
+    throw ErrorStateError();
+
+  if (bufferSize == 0U)
+    throw std::invalid_argument("BufferedStreamWriter::BufferedStreamWriter: bufferSize is zero");
+
+  if (underlyingStream.GetNbOfCachedBits() != 0U)
+    throw std::invalid_argument("BufferedStreamWriter::BufferedStreamWriter: _underlyingStream contains cached bits");
+
+  if (remainingCapacitySupported)
+    remainingCapacity = underlyingStream.RemainingCapacity();
+
+  buffer.resize(bufferSize);
+}
+
+/**
+ * \brief Destructor. Closes the stream (if not yet done) and releases the object.
+ *
+ * _Any stream should be closed via_ @ref Close() _before it is released._\n
+ * If it is not closed yet, then it will be closed now by this destructor.\n
+ * If the close-operation fails, then the application will terminate via @ref gpcc::osal::Panic().
+ * To avoid this scenario, invoke @ref Close() before destroying the object.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee:\n
+ * Operations may only fail due to serious errors that will result in program termination via Panic(...).\n
+ * To prevent any error, ensure that the stream is closed __before__ it is released.
+ *
+ * __Thread cancellation safety:__\n
+ * Deferred cancellation is not allowed.\n
+ * Any cancellation will result in @ref gpcc::osal::Panic().
+ */
+BufferedStreamWriter::~BufferedStreamWriter(void)
+{
+  try
+  {
+    if (state != States::closed)
+      Close();
+  }
+  catch (std::exception const & e)
+  {
+    PANIC_E(e);
+  }
+  catch (...)
+  {
+    PANIC();
+  }
+}
+
+/**
+ * \brief Writes the buffered data to the decorated stream.
+ *
+ * Any cached bits (see @ref GetNbOfCachedBits()) are not written.
+ *
+ * \pre   The stream must be in state [States::open](@ref gpcc::stream::IStreamWriter::States::open) or
+ *        [States::full](@ref gpcc::stream::IStreamWriter::States::full).
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * The state of the object is modified. Any concurrent accesses are not safe.
+ *
+ * __Exception safety:__\n
+ * Basic guarantee:
+ * - the stream enters state [States::error](@ref gpcc::stream::IStreamWriter::States::error)
+ *
+ * \throws ClosedError       Stream is closed ([details](@ref gpcc::stream::ClosedError)).
+ *
+ * \throws ErrorStateError   Stream is in error state ([details](@ref gpcc::stream::ErrorStateError)).
+ *
+ * Any exception thrown by the decorated stream is passed to the caller.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, if the decorated stream is safe. The stream enters state
+ * [States::error](@ref gpcc::stream::IStreamWriter::States::error) in case of cancellation.
+ */
+void BufferedStreamWriter::Flush(void)
+{
+  switch (state)
+  {
+    case States::open:
+    case States::full:
+      FlushBuffer();
+      break;
+
+    case States::closed:
+      throw ClosedError();
+
+    case States::error:
+      throw ErrorStateError();
+  } // switch (state)
+}
+
+// --> IStreamWriter
+
+/// \copydoc IStreamWriter::IsRemainingCapacitySupported
+bool BufferedStreamWriter::IsRemainingCapacitySupported(void) const
+{
+  return remainingCapacitySupported;
+}
+
+/// \copydoc IStreamWriter::RemainingCapacity
+size_t BufferedStreamWriter::RemainingCapacity(void) const
+{
+  switch (state)
+  {
+    case States::open:
+    case States::full:
+    {
+      if (!remainingCapacitySupported)
+        throw std::logic_error("BufferedStreamWriter::RemainingCapacity: Operation not supported");
+
+      return remainingCapacity;
+    }
+
+    case States::closed:
+      throw ClosedError();
+
+    case States::error:
+      throw ErrorStateError();
+  }
+
+  PANIC();
+}
+
+/// \copydoc IStreamWriter::GetNbOfCachedBits
+uint_fast8_t BufferedStreamWriter::GetNbOfCachedBits(void) const
+{
+  switch (state)
+  {
+    case States::open:
+    case States::full:
+      return nbOfBitsWritten;
+
+    case States::closed:
+      throw ClosedError();
+
+    case States::error:
+      throw ErrorStateError();
+  }
+
+  PANIC();
+}
+
+/**
+ * \brief Closes the stream if it is not yet closed.
+ *
+ * Any buffered data is written to the decorated stream. Any cached bits are written to the decorated stream as bits.
+ * The decorated stream is not closed.
+ *
+ * If the stream is in state [States::error](@ref gpcc::stream::IStreamWriter::States::error), then any buffered data
+ * is discarded.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * The state of the object is modified. Any concurrent accesses are not safe.
+ *
+ * __Exception safety:__\n
+ * Basic guarantee:
+ * - In any case, the stream will always be closed.
+ * - Buffered data may not have been written to the decorated stream.
+ *
+ * Any exception thrown by the decorated stream is passed to the caller.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, if the decorated stream is safe. The stream will always be closed.
+ */
+void BufferedStreamWriter::Close(void)
+{
+  if ((state == States::open) || (state == States::full))
+  {
+    ON_SCOPE_EXIT()
+    {
+      fillLevel = 0U;
+      nbOfBitsWritten = 0U;
+      bitData = 0U;
+      state = States::closed;
+    };
+
+    FlushBuffer();
+
+    if (nbOfBitsWritten != 0U)
+      underlyingStream.Write_Bits(bitData, nbOfBitsWritten);
+  }
+  else
+  {
+    fillLevel = 0U;
+    state = States::closed;
+  }
+}
+
+// <-- IStreamWriter
+
+// --> StreamWriterBase
+
+/// \copydoc StreamWriterBase::Push(char c)
+void BufferedStreamWriter::Push(char c)
+{
+  // Write bits first if some bits are not yet written so that the byte based data will
+  // be aligned to a byte boundary.
+  if (nbOfBitsWritten != 0U)
+  {
+    // move the bits to be written into d
+    char const d = static_cast<char>(bitData);
+
+    // clear bit buffer now and not after writing the bits, because we are going to call this method recursive now!
+    nbOfBitsWritten = 0U;
+    bitData = 0U;
+
+    // write bits
+    Push(d);
+  }
+
+  switch (state)
+  {
+    case States::open:
+    {
+      AppendByte(static_cast<unsigned char>(c));
+
+      // full?
+      if ((remainingCapacitySupported) && (remainingCapacity == 0U))
+        state = States::full;
+
+      break;
+    }
+
+    case States::full:
+    {
+      state = States::error;
+      throw FullError();
+    }
+
+    case States::closed:
+      throw ClosedError();
+
+    case States::error:
+      throw ErrorStateError();
+  } // switch (state)
+}
+
+/// \copydoc StreamWriterBase::Push(void const * pData, size_t n)
+void BufferedStreamWriter::Push(void const * pData, size_t n)
+{
+  if (n == 0U)
+    return;
+
+  // Write bits first if some bits are not yet written so that the byte based data will
+  // be aligned to a byte boundary.
+  if (nbOfBitsWritten != 0U)
+  {
+    // move the bits to be written into d
+    char const d = static_cast<char>(bitData);
+
+    // clear bit buffer now and not after writing the bits, because we are going to call this method now!
+    nbOfBitsWritten = 0U;
+    bitData = 0U;
+
+    // write bits
+    Push(d);
+  }
+
+  switch (state)
+  {
+    case States::open:
+    {
+      // does "n" exceed the remaining capacity?
+      if ((remainingCapacitySupported) && (n > remainingCapacity))
+      {
+        state = States::error;
+        throw FullError();
+      }
+
+      if (n >= buffer.size())
+      {
+        // (large write: bypass buffer)
+        FlushBuffer();
+
+        try
+        {
+          underlyingStream.Write_uint8(static_cast<uint8_t const *>(pData), n);
+        }
+        catch (...)
+        {
+          state = States::error;
+          throw;
+        }
+      }
+      else
+      {
+        unsigned char const * pSrc = static_cast<unsigned char const *>(pData);
+        size_t remaining = n;
+        while (remaining != 0U)
+        {
+          if (fillLevel == buffer.size())
+            FlushBuffer();
+
+          size_t const chunkSize = std::min(remaining, buffer.size() - fillLevel);
+          memcpy(buffer.data() + fillLevel, pSrc, chunkSize);
+          fillLevel += chunkSize;
+          pSrc      += chunkSize;
+          remaining -= chunkSize;
+        }
+      }
+
+      if (remainingCapacitySupported)
+      {
+        remainingCapacity -= n;
+
+        // full?
+        if (remainingCapacity == 0U)
+          state = States::full;
+      }
+
+      break;
+    }
+
+    case States::full:
+    {
+      state = States::error;
+      throw FullError();
+    }
+
+    case States::closed:
+      throw ClosedError();
+
+    case States::error:
+      throw ErrorStateError();
+  } // switch (state)
+}
+
+/// \copydoc StreamWriterBase::PushBits
+void BufferedStreamWriter::PushBits(uint8_t bits, uint_fast8_t n)
+{
+  if (n == 0U)
+    return;
+
+  if (n > 8U)
+    throw std::invalid_argument("BufferedStreamWriter::PushBits: n must be [0..8].");
+
+  switch (state)
+  {
+    case States::open:
+    {
+      // clear upper bits that shall be ignored
+      bits &= static_cast<uint_fast16_t>(static_cast<uint_fast16_t>(1U) << n) - 1U;
+
+      // combine potential previously written bits with the bits that shall be written
+      uint_fast16_t data = static_cast<uint_fast16_t>(bitData) | (static_cast<uint_fast16_t>(bits) << nbOfBitsWritten);
+      nbOfBitsWritten += n;
+
+      // one byte filled up with bits?
+      if (nbOfBitsWritten >= 8U)
+      {
+        // write byte into the buffer
+        AppendByte(static_cast<unsigned char>(data));
+
+        nbOfBitsWritten -= 8U;
+        data >>= 8U;
+
+        // capacity exhausted?
+        if ((remainingCapacitySupported) && (remainingCapacity == 0U))
+        {
+          // more bits to be written?
+          if (nbOfBitsWritten != 0U)
+          {
+            // wrote beyond end of stream
+            state = States::error;
+            throw FullError();
+          }
+          else
+          {
+            state = States::full;
+          }
+        }
+      }
+
+      // store temporary stuff back in bitData
+      bitData = static_cast<uint8_t>(data);
+
+      break;
+    }
+
+    case States::full:
+    {
+      // (attempt to write to a full stream)
+      state = States::error;
+      throw FullError();
+    }
+
+    case States::closed:
+      throw ClosedError();
+
+    case States::error:
+      throw ErrorStateError();
+  } // switch (state)
+}
+
+// <-- StreamWriterBase
+
+/**
+ * \brief Appends one byte to the buffer. The buffer is written to the decorated stream before, if it is full.
+ *
+ * @ref remainingCapacity is updated.
+ *
+ * \pre   The stream is in state @ref States::open.
+ *
+ * \pre   If @ref remainingCapacitySupported is true, then @ref remainingCapacity is not zero.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * The state of the object is modified. Any concurrent accesses are not safe.
+ *
+ * __Exception safety:__\n
+ * Basic guarantee:
+ * - the stream enters state @ref States::error
+ *
+ * Any exception thrown by the decorated stream is passed to the caller.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, if the decorated stream is safe. The stream enters state @ref States::error in case of cancellation.
+ *
+ * - - -
+ *
+ * \param c
+ * Byte that shall be appended.
+ */
+void BufferedStreamWriter::AppendByte(unsigned char const c)
+{
+  if (fillLevel == buffer.size())
+    FlushBuffer();
+
+  buffer[fillLevel++] = c;
+
+  if (remainingCapacitySupported)
+    remainingCapacity--;
+}
+
+/**
+ * \brief Writes the content of the buffer to the decorated stream.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * The state of the object is modified. Any concurrent accesses are not safe.
+ *
+ * __Exception safety:__\n
+ * Basic guarantee:
+ * - the stream enters state @ref States::error
+ *
+ * Any exception thrown by the decorated stream is passed to the caller.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, if the decorated stream is safe. The stream enters state @ref States::error in case of cancellation.
+ */
+void BufferedStreamWriter::FlushBuffer(void)
+{
+  if (fillLevel == 0U)
+    return;
+
+  try
+  {
+    underlyingStream.Write_uint8(buffer.data(), fillLevel);
+    fillLevel = 0U;
+  }
+  catch (...)
+  {
+    fillLevel = 0U;
+    state = States::error;
+    throw;
+  }
+}
+
+} // namespace stream
+} // namespace gpcc
@@ -391,6 +391,184 @@ void MemStreamReader::Shrink(size_t const newRemainingBytes)
   } // switch (state)
 }
 
+/**
+ * \brief Retrieves a pointer to the next bytes that would be read from the stream, without reading them.
+ *
+ * This allows to access the underlying memory without copying it. The state of the stream is not modified.
+ *
+ * If there are any bits of the current read byte that have not yet been read, then the returned pointer refers to the
+ * first byte behind the current read byte. This is the same byte that would be read by the next byte-based read
+ * operation.
+ *
+ * \pre   The stream must be in [States::open](@ref gpcc::stream::IStreamReader::States::open) or
+ *        [States::empty](@ref gpcc::stream::IStreamReader::States::empty).
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * The state of the object is not modified. Concurrent accesses are safe.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * \throws EmptyError           Less than `n` bytes are left to be read ([details](@ref gpcc::stream::EmptyError)).
+ *
+ * \throws ClosedError          Stream is closed ([details](@ref gpcc::stream::ClosedError)).
+ *
+ * \throws ErrorStateError      Stream is in error state ([details](@ref gpcc::stream::ErrorStateError)).
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \param n
+ * Number of bytes that shall be accessible via the returned pointer.\n
+ * Zero is allowed.
+ *
+ * \return
+ * Pointer to the next `n` bytes in the underlying memory.\n
+ * If `n` is zero, then nullptr is returned.\n
+ * The pointer is valid as long as the underlying memory is valid. The referenced data must not be modified.
+ */
+void const * MemStreamReader::PeekSpan(size_t const n) const
+{
+  switch (state)
+  {
+    case States::open:
+    {
+      if (n > remainingBytes)
+        throw EmptyError();
+
+      if (n == 0U)
+        return nullptr;
+
+      return pMem;
+    }
+
+    case States::empty:
+    {
+      if (n != 0U)
+        throw EmptyError();
+
+      return nullptr;
+    }
+
+    case States::closed:
+      throw ClosedError();
+
+    case States::error:
+      throw ErrorStateError();
+  } // switch (state)
+
+  PANIC();
+}
+
+/**
+ * \brief Reads one or more bytes from the stream without copying them and retrieves a pointer to the read bytes.
+ *
+ * This is the zero-copy equivalent of @ref IStreamReader::Read_uint8(uint8_t*, size_t). Instead of copying the data
+ * into a buffer provided by the caller, a pointer into the underlying memory is returned.
+ *
+ * If there are any bits of the current read byte that have not yet been read, then the bits will be discarded
+ * and the read pointer will be moved to the next byte boundary before the bytes are read.
+ *
+ * In contrast to the read-methods offered by @ref IStreamReader, the stream will not enter
+ * [States::error](@ref gpcc::stream::IStreamReader::States::error) if there are less than `n` bytes left to be read.
+ * Instead the stream is not modified at all. This allows to fall back to the regular read-methods.
+ *
+ * \pre   The stream must be in [States::open](@ref gpcc::stream::IStreamReader::States::open) or
+ *        [States::empty](@ref gpcc::stream::IStreamReader::States::empty).
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * The state of the object is modified. Any concurrent accesses are not safe.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * \throws EmptyError           Less than `n` bytes are left to be read ([details](@ref gpcc::stream::EmptyError)).
+ *
+ * \throws ClosedError          Stream is closed ([details](@ref gpcc::stream::ClosedError)).
+ *
+ * \throws ErrorStateError      Stream is in error state ([details](@ref gpcc::stream::ErrorStateError)).
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \param n
+ * Number of bytes to be read.\n
+ * Zero is allowed.\n
+ * Note that any bits that have not yet been read will be discarded, even if this is zero.
+ *
+ * \return
+ * Pointer to the read bytes in the underlying memory.\n
+ * If `n` is zero, then nullptr is returned.\n
+ * The pointer is valid as long as the underlying memory is valid. The referenced data must not be modified.
+ */
+void const * MemStreamReader::ReadSpan(size_t const n)
+{
+  switch (state)
+  {
+    case States::open:
+    {
+      if (n > remainingBytes)
+        throw EmptyError();
+
+      // discard any bits from the last read byte that have not yet been read
+      if (nbOfBitsInBitData != 0U)
+      {
+        nbOfBitsInBitData = 0;
+        bitData = 0;
+      }
+
+      if (n == 0U)
+      {
+        if (remainingBytes == 0U)
+          state = States::empty;
+
+        return nullptr;
+      }
+
+      char const * const pRet = pMem;
+      remainingBytes -= n;
+
+      if (remainingBytes == 0U)
+      {
+        // (empty now)
+        pMem = nullptr;
+        state = States::empty;
+      }
+      else
+      {
+        // (move read pointer forward)
+        pMem += n;
+      }
+
+      return pRet;
+    }
+
+    case States::empty:
+    {
+      if (n != 0U)
+        throw EmptyError();
+
+      return nullptr;
+    }
+
+    case States::closed:
+      throw ClosedError();
+
+    case States::error:
+      throw ErrorStateError();
+  } // switch (state)
+
+  PANIC();
+}
+
 /**
  * \brief Retrieves the read-pointer of the @ref MemStreamReader.
  *
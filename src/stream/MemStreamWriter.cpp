@@ -261,6 +261,112 @@ MemStreamWriter& MemStreamWriter::operator=(MemStreamWriter&& rhv) noexcept
   return *this;
 }
 
+/**
+ * \brief Reserves one or more bytes in the stream and retrieves a pointer to them, so that the caller can write the
+ *        data directly into the underlying memory.
+ *
+ * This is the zero-copy equivalent of @ref IStreamWriter::Write_uint8(uint8_t const *, size_t). Instead of copying
+ * data provided by the caller, a pointer into the underlying memory is returned. The caller shall write all `n` bytes
+ * referenced by the returned pointer. The content of the reserved bytes is undefined until they are written by the
+ * caller.
+ *
+ * If there are any bits that have been written via bit based write methods and that have not yet been written to the
+ * underlying memory, then these bits will be written (padded with zeros) before the bytes are reserved.
+ *
+ * In contrast to the write-methods offered by @ref IStreamWriter, the stream will not enter
+ * [States::error](@ref gpcc::stream::IStreamWriter::States::error) if the remaining capacity is not sufficient.
+ * Instead the stream is not modified at all. This allows to fall back to the regular write-methods.
+ *
+ * \pre   The stream must be in [States::open](@ref gpcc::stream::IStreamWriter::States::open) or
+ *        [States::full](@ref gpcc::stream::IStreamWriter::States::full).
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * The state of the object is modified. Any concurrent accesses are not safe.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * \throws FullError            Remaining capacity is not sufficient ([details](@ref gpcc::stream::FullError)).
+ *
+ * \throws ClosedError          Stream is closed ([details](@ref gpcc::stream::ClosedError)).
+ *
+ * \throws ErrorStateError      Stream is in error state ([details](@ref gpcc::stream::ErrorStateError)).
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \param n
+ * Number of bytes that shall be reserved.\n
+ * Zero is allowed. In this case the stream is not modified.
+ *
+ * \return
+ * Pointer to the reserved bytes in the underlying memory.\n
+ * If `n` is zero, then nullptr is returned.\n
+ * The pointer is valid as long as the underlying memory is valid.
+ */
+void* MemStreamWriter::ReserveSpan(size_t const n)
+{
+  switch (state)
+  {
+    case States::open:
+    {
+      if (n == 0U)
+        return nullptr;
+
+      // Any bits not yet written will occupy one byte in front of the reserved bytes.
+      // The design guarantees that one byte of capacity is left if there are any bits.
+      size_t const nbOfBitBytes = (nbOfBitsWritten != 0U) ? 1U : 0U;
+      if (n > remainingBytes - nbOfBitBytes)
+        throw FullError();
+
+      // write bits first if some bits are not yet written
+      if (nbOfBitsWritten != 0U)
+      {
+        *pMem++ = static_cast<char>(bitData);
+        remainingBytes--;
+        nbOfBitsWritten = 0;
+        bitData = 0;
+      }
+
+      char * const pRet = pMem;
+      remainingBytes -= n;
+
+      // full?
+      if (remainingBytes == 0U)
+      {
+        pMem = nullptr;
+        state = States::full;
+      }
+      else
+      {
+        pMem += n;
+      }
+
+      return pRet;
+    }
+
+    case States::full:
+    {
+      if (n != 0U)
+        throw FullError();
+
+      return nullptr;
+    }
+
+    case States::closed:
+      throw ClosedError();
+
+    case States::error:
+      throw ErrorStateError();
+  } // switch (state)
+
+  PANIC();
+}
+
 // --> IStreamWriter
 
 bool MemStreamWriter::IsRemainingCapacitySupported(void) const
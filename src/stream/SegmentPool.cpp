@@ -0,0 +1,180 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#include <gpcc/stream/SegmentPool.hpp>
+#include <gpcc/osal/MutexLocker.hpp>
+#include <gpcc/osal/Panic.hpp>
+#include <stdexcept>
+
+namespace gpcc   {
+namespace stream {
+
+using namespace gpcc::osal;
+
+/**
+ * \brief Constructor.
+ *
+ * No segments are allocated here. Segments are allocated on demand.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Deferred cancellation is safe.
+ *
+ * - - -
+ *
+ * \param _segmentSize
+ * Size of each segment in bytes.\n
+ * Zero is not allowed.
+ *
+ * \param _maxNbOfCachedSegments
+ * Maximum number of returned segments that shall be kept for reuse.\n
+ * Zero is allowed. In this case, each segment is released to the heap when it is returned to the pool.
+ */
+SegmentPool::SegmentPool(size_t const _segmentSize, size_t const _maxNbOfCachedSegments)
+: segmentSize(_segmentSize)
+, maxNbOfCachedSegments(_maxNbOfCachedSegments)
+, mutex()
+, cachedSegments()
+, nbOfSegmentsInUse(0U)
+{
+  if (segmentSize == 0U)
+    throw std::invalid_argument("SegmentPool::SegmentPool: _segmentSize is zero");
+
+  cachedSegments.reserve(maxNbOfCachedSegments);
+}
+
+/**
+ * \brief Destructor.
+ *
+ * \pre   All segments must have been returned to the pool.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ */
+SegmentPool::~SegmentPool(void)
+{
+  if (nbOfSegmentsInUse != 0U)
+    Panic("SegmentPool::~SegmentPool: Segments still in use");
+
+  for (auto const p : cachedSegments)
+    delete [] p;
+}
+
+/**
+ * \brief Retrieves the number of segments currently cached for reuse.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \return
+ * Number of segments currently cached for reuse.
+ */
+size_t SegmentPool::GetNbOfCachedSegments(void) const
+{
+  MutexLocker mutexLocker(mutex);
+  return cachedSegments.size();
+}
+
+/**
+ * \brief Retrieves a segment from the pool.
+ *
+ * If the pool is empty, then a new segment is allocated on the heap.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * \throws std::bad_alloc   Out of memory.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \return
+ * Pointer to the segment. The segment has a size of @ref GetSegmentSize() bytes.\n
+ * The content of the segment is undefined.\n
+ * The segment must be returned to the pool via @ref Put().
+ */
+unsigned char* SegmentPool::Get(void)
+{
+  MutexLocker mutexLocker(mutex);
+
+  unsigned char* pSegment;
+  if (!cachedSegments.empty())
+  {
+    pSegment = cachedSegments.back();
+    cachedSegments.pop_back();
+  }
+  else
+  {
+    pSegment = new unsigned char[segmentSize];
+  }
+
+  nbOfSegmentsInUse++;
+  return pSegment;
+}
+
+/**
+ * \brief Returns a segment to the pool.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * This is thread-safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param pSegment
+ * Pointer to the segment that shall be returned. The segment must have been retrieved via @ref Get().
+ */
+void SegmentPool::Put(unsigned char* const pSegment) noexcept
+{
+  MutexLocker mutexLocker(mutex);
+
+  if (cachedSegments.size() < maxNbOfCachedSegments)
+    cachedSegments.push_back(pSegment);
+  else
+    delete [] pSegment;
+
+  nbOfSegmentsInUse--;
+}
+
+} // namespace stream
+} // namespace gpcc
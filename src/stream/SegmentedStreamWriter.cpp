@@ -0,0 +1,541 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#include <gpcc/stream/SegmentedStreamWriter.hpp>
+#include <gpcc/osal/Panic.hpp>
+#include <gpcc/raii/scope_guard.hpp>
+#include <gpcc/stream/SegmentPool.hpp>
+#include <gpcc/stream/stream_errors.hpp>
+#include <algorithm>
+#include <stdexcept>
+#include <cstring>
+
+namespace gpcc   {
+namespace stream {
+
+/**
+ * \brief Constructor. Creates an empty @ref SegmentedStreamWriter in state @ref States::open.
+ *
+ * No segment is retrieved from the pool here. Segments are retrieved when data is written.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param _pool
+ * Pool from which segments shall be retrieved.\n
+ * The pool must not be destroyed before this object.
+ *
+ * \param _endian
+ * Endian of the data that shall be written.
+ */
+SegmentedStreamWriter::SegmentedStreamWriter(SegmentPool & _pool, Endian const _endian)
+: StreamWriterBase(States::open, _endian)
+, pool(_pool)
+, segmentSize(_pool.GetSegmentSize())
+, segments()
+, pWrite(nullptr)
+, remainingBytesInSegment(0U)
+, size(0U)
+, nbOfBitsWritten(0U)
+, bitData(0U)
+{
+}
+
+/**
+ * \brief Destructor. Closes the stream (if not yet done) and returns all segments to the pool.
+ *
+ * - - -
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ */
+SegmentedStreamWriter::~SegmentedStreamWriter(void)
+{
+  Close();
+
+  for (auto const p : segments)
+    pool.Put(p);
+}
+
+/**
+ * \brief Retrieves the number of bytes written to the stream.
+ *
+ * \pre   The stream must be in state [States::open](@ref gpcc::stream::IStreamWriter::States::open) or
+ *        [States::closed](@ref gpcc::stream::IStreamWriter::States::closed).
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * The state of the object is not modified. Concurrent accesses are safe.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * \throws ErrorStateError   Stream is in error state ([details](@ref gpcc::stream::ErrorStateError)).
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \return
+ * Number of bytes written to the stream.\n
+ * If the stream is not yet closed, then any cached bits (see @ref GetNbOfCachedBits()) are not included.
+ */
+size_t SegmentedStreamWriter::GetSize(void) const
+{
+  CheckDataAccessible();
+  return size;
+}
+
+/**
+ * \brief Retrieves a list of memory chunks containing the data written to the stream.
+ *
+ * The list can be used for vectored output (e.g. `writev()`) without copying the data.
+ *
+ * \pre   The stream must be in state [States::open](@ref gpcc::stream::IStreamWriter::States::open) or
+ *        [States::closed](@ref gpcc::stream::IStreamWriter::States::closed).
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * The state of the object is not modified. Concurrent accesses are safe.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * \throws ErrorStateError   Stream is in error state ([details](@ref gpcc::stream::ErrorStateError)).
+ *
+ * \throws std::bad_alloc    Out of memory.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \return
+ * List of memory chunks. Concatenating the chunks in the order of the list yields the written data.\n
+ * The list is empty if no data has been written.\n
+ * If the stream is not yet closed, then any cached bits (see @ref GetNbOfCachedBits()) are not included.\n
+ * The referenced memory is valid until this object is destroyed or until further data is written to the stream.
+ */
+std::vector<SegmentedStreamWriter::Chunk> SegmentedStreamWriter::GetGatherList(void) const
+{
+  CheckDataAccessible();
+
+  std::vector<Chunk> list;
+  list.reserve(segments.size());
+
+  size_t remaining = size;
+  for (auto const p : segments)
+  {
+    if (remaining == 0U)
+      break;
+
+    size_t const n = std::min(remaining, segmentSize);
+    list.push_back(Chunk{p, n});
+    remaining -= n;
+  }
+
+  return list;
+}
+
+/**
+ * \brief Copies the data written to the stream into a new contiguous buffer.
+ *
+ * \pre   The stream must be in state [States::open](@ref gpcc::stream::IStreamWriter::States::open) or
+ *        [States::closed](@ref gpcc::stream::IStreamWriter::States::closed).
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * The state of the object is not modified. Concurrent accesses are safe.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * \throws ErrorStateError   Stream is in error state ([details](@ref gpcc::stream::ErrorStateError)).
+ *
+ * \throws std::bad_alloc    Out of memory.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \return
+ * Buffer containing the data written to the stream.\n
+ * If the stream is not yet closed, then any cached bits (see @ref GetNbOfCachedBits()) are not included.
+ */
+std::vector<uint8_t> SegmentedStreamWriter::Flatten(void) const
+{
+  CheckDataAccessible();
+
+  std::vector<uint8_t> v(size);
+  Flatten(v.data(), v.size());
+  return v;
+}
+
+/**
+ * \brief Copies the data written to the stream into a contiguous buffer provided by the caller.
+ *
+ * \pre   The stream must be in state [States::open](@ref gpcc::stream::IStreamWriter::States::open) or
+ *        [States::closed](@ref gpcc::stream::IStreamWriter::States::closed).
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * The state of the object is not modified. Concurrent accesses are safe.\n
+ * The memory referenced by `pDest` is modified.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * \throws ErrorStateError         Stream is in error state ([details](@ref gpcc::stream::ErrorStateError)).
+ *
+ * \throws std::invalid_argument   `destSize` is less than @ref GetSize().
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ *
+ * - - -
+ *
+ * \param pDest
+ * Pointer to the destination buffer.\n
+ * nullptr is allowed, if no data has been written to the stream.
+ *
+ * \param destSize
+ * Size of the destination buffer in bytes. This must be equal to or larger than @ref GetSize().\n
+ * Only the first @ref GetSize() bytes of the destination buffer are written.
+ */
+void SegmentedStreamWriter::Flatten(void* const pDest, size_t const destSize) const
+{
+  CheckDataAccessible();
+
+  if (destSize < size)
+    throw std::invalid_argument("SegmentedStreamWriter::Flatten: destSize too small");
+
+  unsigned char* pd = static_cast<unsigned char*>(pDest);
+  size_t remaining = size;
+  for (auto const p : segments)
+  {
+    if (remaining == 0U)
+      break;
+
+    size_t const n = std::min(remaining, segmentSize);
+    memcpy(pd, p, n);
+    pd += n;
+    remaining -= n;
+  }
+}
+
+// --> IStreamWriter
+
+/// \copydoc IStreamWriter::IsRemainingCapacitySupported
+bool SegmentedStreamWriter::IsRemainingCapacitySupported(void) const
+{
+  return false;
+}
+
+/// \copydoc IStreamWriter::RemainingCapacity
+size_t SegmentedStreamWriter::RemainingCapacity(void) const
+{
+  switch (state)
+  {
+    case States::open:
+      throw std::logic_error("SegmentedStreamWriter::RemainingCapacity: Operation not supported");
+
+    case States::full:
+      // (this state is not used by class SegmentedStreamWriter)
+      throw std::logic_error("SegmentedStreamWriter::RemainingCapacity: Unused state (States::full) encountered");
+
+    case States::closed:
+      throw ClosedError();
+
+    case States::error:
+      throw ErrorStateError();
+  }
+
+  PANIC();
+}
+
+/// \copydoc IStreamWriter::GetNbOfCachedBits
+uint_fast8_t SegmentedStreamWriter::GetNbOfCachedBits(void) const
+{
+  switch (state)
+  {
+    case States::open:
+      return nbOfBitsWritten;
+
+    case States::full:
+      // (this state is not used by class SegmentedStreamWriter)
+      throw std::logic_error("SegmentedStreamWriter::GetNbOfCachedBits: Unused state (States::full) encountered");
+
+    case States::closed:
+      throw ClosedError();
+
+    case States::error:
+      throw ErrorStateError();
+  }
+
+  PANIC();
+}
+
+/// \copydoc IStreamWriter::Close
+void SegmentedStreamWriter::Close(void) noexcept
+{
+  if ((state == States::open) && (nbOfBitsWritten != 0U))
+    FlushBits();
+
+  state = States::closed;
+}
+
+// <-- IStreamWriter
+
+// --> StreamWriterBase
+
+/// \copydoc StreamWriterBase::Push(char c)
+void SegmentedStreamWriter::Push(char c)
+{
+  switch (state)
+  {
+    case States::open:
+    {
+      if (nbOfBitsWritten != 0U)
+        FlushBits();
+
+      if (remainingBytesInSegment == 0U)
+        AddSegment();
+
+      *pWrite++ = static_cast<unsigned char>(c);
+      remainingBytesInSegment--;
+      size++;
+      break;
+    }
+
+    case States::full:
+      // (this state is not used by class SegmentedStreamWriter)
+      state = States::error;
+      throw std::logic_error("SegmentedStreamWriter::Push: Unused state (States::full) encountered");
+
+    case States::closed:
+      throw ClosedError();
+
+    case States::error:
+      throw ErrorStateError();
+  } // switch (state)
+}
+
+/// \copydoc StreamWriterBase::Push(void const * pData, size_t n)
+void SegmentedStreamWriter::Push(void const * pData, size_t n)
+{
+  if (n == 0U)
+    return;
+
+  switch (state)
+  {
+    case States::open:
+    {
+      if (nbOfBitsWritten != 0U)
+        FlushBits();
+
+      unsigned char const * ps = static_cast<unsigned char const*>(pData);
+      while (n != 0U)
+      {
+        if (remainingBytesInSegment == 0U)
+          AddSegment();
+
+        size_t const chunkSize = std::min(n, remainingBytesInSegment);
+        memcpy(pWrite, ps, chunkSize);
+        pWrite += chunkSize;
+        remainingBytesInSegment -= chunkSize;
+        size += chunkSize;
+        ps += chunkSize;
+        n -= chunkSize;
+      }
+
+      break;
+    }
+
+    case States::full:
+      // (this state is not used by class SegmentedStreamWriter)
+      state = States::error;
+      throw std::logic_error("SegmentedStreamWriter::Push: Unused state (States::full) encountered");
+
+    case States::closed:
+      throw ClosedError();
+
+    case States::error:
+      throw ErrorStateError();
+  } // switch (state)
+}
+
+/// \copydoc StreamWriterBase::PushBits
+void SegmentedStreamWriter::PushBits(uint8_t bits, uint_fast8_t n)
+{
+  if (n == 0U)
+    return;
+
+  if (n > 8U)
+    throw std::invalid_argument("SegmentedStreamWriter::PushBits: n must be [0..8].");
+
+  switch (state)
+  {
+    case States::open:
+    {
+      // Ensure that there is space for the byte that will finally contain the bits.
+      if (remainingBytesInSegment == 0U)
+        AddSegment();
+
+      // clear upper bits that shall be ignored
+      bits &= static_cast<uint_fast16_t>(static_cast<uint_fast16_t>(1U) << n) - 1U;
+
+      // combine potential previously written bits with the bits that shall be written
+      uint_fast16_t data = static_cast<uint_fast16_t>(bitData) | (static_cast<uint_fast16_t>(bits) << nbOfBitsWritten);
+      nbOfBitsWritten += n;
+
+      // one byte filled up with bits?
+      if (nbOfBitsWritten >= 8U)
+      {
+        *pWrite++ = static_cast<unsigned char>(data);
+        remainingBytesInSegment--;
+        size++;
+
+        nbOfBitsWritten -= 8U;
+        data >>= 8U;
+      }
+
+      // store temporary stuff back in bitData
+      bitData = static_cast<uint8_t>(data);
+
+      // Ensure that there is space for the byte that will finally contain the remaining bits.
+      if ((nbOfBitsWritten != 0U) && (remainingBytesInSegment == 0U))
+        AddSegment();
+
+      break;
+    }
+
+    case States::full:
+      // (this state is not used by class SegmentedStreamWriter)
+      state = States::error;
+      throw std::logic_error("SegmentedStreamWriter::PushBits: Unused state (States::full) encountered");
+
+    case States::closed:
+      throw ClosedError();
+
+    case States::error:
+      throw ErrorStateError();
+  } // switch (state)
+}
+
+// <-- StreamWriterBase
+
+/**
+ * \brief Appends a new segment to the chain of segments.
+ *
+ * \pre   The last segment (if any) is full.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * The state of the object is modified. Any concurrent accesses are not safe.
+ *
+ * __Exception safety:__\n
+ * Basic guarantee:
+ * - the stream enters state @ref States::error if no segment could be appended
+ *
+ * \throws std::bad_alloc   Out of memory.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ */
+void SegmentedStreamWriter::AddSegment(void)
+{
+  try
+  {
+    unsigned char* const pSegment = pool.Get();
+    ON_SCOPE_EXIT(returnSegment) { pool.Put(pSegment); };
+
+    segments.push_back(pSegment);
+
+    ON_SCOPE_EXIT_DISMISS(returnSegment);
+
+    pWrite = pSegment;
+    remainingBytesInSegment = segmentSize;
+  }
+  catch (...)
+  {
+    state = States::error;
+    throw;
+  }
+}
+
+/**
+ * \brief Writes the cached bits (padded with zeros) into the stream.
+ *
+ * \pre   The stream is in state @ref States::open.
+ *
+ * \pre   There are cached bits. The design guarantees that there is space for one byte in the last segment.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * The state of the object is modified. Any concurrent accesses are not safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ */
+void SegmentedStreamWriter::FlushBits(void) noexcept
+{
+  *pWrite++ = bitData;
+  remainingBytesInSegment--;
+  size++;
+
+  nbOfBitsWritten = 0U;
+  bitData = 0U;
+}
+
+/**
+ * \brief Checks if the written data can be accessed in the current state of the stream.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * The state of the object is not modified. Concurrent accesses are safe.
+ *
+ * __Exception safety:__\n
+ * Strong guarantee.
+ *
+ * \throws ErrorStateError   Stream is in error state ([details](@ref gpcc::stream::ErrorStateError)).
+ *
+ * __Thread cancellation safety:__\n
+ * Safe, no cancellation point included.
+ */
+void SegmentedStreamWriter::CheckDataAccessible(void) const
+{
+  if (state == States::error)
+    throw ErrorStateError();
+}
+
+} // namespace stream
+} // namespace gpcc
@@ -9,6 +9,7 @@
 */
 
 #include <gpcc/stream/StreamReaderBase.hpp>
+#include <gpcc/stream/internal/byte_order.hpp>
 
 namespace gpcc
 {
@@ -49,64 +50,27 @@ uint16_t StreamReaderBase::Read_uint16(void)
 /// \copydoc IStreamReader::Read_uint16(void)
 {
   uint16_t retVal;
-  if (endian == Endian::Little)
-  {
-   retVal  = static_cast<uint16_t>(Pop());
-   retVal |= static_cast<uint16_t>(Pop()) << 8U;
-  }
-  else
-  {
-    retVal  = static_cast<uint16_t>(Pop()) << 8U;
-    retVal |= static_cast<uint16_t>(Pop());
-  }
+  Pop(&retVal, sizeof(retVal));
+  if (IsByteSwapRequired())
+    retVal = internal::ByteSwap(retVal);
   return retVal;
 }
 uint32_t StreamReaderBase::Read_uint32(void)
 /// \copydoc IStreamReader::Read_uint32(void)
 {
   uint32_t retVal;
-  if (endian == Endian::Little)
-  {
-   retVal  = static_cast<uint32_t>(Pop());
-   retVal |= static_cast<uint32_t>(Pop()) << 8U;
-   retVal |= static_cast<uint32_t>(Pop()) << 16U;
-   retVal |= static_cast<uint32_t>(Pop()) << 24U;
-  }
-  else
-  {
-    retVal  = static_cast<uint32_t>(Pop()) << 24U;
-    retVal |= static_cast<uint32_t>(Pop()) << 16U;
-    retVal |= static_cast<uint32_t>(Pop()) << 8U;
-    retVal |= static_cast<uint32_t>(Pop());
-  }
+  Pop(&retVal, sizeof(retVal));
+  if (IsByteSwapRequired())
+    retVal = internal::ByteSwap(retVal);
   return retVal;
 }
 uint64_t StreamReaderBase::Read_uint64(void)
 /// \copydoc IStreamReader::Read_uint64(void)
 {
   uint64_t retVal;
-  if (endian == Endian::Little)
-  {
-   retVal  = static_cast<uint64_t>(Pop());
-   retVal |= static_cast<uint64_t>(Pop()) << 8U;
-   retVal |= static_cast<uint64_t>(Pop()) << 16U;
-   retVal |= static_cast<uint64_t>(Pop()) << 24U;
-   retVal |= static_cast<uint64_t>(Pop()) << 32U;
-   retVal |= static_cast<uint64_t>(Pop()) << 40U;
-   retVal |= static_cast<uint64_t>(Pop()) << 48U;
-   retVal |= static_cast<uint64_t>(Pop()) << 56U;
-  }
-  else
-  {
-    retVal  = static_cast<uint64_t>(Pop()) << 56U;
-    retVal |= static_cast<uint64_t>(Pop()) << 48U;
-    retVal |= static_cast<uint64_t>(Pop()) << 40U;
-    retVal |= static_cast<uint64_t>(Pop()) << 32U;
-    retVal |= static_cast<uint64_t>(Pop()) << 24U;
-    retVal |= static_cast<uint64_t>(Pop()) << 16U;
-    retVal |= static_cast<uint64_t>(Pop()) << 8U;
-    retVal |= static_cast<uint64_t>(Pop());
-  }
+  Pop(&retVal, sizeof(retVal));
+  if (IsByteSwapRequired())
+    retVal = internal::ByteSwap(retVal);
   return retVal;
 }
 int8_t StreamReaderBase::Read_int8(void)
@@ -187,20 +151,23 @@ void StreamReaderBase::Read_uint8(uint8_t* pDest, size_t n)
 void StreamReaderBase::Read_uint16(uint16_t* pDest, size_t n)
 /// \copydoc IStreamReader::Read_uint16(uint16_t*,size_t)
 {
-  while (n-- != 0)
-    *pDest++ = Read_uint16();
+  Pop(pDest, n * sizeof(uint16_t));
+  if (IsByteSwapRequired())
+    internal::ByteSwapInPlace<uint16_t>(pDest, n);
 }
 void StreamReaderBase::Read_uint32(uint32_t* pDest, size_t n)
 /// \copydoc IStreamReader::Read_uint32(uint32_t*,size_t)
 {
-  while (n-- != 0)
-    *pDest++ = Read_uint32();
+  Pop(pDest, n * sizeof(uint32_t));
+  if (IsByteSwapRequired())
+    internal::ByteSwapInPlace<uint32_t>(pDest, n);
 }
 void StreamReaderBase::Read_uint64(uint64_t* pDest, size_t n)
 /// \copydoc IStreamReader::Read_uint64(uint64_t*,size_t)
 {
-  while (n-- != 0)
-    *pDest++ = Read_uint64();
+  Pop(pDest, n * sizeof(uint64_t));
+  if (IsByteSwapRequired())
+    internal::ByteSwapInPlace<uint64_t>(pDest, n);
 }
 void StreamReaderBase::Read_int8(int8_t* pDest, size_t n)
 /// \copydoc IStreamReader::Read_int8(int8_t*,size_t)
@@ -210,32 +177,37 @@ void StreamReaderBase::Read_int8(int8_t* pDest, size_t n)
 void StreamReaderBase::Read_int16(int16_t* pDest, size_t n)
 /// \copydoc IStreamReader::Read_int16(int16_t*,size_t)
 {
-  while (n-- != 0)
-    *pDest++ = Read_int16();
+  Pop(pDest, n * sizeof(int16_t));
+  if (IsByteSwapRequired())
+    internal::ByteSwapInPlace<uint16_t>(pDest, n);
 }
 void StreamReaderBase::Read_int32(int32_t* pDest, size_t n)
 /// \copydoc IStreamReader::Read_int32(int32_t*,size_t)
 {
-  while (n-- != 0)
-    *pDest++ = Read_int32();
+  Pop(pDest, n * sizeof(int32_t));
+  if (IsByteSwapRequired())
+    internal::ByteSwapInPlace<uint32_t>(pDest, n);
 }
 void StreamReaderBase::Read_int64(int64_t* pDest, size_t n)
 /// \copydoc IStreamReader::Read_int64(int64_t*,size_t)
 {
-  while (n-- != 0)
-    *pDest++ = Read_int64();
+  Pop(pDest, n * sizeof(int64_t));
+  if (IsByteSwapRequired())
+    internal::ByteSwapInPlace<uint64_t>(pDest, n);
 }
 void StreamReaderBase::Read_float(float* pDest, size_t n)
 /// \copydoc IStreamReader::Read_float(float*,size_t)
 {
-  while (n-- != 0)
-    *pDest++ = Read_float();
+  Pop(pDest, n * sizeof(float));
+  if (IsByteSwapRequired())
+    internal::ByteSwapInPlace<uint32_t>(pDest, n);
 }
 void StreamReaderBase::Read_double(double* pDest, size_t n)
 /// \copydoc IStreamReader::Read_double(double*,size_t)
 {
-  while (n-- != 0)
-    *pDest++ = Read_double();
+  Pop(pDest, n * sizeof(double));
+  if (IsByteSwapRequired())
+    internal::ByteSwapInPlace<uint64_t>(pDest, n);
 }
 void StreamReaderBase::Read_bool(bool* pDest, size_t n)
 /// \copydoc IStreamReader::Read_bool(bool*,size_t)
@@ -261,6 +233,30 @@ void StreamReaderBase::Read_char(char* pDest, size_t n)
 }
 // <-- IStreamReader stuff
 
+bool StreamReaderBase::IsByteSwapRequired(void) const noexcept
+/**
+ * \brief Checks if the byte order of the data inside the stream differs from the byte order of the host.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * The state of the object is not modified. Concurrent accesses are safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \retval true   Multi-byte values read via @ref Pop(void* p, size_t n) must be byte-swapped.
+ * \retval false  Multi-byte values read via @ref Pop(void* p, size_t n) can be used as they are.
+ */
+{
+  return ((endian == Endian::Little) != internal::hostIsLittleEndian);
+}
+
 StreamReaderBase::StreamReaderBase(States const _state, Endian const _endian) noexcept
 : IStreamReader()
 , state(_state)
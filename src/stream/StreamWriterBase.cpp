@@ -9,6 +9,9 @@
 */
 
 #include <gpcc/stream/StreamWriterBase.hpp>
+#include <gpcc/stream/internal/byte_order.hpp>
+#include <algorithm>
+#include <cstring>
 
 namespace gpcc
 {
@@ -56,8 +59,15 @@ void StreamWriterBase::FillBits(size_t n, bool const oneNotZero)
 void StreamWriterBase::FillBytes(size_t n, uint8_t const value)
 /// \copydoc IStreamWriter::FillBytes
 {
-  while (n-- != 0U)
-    Push(value);
+  unsigned char buffer[64];
+  memset(buffer, value, std::min(n, sizeof(buffer)));
+
+  while (n != 0U)
+  {
+    size_t const chunk = std::min(n, sizeof(buffer));
+    Push(buffer, chunk);
+    n -= chunk;
+  }
 }
 
 void StreamWriterBase::Write_uint8(uint8_t data)
@@ -73,78 +83,47 @@ void StreamWriterBase::Write_uint8(uint8_t const * pData, size_t n)
 void StreamWriterBase::Write_uint16(uint16_t data)
 /// \copydoc IStreamWriter::Write_uint16(uint16_t)
 {
-  if (endian == Endian::Little)
-  {
-    Push(static_cast<char>(data));
-    Push(static_cast<char>(data >> 8));
-  }
-  else
-  {
-    Push(static_cast<char>(data >> 8));
-    Push(static_cast<char>(data));
-  }
+  if (IsByteSwapRequired())
+    data = internal::ByteSwap(data);
+  Push(&data, sizeof(data));
 }
 void StreamWriterBase::Write_uint16(uint16_t const * pData, size_t n)
 /// \copydoc IStreamWriter::Write_uint16(uint16_t const *,size_t)
 {
-  while (n-- != 0)
-    Write_uint16(*pData++);
+  if (IsByteSwapRequired())
+    PushByteSwapped<uint16_t>(pData, n);
+  else
+    Push(pData, n * sizeof(uint16_t));
 }
 void StreamWriterBase::Write_uint32(uint32_t data)
 /// \copydoc IStreamWriter::Write_uint32(uint32_t)
 {
-  if (endian == Endian::Little)
-  {
-    Push(static_cast<char>(data));
-    Push(static_cast<char>(data >> 8));
-    Push(static_cast<char>(data >> 16));
-    Push(static_cast<char>(data >> 24));
-  }
-  else
-  {
-    Push(static_cast<char>(data >> 24));
-    Push(static_cast<char>(data >> 16));
-    Push(static_cast<char>(data >> 8));
-    Push(static_cast<char>(data));
-  }
+  if (IsByteSwapRequired())
+    data = internal::ByteSwap(data);
+  Push(&data, sizeof(data));
 }
 void StreamWriterBase::Write_uint32(uint32_t const * pData, size_t n)
 /// \copydoc IStreamWriter::Write_uint32(uint32_t const *,size_t)
 {
-  while (n-- != 0)
-    Write_uint32(*pData++);
+  if (IsByteSwapRequired())
+    PushByteSwapped<uint32_t>(pData, n);
+  else
+    Push(pData, n * sizeof(uint32_t));
 }
 void StreamWriterBase::Write_uint64(uint64_t data)
 /// \copydoc IStreamWriter::Write_uint64(uint64_t)
 {
-  if (endian == Endian::Little)
-  {
-    Push(static_cast<char>(data));
-    Push(static_cast<char>(data >> 8));
-    Push(static_cast<char>(data >> 16));
-    Push(static_cast<char>(data >> 24));
-    Push(static_cast<char>(data >> 32));
-    Push(static_cast<char>(data >> 40));
-    Push(static_cast<char>(data >> 48));
-    Push(static_cast<char>(data >> 56));
-  }
-  else
-  {
-    Push(static_cast<char>(data >> 56));
-    Push(static_cast<char>(data >> 48));
-    Push(static_cast<char>(data >> 40));
-    Push(static_cast<char>(data >> 32));
-    Push(static_cast<char>(data >> 24));
-    Push(static_cast<char>(data >> 16));
-    Push(static_cast<char>(data >> 8));
-    Push(static_cast<char>(data));
-  }
+  if (IsByteSwapRequired())
+    data = internal::ByteSwap(data);
+  Push(&data, sizeof(data));
 }
 void StreamWriterBase::Write_uint64(uint64_t const * pData, size_t n)
 /// \copydoc IStreamWriter::Write_uint64(uint64_t const *,size_t)
 {
-  while (n-- != 0)
-    Write_uint64(*pData++);
+  if (IsByteSwapRequired())
+    PushByteSwapped<uint64_t>(pData, n);
+  else
+    Push(pData, n * sizeof(uint64_t));
 }
 
 void StreamWriterBase::Write_int8(int8_t data)
@@ -272,6 +251,75 @@ void StreamWriterBase::Write_line(std::string const & str)
 }
 // <-- IStreamWriter
 
+bool StreamWriterBase::IsByteSwapRequired(void) const noexcept
+/**
+ * \brief Checks if the byte order of the data inside the stream differs from the byte order of the host.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * The state of the object is not modified. Concurrent accesses are safe.
+ *
+ * __Exception safety:__\n
+ * No-throw guarantee.
+ *
+ * __Thread cancellation safety:__\n
+ * No cancellation point included.
+ *
+ * - - -
+ *
+ * \retval true   Multi-byte values must be byte-swapped before they are written via
+ *                @ref Push(void const * pData, size_t n).
+ * \retval false  Multi-byte values can be written via @ref Push(void const * pData, size_t n) as they are.
+ */
+{
+  return ((endian == Endian::Little) != internal::hostIsLittleEndian);
+}
+
+template<typename T>
+void StreamWriterBase::PushByteSwapped(void const * pData, size_t n)
+/**
+ * \brief Reverses the byte order of each element of an array and pushes the result onto the stream.
+ *
+ * The array is processed in chunks using a small buffer on the stack. The array itself is not modified.
+ *
+ * - - -
+ *
+ * __Thread safety:__\n
+ * The state of the object is modified. Concurrent accesses are not safe.
+ *
+ * __Exception safety:__\n
+ * Basic exception safety, see @ref Push(void const * pData, size_t n).
+ *
+ * __Thread cancellation safety:__\n
+ * Deferred cancellation is safe, see @ref Push(void const * pData, size_t n).
+ *
+ * - - -
+ *
+ * \tparam T
+ * Unsigned integer type with the size of one element (`uint16_t`, `uint32_t`, or `uint64_t`).
+ *
+ * \param pData
+ * Pointer to the array.
+ *
+ * \param n
+ * Number of elements.
+ */
+{
+  size_t const elementsPerChunk = 256U / sizeof(T);
+  unsigned char buffer[elementsPerChunk * sizeof(T)];
+
+  unsigned char const * p = static_cast<unsigned char const*>(pData);
+  while (n != 0U)
+  {
+    size_t const chunk = std::min(n, elementsPerChunk);
+    internal::ByteSwapCopy<T>(buffer, p, chunk);
+    Push(buffer, chunk * sizeof(T));
+    p += chunk * sizeof(T);
+    n -= chunk;
+  }
+}
+
 StreamWriterBase::StreamWriterBase(States const _state, Endian const _endian) noexcept
 : IStreamWriter()
 , state(_state)
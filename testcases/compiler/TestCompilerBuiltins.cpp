@@ -27,6 +27,9 @@ using gpcc::compiler::CountTrailingOnes;
 using gpcc::compiler::ReverseBits8;
 using gpcc::compiler::ReverseBits16;
 using gpcc::compiler::ReverseBits32;
+using gpcc::compiler::ByteSwap16;
+using gpcc::compiler::ByteSwap32;
+using gpcc::compiler::ByteSwap64;
 using namespace testing;
 
 TEST(GPCC_Compiler_CompilerBuiltins_Tests, OverflowAwareAdd_i64_i64_i64)
@@ -657,5 +660,26 @@ TEST(GPCC_Compiler_CompilerBuiltins_Tests, ReverseBits32)
   }
 }
 
+TEST(GPCC_Compiler_CompilerBuiltins_Tests, ByteSwap16)
+{
+  EXPECT_EQ(ByteSwap16(0x0000U), 0x0000U);
+  EXPECT_EQ(ByteSwap16(0x1234U), 0x3412U);
+  EXPECT_EQ(ByteSwap16(0xFF00U), 0x00FFU);
+}
+
+TEST(GPCC_Compiler_CompilerBuiltins_Tests, ByteSwap32)
+{
+  EXPECT_EQ(ByteSwap32(0x00000000UL), 0x00000000UL);
+  EXPECT_EQ(ByteSwap32(0x12345678UL), 0x78563412UL);
+  EXPECT_EQ(ByteSwap32(0xFF000080UL), 0x800000FFUL);
+}
+
+TEST(GPCC_Compiler_CompilerBuiltins_Tests, ByteSwap64)
+{
+  EXPECT_EQ(ByteSwap64(0x0000000000000000ULL), 0x0000000000000000ULL);
+  EXPECT_EQ(ByteSwap64(0x123456789ABCDEF0ULL), 0xF0DEBC9A78563412ULL);
+  EXPECT_EQ(ByteSwap64(0xFF00000000000080ULL), 0x80000000000000FFULL);
+}
+
 } // namespace Compiler
 } // namespace gpcc_tests
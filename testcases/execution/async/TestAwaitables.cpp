@@ -0,0 +1,270 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+// Coroutines require C++20
+#if defined(__cpp_impl_coroutine) && (__cpp_impl_coroutine >= 201902L)
+
+#include <gpcc/execution/async/Awaitables.hpp>
+#include <gpcc/execution/async/DeferredWorkQueue.hpp>
+#include <gpcc/execution/async/WorkPackagePool.hpp>
+#include <gpcc/osal/ConditionVariable.hpp>
+#include <gpcc/osal/Semaphore.hpp>
+#include <gpcc/osal/Thread.hpp>
+#include <gpcc/time/TimePoint.hpp>
+#include <gpcc/time/TimeSpan.hpp>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <cstdint>
+
+namespace gpcc_tests {
+namespace execution  {
+namespace async      {
+
+using namespace gpcc::execution::async;
+using gpcc::osal::ConditionVariable;
+using gpcc::osal::Semaphore;
+using gpcc::osal::Thread;
+using gpcc::time::TimePoint;
+using gpcc::time::TimeSpan;
+
+// Test fixture for the awaitables. Provides two deferred work queues, each driven by a thread.
+class gpcc_execution_async_Awaitables_TestsF: public testing::Test
+{
+  public:
+    gpcc_execution_async_Awaitables_TestsF(void);
+
+  protected:
+    DeferredWorkQueue dwq1;
+    DeferredWorkQueue dwq2;
+    Thread thread1;
+    Thread thread2;
+    bool threadsStarted;
+    Semaphore done;
+
+    void SetUp(void) override;
+    void TearDown(void) override;
+};
+
+gpcc_execution_async_Awaitables_TestsF::gpcc_execution_async_Awaitables_TestsF(void)
+: Test()
+, dwq1()
+, dwq2()
+, thread1("DWQ1")
+, thread2("DWQ2")
+, threadsStarted(false)
+, done(0U)
+{
+}
+
+void gpcc_execution_async_Awaitables_TestsF::SetUp(void)
+{
+  thread1.Start([&]() -> void* { dwq1.Work(); return nullptr; },
+                Thread::SchedPolicy::Other, 0U, Thread::GetDefaultStackSize());
+  thread2.Start([&]() -> void* { dwq2.Work(); return nullptr; },
+                Thread::SchedPolicy::Other, 0U, Thread::GetDefaultStackSize());
+  threadsStarted = true;
+}
+
+void gpcc_execution_async_Awaitables_TestsF::TearDown(void)
+{
+  if (threadsStarted)
+  {
+    dwq1.FlushNonDeferredWorkPackages();
+    dwq2.FlushNonDeferredWorkPackages();
+    dwq1.RequestTermination();
+    dwq2.RequestTermination();
+    thread1.Join();
+    thread2.Join();
+  }
+}
+
+TEST_F(gpcc_execution_async_Awaitables_TestsF, Yield_SwitchQueues)
+{
+  bool onThread1 = false;
+  bool onThread2 = false;
+  bool backOnThread1 = false;
+
+  auto coroutine = [&]() -> Task<void>
+  {
+    onThread1 = thread1.IsItMe();
+    co_await Yield(dwq2);
+    onThread2 = thread2.IsItMe();
+    co_await Yield(dwq1);
+    backOnThread1 = thread1.IsItMe();
+    done.Post();
+  };
+
+  Spawn(dwq1, coroutine());
+  done.Wait();
+
+  EXPECT_TRUE(onThread1);
+  EXPECT_TRUE(onThread2);
+  EXPECT_TRUE(backOnThread1);
+}
+
+TEST_F(gpcc_execution_async_Awaitables_TestsF, Yield_WithPool_NoHeapAllocation)
+{
+  WorkPackagePool pool(2U);
+  uint32_t cnt = 0U;
+
+  auto coroutine = [&]() -> Task<void>
+  {
+    for (uint_fast8_t i = 0U; i < 10U; i++)
+    {
+      co_await Yield(dwq1, &pool);
+      cnt++;
+    }
+    done.Post();
+  };
+
+  Spawn(dwq1, coroutine(), &pool);
+  done.Wait();
+  dwq1.FlushNonDeferredWorkPackages();
+
+  EXPECT_EQ(cnt, 10U);
+
+  auto const stat = pool.GetStatistics();
+  EXPECT_EQ(stat.nbOfAllocations, 11U);
+  EXPECT_EQ(stat.nbOfExhaustions, 0U);
+  EXPECT_EQ(stat.nbOfOversizedFunctors, 0U);
+  EXPECT_EQ(stat.nbOfFreeBlocks, 2U);
+}
+
+TEST_F(gpcc_execution_async_Awaitables_TestsF, Delay)
+{
+  TimePoint start;
+  TimePoint end;
+  bool onThread2 = false;
+
+  auto coroutine = [&]() -> Task<void>
+  {
+    start = TimePoint::FromSystemClock(ConditionVariable::clockID);
+    co_await Delay(dwq2, TimeSpan::ms(50));
+    end = TimePoint::FromSystemClock(ConditionVariable::clockID);
+    onThread2 = thread2.IsItMe();
+    done.Post();
+  };
+
+  Spawn(dwq1, coroutine());
+  done.Wait();
+
+  EXPECT_TRUE(onThread2);
+  EXPECT_GE((end - start).ms(), 50);
+}
+
+TEST_F(gpcc_execution_async_Awaitables_TestsF, DelayUntil_WithPool)
+{
+  WorkPackagePool pool(1U);
+  TimePoint tp;
+  TimePoint end;
+
+  auto coroutine = [&]() -> Task<void>
+  {
+    tp = TimePoint::FromSystemClock(ConditionVariable::clockID) + TimeSpan::ms(20);
+    co_await DelayUntil(dwq1, tp, &pool);
+    end = TimePoint::FromSystemClock(ConditionVariable::clockID);
+    done.Post();
+  };
+
+  Spawn(dwq1, coroutine());
+  done.Wait();
+  dwq1.FlushNonDeferredWorkPackages();
+
+  EXPECT_TRUE(end >= tp);
+
+  auto const stat = pool.GetStatistics();
+  EXPECT_EQ(stat.nbOfAllocations, 1U);
+  EXPECT_EQ(stat.nbOfExhaustions, 0U);
+}
+
+TEST_F(gpcc_execution_async_Awaitables_TestsF, AsyncResult_ResultBeforeAwait)
+{
+  std::string result;
+
+  auto coroutine = [&]() -> Task<void>
+  {
+    AsyncResult<std::string> ar(dwq1);
+    ar.SetResult("Test");
+    result = co_await ar;
+    done.Post();
+  };
+
+  Spawn(dwq1, coroutine());
+  done.Wait();
+
+  EXPECT_EQ(result, "Test");
+}
+
+TEST_F(gpcc_execution_async_Awaitables_TestsF, AsyncResult_ResultFromOtherThread)
+{
+  AsyncResult<int>* pAR = nullptr;
+  Semaphore awaiting(0U);
+  int result = 0;
+  bool resumedOnThread1 = false;
+
+  auto coroutine = [&]() -> Task<void>
+  {
+    AsyncResult<int> ar(dwq1);
+    pAR = &ar;
+    awaiting.Post();
+    result = co_await ar;
+    resumedOnThread1 = thread1.IsItMe();
+    done.Post();
+  };
+
+  Spawn(dwq1, coroutine());
+
+  // deliver the result from thread 2 (the coroutine may or may not be suspended yet)
+  awaiting.Wait();
+  dwq2.Add(WorkPackage::CreateDynamic(nullptr, 0U, [&]() { pAR->SetResult(42); }));
+  done.Wait();
+
+  EXPECT_EQ(result, 42);
+  EXPECT_TRUE(resumedOnThread1);
+}
+
+TEST_F(gpcc_execution_async_Awaitables_TestsF, AsyncResult_Void)
+{
+  AsyncResult<void>* pAR = nullptr;
+  Semaphore awaiting(0U);
+  bool resumed = false;
+
+  auto coroutine = [&]() -> Task<void>
+  {
+    AsyncResult<void> ar(dwq1);
+    pAR = &ar;
+    awaiting.Post();
+    co_await ar;
+    resumed = true;
+    done.Post();
+  };
+
+  Spawn(dwq1, coroutine());
+
+  awaiting.Wait();
+  dwq2.Add(WorkPackage::CreateDynamic(nullptr, 0U, [&]() { pAR->SetResult(); }));
+  done.Wait();
+
+  EXPECT_TRUE(resumed);
+}
+
+TEST_F(gpcc_execution_async_Awaitables_TestsF, AsyncResult_SetTwice)
+{
+  AsyncResult<int> ar(dwq1);
+  ar.SetResult(1);
+  EXPECT_THROW(ar.SetResult(2), std::logic_error);
+}
+
+} // namespace async
+} // namespace execution
+} // namespace gpcc_tests
+
+#endif // #if defined(__cpp_impl_coroutine) && (__cpp_impl_coroutine >= 201902L)
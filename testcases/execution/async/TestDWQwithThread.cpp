@@ -42,6 +42,27 @@ TEST(gpcc_execution_async_DWQwithThread_Tests, CreateStartStopAndDestroy)
   spUUT.reset();
 }
 
+TEST(gpcc_execution_async_DWQwithThread_Tests, CreateWithLanesStartStopAndDestroy)
+{
+  std::unique_ptr<DWQwithThread> spUUT;
+
+  ASSERT_NO_THROW(spUUT = std::make_unique<DWQwithThread>("UUT", 3U, 1U, 4U));
+  EXPECT_EQ(spUUT->GetDWQ().GetNbOfLanes(), 3U);
+
+  ASSERT_NO_THROW(spUUT->Start(Thread::SchedPolicy::Other, 0U, Thread::GetDefaultStackSize()));
+  spUUT->Stop();
+
+  spUUT.reset();
+}
+
+TEST(gpcc_execution_async_DWQwithThread_Tests, CreateWithInvalidLaneConfig)
+{
+  std::unique_ptr<DWQwithThread> spUUT;
+
+  ASSERT_THROW(spUUT = std::make_unique<DWQwithThread>("UUT", 0U, 0U, 0U), std::invalid_argument);
+  ASSERT_THROW(spUUT = std::make_unique<DWQwithThread>("UUT", 2U, 2U, 0U), std::invalid_argument);
+}
+
 TEST(gpcc_execution_async_DWQwithThread_Tests, StartTwice)
 {
   std::unique_ptr<DWQwithThread> spUUT;
@@ -282,6 +282,41 @@ TEST_F(gpcc_execution_async_DeferredWorkPackage_TestsF, SetTimeSpan)
   ASSERT_THROW(spUUT->SetTimeSpan(TimeSpan::ms(10)), std::logic_error);
 }
 
+TEST_F(gpcc_execution_async_DeferredWorkPackage_TestsF, SetPeriodic)
+{
+  // static work package
+  spUUT.reset(new DeferredWorkPackage(&dummyOwner, 0, std::bind(&GTEST_TEST_CLASS_NAME_(gpcc_execution_async_DeferredWorkPackage_TestsF, SetPeriodic)::DummyFunc, this), TimePoint()));
+  EXPECT_FALSE(spUUT->IsPeriodic());
+  spUUT->SetPeriodic(TimeSpan::ms(10), DeferredWorkPackage::OverrunPolicy::catchUp);
+  EXPECT_TRUE(spUUT->IsPeriodic());
+  spUUT->SetNonPeriodic();
+  EXPECT_FALSE(spUUT->IsPeriodic());
+
+  // invalid period
+  ASSERT_THROW(spUUT->SetPeriodic(TimeSpan::ms(0), DeferredWorkPackage::OverrunPolicy::skip), std::invalid_argument);
+  ASSERT_THROW(spUUT->SetPeriodic(TimeSpan::ms(-1), DeferredWorkPackage::OverrunPolicy::skip), std::invalid_argument);
+  EXPECT_FALSE(spUUT->IsPeriodic());
+
+  // dynamic work package
+  spUUT = DeferredWorkPackage::CreateDynamic(&dummyOwner, 0, std::bind(&GTEST_TEST_CLASS_NAME_(gpcc_execution_async_DeferredWorkPackage_TestsF, SetPeriodic)::DummyFunc, this), TimePoint());
+  ASSERT_THROW(spUUT->SetPeriodic(TimeSpan::ms(10), DeferredWorkPackage::OverrunPolicy::skip), std::logic_error);
+  ASSERT_THROW(spUUT->SetNonPeriodic(), std::logic_error);
+}
+
+TEST_F(gpcc_execution_async_DeferredWorkPackage_TestsF, PeriodicStatistics)
+{
+  spUUT.reset(new DeferredWorkPackage(&dummyOwner, 0, std::bind(&GTEST_TEST_CLASS_NAME_(gpcc_execution_async_DeferredWorkPackage_TestsF, PeriodicStatistics)::DummyFunc, this), TimePoint()));
+
+  auto stats = spUUT->GetPeriodicStatistics();
+  EXPECT_EQ(stats.nbOfOverruns, 0U);
+  EXPECT_EQ(stats.nbOfMissedPeriods, 0U);
+
+  spUUT->ResetPeriodicStatistics();
+  stats = spUUT->GetPeriodicStatistics();
+  EXPECT_EQ(stats.nbOfOverruns, 0U);
+  EXPECT_EQ(stats.nbOfMissedPeriods, 0U);
+}
+
 } // namespace execution
 } // namespace async
 } // namespace gpcc_tests
@@ -9,8 +9,15 @@
 */
 
 #include "TestIWorkQueue.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
 #include <iostream>
 #include <iomanip>
+#include <memory>
+#include <utility>
+#include <vector>
 
 // Time span used to delay execution of deferred work packages in ms.
 #define DELAY_TIME_MS 10
@@ -2563,6 +2570,733 @@ TEST_F(gpcc_execution_async_DeferredWorkQueue_TestsF, UseIDeferredWorkQueue)
   ASSERT_TRUE(CheckCheckList(expectedChecklist, 6));
 }
 
+TEST_F(gpcc_execution_async_DeferredWorkQueue_TestsF, ManyDeferredWPs_OrderAndRemoval)
+{
+  // This test adds a large number of deferred work packages with pseudo-random time points (including duplicates)
+  // and removes some of them by reference and by owner/ownerID. The remaining deferred work packages must be executed
+  // sorted by their time points, and in FIFO order if time points are equal.
+
+  size_t const n = 2000U;
+  TimePoint const now = TimePoint::FromSystemClock(ConditionVariable::clockID);
+
+  std::vector<std::unique_ptr<DeferredWorkPackage>> dwps;
+  std::vector<std::pair<TimePoint, uint32_t>> expected;
+  dwps.reserve(n);
+  expected.reserve(n);
+
+  ON_SCOPE_EXIT()
+  {
+    uut.Remove(this);
+    uut.Remove(&owner1);
+  };
+
+  uint32_t rnd = 0x12345678UL;
+  for (uint32_t i = 0U; i < n; i++)
+  {
+    rnd = (rnd * 1103515245UL) + 12345UL;
+    TimePoint const tp = now - TimeSpan::ms(static_cast<int64_t>((rnd >> 16U) % 500U) + 1);
+
+    // every 5th work package belongs to owner1, the others belong to "this" with ownerID 0 or 1
+    void const * const pOwner = ((i % 5U) == 0U) ? static_cast<void const*>(&owner1) :
+                                                   static_cast<void const*>(this);
+    uint32_t const ownerID = (i % 3U) == 0U ? 1U : 0U;
+
+    dwps.emplace_back(std::make_unique<DeferredWorkPackage>(pOwner, ownerID,
+                                                            [this, i]() { WQ_PushToCheckList(i); }, tp));
+    uut.Add(*dwps.back());
+
+    bool const removedByOwner = (pOwner == &owner1);
+    bool const removedByOwnerAndID = ((pOwner == this) && (ownerID == 1U));
+    bool const removedByRef = ((i % 7U) == 0U);
+    if ((!removedByOwner) && (!removedByOwnerAndID) && (!removedByRef))
+      expected.emplace_back(tp, i);
+  }
+
+  for (uint32_t i = 0U; i < n; i += 7U)
+    uut.Remove(*dwps[i]);
+  uut.Remove(&owner1);
+  uut.Remove(this, 1U);
+
+  EXPECT_FALSE(uut.IsAnyInQueue(&owner1));
+
+  std::stable_sort(expected.begin(), expected.end(),
+                   [](std::pair<TimePoint, uint32_t> const & a, std::pair<TimePoint, uint32_t> const & b)
+                   { return a.first < b.first; });
+
+  WQ_AddWPTerminate();
+
+  EnterUUTWork();
+  JoinWorkThread();
+  EXPECT_TRUE(pCaughtException == nullptr);
+
+  ASSERT_EQ(checkList.size(), expected.size());
+  for (size_t i = 0U; i < expected.size(); i++)
+  {
+    ASSERT_EQ(checkList[i], expected[i].second) << "Mismatch at index " << i;
+  }
+}
+
+// Helper for the priority lane tests: Executes all work packages in "uut" in the context of the calling thread.
+// A work package requesting termination is added to the lane with the lowest priority.
+static void ExecuteAllInLanes(DeferredWorkQueue & uut)
+{
+  uut.Add(WorkPackage::CreateDynamic(nullptr, 0U, [&uut]() { uut.RequestTermination(); }), uut.GetNbOfLanes() - 1U);
+  uut.Work();
+}
+
+TEST(gpcc_execution_async_DeferredWorkQueue_Tests, Lanes_InvalidArgs)
+{
+  std::unique_ptr<DeferredWorkQueue> spUUT;
+
+  EXPECT_THROW(spUUT = std::make_unique<DeferredWorkQueue>(0U, 0U, 0U), std::invalid_argument);
+  EXPECT_THROW(spUUT = std::make_unique<DeferredWorkQueue>(DeferredWorkQueue::maxNbOfLanes + 1U, 0U, 0U),
+               std::invalid_argument);
+  EXPECT_THROW(spUUT = std::make_unique<DeferredWorkQueue>(2U, 2U, 0U), std::invalid_argument);
+
+  ASSERT_NO_THROW(spUUT = std::make_unique<DeferredWorkQueue>(DeferredWorkQueue::maxNbOfLanes, 0U, 0U));
+  EXPECT_EQ(spUUT->GetNbOfLanes(), DeferredWorkQueue::maxNbOfLanes);
+
+  spUUT = std::make_unique<DeferredWorkQueue>(2U, 0U, 0U);
+
+  EXPECT_THROW(spUUT->Add(WorkPackage::CreateDynamic(nullptr, 0U, []() {}), 2U), std::invalid_argument);
+
+  WorkPackage wp(nullptr, 0U, []() {});
+  EXPECT_THROW(spUUT->Add(wp, 2U), std::invalid_argument);
+
+  EXPECT_THROW((void)spUUT->GetLaneStatistics(2U), std::invalid_argument);
+
+  EXPECT_FALSE(spUUT->IsAnyInQueue(nullptr));
+}
+
+TEST(gpcc_execution_async_DeferredWorkQueue_Tests, Lanes_DefaultCtorHasOneLane)
+{
+  DeferredWorkQueue uut;
+  EXPECT_EQ(uut.GetNbOfLanes(), 1U);
+}
+
+TEST(gpcc_execution_async_DeferredWorkQueue_Tests, Lanes_PriorityOrder)
+{
+  DeferredWorkQueue uut(3U, 2U, 0U);
+  std::vector<uint32_t> order;
+
+  uut.Add(WorkPackage::CreateDynamic(nullptr, 0U, [&order]() { order.push_back(21U); }), 2U);
+  uut.Add(WorkPackage::CreateDynamic(nullptr, 0U, [&order]() { order.push_back(11U); }), 1U);
+  uut.Add(WorkPackage::CreateDynamic(nullptr, 0U, [&order]() { order.push_back(1U); }), 0U);
+  uut.Add(WorkPackage::CreateDynamic(nullptr, 0U, [&order]() { order.push_back(22U); }), 2U);
+  uut.Add(WorkPackage::CreateDynamic(nullptr, 0U, [&order]() { order.push_back(2U); }), 0U);
+
+  ExecuteAllInLanes(uut);
+
+  std::vector<uint32_t> const expected = {1U, 2U, 11U, 21U, 22U};
+  EXPECT_EQ(order, expected);
+}
+
+TEST(gpcc_execution_async_DeferredWorkQueue_Tests, Lanes_DefaultLaneAndStaticWP)
+{
+  DeferredWorkQueue uut(3U, 1U, 0U);
+  std::vector<uint32_t> order;
+
+  WorkPackage wp(nullptr, 0U, [&order]() { order.push_back(2U); });
+
+  uut.Add(WorkPackage::CreateDynamic(nullptr, 0U, [&order]() { order.push_back(3U); }), 2U);
+  uut.Add(WorkPackage::CreateDynamic(nullptr, 0U, [&order]() { order.push_back(1U); })); // default lane
+  uut.Add(wp, 1U);
+
+  ExecuteAllInLanes(uut);
+
+  std::vector<uint32_t> const expected = {1U, 2U, 3U};
+  EXPECT_EQ(order, expected);
+
+  EXPECT_EQ(uut.GetLaneStatistics(0U).nbOfExecutedWPs, 0U);
+  EXPECT_EQ(uut.GetLaneStatistics(1U).nbOfExecutedWPs, 2U);
+  EXPECT_EQ(uut.GetLaneStatistics(2U).nbOfExecutedWPs, 2U);
+}
+
+TEST(gpcc_execution_async_DeferredWorkQueue_Tests, Lanes_InsertAtHeadOfList)
+{
+  DeferredWorkQueue uut(2U, 1U, 0U);
+  std::vector<uint32_t> order;
+
+  uut.Add(WorkPackage::CreateDynamic(nullptr, 0U, [&order]() { order.push_back(2U); }), 0U);
+  uut.Add(WorkPackage::CreateDynamic(nullptr, 0U, [&order]() { order.push_back(3U); }), 1U);
+  uut.InsertAtHeadOfList(WorkPackage::CreateDynamic(nullptr, 0U, [&order]() { order.push_back(1U); }));
+
+  ExecuteAllInLanes(uut);
+
+  std::vector<uint32_t> const expected = {1U, 2U, 3U};
+  EXPECT_EQ(order, expected);
+}
+
+TEST(gpcc_execution_async_DeferredWorkQueue_Tests, Lanes_RemoveFromAllLanes)
+{
+  DeferredWorkQueue uut(3U, 0U, 0U);
+  std::vector<uint32_t> order;
+  int owner1;
+  int owner2;
+
+  WorkPackage wp(&owner2, 0U, [&order]() { order.push_back(99U); });
+
+  uut.Add(WorkPackage::CreateDynamic(&owner1, 0U, [&order]() { order.push_back(1U); }), 0U);
+  uut.Add(WorkPackage::CreateDynamic(&owner2, 0U, [&order]() { order.push_back(2U); }), 1U);
+  uut.Add(WorkPackage::CreateDynamic(&owner1, 1U, [&order]() { order.push_back(3U); }), 2U);
+  uut.Add(WorkPackage::CreateDynamic(&owner1, 0U, [&order]() { order.push_back(4U); }), 2U);
+  uut.Add(wp, 1U);
+
+  EXPECT_TRUE(uut.IsAnyInQueue(&owner2));
+  uut.Remove(wp);
+  uut.Remove(&owner1, 0U);
+
+  ExecuteAllInLanes(uut);
+
+  std::vector<uint32_t> const expected = {2U, 3U};
+  EXPECT_EQ(order, expected);
+  EXPECT_FALSE(uut.IsAnyInQueue(&owner1));
+  EXPECT_FALSE(uut.IsAnyInQueue(&owner2));
+}
+
+TEST(gpcc_execution_async_DeferredWorkQueue_Tests, Lanes_StarvationCounters)
+{
+  DeferredWorkQueue uut(2U, 0U, 0U);
+
+  for (uint_fast8_t i = 0U; i < 3U; i++)
+    uut.Add(WorkPackage::CreateDynamic(nullptr, 0U, []() {}), 0U);
+  uut.Add(WorkPackage::CreateDynamic(nullptr, 0U, []() {}), 1U);
+
+  ExecuteAllInLanes(uut);
+
+  auto const stats0 = uut.GetLaneStatistics(0U);
+  EXPECT_EQ(stats0.nbOfExecutedWPs, 3U);
+  EXPECT_EQ(stats0.nbOfBypasses, 0U);
+  EXPECT_EQ(stats0.maxConsecutiveBypasses, 0U);
+
+  auto const stats1 = uut.GetLaneStatistics(1U);
+  EXPECT_EQ(stats1.nbOfExecutedWPs, 2U);
+  EXPECT_EQ(stats1.nbOfBypasses, 3U);
+  EXPECT_EQ(stats1.maxConsecutiveBypasses, 3U);
+  EXPECT_EQ(stats1.nbOfAgingPromotions, 0U);
+}
+
+TEST(gpcc_execution_async_DeferredWorkQueue_Tests, Lanes_Aging)
+{
+  DeferredWorkQueue uut(2U, 0U, 2U);
+  std::vector<uint32_t> order;
+
+  for (uint32_t i = 1U; i <= 6U; i++)
+    uut.Add(WorkPackage::CreateDynamic(nullptr, 0U, [&order, i]() { order.push_back(i); }), 0U);
+  uut.Add(WorkPackage::CreateDynamic(nullptr, 0U, [&order]() { order.push_back(101U); }), 1U);
+  uut.Add(WorkPackage::CreateDynamic(nullptr, 0U, [&order]() { order.push_back(102U); }), 1U);
+
+  ExecuteAllInLanes(uut);
+
+  std::vector<uint32_t> const expected = {1U, 2U, 101U, 3U, 4U, 102U, 5U, 6U};
+  EXPECT_EQ(order, expected);
+
+  auto const stats0 = uut.GetLaneStatistics(0U);
+  EXPECT_EQ(stats0.nbOfExecutedWPs, 6U);
+  EXPECT_EQ(stats0.nbOfBypasses, 2U);
+  EXPECT_EQ(stats0.maxConsecutiveBypasses, 1U);
+
+  auto const stats1 = uut.GetLaneStatistics(1U);
+  EXPECT_EQ(stats1.nbOfExecutedWPs, 3U);
+  EXPECT_EQ(stats1.nbOfBypasses, 6U);
+  EXPECT_EQ(stats1.maxConsecutiveBypasses, 2U);
+  EXPECT_EQ(stats1.nbOfAgingPromotions, 2U);
+}
+
+TEST_F(gpcc_execution_async_DeferredWorkQueue_TestsF, Lanes_DeferredWPsHavePriority)
+{
+  DeferredWorkQueue uut2(2U, 0U, 0U);
+  std::vector<uint32_t> order;
+
+  TimePoint const past = TimePoint::FromSystemClock(ConditionVariable::clockID) - TimeSpan::ms(1);
+  uut2.Add(WorkPackage::CreateDynamic(nullptr, 0U, [&order]() { order.push_back(2U); }), 0U);
+  uut2.Add(DeferredWorkPackage::CreateDynamic(nullptr, 0U, [&order]() { order.push_back(1U); }, past));
+
+  ExecuteAllInLanes(uut2);
+
+  std::vector<uint32_t> const expected = {1U, 2U};
+  EXPECT_EQ(order, expected);
+}
+
+TEST_F(gpcc_execution_async_DeferredWorkQueue_TestsF, Lanes_FlushAwaitsAllLanes)
+{
+  DeferredWorkQueue uut2(2U, 0U, 1U);
+  std::vector<uint32_t> order;
+
+  // lane 0 is blocked by a work package that waits for the flush work packages being enqueued
+  gpcc::osal::Semaphore blocker(0U);
+  uut2.Add(WorkPackage::CreateDynamic(nullptr, 0U, [&blocker]() { blocker.Wait(); }), 0U);
+  for (uint32_t i = 1U; i <= 3U; i++)
+    uut2.Add(WorkPackage::CreateDynamic(nullptr, 0U, [&order, i]() { order.push_back(i); }), 0U);
+  for (uint32_t i = 101U; i <= 102U; i++)
+    uut2.Add(WorkPackage::CreateDynamic(nullptr, 0U, [&order, i]() { order.push_back(i); }), 1U);
+
+  Thread t("LanesTestWQ");
+  t.Start([&uut2]() -> void* { uut2.Work(); return nullptr; }, Thread::SchedPolicy::Other, 0U,
+          Thread::GetDefaultStackSize());
+  ON_SCOPE_EXIT(joinThread)
+  {
+    uut2.RequestTermination();
+    t.Join();
+  };
+
+  Thread flusher("LanesTestFlusher");
+  flusher.Start([&uut2, &order]() -> void* { uut2.FlushNonDeferredWorkPackages(); order.push_back(100U); return nullptr; },
+                Thread::SchedPolicy::Other, 0U, Thread::GetDefaultStackSize());
+
+  Thread::Sleep_ms(WAITTIME_MS);
+  blocker.Post();
+  flusher.Join();
+
+  // all work packages enqueued before the flush must have been executed (order is subject to aging)
+  ASSERT_EQ(order.size(), 6U);
+  EXPECT_EQ(order.back(), 100U);
+  std::vector<uint32_t> sorted(order.begin(), order.end() - 1);
+  std::sort(sorted.begin(), sorted.end());
+  std::vector<uint32_t> const expected = {1U, 2U, 3U, 101U, 102U};
+  EXPECT_EQ(sorted, expected);
+}
+
+TEST_F(gpcc_execution_async_DeferredWorkQueue_TestsF, Lanes_FlushCompletesDespiteSustainedTrafficInHigherLane)
+{
+  // Lane 0 never becomes empty. Aging must allow the flush work package in lane 1 to be executed.
+  DeferredWorkQueue uut2(2U, 0U, 2U);
+  std::vector<uint32_t> order;
+
+  // lane 0 is blocked by a work package that waits for the flush work packages being enqueued
+  gpcc::osal::Semaphore blocker(0U);
+  uut2.Add(WorkPackage::CreateDynamic(nullptr, 0U, [&blocker]() { blocker.Wait(); }), 0U);
+
+  std::atomic<bool> stopTraffic(false);
+  std::function<void()> traffic;
+  traffic = [&uut2, &stopTraffic, &traffic]()
+  {
+    if (!stopTraffic)
+      uut2.Add(WorkPackage::CreateDynamic(nullptr, 0U, traffic), 0U);
+  };
+  uut2.Add(WorkPackage::CreateDynamic(nullptr, 0U, traffic), 0U);
+
+  for (uint32_t i = 101U; i <= 102U; i++)
+    uut2.Add(WorkPackage::CreateDynamic(nullptr, 0U, [&order, i]() { order.push_back(i); }), 1U);
+
+  Thread t("LanesTestWQ");
+  t.Start([&uut2]() -> void* { uut2.Work(); return nullptr; }, Thread::SchedPolicy::Other, 0U,
+          Thread::GetDefaultStackSize());
+  ON_SCOPE_EXIT(joinThread)
+  {
+    stopTraffic = true;
+    uut2.FlushNonDeferredWorkPackages();
+    uut2.RequestTermination();
+    t.Join();
+  };
+
+  Thread flusher("LanesTestFlusher");
+  flusher.Start([&uut2]() -> void* { uut2.FlushNonDeferredWorkPackages(); return nullptr; },
+                Thread::SchedPolicy::Other, 0U, Thread::GetDefaultStackSize());
+
+  Thread::Sleep_ms(WAITTIME_MS);
+  blocker.Post();
+  flusher.Join();
+
+  std::vector<uint32_t> const expected = {101U, 102U};
+  EXPECT_EQ(order, expected);
+
+  // 101, 102, and the flush work package in lane 1
+  EXPECT_EQ(uut2.GetLaneStatistics(1U).nbOfAgingPromotions, 3U);
+}
+
+TEST_F(gpcc_execution_async_DeferredWorkQueue_TestsF, Periodic_NoDrift)
+{
+  // The work package's execution time (4ms) must not shift the phase of the 10ms period.
+
+  TimePoint const start = TimePoint::FromSystemClock(ConditionVariable::clockID) + TimeSpan::ms(DELAY_TIME_MS);
+
+  size_t cnt = 0U;
+  DeferredWorkPackage dwp(this, 0U,
+                          [&]()
+                          {
+                            timestampList.push_back(TimePoint::FromSystemClock(ConditionVariable::clockID));
+                            Thread::Sleep_ms(4U);
+                            if (++cnt == 5U)
+                            {
+                              uut.Remove(dwp);
+                              WQ_AddWPTerminate();
+                            }
+                          },
+                          start);
+  dwp.SetPeriodic(TimeSpan::ms(DELAY_TIME_MS), DeferredWorkPackage::OverrunPolicy::skip);
+  ON_SCOPE_EXIT() { uut.Remove(this); };
+
+  uut.Add(dwp);
+  EnterUUTWork();
+  JoinWorkThread();
+  EXPECT_TRUE(pCaughtException == nullptr);
+
+  // with drift, the 5th execution would take place at start + 4 * (10ms + 4ms)
+  ASSERT_EQ(timestampList.size(), 5U);
+  EXPECT_TRUE(timestampList[4] >= start + TimeSpan::ms(4 * DELAY_TIME_MS));
+  EXPECT_TRUE(timestampList[4] < start + TimeSpan::ms(5 * DELAY_TIME_MS));
+
+  auto const stats = dwp.GetPeriodicStatistics();
+  EXPECT_EQ(stats.nbOfOverruns, 0U);
+  EXPECT_EQ(stats.nbOfMissedPeriods, 0U);
+}
+
+TEST_F(gpcc_execution_async_DeferredWorkQueue_TestsF, Periodic_Overrun_Skip)
+{
+  // The first point in time is 3.5 periods in the past. Periods 1..3 are skipped, period 4 is executed.
+
+  TimePoint const start = TimePoint::FromSystemClock(ConditionVariable::clockID) - TimeSpan::ms(35);
+
+  size_t cnt = 0U;
+  DeferredWorkPackage dwp(this, 0U,
+                          [&]()
+                          {
+                            timestampList.push_back(TimePoint::FromSystemClock(ConditionVariable::clockID));
+                            if (++cnt == 2U)
+                            {
+                              uut.Remove(dwp);
+                              WQ_AddWPTerminate();
+                            }
+                          },
+                          start);
+  dwp.SetPeriodic(TimeSpan::ms(10), DeferredWorkPackage::OverrunPolicy::skip);
+  ON_SCOPE_EXIT() { uut.Remove(this); };
+
+  uut.Add(dwp);
+  EnterUUTWork();
+  JoinWorkThread();
+  EXPECT_TRUE(pCaughtException == nullptr);
+
+  ASSERT_EQ(timestampList.size(), 2U);
+  EXPECT_TRUE(timestampList[1] >= start + TimeSpan::ms(40));
+
+  auto const stats = dwp.GetPeriodicStatistics();
+  EXPECT_EQ(stats.nbOfOverruns, 1U);
+  EXPECT_EQ(stats.nbOfMissedPeriods, 3U);
+}
+
+TEST_F(gpcc_execution_async_DeferredWorkQueue_TestsF, Periodic_Overrun_CatchUp)
+{
+  // The first point in time is 3.5 periods in the past. Periods 1..3 are executed back-to-back.
+
+  TimePoint const start = TimePoint::FromSystemClock(ConditionVariable::clockID) - TimeSpan::ms(35);
+
+  size_t cnt = 0U;
+  DeferredWorkPackage dwp(this, 0U,
+                          [&]()
+                          {
+                            timestampList.push_back(TimePoint::FromSystemClock(ConditionVariable::clockID));
+                            if (++cnt == 5U)
+                            {
+                              uut.Remove(dwp);
+                              WQ_AddWPTerminate();
+                            }
+                          },
+                          start);
+  dwp.SetPeriodic(TimeSpan::ms(10), DeferredWorkPackage::OverrunPolicy::catchUp);
+  ON_SCOPE_EXIT() { uut.Remove(this); };
+
+  uut.Add(dwp);
+  EnterUUTWork();
+  JoinWorkThread();
+  EXPECT_TRUE(pCaughtException == nullptr);
+
+  ASSERT_EQ(timestampList.size(), 5U);
+  EXPECT_TRUE(timestampList[3] < start + TimeSpan::ms(40));
+  EXPECT_TRUE(timestampList[4] >= start + TimeSpan::ms(40));
+
+  auto const stats = dwp.GetPeriodicStatistics();
+  EXPECT_EQ(stats.nbOfOverruns, 3U);
+  EXPECT_EQ(stats.nbOfMissedPeriods, 0U);
+}
+
+TEST_F(gpcc_execution_async_DeferredWorkQueue_TestsF, Periodic_Overrun_Coalesce)
+{
+  // The first point in time is 3.5 periods in the past. Periods 1..3 are covered by one immediate execution.
+
+  TimePoint const start = TimePoint::FromSystemClock(ConditionVariable::clockID) - TimeSpan::ms(35);
+
+  size_t cnt = 0U;
+  DeferredWorkPackage dwp(this, 0U,
+                          [&]()
+                          {
+                            timestampList.push_back(TimePoint::FromSystemClock(ConditionVariable::clockID));
+                            if (++cnt == 3U)
+                            {
+                              uut.Remove(dwp);
+                              WQ_AddWPTerminate();
+                            }
+                          },
+                          start);
+  dwp.SetPeriodic(TimeSpan::ms(10), DeferredWorkPackage::OverrunPolicy::coalesce);
+  ON_SCOPE_EXIT() { uut.Remove(this); };
+
+  uut.Add(dwp);
+  EnterUUTWork();
+  JoinWorkThread();
+  EXPECT_TRUE(pCaughtException == nullptr);
+
+  ASSERT_EQ(timestampList.size(), 3U);
+  EXPECT_TRUE(timestampList[1] < start + TimeSpan::ms(40));
+  EXPECT_TRUE(timestampList[2] >= start + TimeSpan::ms(40));
+
+  auto const stats = dwp.GetPeriodicStatistics();
+  EXPECT_EQ(stats.nbOfOverruns, 1U);
+  EXPECT_EQ(stats.nbOfMissedPeriods, 2U);
+}
+
+TEST_F(gpcc_execution_async_DeferredWorkQueue_TestsF, Periodic_SetNonPeriodicDuringExecution)
+{
+  size_t cnt = 0U;
+  DeferredWorkPackage dwp(this, 0U,
+                          [&]()
+                          {
+                            if (++cnt == 3U)
+                              dwp.SetNonPeriodic();
+                          },
+                          TimePoint::FromSystemClock(ConditionVariable::clockID));
+  dwp.SetPeriodic(TimeSpan::ms(1), DeferredWorkPackage::OverrunPolicy::skip);
+  ON_SCOPE_EXIT() { uut.Remove(this); };
+
+  uut.Add(dwp);
+  uut.Add(DeferredWorkPackage::CreateDynamic(this, 0U, [&]() { WQ_AddWPTerminate(); }, TimeSpan::ms(DELAY_TIME_MS)));
+  EnterUUTWork();
+  JoinWorkThread();
+  EXPECT_TRUE(pCaughtException == nullptr);
+
+  EXPECT_EQ(cnt, 3U);
+  EXPECT_FALSE(dwp.IsPeriodic());
+}
+
+TEST_F(gpcc_execution_async_DeferredWorkQueue_TestsF, Periodic_RemoveByOwnerDuringExecution)
+{
+  size_t cnt = 0U;
+  DeferredWorkPackage dwp(this, 7U,
+                          [&]()
+                          {
+                            if (++cnt == 2U)
+                              uut.Remove(this, 7U);
+                          },
+                          TimePoint::FromSystemClock(ConditionVariable::clockID));
+  dwp.SetPeriodic(TimeSpan::ms(1), DeferredWorkPackage::OverrunPolicy::skip);
+  ON_SCOPE_EXIT() { uut.Remove(this); };
+
+  uut.Add(dwp);
+  uut.Add(DeferredWorkPackage::CreateDynamic(nullptr, 0U, [&]() { WQ_AddWPTerminate(); }, TimeSpan::ms(DELAY_TIME_MS)));
+  EnterUUTWork();
+  JoinWorkThread();
+  EXPECT_TRUE(pCaughtException == nullptr);
+
+  EXPECT_EQ(cnt, 2U);
+  EXPECT_FALSE(uut.IsAnyInQueue(this));
+}
+
+TEST_F(gpcc_execution_async_DeferredWorkQueue_TestsF, Periodic_ReAddDuringExecutionTakesPrecedence)
+{
+  size_t cnt = 0U;
+  TimePoint const start = TimePoint::FromSystemClock(ConditionVariable::clockID);
+  DeferredWorkPackage dwp(this, 0U,
+                          [&]()
+                          {
+                            timestampList.push_back(TimePoint::FromSystemClock(ConditionVariable::clockID));
+                            if (++cnt == 1U)
+                            {
+                              // re-add with a delay of 5 periods instead of the regular period
+                              dwp.SetTimePoint(start + TimeSpan::ms(5 * DELAY_TIME_MS));
+                              uut.Add(dwp);
+                            }
+                            else
+                            {
+                              uut.Remove(dwp);
+                              WQ_AddWPTerminate();
+                            }
+                          },
+                          start);
+  dwp.SetPeriodic(TimeSpan::ms(DELAY_TIME_MS), DeferredWorkPackage::OverrunPolicy::skip);
+  ON_SCOPE_EXIT() { uut.Remove(this); };
+
+  uut.Add(dwp);
+  EnterUUTWork();
+  JoinWorkThread();
+  EXPECT_TRUE(pCaughtException == nullptr);
+
+  ASSERT_EQ(timestampList.size(), 2U);
+  EXPECT_TRUE(timestampList[1] >= start + TimeSpan::ms(5 * DELAY_TIME_MS));
+}
+
+TEST(gpcc_execution_async_DeferredWorkQueue_Tests, BatchAdd_Lanes)
+{
+  DeferredWorkQueue uut(2U, 1U, 0U);
+  std::vector<uint32_t> order;
+
+  WorkPackage wp1(nullptr, 0U, [&order]() { order.push_back(3U); });
+  WorkPackage wp2(nullptr, 0U, [&order]() { order.push_back(4U); });
+
+  uut.Add(WorkPackage::CreateDynamic(nullptr, 0U, [&order]() { order.push_back(10U); })); // default lane
+
+  std::vector<std::unique_ptr<WorkPackage>> batch;
+  batch.emplace_back(WorkPackage::CreateDynamic(nullptr, 0U, [&order]() { order.push_back(11U); }));
+  batch.emplace_back(WorkPackage::CreateDynamic(nullptr, 0U, [&order]() { order.push_back(12U); }));
+  uut.Add(batch); // default lane
+  EXPECT_TRUE(batch.empty());
+
+  batch.emplace_back(WorkPackage::CreateDynamic(nullptr, 0U, [&order]() { order.push_back(1U); }));
+  batch.emplace_back(WorkPackage::CreateDynamic(nullptr, 0U, [&order]() { order.push_back(2U); }));
+  uut.Add(batch, 0U);
+  EXPECT_TRUE(batch.empty());
+
+  WorkPackage* const staticBatch[2] = { &wp1, &wp2 };
+  uut.Add(staticBatch, 2U, 0U);
+
+  ExecuteAllInLanes(uut);
+
+  std::vector<uint32_t> const expected = {1U, 2U, 3U, 4U, 10U, 11U, 12U};
+  EXPECT_EQ(order, expected);
+  EXPECT_EQ(uut.GetLaneStatistics(0U).nbOfExecutedWPs, 4U);
+}
+
+TEST(gpcc_execution_async_DeferredWorkQueue_Tests, BatchAdd_InvalidArgs)
+{
+  DeferredWorkQueue uut(2U, 0U, 0U);
+
+  std::vector<std::unique_ptr<WorkPackage>> batch;
+  batch.emplace_back(WorkPackage::CreateDynamic(nullptr, 0U, []() {}));
+  EXPECT_THROW(uut.Add(batch, 2U), std::invalid_argument);
+  batch.emplace_back(nullptr);
+  EXPECT_THROW(uut.Add(batch), std::invalid_argument);
+  ASSERT_EQ(batch.size(), 2U);
+  EXPECT_TRUE(batch[0] != nullptr);
+
+  WorkPackage wp(nullptr, 0U, []() {});
+  WorkPackage* const staticBatch[2] = { &wp, nullptr };
+  EXPECT_THROW(uut.Add(staticBatch, 1U, 2U), std::invalid_argument);
+  EXPECT_THROW(uut.Add(staticBatch, 2U), std::invalid_argument);
+
+  std::vector<std::unique_ptr<DeferredWorkPackage>> dBatch;
+  dBatch.emplace_back(DeferredWorkPackage::CreateDynamic(nullptr, 0U, []() {}, TimeSpan::ms(0)));
+  dBatch.emplace_back(nullptr);
+  EXPECT_THROW(uut.Add(dBatch), std::invalid_argument);
+  ASSERT_EQ(dBatch.size(), 2U);
+  EXPECT_TRUE(dBatch[0] != nullptr);
+
+  DeferredWorkPackage dwp(nullptr, 0U, []() {}, TimeSpan::ms(0));
+  DeferredWorkPackage* const staticDBatch[2] = { &dwp, nullptr };
+  EXPECT_THROW(uut.Add(staticDBatch, 2U), std::invalid_argument);
+
+  EXPECT_FALSE(uut.IsAnyInQueue(nullptr));
+}
+
+TEST_F(gpcc_execution_async_DeferredWorkQueue_TestsF, BatchAdd_Deferred_Dynamic)
+{
+  TimePoint const now = TimePoint::FromSystemClock(ConditionVariable::clockID);
+
+  // DWPs with equal time points must be executed in the order in which they are stored in the batch
+  std::vector<std::unique_ptr<DeferredWorkPackage>> batch;
+  batch.emplace_back(DeferredWorkPackage::CreateDynamic(this, 0U, [this]() { WQ_PushToCheckList(3U); },
+                                                        now + TimeSpan::ms(2 * DELAY_TIME_MS)));
+  batch.emplace_back(DeferredWorkPackage::CreateDynamic(this, 0U, [this]() { WQ_PushToCheckList(1U); },
+                                                        now + TimeSpan::ms(DELAY_TIME_MS)));
+  batch.emplace_back(DeferredWorkPackage::CreateDynamic(this, 0U, [this]() { WQ_PushToCheckList(2U); },
+                                                        now + TimeSpan::ms(DELAY_TIME_MS)));
+  batch.emplace_back(DeferredWorkPackage::CreateDynamic(this, 0U, [this]() { WQ_AddWPTerminate(); },
+                                                        now + TimeSpan::ms(3 * DELAY_TIME_MS)));
+
+  EnterUUTWork();
+
+  uut.Add(batch);
+  EXPECT_TRUE(batch.empty());
+
+  JoinWorkThread();
+  EXPECT_TRUE(pCaughtException == nullptr);
+
+  uint32_t const expected[] = {1U, 2U, 3U};
+  ASSERT_TRUE(CheckCheckList(expected, 3U));
+}
+
+TEST_F(gpcc_execution_async_DeferredWorkQueue_TestsF, BatchAdd_Deferred_Static_BadStateRollsBack)
+{
+  TimePoint const tp = TimePoint::FromSystemClock(ConditionVariable::clockID) + TimeSpan::ms(DELAY_TIME_MS);
+
+  DeferredWorkPackage dwp1(this, 0U, [this]() { WQ_PushToCheckList(1U); }, tp);
+  DeferredWorkPackage dwp2(this, 0U, [this]() { WQ_PushToCheckList(2U); }, tp);
+  DeferredWorkPackage dwp3(this, 0U, [this]() { WQ_AddWPTerminate(); }, tp);
+  ON_SCOPE_EXIT() { uut.Remove(this); };
+
+  // dwp2 is already enqueued
+  uut.Add(dwp2);
+  DeferredWorkPackage* const batch1[3] = { &dwp1, &dwp3, &dwp2 };
+  EXPECT_THROW(uut.Add(batch1, 3U), std::logic_error);
+
+  // dwp1 is contained twice
+  uut.Remove(dwp2);
+  DeferredWorkPackage* const batch2[2] = { &dwp1, &dwp1 };
+  EXPECT_THROW(uut.Add(batch2, 2U), std::logic_error);
+
+  EXPECT_FALSE(uut.IsAnyInQueue(this));
+
+  // the states must have been rolled back, so the DWPs can be added now
+  DeferredWorkPackage* const batch3[3] = { &dwp1, &dwp2, &dwp3 };
+  uut.Add(batch3, 3U);
+
+  EnterUUTWork();
+  JoinWorkThread();
+  EXPECT_TRUE(pCaughtException == nullptr);
+
+  uint32_t const expected[] = {1U, 2U};
+  ASSERT_TRUE(CheckCheckList(expected, 2U));
+}
+
+#ifndef SKIP_LOAD_DEPENDENT_TESTS
+TEST_F(gpcc_execution_async_DeferredWorkQueue_TestsF, Benchmark_InsertAndExpiryAtScale)
+{
+  // This measures the costs for inserting and executing a large number of deferred work packages.
+  // The results are printed to stdout.
+
+  size_t const n = 20000U;
+  TimePoint const now = TimePoint::FromSystemClock(ConditionVariable::clockID);
+
+  std::vector<std::unique_ptr<DeferredWorkPackage>> dwps;
+  dwps.reserve(n);
+
+  ON_SCOPE_EXIT()
+  {
+    uut.Remove(this);
+  };
+
+  uint32_t rnd = 0x87654321UL;
+  for (uint32_t i = 0U; i < n; i++)
+  {
+    rnd = (rnd * 1103515245UL) + 12345UL;
+    TimePoint const tp = now - TimeSpan::ms(static_cast<int64_t>((rnd >> 8U) % 100000U) + 1);
+    dwps.emplace_back(std::make_unique<DeferredWorkPackage>(this, 0U, []() {}, tp));
+  }
+
+  auto const t0 = std::chrono::steady_clock::now();
+
+  for (auto & spDWP : dwps)
+    uut.Add(*spDWP);
+
+  auto const t1 = std::chrono::steady_clock::now();
+
+  WQ_AddWPTerminate();
+  EnterUUTWork();
+  JoinWorkThread();
+  EXPECT_TRUE(pCaughtException == nullptr);
+
+  auto const t2 = std::chrono::steady_clock::now();
+
+  EXPECT_FALSE(uut.IsAnyInQueue(this));
+
+  auto const insert_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count();
+  auto const expiry_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count();
+  std::cout << "DeferredWorkQueue with " << n << " deferred work packages:" << std::endl
+            << "  Insert: " << (insert_ns / static_cast<int64_t>(n)) << " ns per work package" << std::endl
+            << "  Expiry: " << (expiry_ns / static_cast<int64_t>(n)) << " ns per work package (incl. execution)"
+            << std::endl;
+}
+#endif
+
 } // namespace execution
 } // namespace async
 } // namespace gpcc_tests
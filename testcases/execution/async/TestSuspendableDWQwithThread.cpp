@@ -45,6 +45,27 @@ TEST(gpcc_execution_async_SuspendableDWQwithThread_Tests, CreateStartStopAndDest
   spUUT.reset();
 }
 
+TEST(gpcc_execution_async_SuspendableDWQwithThread_Tests, CreateWithLanesStartStopAndDestroy)
+{
+  std::unique_ptr<SuspendableDWQwithThread> spUUT;
+
+  ASSERT_NO_THROW(spUUT = std::make_unique<SuspendableDWQwithThread>("UUT", 3U, 1U, 4U));
+  EXPECT_EQ(spUUT->GetDWQ().GetNbOfLanes(), 3U);
+
+  ASSERT_NO_THROW(spUUT->Start(Thread::SchedPolicy::Other, 0U, Thread::GetDefaultStackSize()));
+  spUUT->Stop();
+
+  spUUT.reset();
+}
+
+TEST(gpcc_execution_async_SuspendableDWQwithThread_Tests, CreateWithInvalidLaneConfig)
+{
+  std::unique_ptr<SuspendableDWQwithThread> spUUT;
+
+  ASSERT_THROW(spUUT = std::make_unique<SuspendableDWQwithThread>("UUT", 0U, 0U, 0U), std::invalid_argument);
+  ASSERT_THROW(spUUT = std::make_unique<SuspendableDWQwithThread>("UUT", 2U, 2U, 0U), std::invalid_argument);
+}
+
 TEST(gpcc_execution_async_SuspendableDWQwithThread_Tests, StartTwice)
 {
   std::unique_ptr<SuspendableDWQwithThread> spUUT;
@@ -0,0 +1,341 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+// Coroutines require C++20
+#if defined(__cpp_impl_coroutine) && (__cpp_impl_coroutine >= 201902L)
+
+#include <gpcc/execution/async/Task.hpp>
+#include <gpcc/execution/async/DeferredWorkQueue.hpp>
+#include <gpcc/execution/async/WorkPackagePool.hpp>
+#include <gpcc/osal/Semaphore.hpp>
+#include <gpcc/osal/Thread.hpp>
+#include <gpcc_test/compiler/warnings.hpp>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <cstdint>
+#include <cstdlib>
+
+namespace gpcc_tests {
+namespace execution  {
+namespace async      {
+
+using namespace gpcc::execution::async;
+using gpcc::osal::Semaphore;
+using gpcc::osal::Thread;
+
+namespace {
+
+// Frame allocator that counts allocations and releases.
+class CountingFrameAllocator final : public ICoroutineFrameAllocator
+{
+  public:
+    std::atomic<uint32_t> nbOfAllocations;
+    std::atomic<uint32_t> nbOfDeallocations;
+
+    CountingFrameAllocator(void) : ICoroutineFrameAllocator(), nbOfAllocations(0U), nbOfDeallocations(0U) {}
+    ~CountingFrameAllocator(void) = default;
+
+    void* Allocate(size_t const size) override
+    {
+      void* const p = std::malloc(size);
+      if (p == nullptr)
+        throw std::bad_alloc();
+
+      nbOfAllocations++;
+      return p;
+    }
+
+    void Deallocate(void* const p, size_t const size) noexcept override
+    {
+      (void)size;
+      nbOfDeallocations++;
+      std::free(p);
+    }
+};
+
+// Increments a counter when destroyed. Used to detect destruction of coroutine frames.
+class DestructionDetector final
+{
+  public:
+    explicit DestructionDetector(uint32_t & _cnt) : cnt(_cnt) {}
+    ~DestructionDetector(void) { cnt++; }
+
+  private:
+    uint32_t & cnt;
+};
+
+Task<int> Add(int const a, int const b)
+{
+  co_return a + b;
+}
+
+Task<int> AddTwice(int const a, int const b)
+{
+  int const x = co_await Add(a, b);
+  int const y = co_await Add(x, b);
+  co_return y;
+}
+
+Task<int> Throw(void)
+{
+  throw std::runtime_error("Test");
+  co_return 0;
+}
+
+GPCC_DISABLE_WARN_MISMATCHED_NEW_DELETE();
+Task<int> AddWithAllocator(std::allocator_arg_t, ICoroutineFrameAllocator &, int const a, int const b)
+{
+  co_return co_await Add(a, b);
+}
+GPCC_RESTORE_WARN_MISMATCHED_NEW_DELETE();
+
+Task<void> SetFlag(bool & flag, uint32_t & destructionCnt)
+{
+  DestructionDetector dd(destructionCnt);
+  flag = true;
+  co_return;
+}
+
+class MemberCoroutine final
+{
+  public:
+    int offset = 10;
+
+    GPCC_DISABLE_WARN_MISMATCHED_NEW_DELETE();
+    Task<int> AddOffset(std::allocator_arg_t, ICoroutineFrameAllocator &, int const a)
+    {
+      co_return a + offset;
+    }
+    GPCC_RESTORE_WARN_MISMATCHED_NEW_DELETE();
+};
+
+} // anonymous namespace
+
+// Test fixture for Task and Spawn. Provides a deferred work queue driven by a thread.
+class gpcc_execution_async_Task_TestsF: public testing::Test
+{
+  public:
+    gpcc_execution_async_Task_TestsF(void);
+
+  protected:
+    DeferredWorkQueue dwq;
+    Thread thread;
+    bool threadStarted;
+    Semaphore done;
+
+    void SetUp(void) override;
+    void TearDown(void) override;
+};
+
+gpcc_execution_async_Task_TestsF::gpcc_execution_async_Task_TestsF(void)
+: Test()
+, dwq()
+, thread("DWQ")
+, threadStarted(false)
+, done(0U)
+{
+}
+
+void gpcc_execution_async_Task_TestsF::SetUp(void)
+{
+  thread.Start([&]() -> void* { dwq.Work(); return nullptr; },
+               Thread::SchedPolicy::Other, 0U, Thread::GetDefaultStackSize());
+  threadStarted = true;
+}
+
+void gpcc_execution_async_Task_TestsF::TearDown(void)
+{
+  if (threadStarted)
+  {
+    dwq.FlushNonDeferredWorkPackages();
+    dwq.RequestTermination();
+    thread.Join();
+  }
+}
+
+TEST(gpcc_execution_async_Task_Tests, LazyStartAndDestroy)
+{
+  bool flag = false;
+  uint32_t destructionCnt = 0U;
+
+  {
+    auto task = SetFlag(flag, destructionCnt);
+    EXPECT_FALSE(flag);
+  }
+
+  // the coroutine has never been started, so the local variable has never been created
+  EXPECT_FALSE(flag);
+  EXPECT_EQ(destructionCnt, 0U);
+}
+
+TEST(gpcc_execution_async_Task_Tests, MoveConstructionAndAssignment)
+{
+  bool flag1 = false;
+  bool flag2 = false;
+  uint32_t destructionCnt = 0U;
+
+  auto task1 = SetFlag(flag1, destructionCnt);
+  auto task2(std::move(task1));
+  auto task3 = SetFlag(flag2, destructionCnt);
+  task3 = std::move(task2);
+
+  EXPECT_FALSE(flag1);
+  EXPECT_FALSE(flag2);
+}
+
+TEST(gpcc_execution_async_Task_Tests, SpawnMovedAwayTask)
+{
+  DeferredWorkQueue dwq;
+  bool flag = false;
+  uint32_t destructionCnt = 0U;
+
+  auto task1 = SetFlag(flag, destructionCnt);
+  auto task2(std::move(task1));
+
+  EXPECT_THROW(Spawn(dwq, std::move(task1)), std::invalid_argument);
+}
+
+TEST_F(gpcc_execution_async_Task_TestsF, Spawn)
+{
+  bool flag = false;
+  bool executedByDWQ = false;
+
+  auto coroutine = [&]() -> Task<void>
+  {
+    flag = true;
+    executedByDWQ = thread.IsItMe();
+    done.Post();
+    co_return;
+  };
+
+  auto task = coroutine();
+  Spawn(dwq, std::move(task));
+  done.Wait();
+
+  EXPECT_TRUE(flag);
+  EXPECT_TRUE(executedByDWQ);
+}
+
+TEST_F(gpcc_execution_async_Task_TestsF, SpawnDestroysFrame)
+{
+  bool flag = false;
+  uint32_t destructionCnt = 0U;
+
+  Spawn(dwq, SetFlag(flag, destructionCnt));
+  dwq.FlushNonDeferredWorkPackages();
+
+  EXPECT_TRUE(flag);
+  EXPECT_EQ(destructionCnt, 1U);
+}
+
+TEST_F(gpcc_execution_async_Task_TestsF, SpawnWithPool)
+{
+  WorkPackagePool pool(2U);
+  bool flag = false;
+  uint32_t destructionCnt = 0U;
+
+  Spawn(dwq, SetFlag(flag, destructionCnt), &pool);
+  dwq.FlushNonDeferredWorkPackages();
+
+  EXPECT_TRUE(flag);
+
+  auto const stat = pool.GetStatistics();
+  EXPECT_EQ(stat.nbOfAllocations, 1U);
+  EXPECT_EQ(stat.nbOfExhaustions, 0U);
+  EXPECT_EQ(stat.nbOfFreeBlocks, 2U);
+}
+
+TEST_F(gpcc_execution_async_Task_TestsF, AwaitTaskWithResult)
+{
+  int result = 0;
+
+  auto coroutine = [&]() -> Task<void>
+  {
+    result = co_await AddTwice(3, 4);
+    done.Post();
+  };
+
+  Spawn(dwq, coroutine());
+  done.Wait();
+
+  EXPECT_EQ(result, 11);
+}
+
+TEST_F(gpcc_execution_async_Task_TestsF, ExceptionPropagatesToAwaitingCoroutine)
+{
+  bool caught = false;
+
+  auto coroutine = [&]() -> Task<void>
+  {
+    try
+    {
+      (void)co_await Throw();
+    }
+    catch (std::runtime_error const &)
+    {
+      caught = true;
+    }
+    done.Post();
+  };
+
+  Spawn(dwq, coroutine());
+  done.Wait();
+
+  EXPECT_TRUE(caught);
+}
+
+TEST_F(gpcc_execution_async_Task_TestsF, FrameAllocator)
+{
+  CountingFrameAllocator allocator;
+  int result = 0;
+
+  auto coroutine = [&]() -> Task<void>
+  {
+    result = co_await AddWithAllocator(std::allocator_arg, allocator, 1, 2);
+    done.Post();
+  };
+
+  Spawn(dwq, coroutine());
+  done.Wait();
+  dwq.FlushNonDeferredWorkPackages();
+
+  EXPECT_EQ(result, 3);
+  EXPECT_EQ(allocator.nbOfAllocations, 1U);
+  EXPECT_EQ(allocator.nbOfDeallocations, 1U);
+}
+
+TEST_F(gpcc_execution_async_Task_TestsF, FrameAllocator_MemberCoroutine)
+{
+  CountingFrameAllocator allocator;
+  MemberCoroutine obj;
+  int result = 0;
+
+  auto coroutine = [&]() -> Task<void>
+  {
+    result = co_await obj.AddOffset(std::allocator_arg, allocator, 5);
+    done.Post();
+  };
+
+  Spawn(dwq, coroutine());
+  done.Wait();
+  dwq.FlushNonDeferredWorkPackages();
+
+  EXPECT_EQ(result, 15);
+  EXPECT_EQ(allocator.nbOfAllocations, 1U);
+  EXPECT_EQ(allocator.nbOfDeallocations, 1U);
+}
+
+} // namespace async
+} // namespace execution
+} // namespace gpcc_tests
+
+#endif // #if defined(__cpp_impl_coroutine) && (__cpp_impl_coroutine >= 201902L)
@@ -0,0 +1,279 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#include <gpcc/execution/async/WorkPackagePool.hpp>
+#include <gpcc/execution/async/DeferredWorkPackage.hpp>
+#include <gpcc/execution/async/DeferredWorkQueue.hpp>
+#include <gpcc/execution/async/WorkPackage.hpp>
+#include <gpcc/execution/async/WorkQueue.hpp>
+#include <gpcc/time/TimeSpan.hpp>
+#include <gtest/gtest.h>
+#include <array>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <cstdint>
+
+namespace gpcc_tests {
+namespace execution  {
+namespace async      {
+
+using gpcc::execution::async::DeferredWorkPackage;
+using gpcc::execution::async::DeferredWorkQueue;
+using gpcc::execution::async::WorkPackage;
+using gpcc::execution::async::WorkPackagePool;
+using gpcc::execution::async::WorkQueue;
+using gpcc::time::TimeSpan;
+
+TEST(gpcc_execution_async_WorkPackagePool_Tests, CreateAndDestroy)
+{
+  std::unique_ptr<WorkPackagePool> spUUT;
+
+  ASSERT_NO_THROW(spUUT = std::make_unique<WorkPackagePool>(4U));
+  EXPECT_EQ(spUUT->GetInlineFunctorSize(), WorkPackagePool::defaultInlineFunctorSize);
+
+  auto const stats = spUUT->GetStatistics();
+  EXPECT_EQ(stats.nbOfBlocks, 4U);
+  EXPECT_EQ(stats.nbOfFreeBlocks, 4U);
+  EXPECT_EQ(stats.minNbOfFreeBlocks, 4U);
+  EXPECT_EQ(stats.nbOfAllocations, 0U);
+  EXPECT_EQ(stats.nbOfExhaustions, 0U);
+  EXPECT_EQ(stats.nbOfOversizedFunctors, 0U);
+
+  spUUT.reset();
+}
+
+TEST(gpcc_execution_async_WorkPackagePool_Tests, CreateWithZeroBlocks)
+{
+  std::unique_ptr<WorkPackagePool> spUUT;
+
+  ASSERT_THROW(spUUT = std::make_unique<WorkPackagePool>(0U), std::invalid_argument);
+}
+
+TEST(gpcc_execution_async_WorkPackagePool_Tests, InlineFunctorSizeRoundedUp)
+{
+  WorkPackagePool uut(1U, 1U);
+  EXPECT_EQ(uut.GetInlineFunctorSize(), alignof(std::max_align_t));
+}
+
+TEST(gpcc_execution_async_WorkPackagePool_Tests, CreateAndReleaseWP)
+{
+  WorkPackagePool uut(2U);
+  int owner;
+
+  auto spWP = WorkPackage::CreateDynamic(uut, &owner, 0U, []() {});
+
+  auto stats = uut.GetStatistics();
+  EXPECT_EQ(stats.nbOfFreeBlocks, 1U);
+  EXPECT_EQ(stats.minNbOfFreeBlocks, 1U);
+  EXPECT_EQ(stats.nbOfAllocations, 1U);
+
+  spWP.reset();
+
+  stats = uut.GetStatistics();
+  EXPECT_EQ(stats.nbOfFreeBlocks, 2U);
+  EXPECT_EQ(stats.minNbOfFreeBlocks, 1U);
+  EXPECT_EQ(stats.nbOfAllocations, 1U);
+}
+
+TEST(gpcc_execution_async_WorkPackagePool_Tests, CreateAndReleaseDWP)
+{
+  WorkPackagePool uut(2U);
+  int owner;
+
+  auto spDWP1 = DeferredWorkPackage::CreateDynamic(uut, &owner, 0U, []() {}, TimeSpan::ms(10));
+  auto spDWP2 = DeferredWorkPackage::CreateDynamic(uut, &owner, 0U, []() {}, TimeSpan::ms(10));
+
+  auto stats = uut.GetStatistics();
+  EXPECT_EQ(stats.nbOfFreeBlocks, 0U);
+  EXPECT_EQ(stats.nbOfAllocations, 2U);
+
+  spDWP1.reset();
+  spDWP2.reset();
+
+  stats = uut.GetStatistics();
+  EXPECT_EQ(stats.nbOfFreeBlocks, 2U);
+}
+
+TEST(gpcc_execution_async_WorkPackagePool_Tests, ExecutionInWorkQueue)
+{
+  WorkPackagePool uut(4U);
+  WorkQueue wq;
+  int owner;
+
+  uint32_t cnt = 0U;
+  uint32_t const increment = 3U;
+  wq.Add(WorkPackage::CreateDynamic(uut, &owner, 0U, [&cnt, increment]() { cnt += increment; }));
+  wq.Add(WorkPackage::CreateDynamic(uut, &owner, 0U, [&cnt, increment]() { cnt += increment; }));
+  wq.Add(WorkPackage::CreateDynamic(uut, &owner, 0U, [&wq]() { wq.RequestTermination(); }));
+
+  EXPECT_EQ(uut.GetStatistics().nbOfFreeBlocks, 1U);
+
+  wq.Work();
+
+  EXPECT_EQ(cnt, 6U);
+  EXPECT_EQ(uut.GetStatistics().nbOfFreeBlocks, 4U);
+}
+
+TEST(gpcc_execution_async_WorkPackagePool_Tests, ExecutionInDeferredWorkQueue)
+{
+  WorkPackagePool uut(4U);
+  DeferredWorkQueue dwq;
+  int owner;
+
+  uint32_t cnt = 0U;
+  dwq.Add(DeferredWorkPackage::CreateDynamic(uut, &owner, 0U, [&cnt]() { cnt++; }, TimeSpan::ms(1)));
+  dwq.Add(DeferredWorkPackage::CreateDynamic(uut, &owner, 0U, [&dwq]() { dwq.RequestTermination(); },
+                                             TimeSpan::ms(2)));
+
+  EXPECT_EQ(uut.GetStatistics().nbOfFreeBlocks, 2U);
+
+  dwq.Work();
+
+  EXPECT_EQ(cnt, 1U);
+  EXPECT_EQ(uut.GetStatistics().nbOfFreeBlocks, 4U);
+}
+
+TEST(gpcc_execution_async_WorkPackagePool_Tests, RemovedFromQueue)
+{
+  WorkPackagePool uut(2U);
+  int owner;
+
+  {
+    WorkQueue wq;
+    wq.Add(WorkPackage::CreateDynamic(uut, &owner, 0U, []() {}));
+    wq.Add(WorkPackage::CreateDynamic(uut, &owner, 1U, []() {}));
+    EXPECT_EQ(uut.GetStatistics().nbOfFreeBlocks, 0U);
+
+    wq.Remove(&owner, 0U);
+    EXPECT_EQ(uut.GetStatistics().nbOfFreeBlocks, 1U);
+
+    // the destructor of the work queue releases the remaining work package
+  }
+
+  EXPECT_EQ(uut.GetStatistics().nbOfFreeBlocks, 2U);
+}
+
+TEST(gpcc_execution_async_WorkPackagePool_Tests, PoolExhausted)
+{
+  WorkPackagePool uut(1U);
+  int owner;
+  uint32_t cnt = 0U;
+
+  auto spWP1 = WorkPackage::CreateDynamic(uut, &owner, 0U, [&cnt]() { cnt++; });
+  auto spWP2 = WorkPackage::CreateDynamic(uut, &owner, 0U, [&cnt]() { cnt++; });
+
+  auto stats = uut.GetStatistics();
+  EXPECT_EQ(stats.nbOfFreeBlocks, 0U);
+  EXPECT_EQ(stats.nbOfAllocations, 1U);
+  EXPECT_EQ(stats.nbOfExhaustions, 1U);
+
+  WorkQueue wq;
+  wq.Add(std::move(spWP1));
+  wq.Add(std::move(spWP2));
+  wq.Add(WorkPackage::CreateDynamic(&owner, 0U, [&wq]() { wq.RequestTermination(); }));
+  wq.Work();
+
+  EXPECT_EQ(cnt, 2U);
+
+  stats = uut.GetStatistics();
+  EXPECT_EQ(stats.nbOfFreeBlocks, 1U);
+  EXPECT_EQ(stats.minNbOfFreeBlocks, 0U);
+}
+
+TEST(gpcc_execution_async_WorkPackagePool_Tests, OversizedFunctor)
+{
+  WorkPackagePool uut(1U, 16U);
+  int owner;
+
+  std::array<uint8_t, 64> data;
+  data.fill(0xABU);
+  uint32_t sum = 0U;
+
+  auto spWP = WorkPackage::CreateDynamic(uut, &owner, 0U, [data, &sum]() { for (auto v : data) sum += v; });
+
+  auto stats = uut.GetStatistics();
+  EXPECT_EQ(stats.nbOfFreeBlocks, 1U);
+  EXPECT_EQ(stats.nbOfAllocations, 0U);
+  EXPECT_EQ(stats.nbOfOversizedFunctors, 1U);
+
+  WorkQueue wq;
+  wq.Add(std::move(spWP));
+  wq.Add(WorkPackage::CreateDynamic(&owner, 0U, [&wq]() { wq.RequestTermination(); }));
+  wq.Work();
+
+  EXPECT_EQ(sum, 64U * 0xABU);
+}
+
+TEST(gpcc_execution_async_WorkPackagePool_Tests, CallableDestroyedOnRelease)
+{
+  WorkPackagePool uut(1U);
+  int owner;
+
+  auto spShared = std::make_shared<int>(5);
+  auto spWP = WorkPackage::CreateDynamic(uut, &owner, 0U, [spShared]() { (*spShared)++; });
+  EXPECT_EQ(spShared.use_count(), 2);
+
+  spWP.reset();
+  EXPECT_EQ(spShared.use_count(), 1);
+}
+
+TEST(gpcc_execution_async_WorkPackagePool_Tests, StdFunctionAsCallable)
+{
+  WorkPackagePool uut(1U);
+  int owner;
+  uint32_t cnt = 0U;
+
+  WorkPackage::tFunctor f = [&cnt]() { cnt++; };
+  auto spWP = WorkPackage::CreateDynamic(uut, &owner, 0U, f);
+  EXPECT_EQ(uut.GetStatistics().nbOfAllocations, 1U);
+
+  WorkQueue wq;
+  wq.Add(std::move(spWP));
+  wq.Add(WorkPackage::CreateDynamic(&owner, 0U, [&wq]() { wq.RequestTermination(); }));
+  wq.Work();
+
+  EXPECT_EQ(cnt, 1U);
+}
+
+TEST(gpcc_execution_async_WorkPackagePool_Tests, EmptyCallable)
+{
+  WorkPackagePool uut(1U);
+  int owner;
+
+  WorkPackage::tFunctor f;
+  std::unique_ptr<WorkPackage> spWP;
+  EXPECT_THROW(spWP = WorkPackage::CreateDynamic(uut, &owner, 0U, f), std::invalid_argument);
+
+  void (*pFunc)(void) = nullptr;
+  std::unique_ptr<DeferredWorkPackage> spDWP;
+  EXPECT_THROW(spDWP = DeferredWorkPackage::CreateDynamic(uut, &owner, 0U, pFunc, TimeSpan::ms(1)),
+               std::invalid_argument);
+
+  auto const stats = uut.GetStatistics();
+  EXPECT_EQ(stats.nbOfFreeBlocks, 1U);
+  EXPECT_EQ(stats.nbOfAllocations, 0U);
+}
+
+TEST(gpcc_execution_async_WorkPackagePool_DeathTests, DestroyPoolWithBlocksInUse)
+{
+  auto spUUT = std::make_unique<WorkPackagePool>(1U);
+  int owner;
+
+  auto spWP = WorkPackage::CreateDynamic(*spUUT, &owner, 0U, []() {});
+
+  EXPECT_DEATH(spUUT.reset(), ".*WorkPackagePool::~WorkPackagePool: Blocks still in use.*");
+
+  spWP.reset();
+}
+
+} // namespace async
+} // namespace execution
+} // namespace gpcc_tests
@@ -9,15 +9,244 @@
 */
 
 #include "TestIWorkQueue.hpp"
+#include <gpcc/osal/Mutex.hpp>
+#include <gpcc/osal/MutexLocker.hpp>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 namespace gpcc_tests {
 namespace execution {
 namespace async {
 
+using gpcc::execution::async::IWorkQueue;
+using gpcc::osal::Mutex;
+using gpcc::osal::MutexLocker;
+
+/// Wrapper for a @ref WorkQueue using @ref WorkQueue::IngressMode::lockFree.
+/** This allows to run the typed IWorkQueue test suites against a @ref WorkQueue using lock-free ingress, because
+    the typed test fixtures require a default-constructible type. */
+class WorkQueueLockFreeIngress final: public IWorkQueue
+{
+  public:
+    WorkQueueLockFreeIngress(void) : wq(WorkQueue::IngressMode::lockFree) {}
+    virtual ~WorkQueueLockFreeIngress(void) = default;
+
+    void Add(std::unique_ptr<WorkPackage> spWP) override { wq.Add(std::move(spWP)); }
+    void Add(WorkPackage & wp) override { wq.Add(wp); }
+    void InsertAtHeadOfList(std::unique_ptr<WorkPackage> spWP) override { wq.InsertAtHeadOfList(std::move(spWP)); }
+    void InsertAtHeadOfList(WorkPackage & wp) override { wq.InsertAtHeadOfList(wp); }
+    void Remove(WorkPackage & wp) override { wq.Remove(wp); }
+    void Remove(void const * const pOwnerObject) override { wq.Remove(pOwnerObject); }
+    void Remove(void const * const pOwnerObject, uint32_t const ownerID) override { wq.Remove(pOwnerObject, ownerID); }
+    void WaitUntilCurrentWorkPackageHasBeenExecuted(void const * const pOwnerObject) const override
+    {
+      wq.WaitUntilCurrentWorkPackageHasBeenExecuted(pOwnerObject);
+    }
+    bool IsAnyInQueue(void const * const pOwnerObject) const override { return wq.IsAnyInQueue(pOwnerObject); }
+    void FlushNonDeferredWorkPackages(void) override { wq.FlushNonDeferredWorkPackages(); }
+
+    void Work(void) { wq.Work(); }
+    void RequestTermination(void) noexcept { wq.RequestTermination(); }
+
+  private:
+    WorkQueue wq;
+};
+
 INSTANTIATE_TYPED_TEST_SUITE_P(gpcc_execution_async_WorkQueue_, IWorkQueue_Tests1F, WorkQueue);
 INSTANTIATE_TYPED_TEST_SUITE_P(gpcc_execution_async_WorkQueue_, IWorkQueue_Tests2F, WorkQueue);
 INSTANTIATE_TYPED_TEST_SUITE_P(gpcc_execution_async_WorkQueue_, IWorkQueue_DeathTests1F, WorkQueue);
 
+INSTANTIATE_TYPED_TEST_SUITE_P(gpcc_execution_async_WorkQueueLockFreeIngress_, IWorkQueue_Tests1F,
+                               WorkQueueLockFreeIngress);
+INSTANTIATE_TYPED_TEST_SUITE_P(gpcc_execution_async_WorkQueueLockFreeIngress_, IWorkQueue_Tests2F,
+                               WorkQueueLockFreeIngress);
+INSTANTIATE_TYPED_TEST_SUITE_P(gpcc_execution_async_WorkQueueLockFreeIngress_, IWorkQueue_DeathTests1F,
+                               WorkQueueLockFreeIngress);
+
+// Multiple threads add dynamic and static work packages concurrently.
+// All work packages must be executed and the work packages of each producer must be executed in FIFO order.
+TEST(gpcc_execution_async_WorkQueueLockFreeIngress_Tests, MultipleProducers)
+{
+  size_t const nbOfProducers = 4U;
+  size_t const nbOfWPsPerProducer = 1000U;
+
+  WorkQueue uut(WorkQueue::IngressMode::lockFree);
+
+  Mutex resultMutex;
+  std::vector<std::vector<size_t>> results(nbOfProducers);
+  size_t nbOfStaticWPExecutions = 0U;
+
+  auto record = [&](size_t const producer, size_t const value)
+  {
+    MutexLocker resultMutexLocker(resultMutex);
+    results[producer].push_back(value);
+  };
+
+  // static work package enqueued by all producers, maybe while it is executed
+  WorkPackage staticWP(&uut, 1U, [&]() { MutexLocker resultMutexLocker(resultMutex); nbOfStaticWPExecutions++; });
+
+  auto producerEntry = [&](size_t const producer) -> void*
+  {
+    for (size_t i = 0U; i < nbOfWPsPerProducer; i++)
+    {
+      uut.Add(WorkPackage::CreateDynamic(&uut, 0U, std::bind(record, producer, i)));
+
+      if ((i % 100U) == 0U)
+      {
+        // Add() of a static WP fails with std::logic_error if the WP is already in the queue
+        try { uut.Add(staticWP); } catch (std::logic_error const &) {}
+      }
+    }
+    return nullptr;
+  };
+
+  Thread wqThread("WQ");
+  wqThread.Start([&]() -> void* { uut.Work(); return nullptr; },
+                 Thread::SchedPolicy::Other, 0U, Thread::GetDefaultStackSize());
+
+  ON_SCOPE_EXIT(stopWQThread)
+  {
+    uut.RequestTermination();
+    wqThread.Join();
+  };
+
+  std::vector<std::unique_ptr<Thread>> producers;
+  for (size_t i = 0U; i < nbOfProducers; i++)
+  {
+    producers.emplace_back(std::make_unique<Thread>("Producer" + std::to_string(i)));
+    producers.back()->Start(std::bind(producerEntry, i), Thread::SchedPolicy::Other, 0U, Thread::GetDefaultStackSize());
+  }
+
+  for (auto & spProducer : producers)
+    spProducer->Join();
+
+  uut.FlushNonDeferredWorkPackages();
+  uut.Remove(staticWP);
+
+  MutexLocker resultMutexLocker(resultMutex);
+  for (size_t producer = 0U; producer < nbOfProducers; producer++)
+  {
+    ASSERT_EQ(results[producer].size(), nbOfWPsPerProducer);
+    for (size_t i = 0U; i < nbOfWPsPerProducer; i++)
+    {
+      ASSERT_EQ(results[producer][i], i);
+    }
+  }
+
+  EXPECT_GE(nbOfStaticWPExecutions, 1U);
+}
+
+namespace {
+
+// Adds single work packages and batches of work packages to a work queue using the given ingress mode and checks that
+// the order of execution is maintained.
+void BatchAddMaintainsOrder(WorkQueue::IngressMode const ingressMode)
+{
+  WorkQueue uut(ingressMode);
+  std::vector<int> results;
+
+  WorkPackage staticWP1(&uut, 0U, [&]() { results.push_back(4); });
+  WorkPackage staticWP2(&uut, 0U, [&]() { results.push_back(5); });
+
+  uut.Add(WorkPackage::CreateDynamic(&uut, 0U, [&]() { results.push_back(0); }));
+
+  std::vector<std::unique_ptr<WorkPackage>> batch;
+  for (int i = 1; i <= 3; i++)
+    batch.emplace_back(WorkPackage::CreateDynamic(&uut, 0U, [&results, i]() { results.push_back(i); }));
+  uut.Add(batch);
+  EXPECT_TRUE(batch.empty());
+
+  WorkPackage* const staticBatch[2] = { &staticWP1, &staticWP2 };
+  uut.Add(staticBatch, 2U);
+
+  // empty batches are ignored
+  uut.Add(batch);
+  uut.Add(nullptr, 0U);
+
+  uut.Add(WorkPackage::CreateDynamic(&uut, 0U, [&]() { uut.RequestTermination(); }));
+
+  uut.Work();
+
+  ASSERT_EQ(results.size(), 6U);
+  for (size_t i = 0U; i < results.size(); i++)
+  {
+    EXPECT_EQ(results[i], static_cast<int>(i));
+  }
+}
+
+} // anonymous namespace
+
+TEST(gpcc_execution_async_WorkQueue_Tests, BatchAdd_Order)
+{
+  BatchAddMaintainsOrder(WorkQueue::IngressMode::locked);
+}
+
+TEST(gpcc_execution_async_WorkQueueLockFreeIngress_Tests, BatchAdd_Order)
+{
+  BatchAddMaintainsOrder(WorkQueue::IngressMode::lockFree);
+}
+
+TEST(gpcc_execution_async_WorkQueue_Tests, BatchAdd_Dynamic_nullptr)
+{
+  WorkQueue uut;
+
+  std::vector<std::unique_ptr<WorkPackage>> batch;
+  batch.emplace_back(WorkPackage::CreateDynamic(&uut, 0U, []() {}));
+  batch.emplace_back(nullptr);
+
+  ASSERT_THROW(uut.Add(batch), std::invalid_argument);
+
+  // batch must not be modified
+  ASSERT_EQ(batch.size(), 2U);
+  EXPECT_TRUE(batch[0] != nullptr);
+  EXPECT_FALSE(uut.IsAnyInQueue(&uut));
+}
+
+TEST(gpcc_execution_async_WorkQueue_Tests, BatchAdd_Static_BadArgs)
+{
+  WorkQueue uut;
+  WorkPackage wp(&uut, 0U, []() {});
+
+  WorkPackage* const batch[2] = { &wp, nullptr };
+  EXPECT_THROW(uut.Add(batch, 2U), std::invalid_argument);
+  EXPECT_THROW(uut.Add(nullptr, 1U), std::invalid_argument);
+
+  EXPECT_FALSE(uut.IsAnyInQueue(&uut));
+}
+
+TEST(gpcc_execution_async_WorkQueue_Tests, BatchAdd_Static_BadStateRollsBack)
+{
+  WorkQueue uut;
+  std::vector<int> results;
+
+  WorkPackage wp1(&uut, 1U, [&]() { results.push_back(1); });
+  WorkPackage wp2(&uut, 2U, [&]() { results.push_back(2); });
+
+  // wp2 is already enqueued
+  uut.Add(wp2);
+
+  WorkPackage* const batch1[2] = { &wp1, &wp2 };
+  EXPECT_THROW(uut.Add(batch1, 2U), std::logic_error);
+
+  // wp1 is contained twice
+  uut.Remove(wp2);
+  WorkPackage* const batch2[3] = { &wp1, &wp2, &wp1 };
+  EXPECT_THROW(uut.Add(batch2, 3U), std::logic_error);
+
+  EXPECT_FALSE(uut.IsAnyInQueue(&uut));
+
+  // the states of wp1 and wp2 must have been rolled back
+  uut.Add(batch1, 2U);
+  uut.Add(WorkPackage::CreateDynamic(&uut, 0U, [&]() { uut.RequestTermination(); }));
+  uut.Work();
+
+  ASSERT_EQ(results.size(), 2U);
+  EXPECT_EQ(results[0], 1);
+  EXPECT_EQ(results[1], 2);
+}
+
 } // namespace execution
 } // namespace async
 } // namespace gpcc_tests
@@ -0,0 +1,358 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#include <gpcc/execution/async/WorkQueuePool.hpp>
+#include <gpcc/execution/async/WorkPackage.hpp>
+#include <gpcc/osal/Mutex.hpp>
+#include <gpcc/osal/MutexLocker.hpp>
+#include <gpcc/osal/Thread.hpp>
+#include <gpcc/time/TimePoint.hpp>
+#include <gpcc/time/TimeSpan.hpp>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <functional>
+#include <vector>
+#include <cstdint>
+
+namespace gpcc_tests {
+namespace execution  {
+namespace async      {
+
+using gpcc::execution::async::WorkQueuePool;
+using gpcc::execution::async::WorkPackage;
+using gpcc::osal::Mutex;
+using gpcc::osal::MutexLocker;
+using gpcc::osal::Thread;
+using gpcc::time::TimePoint;
+using gpcc::time::TimeSpan;
+
+TEST(gpcc_execution_async_WorkQueuePool_Tests, CreateAndDestroy)
+{
+  std::unique_ptr<WorkQueuePool> spUUT;
+
+  ASSERT_NO_THROW(spUUT = std::make_unique<WorkQueuePool>("UUT", 4U));
+  EXPECT_EQ(spUUT->GetNbOfThreads(), 4U);
+  spUUT.reset();
+}
+
+TEST(gpcc_execution_async_WorkQueuePool_Tests, CreateWithZeroThreads)
+{
+  std::unique_ptr<WorkQueuePool> spUUT;
+
+  ASSERT_THROW(spUUT = std::make_unique<WorkQueuePool>("UUT", 0U), std::invalid_argument);
+}
+
+TEST(gpcc_execution_async_WorkQueuePool_Tests, CreateStartStopAndDestroy)
+{
+  std::unique_ptr<WorkQueuePool> spUUT;
+
+  ASSERT_NO_THROW(spUUT = std::make_unique<WorkQueuePool>("UUT", 4U));
+  ASSERT_NO_THROW(spUUT->Start(Thread::SchedPolicy::Other, 0U, Thread::GetDefaultStackSize()));
+  spUUT->Stop();
+  spUUT.reset();
+}
+
+TEST(gpcc_execution_async_WorkQueuePool_Tests, StartTwice)
+{
+  std::unique_ptr<WorkQueuePool> spUUT;
+
+  ASSERT_NO_THROW(spUUT = std::make_unique<WorkQueuePool>("UUT", 2U));
+  ASSERT_NO_THROW(spUUT->Start(Thread::SchedPolicy::Other, 0U, Thread::GetDefaultStackSize()));
+  ASSERT_THROW(spUUT->Start(Thread::SchedPolicy::Other, 0U, Thread::GetDefaultStackSize()), std::logic_error);
+  spUUT->Stop();
+  spUUT.reset();
+}
+
+TEST(gpcc_execution_async_WorkQueuePool_Tests, StartStopStart)
+{
+  std::unique_ptr<WorkQueuePool> spUUT;
+
+  ASSERT_NO_THROW(spUUT = std::make_unique<WorkQueuePool>("UUT", 2U));
+  ASSERT_NO_THROW(spUUT->Start(Thread::SchedPolicy::Other, 0U, Thread::GetDefaultStackSize()));
+  spUUT->Stop();
+  ASSERT_NO_THROW(spUUT->Start(Thread::SchedPolicy::Other, 0U, Thread::GetDefaultStackSize()));
+  spUUT->Stop();
+  spUUT.reset();
+}
+
+TEST(gpcc_execution_async_WorkQueuePool_DeathTests, StopTwice)
+{
+  std::unique_ptr<WorkQueuePool> spUUT;
+
+  ASSERT_NO_THROW(spUUT = std::make_unique<WorkQueuePool>("UUT", 2U));
+  ASSERT_NO_THROW(spUUT->Start(Thread::SchedPolicy::Other, 0U, Thread::GetDefaultStackSize()));
+  spUUT->Stop();
+  ASSERT_DEATH(spUUT->Stop(), ".*WorkQueuePool::Stop: Failed.*");
+  spUUT.reset();
+}
+
+#if !defined(SKIP_TFC_BASED_TESTS)
+TEST(gpcc_execution_async_WorkQueuePool_Tests, ExecuteWP)
+{
+  std::atomic<bool> called(false);
+  auto func = [&]() { called = true; };
+
+  auto spUUT = std::make_unique<WorkQueuePool>("UUT", 2U);
+  spUUT->Start(Thread::SchedPolicy::Other, 0U, Thread::GetDefaultStackSize());
+
+  spUUT->Add(WorkPackage::CreateDynamic(this, 0U, func));
+  Thread::Sleep_ms(10U);
+
+  EXPECT_TRUE(called);
+
+  spUUT->FlushNonDeferredWorkPackages();
+  spUUT->Stop();
+}
+#endif
+
+#if !defined(SKIP_TFC_BASED_TESTS)
+TEST(gpcc_execution_async_WorkQueuePool_Tests, DifferentOwnersExecutedConcurrently)
+{
+  int owner1;
+  int owner2;
+  int owner3;
+
+  auto func = []() { Thread::Sleep_ms(100U); };
+
+  auto spUUT = std::make_unique<WorkQueuePool>("UUT", 3U);
+  spUUT->Start(Thread::SchedPolicy::Other, 0U, Thread::GetDefaultStackSize());
+
+  TimePoint const start = TimePoint::FromSystemClock(gpcc::time::Clocks::monotonicPrecise);
+
+  spUUT->Add(WorkPackage::CreateDynamic(&owner1, 0U, func));
+  spUUT->Add(WorkPackage::CreateDynamic(&owner2, 0U, func));
+  spUUT->Add(WorkPackage::CreateDynamic(&owner3, 0U, func));
+  spUUT->FlushNonDeferredWorkPackages();
+
+  TimeSpan const duration = TimePoint::FromSystemClock(gpcc::time::Clocks::monotonicPrecise) - start;
+
+  EXPECT_GE(duration.ms(), 100);
+  EXPECT_LT(duration.ms(), 200);
+
+  spUUT->Stop();
+}
+#endif
+
+#if !defined(SKIP_TFC_BASED_TESTS)
+TEST(gpcc_execution_async_WorkQueuePool_Tests, SameOwnerSerializedInFIFOOrder)
+{
+  int owner1;
+  int owner2;
+
+  Mutex mutex;
+  std::vector<uint32_t> checkList1;
+  std::vector<uint32_t> checkList2;
+  std::atomic<uint32_t> concurrentOwner1(0U);
+  std::atomic<uint32_t> concurrentOwner2(0U);
+  std::atomic<bool> concurrencyViolation(false);
+
+  auto func = [&](std::vector<uint32_t> & checkList, std::atomic<uint32_t> & concurrent, uint32_t const value)
+  {
+    if (++concurrent != 1U)
+      concurrencyViolation = true;
+
+    {
+      MutexLocker mutexLocker(mutex);
+      checkList.push_back(value);
+    }
+
+    Thread::Sleep_ms(5U);
+    --concurrent;
+  };
+
+  auto spUUT = std::make_unique<WorkQueuePool>("UUT", 4U);
+  spUUT->Start(Thread::SchedPolicy::Other, 0U, Thread::GetDefaultStackSize());
+
+  for (uint32_t i = 0U; i < 16U; ++i)
+  {
+    spUUT->Add(WorkPackage::CreateDynamic(&owner1, 0U,
+                                          std::bind(func, std::ref(checkList1), std::ref(concurrentOwner1), i)));
+    spUUT->Add(WorkPackage::CreateDynamic(&owner2, 0U,
+                                          std::bind(func, std::ref(checkList2), std::ref(concurrentOwner2), i)));
+  }
+
+  spUUT->FlushNonDeferredWorkPackages();
+  spUUT->Stop();
+
+  EXPECT_FALSE(concurrencyViolation);
+
+  ASSERT_EQ(checkList1.size(), 16U);
+  ASSERT_EQ(checkList2.size(), 16U);
+  for (uint32_t i = 0U; i < 16U; ++i)
+  {
+    EXPECT_EQ(checkList1[i], i);
+    EXPECT_EQ(checkList2[i], i);
+  }
+}
+#endif
+
+#if !defined(SKIP_TFC_BASED_TESTS)
+TEST(gpcc_execution_async_WorkQueuePool_Tests, FlushWaitsForAllWorkPackages)
+{
+  int owner1;
+  int owner2;
+
+  std::atomic<uint32_t> nbOfCalls(0U);
+  auto func = [&](uint32_t const ms)
+  {
+    Thread::Sleep_ms(ms);
+    ++nbOfCalls;
+  };
+
+  auto spUUT = std::make_unique<WorkQueuePool>("UUT", 2U);
+  spUUT->Start(Thread::SchedPolicy::Other, 0U, Thread::GetDefaultStackSize());
+
+  spUUT->Add(WorkPackage::CreateDynamic(&owner1, 0U, std::bind(func, 50U)));
+  spUUT->Add(WorkPackage::CreateDynamic(&owner2, 0U, std::bind(func, 10U)));
+  spUUT->Add(WorkPackage::CreateDynamic(&owner2, 0U, std::bind(func, 10U)));
+
+  spUUT->FlushNonDeferredWorkPackages();
+  EXPECT_EQ(nbOfCalls, 3U);
+
+  spUUT->Stop();
+}
+#endif
+
+#if !defined(SKIP_TFC_BASED_TESTS)
+TEST(gpcc_execution_async_WorkQueuePool_Tests, RemoveAndWaitUntilCurrentWorkPackageHasBeenExecuted)
+{
+  int owner1;
+  int owner2;
+
+  std::atomic<uint32_t> nbOfCallsOwner1(0U);
+  std::atomic<uint32_t> nbOfCallsOwner2(0U);
+  auto func1 = [&]()
+  {
+    Thread::Sleep_ms(50U);
+    ++nbOfCallsOwner1;
+  };
+  auto func2 = [&]() { ++nbOfCallsOwner2; };
+
+  auto spUUT = std::make_unique<WorkQueuePool>("UUT", 2U);
+  spUUT->Start(Thread::SchedPolicy::Other, 0U, Thread::GetDefaultStackSize());
+
+  spUUT->Add(WorkPackage::CreateDynamic(&owner1, 0U, func1));
+  spUUT->Add(WorkPackage::CreateDynamic(&owner1, 0U, func1));
+  spUUT->Add(WorkPackage::CreateDynamic(&owner1, 1U, func1));
+
+  // wait until the first work package of owner1 is executed
+  Thread::Sleep_ms(10U);
+
+  EXPECT_TRUE(spUUT->IsAnyInQueue(&owner1));
+  spUUT->Remove(&owner1, 1U);
+  EXPECT_TRUE(spUUT->IsAnyInQueue(&owner1));
+  spUUT->Remove(&owner1);
+  EXPECT_FALSE(spUUT->IsAnyInQueue(&owner1));
+
+  // work packages of owner2 shall be executed by the second thread while owner1's work package is executed
+  spUUT->Add(WorkPackage::CreateDynamic(&owner2, 0U, func2));
+  Thread::Sleep_ms(10U);
+  EXPECT_EQ(nbOfCallsOwner2, 1U);
+  EXPECT_EQ(nbOfCallsOwner1, 0U);
+
+  spUUT->WaitUntilCurrentWorkPackageHasBeenExecuted(&owner1);
+  EXPECT_EQ(nbOfCallsOwner1, 1U);
+
+  spUUT->FlushNonDeferredWorkPackages();
+  EXPECT_EQ(nbOfCallsOwner1, 1U);
+
+  spUUT->Stop();
+}
+#endif
+
+#if !defined(SKIP_TFC_BASED_TESTS)
+TEST(gpcc_execution_async_WorkQueuePool_Tests, StaticWPEnqueuesItself)
+{
+  std::atomic<uint32_t> nbOfCalls(0U);
+  std::unique_ptr<WorkQueuePool> spUUT;
+  std::unique_ptr<WorkPackage> spWP;
+
+  auto func = [&]()
+  {
+    if (++nbOfCalls < 3U)
+      spUUT->Add(*spWP);
+  };
+
+  spWP = std::make_unique<WorkPackage>(this, 0U, func);
+  spUUT = std::make_unique<WorkQueuePool>("UUT", 4U);
+  spUUT->Start(Thread::SchedPolicy::Other, 0U, Thread::GetDefaultStackSize());
+
+  spUUT->Add(*spWP);
+  Thread::Sleep_ms(10U);
+  spUUT->FlushNonDeferredWorkPackages();
+
+  EXPECT_EQ(nbOfCalls, 3U);
+
+  spUUT->Stop();
+}
+#endif
+
+#if !defined(SKIP_TFC_BASED_TESTS)
+TEST(gpcc_execution_async_WorkQueuePool_Tests, WorkPackagesLeftUponDestruction)
+{
+  std::atomic<uint8_t> nbOfCalls(0U);
+  auto func = [&]()
+  {
+    ++nbOfCalls;
+    Thread::Sleep_ms(10U);
+  };
+
+  WorkPackage staticWP(this, 0U, func);
+
+  auto spUUT = std::make_unique<WorkQueuePool>("UUT", 2U);
+  spUUT->Start(Thread::SchedPolicy::Other, 0U, Thread::GetDefaultStackSize());
+
+  // Add first work package. Execution will take 10ms.
+  spUUT->Add(WorkPackage::CreateDynamic(this, 0U, func));
+
+  // Add two more work packages of the same owner. They are not intended to be executed because the UUT is destroyed
+  // before they execute.
+  spUUT->Add(staticWP);
+  spUUT->Add(WorkPackage::CreateDynamic(this, 0U, func));
+
+  // wait until the first dynamic work package is executing...
+  Thread::Sleep_ms(5U);
+  EXPECT_TRUE(nbOfCalls == 1U);
+
+  // ...and then destroy the UUT
+  spUUT->Stop();
+  spUUT.reset();
+  EXPECT_TRUE(nbOfCalls == 1U);
+}
+#endif
+
+#if !defined(SKIP_TFC_BASED_TESTS)
+TEST(gpcc_execution_async_WorkQueuePool_DeathTests, WorkpackageThrows)
+{
+  ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+
+  auto func = [&]() { throw std::runtime_error("Intentionally thrown exception."); };
+
+  auto spUUT = std::make_unique<WorkQueuePool>("UUT", 2U);
+  spUUT->Start(Thread::SchedPolicy::Other, 0U, Thread::GetDefaultStackSize());
+
+  auto lethalCode = [&]()
+  {
+    spUUT->Add(WorkPackage::CreateDynamic(this, 0U, func));
+    Thread::Sleep_ms(10U);
+  };
+
+  EXPECT_DEATH(lethalCode(), ".*WorkQueuePool::ThreadEntry: A work package threw.*");
+
+  spUUT->FlushNonDeferredWorkPackages();
+  spUUT->Stop();
+}
+#endif
+
+} // namespace execution
+} // namespace async
+} // namespace gpcc_tests
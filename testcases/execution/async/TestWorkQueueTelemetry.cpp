@@ -0,0 +1,445 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#include <gpcc/execution/async/WorkQueueTelemetry.hpp>
+#include <gpcc/execution/async/DeferredWorkPackage.hpp>
+#include <gpcc/execution/async/DeferredWorkQueue.hpp>
+#include <gpcc/execution/async/WorkPackage.hpp>
+#include <gpcc/execution/async/WorkQueue.hpp>
+#include <gpcc/osal/ConditionVariable.hpp>
+#include <gpcc/osal/Thread.hpp>
+#include <gpcc/time/TimePoint.hpp>
+#include <gpcc/time/TimeSpan.hpp>
+#include "TestIWorkQueue.hpp"
+#include <gtest/gtest.h>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <cstdint>
+
+namespace gpcc_tests {
+namespace execution {
+namespace async {
+
+using gpcc::execution::async::DeferredWorkPackage;
+using gpcc::execution::async::DeferredWorkQueue;
+using gpcc::execution::async::IWorkQueue;
+using gpcc::execution::async::WorkPackage;
+using gpcc::execution::async::WorkQueue;
+using gpcc::execution::async::WorkQueueTelemetry;
+using gpcc::osal::Thread;
+using gpcc::time::TimePoint;
+using gpcc::time::TimeSpan;
+
+using Histogram = WorkQueueTelemetry::Histogram;
+
+/// Wrapper for a @ref WorkQueue using @ref WorkQueue::IngressMode::lockFree with a @ref WorkQueueTelemetry instance
+/// attached.
+/** This allows to run the typed IWorkQueue test suites against a @ref WorkQueue with telemetry enabled. */
+class WorkQueueWithTelemetry final: public IWorkQueue
+{
+  public:
+    WorkQueueWithTelemetry(void) : telemetry(8U), wq(WorkQueue::IngressMode::lockFree) { wq.SetTelemetry(&telemetry); }
+    virtual ~WorkQueueWithTelemetry(void) { wq.SetTelemetry(nullptr); }
+
+    void Add(std::unique_ptr<WorkPackage> spWP) override { wq.Add(std::move(spWP)); }
+    void Add(WorkPackage & wp) override { wq.Add(wp); }
+    void InsertAtHeadOfList(std::unique_ptr<WorkPackage> spWP) override { wq.InsertAtHeadOfList(std::move(spWP)); }
+    void InsertAtHeadOfList(WorkPackage & wp) override { wq.InsertAtHeadOfList(wp); }
+    void Remove(WorkPackage & wp) override { wq.Remove(wp); }
+    void Remove(void const * const pOwnerObject) override { wq.Remove(pOwnerObject); }
+    void Remove(void const * const pOwnerObject, uint32_t const ownerID) override { wq.Remove(pOwnerObject, ownerID); }
+    void WaitUntilCurrentWorkPackageHasBeenExecuted(void const * const pOwnerObject) const override
+    {
+      wq.WaitUntilCurrentWorkPackageHasBeenExecuted(pOwnerObject);
+    }
+    bool IsAnyInQueue(void const * const pOwnerObject) const override { return wq.IsAnyInQueue(pOwnerObject); }
+    void FlushNonDeferredWorkPackages(void) override { wq.FlushNonDeferredWorkPackages(); }
+
+    void Work(void) { wq.Work(); }
+    void RequestTermination(void) noexcept { wq.RequestTermination(); }
+
+  private:
+    WorkQueueTelemetry telemetry;
+    WorkQueue wq;
+};
+
+INSTANTIATE_TYPED_TEST_SUITE_P(gpcc_execution_async_WorkQueueWithTelemetry_, IWorkQueue_Tests1F,
+                               WorkQueueWithTelemetry);
+INSTANTIATE_TYPED_TEST_SUITE_P(gpcc_execution_async_WorkQueueWithTelemetry_, IWorkQueue_Tests2F,
+                               WorkQueueWithTelemetry);
+
+// Looks up the record of an owner in a snapshot. Returns nullptr if there is no record.
+static WorkQueueTelemetry::OwnerRecord const * FindOwner(WorkQueueTelemetry::Snapshot const & s,
+                                                         void const * const pOwnerObject,
+                                                         uint32_t const ownerID)
+{
+  for (auto const & r : s.owners)
+  {
+    if ((!r.others) && (r.pOwnerObject == pOwnerObject) && (r.ownerID == ownerID))
+      return &r;
+  }
+
+  return nullptr;
+}
+
+TEST(gpcc_execution_async_WorkQueueTelemetry_Tests, Histogram_ValueToBucket)
+{
+  EXPECT_EQ(Histogram::ValueToBucket(0U), 0U);
+  EXPECT_EQ(Histogram::ValueToBucket(999U), 0U);
+  EXPECT_EQ(Histogram::ValueToBucket(1000U), 1U);
+  EXPECT_EQ(Histogram::ValueToBucket(1999U), 1U);
+  EXPECT_EQ(Histogram::ValueToBucket(2000U), 2U);
+  EXPECT_EQ(Histogram::ValueToBucket(3999U), 2U);
+  EXPECT_EQ(Histogram::ValueToBucket(4000U), 3U);
+  EXPECT_EQ(Histogram::ValueToBucket((1ULL << 21U) * 1000U), 22U);
+  EXPECT_EQ(Histogram::ValueToBucket((1ULL << 22U) * 1000U), WorkQueueTelemetry::nbOfBuckets - 1U);
+  EXPECT_EQ(Histogram::ValueToBucket(std::numeric_limits<uint64_t>::max()), WorkQueueTelemetry::nbOfBuckets - 1U);
+}
+
+TEST(gpcc_execution_async_WorkQueueTelemetry_Tests, Histogram_BucketUpperLimit)
+{
+  EXPECT_EQ(Histogram::GetBucketUpperLimit_ns(0U), 1000U);
+  EXPECT_EQ(Histogram::GetBucketUpperLimit_ns(1U), 2000U);
+  EXPECT_EQ(Histogram::GetBucketUpperLimit_ns(2U), 4000U);
+  EXPECT_EQ(Histogram::GetBucketUpperLimit_ns(22U), (1ULL << 22U) * 1000U);
+  EXPECT_EQ(Histogram::GetBucketUpperLimit_ns(WorkQueueTelemetry::nbOfBuckets - 1U),
+            std::numeric_limits<uint64_t>::max());
+
+  // consistency with ValueToBucket()
+  for (size_t i = 0U; i < WorkQueueTelemetry::nbOfBuckets - 1U; i++)
+  {
+    EXPECT_EQ(Histogram::ValueToBucket(Histogram::GetBucketUpperLimit_ns(i) - 1U), i);
+    EXPECT_EQ(Histogram::ValueToBucket(Histogram::GetBucketUpperLimit_ns(i)), i + 1U);
+  }
+}
+
+TEST(gpcc_execution_async_WorkQueueTelemetry_Tests, Histogram_RecordAndReset)
+{
+  Histogram uut;
+
+  auto s = uut.GetSnapshot();
+  EXPECT_EQ(s.count, 0U);
+  EXPECT_EQ(s.sum_ns, 0U);
+  EXPECT_EQ(s.max_ns, 0U);
+  EXPECT_EQ(s.GetAverage_ns(), 0U);
+  EXPECT_EQ(s.GetPercentile_ns(50U), 0U);
+  for (auto const n : s.buckets)
+    EXPECT_EQ(n, 0U);
+
+  uut.Record(500U);
+  uut.Record(1500U);
+  uut.Record(1700U);
+  uut.Record(100000U);
+
+  s = uut.GetSnapshot();
+  EXPECT_EQ(s.count, 4U);
+  EXPECT_EQ(s.sum_ns, 103700U);
+  EXPECT_EQ(s.max_ns, 100000U);
+  EXPECT_EQ(s.GetAverage_ns(), 103700U / 4U);
+  EXPECT_EQ(s.buckets[0], 1U);
+  EXPECT_EQ(s.buckets[1], 2U);
+  EXPECT_EQ(s.buckets[Histogram::ValueToBucket(100000U)], 1U);
+
+  EXPECT_EQ(s.GetPercentile_ns(25U), 1000U);
+  EXPECT_EQ(s.GetPercentile_ns(50U), 2000U);
+  EXPECT_EQ(s.GetPercentile_ns(75U), 2000U);
+  EXPECT_EQ(s.GetPercentile_ns(99U), 100000U);
+  EXPECT_EQ(s.GetPercentile_ns(100U), 100000U);
+  EXPECT_EQ(s.GetPercentile_ns(255U), 100000U);
+
+  uut.Reset();
+
+  s = uut.GetSnapshot();
+  EXPECT_EQ(s.count, 0U);
+  EXPECT_EQ(s.sum_ns, 0U);
+  EXPECT_EQ(s.max_ns, 0U);
+  for (auto const n : s.buckets)
+    EXPECT_EQ(n, 0U);
+}
+
+TEST(gpcc_execution_async_WorkQueueTelemetry_Tests, CreateWithZeroOwners)
+{
+  std::unique_ptr<WorkQueueTelemetry> spUUT;
+
+  ASSERT_THROW(spUUT = std::make_unique<WorkQueueTelemetry>(0U), std::invalid_argument);
+}
+
+TEST(gpcc_execution_async_WorkQueueTelemetry_Tests, Empty)
+{
+  WorkQueueTelemetry uut(4U);
+
+  auto const s = uut.GetSnapshot();
+  EXPECT_EQ(s.maxQueueDepth, 0U);
+  EXPECT_TRUE(s.owners.empty());
+}
+
+TEST(gpcc_execution_async_WorkQueueTelemetry_Tests, RecordExecution)
+{
+  WorkQueueTelemetry uut(4U);
+  int owner;
+
+  uut.RecordExecution(&owner, 1U, 1000U, 5000U, 8000U);
+  uut.RecordExecution(&owner, 1U, 0U, 10000U, 11000U);
+  uut.RecordExecution(&owner, 2U, 2000U, 2500U, 2600U);
+
+  auto const s = uut.GetSnapshot();
+  ASSERT_EQ(s.owners.size(), 2U);
+
+  auto const pR1 = FindOwner(s, &owner, 1U);
+  ASSERT_TRUE(pR1 != nullptr);
+  EXPECT_EQ(pR1->latency.count, 1U);
+  EXPECT_EQ(pR1->latency.max_ns, 4000U);
+  EXPECT_EQ(pR1->execution.count, 2U);
+  EXPECT_EQ(pR1->execution.sum_ns, 4000U);
+  EXPECT_EQ(pR1->execution.max_ns, 3000U);
+  EXPECT_EQ(pR1->lateStart.count, 0U);
+
+  auto const pR2 = FindOwner(s, &owner, 2U);
+  ASSERT_TRUE(pR2 != nullptr);
+  EXPECT_EQ(pR2->latency.count, 1U);
+  EXPECT_EQ(pR2->latency.max_ns, 500U);
+  EXPECT_EQ(pR2->execution.count, 1U);
+  EXPECT_EQ(pR2->execution.max_ns, 100U);
+}
+
+TEST(gpcc_execution_async_WorkQueueTelemetry_Tests, RecordDeferredExecution)
+{
+  WorkQueueTelemetry uut(4U);
+
+  uut.RecordDeferredExecution(nullptr, 7U, 3000, 1000U, 1500U);
+  uut.RecordDeferredExecution(nullptr, 7U, -20, 2000U, 2100U);
+
+  auto const s = uut.GetSnapshot();
+  ASSERT_EQ(s.owners.size(), 1U);
+
+  auto const pR = FindOwner(s, nullptr, 7U);
+  ASSERT_TRUE(pR != nullptr);
+  EXPECT_EQ(pR->latency.count, 0U);
+  EXPECT_EQ(pR->lateStart.count, 2U);
+  EXPECT_EQ(pR->lateStart.sum_ns, 3000U);
+  EXPECT_EQ(pR->lateStart.buckets[0], 1U);
+  EXPECT_EQ(pR->execution.count, 2U);
+  EXPECT_EQ(pR->execution.sum_ns, 600U);
+}
+
+TEST(gpcc_execution_async_WorkQueueTelemetry_Tests, TableOfOwnersFull)
+{
+  WorkQueueTelemetry uut(2U);
+  int owner;
+
+  uut.RecordExecution(&owner, 0U, 1U, 1U, 1U);
+  uut.RecordExecution(&owner, 1U, 1U, 1U, 1U);
+  uut.RecordExecution(&owner, 2U, 1U, 1U, 1U);
+  uut.RecordExecution(&owner, 3U, 1U, 1U, 1U);
+  uut.RecordExecution(&owner, 0U, 1U, 1U, 1U);
+
+  auto const s = uut.GetSnapshot();
+  ASSERT_EQ(s.owners.size(), 3U);
+
+  auto const pR0 = FindOwner(s, &owner, 0U);
+  ASSERT_TRUE(pR0 != nullptr);
+  EXPECT_EQ(pR0->execution.count, 2U);
+
+  auto const pR1 = FindOwner(s, &owner, 1U);
+  ASSERT_TRUE(pR1 != nullptr);
+  EXPECT_EQ(pR1->execution.count, 1U);
+
+  EXPECT_TRUE(s.owners.back().others);
+  EXPECT_EQ(s.owners.back().execution.count, 2U);
+}
+
+TEST(gpcc_execution_async_WorkQueueTelemetry_Tests, QueueDepthAndReset)
+{
+  WorkQueueTelemetry uut(2U);
+  int owner;
+
+  uut.RecordQueueDepth(3U);
+  uut.RecordQueueDepth(7U);
+  uut.RecordQueueDepth(5U);
+  uut.RecordExecution(&owner, 0U, 1U, 2U, 3U);
+
+  auto s = uut.GetSnapshot();
+  EXPECT_EQ(s.maxQueueDepth, 7U);
+  EXPECT_EQ(s.owners.size(), 1U);
+
+  uut.Reset();
+
+  s = uut.GetSnapshot();
+  EXPECT_EQ(s.maxQueueDepth, 0U);
+  EXPECT_TRUE(s.owners.empty());
+
+  // the owner keeps its entry
+  uut.RecordExecution(&owner, 0U, 1U, 2U, 3U);
+  s = uut.GetSnapshot();
+  ASSERT_EQ(s.owners.size(), 1U);
+  EXPECT_FALSE(s.owners[0].others);
+}
+
+TEST(gpcc_execution_async_WorkQueueTelemetry_Tests, GetTimestamp)
+{
+  uint64_t const t1 = WorkQueueTelemetry::GetTimestamp_ns();
+  uint64_t const t2 = WorkQueueTelemetry::GetTimestamp_ns();
+
+  EXPECT_NE(t1, 0U);
+  EXPECT_GE(t2, t1);
+}
+
+TEST(gpcc_execution_async_WorkQueueTelemetry_Tests, WorkQueue)
+{
+  WorkQueueTelemetry uut(8U);
+  WorkQueue wq;
+  int owner1;
+  int owner2;
+
+  wq.SetTelemetry(&uut);
+
+  WorkPackage wp(&owner1, 1U, []() {});
+
+  wq.Add(WorkPackage::CreateDynamic(&owner1, 0U, []() {}));
+  wq.Add(wp);
+  wq.InsertAtHeadOfList(WorkPackage::CreateDynamic(&owner1, 1U, []() {}));
+  wq.Add(WorkPackage::CreateDynamic(&owner2, 0U, [&wq]() { wq.RequestTermination(); }));
+  wq.Work();
+
+  auto s = uut.GetSnapshot();
+  EXPECT_EQ(s.maxQueueDepth, 4U);
+  ASSERT_EQ(s.owners.size(), 3U);
+
+  auto pR = FindOwner(s, &owner1, 0U);
+  ASSERT_TRUE(pR != nullptr);
+  EXPECT_EQ(pR->latency.count, 1U);
+  EXPECT_EQ(pR->execution.count, 1U);
+
+  pR = FindOwner(s, &owner1, 1U);
+  ASSERT_TRUE(pR != nullptr);
+  EXPECT_EQ(pR->latency.count, 2U);
+  EXPECT_EQ(pR->execution.count, 2U);
+
+  pR = FindOwner(s, &owner2, 0U);
+  ASSERT_TRUE(pR != nullptr);
+  EXPECT_EQ(pR->execution.count, 1U);
+
+  // detached telemetry object must not be updated any more
+  wq.SetTelemetry(nullptr);
+  wq.Add(WorkPackage::CreateDynamic(&owner2, 0U, [&wq]() { wq.RequestTermination(); }));
+  wq.Work();
+
+  s = uut.GetSnapshot();
+  pR = FindOwner(s, &owner2, 0U);
+  ASSERT_TRUE(pR != nullptr);
+  EXPECT_EQ(pR->execution.count, 1U);
+}
+
+TEST(gpcc_execution_async_WorkQueueTelemetry_Tests, WorkQueue_DepthConsidersRemoval)
+{
+  for (auto const mode : {WorkQueue::IngressMode::locked, WorkQueue::IngressMode::lockFree})
+  {
+    WorkQueueTelemetry uut(8U);
+    WorkQueue wq(mode);
+    int owner1;
+    int owner2;
+
+    wq.SetTelemetry(&uut);
+
+    wq.Add(WorkPackage::CreateDynamic(&owner1, 0U, []() {}));
+    wq.Add(WorkPackage::CreateDynamic(&owner2, 0U, []() {}));
+    wq.Add(WorkPackage::CreateDynamic(&owner2, 0U, []() {}));
+    wq.Remove(&owner2);
+
+    wq.Add(WorkPackage::CreateDynamic(&owner1, 0U, []() {}));
+    EXPECT_TRUE(wq.IsAnyInQueue(&owner1));
+
+    wq.Add(WorkPackage::CreateDynamic(&owner2, 0U, [&wq]() { wq.RequestTermination(); }));
+    wq.Work();
+
+    // Max. depth would be 5 if removal would not be considered. In lock-free mode, the depth is updated when work
+    // packages are moved from the ingress list into the queue, which happens in Remove() and Work().
+    EXPECT_EQ(uut.GetSnapshot().maxQueueDepth, 3U);
+
+    wq.SetTelemetry(nullptr);
+  }
+}
+
+TEST(gpcc_execution_async_WorkQueueTelemetry_Tests, DeferredWorkQueue)
+{
+  WorkQueueTelemetry uut(8U);
+  DeferredWorkQueue dwq(2U, 0U, 0U);
+  int owner1;
+  int owner2;
+
+  dwq.SetTelemetry(&uut);
+
+  TimePoint const past = TimePoint::FromSystemClock(gpcc::osal::ConditionVariable::clockID) - TimeSpan::ms(1);
+
+  dwq.Add(WorkPackage::CreateDynamic(&owner1, 0U, []() {}));
+  dwq.Add(WorkPackage::CreateDynamic(&owner1, 1U, []() {}), 1U);
+  dwq.Add(WorkPackage::CreateDynamic(&owner1, 1U, []() {}), 1U);
+  dwq.Remove(&owner1, 1U);
+  dwq.Add(DeferredWorkPackage::CreateDynamic(&owner1, 2U, []() {}, past));
+  dwq.Add(WorkPackage::CreateDynamic(&owner2, 0U, [&dwq]() { dwq.RequestTermination(); }), 1U);
+  dwq.Work();
+
+  auto const s = uut.GetSnapshot();
+  EXPECT_EQ(s.maxQueueDepth, 3U);
+  ASSERT_EQ(s.owners.size(), 3U);
+
+  auto pR = FindOwner(s, &owner1, 0U);
+  ASSERT_TRUE(pR != nullptr);
+  EXPECT_EQ(pR->latency.count, 1U);
+  EXPECT_EQ(pR->execution.count, 1U);
+  EXPECT_EQ(pR->lateStart.count, 0U);
+
+  pR = FindOwner(s, &owner1, 2U);
+  ASSERT_TRUE(pR != nullptr);
+  EXPECT_EQ(pR->latency.count, 0U);
+  EXPECT_EQ(pR->execution.count, 1U);
+  EXPECT_EQ(pR->lateStart.count, 1U);
+  EXPECT_GE(pR->lateStart.max_ns, 1000000U);
+
+  pR = FindOwner(s, &owner2, 0U);
+  ASSERT_TRUE(pR != nullptr);
+  EXPECT_EQ(pR->latency.count, 1U);
+  EXPECT_EQ(pR->execution.count, 1U);
+
+  dwq.SetTelemetry(nullptr);
+}
+
+#if !defined(SKIP_TFC_BASED_TESTS)
+TEST(gpcc_execution_async_WorkQueueTelemetry_Tests, WorkQueue_Times)
+{
+  WorkQueueTelemetry uut(8U);
+  WorkQueue wq;
+  int owner;
+
+  wq.SetTelemetry(&uut);
+
+  wq.Add(WorkPackage::CreateDynamic(&owner, 0U, []() { Thread::Sleep_ms(10U); }));
+  wq.Add(WorkPackage::CreateDynamic(&owner, 1U, [&wq]() { wq.RequestTermination(); }));
+  wq.Work();
+
+  auto const s = uut.GetSnapshot();
+
+  auto pR = FindOwner(s, &owner, 0U);
+  ASSERT_TRUE(pR != nullptr);
+  EXPECT_GE(pR->execution.max_ns, 10000000U);
+  EXPECT_LT(pR->latency.max_ns, 10000000U);
+
+  pR = FindOwner(s, &owner, 1U);
+  ASSERT_TRUE(pR != nullptr);
+  EXPECT_GE(pR->latency.max_ns, 10000000U);
+
+  wq.SetTelemetry(nullptr);
+}
+#endif
+
+} // namespace async
+} // namespace execution
+} // namespace gpcc_tests
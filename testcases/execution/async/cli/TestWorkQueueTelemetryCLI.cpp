@@ -0,0 +1,227 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#include <gpcc/execution/async/cli/WorkQueueTelemetryCLI.hpp>
+#include <gpcc/cli/CLI.hpp>
+#include <gpcc/cli/Command.hpp>
+#include <gpcc/execution/async/WorkQueueTelemetry.hpp>
+#include <gpcc/osal/Thread.hpp>
+#include <gpcc_test/cli/FakeTerminal.hpp>
+#include <gtest/gtest.h>
+#include <functional>
+#include <iostream>
+#include <cstdint>
+
+namespace gpcc_tests {
+namespace execution  {
+namespace async      {
+
+using gpcc::execution::async::WorkQueueTelemetry;
+
+class gpcc_execution_async_WorkQueueTelemetryCLI_TestsF: public testing::Test
+{
+  public:
+    gpcc_execution_async_WorkQueueTelemetryCLI_TestsF(void);
+
+  protected:
+    WorkQueueTelemetry telemetry;
+    cli::FakeTerminal terminal;
+    gpcc::cli::CLI cli;
+    bool cliNeedsStop;
+
+    void SetUp(void) override;
+    void TearDown(void) override;
+
+    void Login(void);
+};
+
+gpcc_execution_async_WorkQueueTelemetryCLI_TestsF::gpcc_execution_async_WorkQueueTelemetryCLI_TestsF(void)
+: Test()
+, telemetry(1U)
+, terminal(80U, 8U)
+, cli(terminal, 80U, 8U, "CLI", nullptr)
+, cliNeedsStop(false)
+{
+}
+
+void gpcc_execution_async_WorkQueueTelemetryCLI_TestsF::SetUp(void)
+{
+  cli.Start(gpcc::osal::Thread::SchedPolicy::Other, 0, gpcc::osal::Thread::GetDefaultStackSize());
+  cliNeedsStop = true;
+
+  terminal.WaitForInputProcessed();
+
+  cli.AddCommand(gpcc::cli::Command::Create("wqtel", " [reset]\nHelp text",
+                                            std::bind(&gpcc::execution::async::CliCmdPrintWorkQueueTelemetry,
+                                                      std::placeholders::_1,
+                                                      std::placeholders::_2,
+                                                      &telemetry)));
+}
+
+void gpcc_execution_async_WorkQueueTelemetryCLI_TestsF::TearDown(void)
+{
+  if (cliNeedsStop)
+    cli.Stop();
+
+  if (HasFailure())
+  {
+    std::cout << "*****************************************************" << std::endl
+              << "Content of fake terminal's screen" << std::endl
+              << "*****************************************************" << std::endl;
+    std::cout << terminal.GetScreenContent() << std::endl;
+  }
+}
+
+void gpcc_execution_async_WorkQueueTelemetryCLI_TestsF::Login(void)
+{
+  terminal.Input("login");
+
+  for (int i = 0; i < 8; i++)
+  {
+    terminal.Input_ENTER();
+    terminal.WaitForInputProcessed();
+  }
+}
+
+TEST_F(gpcc_execution_async_WorkQueueTelemetryCLI_TestsF, NoRecords)
+{
+  char const * expected[8] =
+  {
+   ">",
+   ">",
+   ">",
+   ">",
+   ">wqtel",
+   "Max. queue depth: 0",
+   "No work packages recorded.",
+   ">"
+  };
+
+  Login();
+
+  terminal.Input("wqtel");
+  terminal.Input_ENTER();
+  terminal.WaitForInputProcessed();
+
+  ASSERT_TRUE(terminal.Compare(expected));
+}
+
+TEST_F(gpcc_execution_async_WorkQueueTelemetryCLI_TestsF, OneOwner)
+{
+  char const * expected[8] =
+  {
+   ">wqtel",
+   "Max. queue depth: 3",
+   "Owner 0x1000 ID 5:",
+   "  Metric          Count  Avg[us]  P50[us]  P99[us]  Max[us]",
+   "  Latency             2        2        2        4        4",
+   "  Execution           2        2        2        2        2",
+   "  Late start          0        -        -        -        -",
+   ">"
+  };
+
+  void const * const pOwner = reinterpret_cast<void const *>(static_cast<uintptr_t>(0x1000U));
+  telemetry.RecordQueueDepth(3U);
+  telemetry.RecordExecution(pOwner, 5U, 1000U, 5000U, 7000U);
+  telemetry.RecordExecution(pOwner, 5U, 8000U, 9500U, 12000U);
+
+  Login();
+
+  terminal.Input("wqtel");
+  terminal.Input_ENTER();
+  terminal.WaitForInputProcessed();
+
+  ASSERT_TRUE(terminal.Compare(expected));
+}
+
+TEST_F(gpcc_execution_async_WorkQueueTelemetryCLI_TestsF, AnonymousAndOtherOwners)
+{
+  // (the first lines have scrolled out of the screen)
+  char const * expected[8] =
+  {
+   "  Execution           1        1        1        1        1",
+   "  Late start          0        -        -        -        -",
+   "Other owners:",
+   "  Metric          Count  Avg[us]  P50[us]  P99[us]  Max[us]",
+   "  Latency             0        -        -        -        -",
+   "  Execution           1       20       20       20       20",
+   "  Late start          1       10       10       10       10",
+   ">"
+  };
+
+  // the table of owners has one entry only, so the second owner's data goes to "other owners"
+  telemetry.RecordExecution(nullptr, 1U, 1000U, 2000U, 3000U);
+  telemetry.RecordDeferredExecution(nullptr, 2U, 10000, 2000U, 22000U);
+
+  Login();
+
+  terminal.Input("wqtel");
+  terminal.Input_ENTER();
+  terminal.WaitForInputProcessed();
+
+  ASSERT_TRUE(terminal.Compare(expected));
+}
+
+TEST_F(gpcc_execution_async_WorkQueueTelemetryCLI_TestsF, Reset)
+{
+  char const * expected[8] =
+  {
+   ">",
+   ">",
+   ">wqtel reset",
+   "Telemetry data cleared.",
+   ">wqtel",
+   "Max. queue depth: 0",
+   "No work packages recorded.",
+   ">"
+  };
+
+  telemetry.RecordQueueDepth(3U);
+  telemetry.RecordExecution(nullptr, 5U, 1000U, 5000U, 7000U);
+
+  Login();
+
+  terminal.Input("wqtel reset");
+  terminal.Input_ENTER();
+  terminal.WaitForInputProcessed();
+
+  terminal.Input("wqtel");
+  terminal.Input_ENTER();
+  terminal.WaitForInputProcessed();
+
+  ASSERT_TRUE(terminal.Compare(expected));
+}
+
+TEST_F(gpcc_execution_async_WorkQueueTelemetryCLI_TestsF, InvalidArgs)
+{
+  char const * expected[8] =
+  {
+   ">",
+   ">",
+   ">wqtel bla",
+   "",
+   "Invalid arguments. Try 'wqtel help'.",
+   "Details:",
+   "0: User entered invalid arguments.",
+   ">"
+  };
+
+  Login();
+
+  terminal.Input("wqtel bla");
+  terminal.Input_ENTER();
+  terminal.WaitForInputProcessed();
+
+  ASSERT_TRUE(terminal.Compare(expected));
+}
+
+} // namespace async
+} // namespace execution
+} // namespace gpcc_tests
@@ -582,24 +582,39 @@ TEST_F(gpcc_file_systems_linux_fs_FileStorage_TestsF, StdIOFileReader_IsRemainin
 
   std::unique_ptr<gpcc::stream::IStreamReader> spISR;
   spISR = spUUT->Open("Test.dat");
-  ASSERT_FALSE(spISR->IsRemainingBytesSupported());
+  ASSERT_TRUE(spISR->IsRemainingBytesSupported());
 }
 TEST_F(gpcc_file_systems_linux_fs_FileStorage_TestsF, StdIOFileReader_RemainingBytes)
 {
   std::unique_ptr<gpcc::stream::IStreamWriter> spISW;
   spISW = spUUT->Create("Test.dat", false);
   spISW->Write_uint8(0x12U);
+  spISW->Write_uint32(0xDEADBEEFUL);
   spISW.reset();
 
   std::unique_ptr<gpcc::stream::IStreamReader> spISR;
   spISR = spUUT->Open("Test.dat");
 
   ASSERT_EQ(gpcc::stream::IStreamReader::States::open, spISR->GetState());
-  EXPECT_THROW((void)spISR->RemainingBytes(), std::logic_error);
+  EXPECT_EQ(5U, spISR->RemainingBytes());
 
-  spISR->Skip(8U);
+  (void)spISR->Read_uint8();
+  EXPECT_EQ(4U, spISR->RemainingBytes());
+
+  // a partially read byte does not count
+  (void)spISR->Read_bits(4U);
+  EXPECT_EQ(3U, spISR->RemainingBytes());
+
+  spISR->Skip(4U + 16U);
+  EXPECT_EQ(1U, spISR->RemainingBytes());
+
+  (void)spISR->Read_bits(1U);
+  ASSERT_EQ(gpcc::stream::IStreamReader::States::open, spISR->GetState());
+  EXPECT_EQ(0U, spISR->RemainingBytes());
+
+  spISR->Skip(7U);
   ASSERT_EQ(gpcc::stream::IStreamReader::States::empty, spISR->GetState());
-  EXPECT_THROW((void)spISR->RemainingBytes(), std::logic_error);
+  EXPECT_EQ(0U, spISR->RemainingBytes());
 
   ASSERT_THROW(spISR->Skip(8U), gpcc::stream::EmptyError);
   ASSERT_EQ(gpcc::stream::IStreamReader::States::error, spISR->GetState());
@@ -12,6 +12,7 @@
 #include <gpcc/log/logfacilities/ThreadedLogFacility.hpp>
 #include <gpcc/log/log_levels.hpp>
 #include <gpcc/osal/Panic.hpp>
+#include <gpcc/osal/Thread.hpp>
 #include <gpcc/raii/scope_guard.hpp>
 #include "logfacilities/FakeBackend.hpp"
 #include <gtest/gtest.h>
@@ -20,6 +21,9 @@
 #include <memory>
 #include <sstream>
 #include <stdexcept>
+#include <string>
+#include <vector>
+#include <cstdio>
 
 using namespace gpcc::log;
 using namespace testing;
@@ -247,6 +251,15 @@ TEST(gpcc_log_Logger_Tests, RaiseLogLevel)
   ASSERT_EQ(LogLevel::Nothing, uut.GetLogLevel());
 }
 
+TEST(gpcc_log_Logger_Tests, SetRateLimit_BadArgs)
+{
+  Logger uut("uut");
+
+  EXPECT_THROW(uut.SetRateLimit(10U, 0U), std::invalid_argument);
+  EXPECT_NO_THROW(uut.SetRateLimit(0U, 0U));
+  EXPECT_NO_THROW(uut.SetRateLimit(0xFFFFFFFFUL, 1U));
+}
+
 TEST(gpcc_log_Logger_Tests, LogButNoLogFacility)
 {
   Logger uut("uut");
@@ -413,6 +426,40 @@ TEST_F(gpcc_log_Logger_TestsF, Log_VariableArgs)
   ASSERT_STREQ(backend.records[2].c_str(), "[INFO ] uut: Log 48 21 %");
 }
 
+TEST_F(gpcc_log_Logger_TestsF, Log_DeferredFormat)
+{
+  uint32_t u32a = 48U;
+  uint32_t u32b = 21U;
+
+  uut.LogD(LogType::Debug, "This should be dropped.");
+
+  uut.LogD(LogType::Info, "Log");
+  uut.LogD(LogType::Info, "Log %u", static_cast<unsigned int>(u32a));
+  uut.LogD(LogType::Info, "Log %u %u %%", static_cast<unsigned int>(u32a), static_cast<unsigned int>(u32b));
+  uut.LogD(LogType::Info, "Log %s %.1f %c", "ROM", 2.5, 'c');
+  logFacility.Flush();
+
+  ASSERT_EQ(4U, backend.records.size());
+  ASSERT_STREQ(backend.records[0].c_str(), "[INFO ] uut: Log");
+  ASSERT_STREQ(backend.records[1].c_str(), "[INFO ] uut: Log 48");
+  ASSERT_STREQ(backend.records[2].c_str(), "[INFO ] uut: Log 48 21 %");
+  ASSERT_STREQ(backend.records[3].c_str(), "[INFO ] uut: Log ROM 2.5 c");
+}
+
+TEST_F(gpcc_log_Logger_TestsF, Log_DeferredFormat_ValuesCapturedAtCallTime)
+{
+  unsigned int value = 1U;
+
+  uut.LogD(LogType::Info, "Value %u", value);
+  value = 2U;
+  uut.LogD(LogType::Info, "Value %u", value);
+  logFacility.Flush();
+
+  ASSERT_EQ(2U, backend.records.size());
+  ASSERT_STREQ(backend.records[0].c_str(), "[INFO ] uut: Value 1");
+  ASSERT_STREQ(backend.records[1].c_str(), "[INFO ] uut: Value 2");
+}
+
 TEST_F(gpcc_log_Logger_TestsF, LogTS_cstring)
 {
   uut.LogTS(LogType::Debug, "This should be dropped.");
@@ -579,6 +626,27 @@ TEST_F(gpcc_log_Logger_TestsF, LogTS_VariableArgs)
   ASSERT_TRUE(backend.records[2] == "[INFO ] uut: Log 48 21 %");
 }
 
+TEST_F(gpcc_log_Logger_TestsF, LogTS_DeferredFormat)
+{
+  uint32_t u32a = 48U;
+  uint32_t u32b = 21U;
+
+  uut.LogDTS(LogType::Debug, "This should be dropped.");
+
+  uut.LogDTS(LogType::Info, "Log");
+  uut.LogDTS(LogType::Info, "Log %u", static_cast<unsigned int>(u32a));
+  uut.LogDTS(LogType::Info, "Log %u %u %%", static_cast<unsigned int>(u32a), static_cast<unsigned int>(u32b));
+  logFacility.Flush();
+
+  ASSERT_EQ(3U, backend.records.size());
+  backend.records[0].erase(13, 28);
+  ASSERT_TRUE(backend.records[0] == "[INFO ] uut: Log");
+  backend.records[1].erase(13, 28);
+  ASSERT_TRUE(backend.records[1] == "[INFO ] uut: Log 48");
+  backend.records[2].erase(13, 28);
+  ASSERT_TRUE(backend.records[2] == "[INFO ] uut: Log 48 21 %");
+}
+
 TEST_F(gpcc_log_Logger_TestsF, LogFailed)
 {
   uut.LogFailed();
@@ -588,6 +656,124 @@ TEST_F(gpcc_log_Logger_TestsF, LogFailed)
   ASSERT_TRUE(backend.records[0] == "[ERROR] *** Logger: 1 error(s) during log message creation (e.g. out-of-memory) ***");
 }
 
+#if (!defined(SKIP_TFC_BASED_TESTS)) || (!defined(SKIP_LOAD_DEPENDENT_TESTS))
+TEST_F(gpcc_log_Logger_TestsF, RateLimit_Refill)
+{
+  uut.SetRateLimit(20U, 1U);
+
+  uut.Log(LogType::Info, "Log1");
+  uut.Log(LogType::Info, "Log2");
+
+  // 50ms are required to gain budget for one message
+  gpcc::osal::Thread::Sleep_ms(100U);
+  uut.Log(LogType::Info, "Log3");
+
+  logFacility.Flush();
+
+  ASSERT_EQ(3U, backend.records.size());
+  ASSERT_TRUE(backend.records[0] == "[INFO ] uut: Log1");
+  ASSERT_TRUE(backend.records[1] == "[ERROR] *** Logger: 1 not (properly) delivered message(s)! ***");
+  ASSERT_TRUE(backend.records[2] == "[INFO ] uut: Log3");
+}
+#endif
+
+TEST_F(gpcc_log_Logger_TestsF, RateLimit_Disable)
+{
+  uut.SetRateLimit(1U, 1U);
+  uut.Log(LogType::Info, "Log1");
+  uut.Log(LogType::Info, "Log2");
+  logFacility.Flush();
+
+  uut.SetRateLimit(0U, 0U);
+  uut.Log(LogType::Info, "Log3");
+  uut.Log(LogType::Info, "Log4");
+  logFacility.Flush();
+
+  ASSERT_EQ(4U, backend.records.size());
+  ASSERT_TRUE(backend.records[0] == "[INFO ] uut: Log1");
+  ASSERT_TRUE(backend.records[1] == "[ERROR] *** Logger: 1 not (properly) delivered message(s)! ***");
+  ASSERT_TRUE(backend.records[2] == "[INFO ] uut: Log3");
+  ASSERT_TRUE(backend.records[3] == "[INFO ] uut: Log4");
+}
+
+TEST_F(gpcc_log_Logger_TestsF, RateLimit_ErrorAndFatalNotAffected)
+{
+  uut.SetRateLimit(1U, 1U);
+
+  uut.Log(LogType::Warning, "Log1");
+  uut.Log(LogType::Warning, "Log2");
+  uut.Log(LogType::Error, "Log3");
+  uut.Log(LogType::Fatal, "Log4");
+  uut.Log(LogType::Warning, "Log5");
+  logFacility.Flush();
+
+  // The log facility may report the dropped messages in several portions
+  std::vector<std::string> messages;
+  unsigned int nbOfDroppedMsgs = 0U;
+  for (auto const & record : backend.records)
+  {
+    unsigned int n = 0U;
+    if (sscanf(record.c_str(), "[ERROR] *** Logger: %u not (properly) delivered message(s)! ***", &n) == 1)
+      nbOfDroppedMsgs += n;
+    else
+      messages.push_back(record);
+  }
+
+  EXPECT_EQ(2U, nbOfDroppedMsgs);
+  ASSERT_EQ(3U, messages.size());
+  EXPECT_TRUE(messages[0] == "[WARN ] uut: Log1");
+  EXPECT_TRUE(messages[1] == "[ERROR] uut: Log3");
+  EXPECT_TRUE(messages[2] == "[FATAL] uut: Log4");
+}
+
+TEST_F(gpcc_log_Logger_TestsF, Log_Macro)
+{
+  volatile bool t = true;
+  size_t nbOfEvaluations = 0U;
+
+  auto buildMsg = [&](char const * const pMsg) -> std::string
+  {
+    nbOfEvaluations++;
+    return pMsg;
+  };
+
+  LOG(uut, LogType::Debug, buildMsg("This should be dropped."));
+  LOG(uut, LogType::Info, buildMsg("Log1"));
+
+  if (t)
+    LOG(uut, LogType::Info, "Log2");
+
+  LOG(uut, LogType::Error, "Log3", std::make_exception_ptr(std::runtime_error("Error")));
+
+  LOGTS(uut, LogType::Debug, buildMsg("This should be dropped."));
+  LOGTS(uut, LogType::Info, buildMsg("Log4"));
+
+  logFacility.Flush();
+
+  EXPECT_EQ(nbOfEvaluations, 2U);
+
+  ASSERT_EQ(4U, backend.records.size());
+  ASSERT_TRUE(backend.records[0] == "[INFO ] uut: Log1");
+  ASSERT_TRUE(backend.records[1] == "[INFO ] uut: Log2");
+  ASSERT_TRUE(backend.records[2] == "[ERROR] uut: Log3\n        1: Error");
+  backend.records[3].erase(13, 28);
+  ASSERT_TRUE(backend.records[3] == "[INFO ] uut: Log4");
+}
+
+TEST_F(gpcc_log_Logger_TestsF, Log_Macro_ExceptionDuringEvaluationOfArgs)
+{
+  auto buildMsg = [&]() -> std::string
+  {
+    throw std::bad_alloc();
+  };
+
+  LOG(uut, LogType::Info, buildMsg());
+  logFacility.Flush();
+
+  ASSERT_EQ(1U, backend.records.size());
+  ASSERT_TRUE(backend.records[0] == "[ERROR] *** Logger: 1 error(s) during log message creation (e.g. out-of-memory) ***");
+}
+
 TEST_F(gpcc_log_Logger_TestsF, Log_VariableArgs_Macro)
 {
   volatile bool t = true;
@@ -628,5 +814,28 @@ TEST_F(gpcc_log_Logger_TestsF, LogTS_VariableArgs_Macro)
   ASSERT_TRUE(backend.records[1] == "[INFO ] uut: Log 48 21 %");
 }
 
+TEST_F(gpcc_log_Logger_TestsF, Log_DeferredFormat_Macro)
+{
+  volatile bool t = true;
+
+  uint32_t u32a = 48U;
+  uint32_t u32b = 21U;
+  LOGD(uut, LogType::Debug, "This should be dropped. %u", static_cast<unsigned int>(u32a));
+  LOGD(uut, LogType::Info, "Log %u", static_cast<unsigned int>(u32a));
+
+  if (t)
+    LOGD(uut, LogType::Info, "Log %u %u %%", static_cast<unsigned int>(u32a), static_cast<unsigned int>(u32b));
+
+  LOGDTS(uut, LogType::Info, "Log %u", static_cast<unsigned int>(u32b));
+
+  logFacility.Flush();
+
+  ASSERT_EQ(3U, backend.records.size());
+  ASSERT_TRUE(backend.records[0] == "[INFO ] uut: Log 48");
+  ASSERT_TRUE(backend.records[1] == "[INFO ] uut: Log 48 21 %");
+  backend.records[2].erase(13, 28);
+  ASSERT_TRUE(backend.records[2] == "[INFO ] uut: Log 21");
+}
+
 } // namespace log
 } // namespace gpcc_tests
@@ -10,6 +10,7 @@
 
 #include <gpcc/log/log_levels.hpp>
 #include <gtest/gtest.h>
+#include <cstdint>
 
 using namespace gpcc::log;
 using namespace testing;
@@ -66,6 +67,18 @@ TEST(gpcc_log_log_levels_Tests, String2LogLevel)
   EXPECT_THROW((void)String2LogLevel("bad"), std::runtime_error);
 }
 
+TEST(gpcc_log_log_levels_Tests, IsEnabledAtCompileTime)
+{
+  static_assert(IsEnabledAtCompileTime(LogType::Fatal) || (compileTimeLogLevel == LogLevel::Nothing),
+                "IsEnabledAtCompileTime() must be usable in constant expressions");
+
+  for (uint8_t i = 0U; i <= static_cast<uint8_t>(LogType::Fatal); i++)
+  {
+    LogType const type = static_cast<LogType>(i);
+    EXPECT_EQ(IsEnabledAtCompileTime(type), i >= static_cast<uint8_t>(compileTimeLogLevel));
+  }
+}
+
 TEST(gpcc_log_log_levels_Tests, LogLevelConversionCounterparts)
 {
   EXPECT_EQ(String2LogLevel(LogLevel2String(LogLevel::DebugOrAbove)),   LogLevel::DebugOrAbove);
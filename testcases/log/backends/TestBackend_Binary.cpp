@@ -0,0 +1,299 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#include <gpcc/log/backends/Backend_Binary.hpp>
+#include <gpcc/log/BinaryLogDecoder.hpp>
+#include <gpcc/log/logfacilities/ThreadedLogFacility.hpp>
+#include <gpcc/log/log_tools.hpp>
+#include <gpcc/log/Logger.hpp>
+#include <gpcc/osal/Thread.hpp>
+#include <gpcc/raii/scope_guard.hpp>
+#include <gpcc/stream/MemStreamReader.hpp>
+#include <gpcc/stream/MemStreamWriter.hpp>
+#include "testcases/log/logfacilities/FakeBackend.hpp"
+#include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace gpcc_tests {
+namespace log {
+
+using namespace testing;
+using namespace gpcc::log;
+using gpcc::stream::IStreamReader;
+using gpcc::stream::IStreamWriter;
+using gpcc::stream::MemStreamReader;
+using gpcc::stream::MemStreamWriter;
+
+// Test fixture for Backend_Binary and BinaryLogDecoder.
+// The binary log is written into a memory buffer. A ThreadedLogFacility, a Logger, and a FakeBackend (text) are
+// available.
+class gpcc_log_Backend_Binary_TestsF: public Test
+{
+  public:
+    gpcc_log_Backend_Binary_TestsF(void);
+
+  protected:
+    static size_t const bufferSize = 4096U;
+
+    std::vector<uint8_t> buffer;
+    std::unique_ptr<MemStreamWriter> spWriter;
+
+    ThreadedLogFacility logFacility;
+    Logger logger;
+
+    void SetUp(void) override;
+    void TearDown(void) override;
+
+    size_t FinishWriting(void);
+    std::vector<std::string> Decode(size_t const size);
+};
+
+gpcc_log_Backend_Binary_TestsF::gpcc_log_Backend_Binary_TestsF(void)
+: Test()
+, buffer(bufferSize)
+, spWriter()
+, logFacility("LFThread", 8U)
+, logger("Src")
+{
+}
+
+void gpcc_log_Backend_Binary_TestsF::SetUp(void)
+{
+  spWriter.reset(new MemStreamWriter(buffer.data(), buffer.size(), IStreamWriter::Endian::Little));
+
+  logger.SetLogLevel(LogLevel::DebugOrAbove);
+  logFacility.Register(logger);
+  logFacility.Start(gpcc::osal::Thread::SchedPolicy::Other, 0U, gpcc::osal::Thread::GetDefaultStackSize());
+}
+
+void gpcc_log_Backend_Binary_TestsF::TearDown(void)
+{
+  logFacility.Stop();
+  logFacility.Unregister(logger);
+
+  if (spWriter)
+    spWriter->Close();
+}
+
+// Closes the writer and returns the number of bytes written.
+size_t gpcc_log_Backend_Binary_TestsF::FinishWriting(void)
+{
+  size_t const size = bufferSize - spWriter->RemainingCapacity();
+  spWriter->Close();
+  spWriter.reset();
+  return size;
+}
+
+// Decodes the first "size" bytes of the buffer.
+std::vector<std::string> gpcc_log_Backend_Binary_TestsF::Decode(size_t const size)
+{
+  MemStreamReader reader(buffer.data(), size, IStreamReader::Endian::Little);
+  BinaryLogDecoder decoder(reader);
+
+  std::vector<std::string> messages;
+  std::string msg;
+  LogType type;
+  while (decoder.Next(msg, type))
+    messages.push_back(msg);
+
+  return messages;
+}
+
+TEST_F(gpcc_log_Backend_Binary_TestsF, Instantiation)
+{
+  {
+    Backend_Binary uut(*spWriter);
+  }
+
+  size_t const size = FinishWriting();
+  ASSERT_EQ(size, 9U);
+  EXPECT_TRUE(Decode(size).empty());
+}
+
+TEST_F(gpcc_log_Backend_Binary_TestsF, Instantiation_BigEndian)
+{
+  MemStreamWriter writer(buffer.data(), buffer.size(), IStreamWriter::Endian::Big);
+  std::unique_ptr<Backend_Binary> spUUT;
+  EXPECT_THROW(spUUT.reset(new Backend_Binary(writer)), std::invalid_argument);
+  writer.Close();
+}
+
+TEST_F(gpcc_log_Backend_Binary_TestsF, IsStructured)
+{
+  Backend_Binary uut(*spWriter);
+  EXPECT_TRUE(uut.IsStructured());
+}
+
+TEST_F(gpcc_log_Backend_Binary_TestsF, DeferredAndTextMessages)
+{
+  Backend_Binary uut(*spWriter);
+  FakeBackend textBackend;
+
+  logFacility.Register(uut);
+  ON_SCOPE_EXIT(unregUUT) { logFacility.Unregister(uut); };
+  logFacility.Register(textBackend);
+  ON_SCOPE_EXIT(unregTextBackend) { logFacility.Unregister(textBackend); };
+
+  char const * const pStr = "Text";
+  logger.LogD(LogType::Info, "Values: %d %u %hhd %llx %.2f %s %c",
+              -5, 7U, static_cast<signed char>(-3), 0x123456789ULL, 2.5, pStr, 'x');
+  logger.Log(LogType::Warning, "Plain text");
+  logger.LogD(LogType::Error, "No args");
+  logger.LogD(LogType::Debug, "%-5d|%5s|%%", 42, pStr);
+  logger.LogDTS(LogType::Info, "With timestamp %u", 1U);
+  logFacility.Flush();
+
+  size_t const size = FinishWriting();
+  auto const messages = Decode(size);
+
+  ASSERT_EQ(messages.size(), 5U);
+  ASSERT_EQ(textBackend.records.size(), 5U);
+  for (size_t i = 0U; i < messages.size(); i++)
+  {
+    EXPECT_EQ(messages[i], textBackend.records[i]);
+  }
+
+  EXPECT_EQ(messages[0], "[INFO ] Src: Values: -5 7 -3 123456789 2.50 Text x");
+  EXPECT_EQ(messages[3], "[DEBUG] Src: 42   | Text|%");
+}
+
+TEST_F(gpcc_log_Backend_Binary_TestsF, PointerArguments)
+{
+  Backend_Binary uut(*spWriter);
+  FakeBackend textBackend;
+
+  logFacility.Register(uut);
+  ON_SCOPE_EXIT(unregUUT) { logFacility.Unregister(uut); };
+  logFacility.Register(textBackend);
+  ON_SCOPE_EXIT(unregTextBackend) { logFacility.Unregister(textBackend); };
+
+  void const * const p1 = reinterpret_cast<void const *>(static_cast<uintptr_t>(0x1234U));
+  void const * const p2 = reinterpret_cast<void const *>(static_cast<uintptr_t>(0xABCDEFU));
+  void const * const pNull = nullptr;
+
+  logger.LogD(LogType::Info, "%p", p1);
+  logger.LogD(LogType::Info, "%8p|%-10p|", p1, p2);
+  logger.LogD(LogType::Info, "%p|%8p|%-8p|", pNull, pNull, pNull);
+  logFacility.Flush();
+
+  auto const messages = Decode(FinishWriting());
+
+  ASSERT_EQ(messages.size(), 3U);
+  ASSERT_EQ(textBackend.records.size(), 3U);
+  for (size_t i = 0U; i < messages.size(); i++)
+  {
+    EXPECT_EQ(messages[i], textBackend.records[i]);
+  }
+
+  EXPECT_EQ(messages[0], "[INFO ] Src: 0x1234");
+  EXPECT_EQ(messages[1], "[INFO ] Src:   0x1234|0xabcdef  |");
+}
+
+TEST_F(gpcc_log_Backend_Binary_TestsF, InterningOfStrings)
+{
+  Backend_Binary uut(*spWriter);
+  logFacility.Register(uut);
+  ON_SCOPE_EXIT(unregUUT) { logFacility.Unregister(uut); };
+
+  logger.LogD(LogType::Info, "Value: %u", 1U);
+  logFacility.Flush();
+  size_t const size1 = bufferSize - spWriter->RemainingCapacity();
+
+  logger.LogD(LogType::Info, "Value: %u", 2U);
+  logFacility.Flush();
+  size_t const size2 = bufferSize - spWriter->RemainingCapacity();
+
+  // second record: tag, type, src ID, flags, fmt ID, nb of args, type code, uint32
+  EXPECT_EQ(size2 - size1, 1U + 1U + 4U + 1U + 4U + 1U + 1U + 4U);
+
+  ON_SCOPE_EXIT_DISMISS(unregUUT);
+  logFacility.Unregister(uut);
+
+  auto const messages = Decode(FinishWriting());
+  ASSERT_EQ(messages.size(), 2U);
+  EXPECT_EQ(messages[0], "[INFO ] Src: Value: 1");
+  EXPECT_EQ(messages[1], "[INFO ] Src: Value: 2");
+}
+
+TEST_F(gpcc_log_Backend_Binary_TestsF, NoTextBackend)
+{
+  Backend_Binary uut(*spWriter);
+  logFacility.Register(uut);
+  ON_SCOPE_EXIT(unregUUT) { logFacility.Unregister(uut); };
+
+  logger.LogD(LogType::Info, "%s has %u items", "List", 3U);
+  logger.LogD(LogType::Info, "Pointer: %p", static_cast<void const *>(nullptr));
+  logFacility.Flush();
+
+  ON_SCOPE_EXIT_DISMISS(unregUUT);
+  logFacility.Unregister(uut);
+
+  auto const messages = Decode(FinishWriting());
+  ASSERT_EQ(messages.size(), 2U);
+  EXPECT_EQ(messages[0], "[INFO ] Src: List has 3 items");
+  EXPECT_EQ(messages[1], "[INFO ] Src: Pointer: (nil)");
+}
+
+TEST_F(gpcc_log_Backend_Binary_TestsF, Decoder_ArgMismatch)
+{
+  Backend_Binary uut(*spWriter);
+  logFacility.Register(uut);
+  ON_SCOPE_EXIT(unregUUT) { logFacility.Unregister(uut); };
+
+  // Note: These are intentionally bad. GCC's format checks do not apply to LogD().
+  logger.LogD(LogType::Info, "%f %d", 1U);
+  logger.LogD(LogType::Info, "%*d", 5, 1);
+  logFacility.Flush();
+
+  ON_SCOPE_EXIT_DISMISS(unregUUT);
+  logFacility.Unregister(uut);
+
+  auto const messages = Decode(FinishWriting());
+  ASSERT_EQ(messages.size(), 2U);
+  EXPECT_EQ(messages[0], "[INFO ] Src: <?> <?>");
+  EXPECT_EQ(messages[1], "[INFO ] Src: <?>");
+}
+
+TEST_F(gpcc_log_Backend_Binary_TestsF, Decoder_BadHeader)
+{
+  spWriter->Write_char("GPCCBLOX", 8U);
+  spWriter->Write_uint8(Backend_Binary::version);
+  size_t const size = FinishWriting();
+
+  EXPECT_THROW((void)Decode(size), std::runtime_error);
+}
+
+TEST_F(gpcc_log_Backend_Binary_TestsF, Decoder_BadVersion)
+{
+  spWriter->Write_char(Backend_Binary::magic, 8U);
+  spWriter->Write_uint8(Backend_Binary::version + 1U);
+  size_t const size = FinishWriting();
+
+  EXPECT_THROW((void)Decode(size), InvalidVersionError);
+}
+
+TEST_F(gpcc_log_Backend_Binary_TestsF, Decoder_UnknownID)
+{
+  spWriter->Write_char(Backend_Binary::magic, 8U);
+  spWriter->Write_uint8(Backend_Binary::version);
+  spWriter->Write_uint8(static_cast<uint8_t>(Backend_Binary::RecordTags::message));
+  spWriter->Write_uint8(static_cast<uint8_t>(LogType::Info));
+  spWriter->Write_uint32(0U);
+  size_t const size = FinishWriting();
+
+  EXPECT_THROW((void)Decode(size), std::runtime_error);
+}
+
+} // namespace log
+} // namespace gpcc_tests
@@ -695,6 +695,54 @@ TEST_F(gpcc_log_Backend_CLILogHistory_TestsF, ExportWithDroppedEntries)
                                                            "[INFO ] Msg_C\n", true));
 }
 
+TEST_F(gpcc_log_Backend_CLILogHistory_TestsF, ExportTrimmedMessage)
+{
+  spUUT = std::make_unique<Backend_CLILogHistory>(&cli, 8U, 128U);
+
+  spUUT->Process("[INFO ] Msg_A", gpcc::log::LogType::Info);
+  spUUT->Process(std::string(200U, 'x'), gpcc::log::LogType::Info);
+
+  std::string const expected = "Note: At least one old log message has been removed from the buffer.\n" +
+                               std::string(125U, 'x') + "...\n";
+
+  spUUT->Export(buffer_msw, false);
+  EXPECT_TRUE(gpcc::string::TestSimplePatternMatch(buffer, expected.c_str(), true));
+}
+
+TEST_F(gpcc_log_Backend_CLILogHistory_TestsF, RingBufferWrapAround)
+{
+  spUUT = std::make_unique<Backend_CLILogHistory>(&cli, 4U, 128U);
+
+  // Messages of different lengths let the records wrap around the end of the ring buffer at different positions
+  // (header, text).
+  for (uint_fast8_t i = 0U; i < 50U; ++i)
+  {
+    std::string msg = "Msg_" + std::to_string(i) + "_" + std::string(i % 23U, '-');
+    spUUT->Process(msg, (i % 2U == 0U) ? gpcc::log::LogType::Info : gpcc::log::LogType::Warning);
+  }
+
+  std::string expected = "Note: At least one old log message has been removed from the buffer.\n";
+  for (uint_fast8_t i = 46U; i < 50U; ++i)
+    expected += "Msg_" + std::to_string(i) + "_" + std::string(i % 23U, '-') + "\n";
+
+  spUUT->Export(buffer_msw, false);
+  EXPECT_TRUE(gpcc::string::TestSimplePatternMatch(buffer, expected.c_str(), true));
+
+  Login();
+
+  terminal.Input("LogHistory 2");
+  terminal.Input_ENTER();
+  terminal.WaitForInputProcessed();
+
+  auto str = terminal.GetScreenContent();
+  EXPECT_TRUE(gpcc::string::TestSimplePatternMatch(str, "*\n" \
+                                                        ">LogHistory 2\n" \
+                                                        "History: Skipping 2 record(s).\n" \
+                                                        "History -2: Msg_48_--\n" \
+                                                        "History -1: Msg_49_---\n" \
+                                                        "Remaining capacity: 0 entries or 94 bytes.\n*", true));
+}
+
 TEST_F(gpcc_log_Backend_CLILogHistory_TestsF, BadParams1)
 {
   spUUT = std::make_unique<Backend_CLILogHistory>(&cli, 2U, 1024U);
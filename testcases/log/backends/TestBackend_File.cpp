@@ -0,0 +1,313 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#if defined(OS_LINUX_ARM) || defined(OS_LINUX_ARM_TFC) || defined(OS_LINUX_X64) || defined(OS_LINUX_X64_TFC)
+
+#include <gpcc/log/backends/Backend_File.hpp>
+#include <gpcc/file_systems/linux_fs/FileStorage.hpp>
+#include <gpcc/log/log_levels.hpp>
+#include <gpcc/osal/Thread.hpp>
+#include <gpcc/stream/IStreamReader.hpp>
+#include "src/file_systems/linux_fs/internal/UnitTestDirProvider.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace gpcc_tests {
+namespace log {
+
+using namespace testing;
+using gpcc::log::Backend_File;
+using gpcc::log::LogType;
+using gpcc::file_systems::linux_fs::FileStorage;
+using gpcc::file_systems::linux_fs::internal::UnitTestDirProvider;
+
+// Test fixture for Backend_File.
+// The test fixture creates a test folder and a FileStorage instance providing access to it.
+class gpcc_log_Backend_File_TestsF: public Test
+{
+  public:
+    gpcc_log_Backend_File_TestsF(void);
+
+  protected:
+    // Manages creation and removal of test directory.
+    UnitTestDirProvider testDirProvider;
+
+    // File storage referring to the test directory.
+    std::unique_ptr<FileStorage> spFS;
+
+    // unit under test
+    std::unique_ptr<Backend_File> spUUT;
+
+    void SetUp(void) override;
+    void TearDown(void) override;
+
+    void CreateUUT(size_t const bufferSize, size_t const maxFileSize, uint8_t const maxNbOfFiles);
+    void StartUUT(void);
+    std::vector<std::string> ReadLines(std::string const & fileName);
+    std::vector<std::string> ListFiles(void);
+};
+
+gpcc_log_Backend_File_TestsF::gpcc_log_Backend_File_TestsF(void)
+: Test()
+, testDirProvider()
+, spFS()
+, spUUT()
+{
+}
+
+void gpcc_log_Backend_File_TestsF::SetUp(void)
+{
+  spFS.reset(new FileStorage(testDirProvider.GetAbsPath()));
+}
+
+void gpcc_log_Backend_File_TestsF::TearDown(void)
+{
+  if (spUUT)
+  {
+    spUUT->Stop();
+    spUUT.reset();
+  }
+
+  spFS.reset();
+}
+
+void gpcc_log_Backend_File_TestsF::CreateUUT(size_t const bufferSize, size_t const maxFileSize, uint8_t const maxNbOfFiles)
+{
+  spUUT.reset(new Backend_File(*spFS, "test.log", bufferSize, 100U, maxFileSize, maxNbOfFiles, "BackendFile"));
+}
+
+void gpcc_log_Backend_File_TestsF::StartUUT(void)
+{
+  spUUT->Start(gpcc::osal::Thread::SchedPolicy::Other, 0U, gpcc::osal::Thread::GetDefaultStackSize());
+}
+
+std::vector<std::string> gpcc_log_Backend_File_TestsF::ReadLines(std::string const & fileName)
+{
+  std::vector<std::string> lines;
+
+  auto spReader = spFS->Open(fileName);
+  while (spReader->GetState() == gpcc::stream::IStreamReader::States::open)
+    lines.push_back(spReader->Read_line());
+  spReader->Close();
+
+  return lines;
+}
+
+std::vector<std::string> gpcc_log_Backend_File_TestsF::ListFiles(void)
+{
+  auto const files = spFS->Enumerate();
+  std::vector<std::string> v(files.begin(), files.end());
+  std::sort(v.begin(), v.end());
+  return v;
+}
+
+TEST_F(gpcc_log_Backend_File_TestsF, Instantiation)
+{
+  CreateUUT(64U, 1024U, 3U);
+}
+
+TEST_F(gpcc_log_Backend_File_TestsF, Instantiation_BadArgs)
+{
+  EXPECT_THROW(spUUT.reset(new Backend_File(*spFS, "", 64U, 100U, 1024U, 3U, "BackendFile")), std::invalid_argument);
+  EXPECT_THROW(spUUT.reset(new Backend_File(*spFS, "test.log", 63U, 100U, 1024U, 3U, "BackendFile")), std::invalid_argument);
+  EXPECT_THROW(spUUT.reset(new Backend_File(*spFS, "test.log", 64U, 0U, 1024U, 3U, "BackendFile")), std::invalid_argument);
+  EXPECT_THROW(spUUT.reset(new Backend_File(*spFS, "test.log", 64U, 100U, 63U, 3U, "BackendFile")), std::invalid_argument);
+  EXPECT_THROW(spUUT.reset(new Backend_File(*spFS, "test.log", 64U, 100U, 1024U, 0U, "BackendFile")), std::invalid_argument);
+}
+
+TEST_F(gpcc_log_Backend_File_TestsF, StartStop)
+{
+  CreateUUT(64U, 1024U, 3U);
+
+  StartUUT();
+  EXPECT_THROW(StartUUT(), std::logic_error);
+  spUUT->Stop();
+
+  // second stop has no effect
+  spUUT->Stop();
+
+  auto const files = ListFiles();
+  ASSERT_EQ(files.size(), 1U);
+  EXPECT_EQ(files[0], "test.log");
+
+  EXPECT_TRUE(ReadLines("test.log").empty());
+}
+
+TEST_F(gpcc_log_Backend_File_TestsF, Flush_NotRunning)
+{
+  CreateUUT(64U, 1024U, 3U);
+
+  EXPECT_THROW(spUUT->Flush(), std::logic_error);
+}
+
+TEST_F(gpcc_log_Backend_File_TestsF, WriteAndStop)
+{
+  CreateUUT(1024U, 4096U, 3U);
+  StartUUT();
+
+  for (int i = 0; i < 20; ++i)
+    spUUT->Process("Message " + std::to_string(i), LogType::Info);
+
+  spUUT->Stop();
+
+  auto const lines = ReadLines("test.log");
+  ASSERT_EQ(lines.size(), 20U);
+  for (size_t i = 0U; i < lines.size(); ++i)
+  {
+    EXPECT_EQ(lines[i], "Message " + std::to_string(i));
+  }
+}
+
+TEST_F(gpcc_log_Backend_File_TestsF, Flush)
+{
+  CreateUUT(1024U, 4096U, 3U);
+  StartUUT();
+
+  spUUT->Process("Message 1", LogType::Info);
+  spUUT->Process("Message 2", LogType::Error);
+  spUUT->Flush();
+
+  // nothing to flush
+  spUUT->Flush();
+
+  spUUT->Process("Message 3", LogType::Info);
+  spUUT->Flush();
+
+  spUUT->Stop();
+
+  auto const lines = ReadLines("test.log");
+  ASSERT_EQ(lines.size(), 3U);
+  EXPECT_EQ(lines[0], "Message 1");
+  EXPECT_EQ(lines[1], "Message 2");
+  EXPECT_EQ(lines[2], "Message 3");
+}
+
+TEST_F(gpcc_log_Backend_File_TestsF, DropWhenBuffersFull)
+{
+  CreateUUT(64U, 4096U, 3U);
+
+  // The back-end is not running yet. The first buffer is swapped, the second one fills up and then messages are
+  // dropped. The note about the dropped messages is written after the content of the second buffer.
+  std::string const msg(15U, 'x'); // 16 bytes incl. '\n', 4 messages per buffer
+  for (int i = 0; i < 10; ++i)
+    spUUT->Process(msg, LogType::Info);
+
+  StartUUT();
+  spUUT->Stop();
+
+  auto const lines = ReadLines("test.log");
+  ASSERT_EQ(lines.size(), 9U);
+  for (size_t i = 0U; i < 8U; ++i)
+  {
+    EXPECT_EQ(lines[i], msg);
+  }
+  EXPECT_EQ(lines[8], "*** Backend_File: 2 message(s) dropped ***");
+}
+
+TEST_F(gpcc_log_Backend_File_TestsF, LongMessageTruncated)
+{
+  CreateUUT(64U, 4096U, 3U);
+  StartUUT();
+
+  spUUT->Process(std::string(100U, 'x'), LogType::Info);
+  spUUT->Stop();
+
+  auto const lines = ReadLines("test.log");
+  ASSERT_EQ(lines.size(), 1U);
+  EXPECT_EQ(lines[0], std::string(63U, 'x'));
+}
+
+TEST_F(gpcc_log_Backend_File_TestsF, RotationUponStart)
+{
+  CreateUUT(64U, 4096U, 3U);
+
+  for (int i = 0; i < 4; ++i)
+  {
+    StartUUT();
+    spUUT->Process("Run " + std::to_string(i), LogType::Info);
+    spUUT->Stop();
+  }
+
+  auto const files = ListFiles();
+  ASSERT_EQ(files.size(), 3U);
+  EXPECT_EQ(files[0], "test.log");
+  EXPECT_EQ(files[1], "test.log.1");
+  EXPECT_EQ(files[2], "test.log.2");
+
+  auto lines = ReadLines("test.log");
+  ASSERT_EQ(lines.size(), 1U);
+  EXPECT_EQ(lines[0], "Run 3");
+
+  lines = ReadLines("test.log.1");
+  ASSERT_EQ(lines.size(), 1U);
+  EXPECT_EQ(lines[0], "Run 2");
+
+  lines = ReadLines("test.log.2");
+  ASSERT_EQ(lines.size(), 1U);
+  EXPECT_EQ(lines[0], "Run 1");
+}
+
+TEST_F(gpcc_log_Backend_File_TestsF, RotationBySize)
+{
+  CreateUUT(64U, 64U, 2U);
+  StartUUT();
+
+  // 3 messages of 19 bytes each (incl. '\n') per file
+  for (int i = 0; i < 7; ++i)
+  {
+    for (int j = 0; j < 3; ++j)
+      spUUT->Process("Message " + std::to_string(i) + "_" + std::to_string(j) + "-------", LogType::Info);
+    spUUT->Flush();
+  }
+
+  spUUT->Stop();
+
+  auto const files = ListFiles();
+  ASSERT_EQ(files.size(), 2U);
+  EXPECT_EQ(files[0], "test.log");
+  EXPECT_EQ(files[1], "test.log.1");
+
+  auto lines = ReadLines("test.log");
+  ASSERT_EQ(lines.size(), 3U);
+  EXPECT_EQ(lines[0], "Message 6_0-------");
+
+  lines = ReadLines("test.log.1");
+  ASSERT_EQ(lines.size(), 3U);
+  EXPECT_EQ(lines[0], "Message 5_0-------");
+}
+
+TEST_F(gpcc_log_Backend_File_TestsF, SingleFile)
+{
+  CreateUUT(64U, 4096U, 1U);
+
+  for (int i = 0; i < 2; ++i)
+  {
+    StartUUT();
+    spUUT->Process("Run " + std::to_string(i), LogType::Info);
+    spUUT->Stop();
+  }
+
+  auto const files = ListFiles();
+  ASSERT_EQ(files.size(), 1U);
+  EXPECT_EQ(files[0], "test.log");
+
+  auto const lines = ReadLines("test.log");
+  ASSERT_EQ(lines.size(), 1U);
+  EXPECT_EQ(lines[0], "Run 1");
+}
+
+} // namespace log
+} // namespace gpcc_tests
+
+#endif // #if defined(OS_LINUX_ARM) || defined(OS_LINUX_ARM_TFC) || defined(OS_LINUX_X64) || defined(OS_LINUX_X64_TFC)
@@ -0,0 +1,63 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#include "src/log/internal/DeferredFormatLogMessage.hpp"
+#include <gtest/gtest.h>
+#include <cstdint>
+
+using namespace gpcc::log;
+using namespace testing;
+
+namespace gpcc_tests {
+namespace log {
+
+TEST(gpcc_log_DeferredFormatLogMessage_Test, Test_OK)
+{
+  gpcc::string::SharedString src("SRC");
+  gpcc::log::internal::DeferredFormatLogMessage uut(src, LogType::Info, "Message", DeferredFormatArgs::Capture());
+  std::string output = uut.BuildText();
+  ASSERT_STREQ(output.c_str(), "[INFO ] SRC: Message");
+}
+
+TEST(gpcc_log_DeferredFormatLogMessage_Test, Test_OK_Args)
+{
+  gpcc::string::SharedString src("SRC");
+
+  char const * const pText = "Text";
+  uint8_t const u8 = 200U;
+  int16_t const i16 = -5;
+  long long const ll = -1234567890123LL;
+  double const d = 1.5;
+  char const c = 'X';
+
+  // the arguments are captured without padding, so this also checks unaligned storage
+  auto const args = DeferredFormatArgs::Capture(u8, i16, ll, d, c, pText);
+
+  gpcc::log::internal::DeferredFormatLogMessage uut(src, LogType::Warning, "%u %d %lld %.2f %c %s", args);
+  std::string output = uut.BuildText();
+  ASSERT_STREQ(output.c_str(), "[WARN ] SRC: 200 -5 -1234567890123 1.50 X Text");
+}
+
+TEST(gpcc_log_DeferredFormatLogMessage_Test, Test_MultiLine)
+{
+  gpcc::string::SharedString src("SRC");
+  gpcc::log::internal::DeferredFormatLogMessage uut(src, LogType::Info, "Line %u\nLine %u", DeferredFormatArgs::Capture(1U, 2U));
+  std::string output = uut.BuildText();
+  ASSERT_STREQ(output.c_str(), "[INFO ] SRC: Line 1\n        Line 2");
+}
+
+TEST(gpcc_log_DeferredFormatLogMessage_Test, Test_InvalidArgs)
+{
+  gpcc::string::SharedString src("SRC");
+  EXPECT_THROW(gpcc::log::internal::DeferredFormatLogMessage uut(src, LogType::Info, nullptr, DeferredFormatArgs::Capture(1)), std::invalid_argument);
+}
+
+} // namespace log
+} // namespace gpcc_tests
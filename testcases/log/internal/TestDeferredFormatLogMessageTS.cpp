@@ -0,0 +1,37 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#include "src/log/internal/DeferredFormatLogMessageTS.hpp"
+#include <gtest/gtest.h>
+
+using namespace gpcc::log;
+using namespace testing;
+
+namespace gpcc_tests {
+namespace log {
+
+TEST(gpcc_log_DeferredFormatLogMessageTS_Test, Test_OK)
+{
+  gpcc::string::SharedString src("SRC");
+  gpcc::log::internal::DeferredFormatLogMessageTS uut(src, LogType::Info, "Message %u", DeferredFormatArgs::Capture(5U));
+  std::string output = uut.BuildText();
+  ASSERT_TRUE(output.size() > 41U);
+  output.erase(13, 28);
+  ASSERT_STREQ(output.c_str(), "[INFO ] SRC: Message 5");
+}
+
+TEST(gpcc_log_DeferredFormatLogMessageTS_Test, Test_InvalidArgs)
+{
+  gpcc::string::SharedString src("SRC");
+  EXPECT_THROW(gpcc::log::internal::DeferredFormatLogMessageTS uut(src, LogType::Info, nullptr, DeferredFormatArgs::Capture(1)), std::invalid_argument);
+}
+
+} // namespace log
+} // namespace gpcc_tests
@@ -0,0 +1,190 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#include "src/log/internal/LogStagingBuffer.hpp"
+#include "src/log/internal/RomConstLogMessage.hpp"
+#include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+
+using namespace gpcc::log;
+using namespace gpcc::log::internal;
+using namespace testing;
+
+namespace gpcc_tests {
+namespace log {
+
+namespace {
+
+std::unique_ptr<LogMessage> CreateMsg(LogType const type, char const * const pText)
+{
+  static gpcc::string::SharedString const src("SRC");
+  return std::make_unique<RomConstLogMessage>(src, type, pText);
+}
+
+} // anonymous namespace
+
+TEST(gpcc_log_LogStagingBuffer_Test, Instantiation)
+{
+  LogStagingBuffer uut(16U, 8U);
+
+  EXPECT_TRUE(uut.IsEmpty());
+  EXPECT_FALSE(uut.HasDropped());
+  EXPECT_FALSE(uut.IsProducerTerminated());
+  EXPECT_FALSE(uut.IsConsumerReleased());
+}
+
+TEST(gpcc_log_LogStagingBuffer_Test, Instantiation_InvalidArgs)
+{
+  EXPECT_THROW(LogStagingBuffer uut(0U, 1U), std::invalid_argument);
+  EXPECT_THROW(LogStagingBuffer uut(12U, 8U), std::invalid_argument);
+  EXPECT_THROW(LogStagingBuffer uut(16U, 0U), std::invalid_argument);
+  EXPECT_THROW(LogStagingBuffer uut(16U, 17U), std::invalid_argument);
+}
+
+TEST(gpcc_log_LogStagingBuffer_Test, PushAndPop)
+{
+  LogStagingBuffer uut(4U, 4U);
+
+  gpcc::time::TimePoint const t1(1, 0);
+  gpcc::time::TimePoint const t2(2, 0);
+
+  auto spMsg1 = CreateMsg(LogType::Info, "Msg1");
+  auto spMsg2 = CreateMsg(LogType::Info, "Msg2");
+  bool wentNonEmpty = false;
+
+  ASSERT_TRUE(uut.Push(spMsg1.get(), t1, wentNonEmpty));
+  spMsg1.release();
+  EXPECT_TRUE(wentNonEmpty);
+
+  ASSERT_TRUE(uut.Push(spMsg2.get(), t2, wentNonEmpty));
+  spMsg2.release();
+  EXPECT_FALSE(wentNonEmpty);
+
+  EXPECT_FALSE(uut.IsEmpty());
+
+  uut.BeginDrain();
+
+  ASSERT_TRUE(uut.IsDrainPending());
+  EXPECT_TRUE(uut.FrontTimestamp() == t1);
+  std::unique_ptr<LogMessage> spPopped(uut.Pop());
+  EXPECT_EQ(spPopped->BuildText(), "[INFO ] SRC: Msg1");
+
+  ASSERT_TRUE(uut.IsDrainPending());
+  EXPECT_TRUE(uut.FrontTimestamp() == t2);
+  spPopped.reset(uut.Pop());
+  EXPECT_EQ(spPopped->BuildText(), "[INFO ] SRC: Msg2");
+
+  EXPECT_FALSE(uut.IsDrainPending());
+  EXPECT_TRUE(uut.IsEmpty());
+}
+
+TEST(gpcc_log_LogStagingBuffer_Test, DrainCycleIsLimitedToSnapshot)
+{
+  LogStagingBuffer uut(4U, 4U);
+  gpcc::time::TimePoint const t;
+  bool wentNonEmpty;
+
+  auto spMsg = CreateMsg(LogType::Info, "Msg1");
+  ASSERT_TRUE(uut.Push(spMsg.get(), t, wentNonEmpty));
+  spMsg.release();
+
+  uut.BeginDrain();
+
+  spMsg = CreateMsg(LogType::Info, "Msg2");
+  ASSERT_TRUE(uut.Push(spMsg.get(), t, wentNonEmpty));
+  spMsg.release();
+
+  ASSERT_TRUE(uut.IsDrainPending());
+  std::unique_ptr<LogMessage> spPopped(uut.Pop());
+  EXPECT_EQ(spPopped->BuildText(), "[INFO ] SRC: Msg1");
+
+  EXPECT_FALSE(uut.IsDrainPending());
+  EXPECT_FALSE(uut.IsEmpty());
+
+  // Msg2 is released by the destructor
+}
+
+TEST(gpcc_log_LogStagingBuffer_Test, CapacityLimit)
+{
+  LogStagingBuffer uut(4U, 2U);
+  gpcc::time::TimePoint const t;
+  bool wentNonEmpty;
+
+  // non-error messages occupy up to "capacity" slots
+  for (int i = 0; i < 2; i++)
+  {
+    auto spMsg = CreateMsg(LogType::Warning, "Msg");
+    ASSERT_TRUE(uut.Push(spMsg.get(), t, wentNonEmpty));
+    spMsg.release();
+  }
+
+  auto spMsg = CreateMsg(LogType::Warning, "Msg");
+  ASSERT_FALSE(uut.Push(spMsg.get(), t, wentNonEmpty));
+
+  // error and fatal messages may occupy the remaining slots
+  spMsg = CreateMsg(LogType::Error, "Msg");
+  ASSERT_TRUE(uut.Push(spMsg.get(), t, wentNonEmpty));
+  spMsg.release();
+
+  spMsg = CreateMsg(LogType::Fatal, "Msg");
+  ASSERT_TRUE(uut.Push(spMsg.get(), t, wentNonEmpty));
+  spMsg.release();
+
+  spMsg = CreateMsg(LogType::Error, "Msg");
+  ASSERT_FALSE(uut.Push(spMsg.get(), t, wentNonEmpty));
+
+  // remove one message
+  uut.BeginDrain();
+  std::unique_ptr<LogMessage> spPopped(uut.Pop());
+  spPopped.reset();
+
+  // still 3 messages inside, non-error messages are still rejected
+  spMsg = CreateMsg(LogType::Info, "Msg");
+  ASSERT_FALSE(uut.Push(spMsg.get(), t, wentNonEmpty));
+
+  spMsg = CreateMsg(LogType::Error, "Msg");
+  ASSERT_TRUE(uut.Push(spMsg.get(), t, wentNonEmpty));
+  spMsg.release();
+}
+
+TEST(gpcc_log_LogStagingBuffer_Test, Dropped)
+{
+  LogStagingBuffer uut(4U, 2U);
+
+  EXPECT_FALSE(uut.HasDropped());
+  EXPECT_TRUE(uut.IncDropped());
+  EXPECT_TRUE(uut.HasDropped());
+  EXPECT_FALSE(uut.IncDropped());
+
+  EXPECT_EQ(uut.FetchDropped(), 2U);
+  EXPECT_FALSE(uut.HasDropped());
+  EXPECT_EQ(uut.FetchDropped(), 0U);
+
+  // saturation
+  for (int i = 0; i < 300; i++)
+    (void)uut.IncDropped();
+  EXPECT_EQ(uut.FetchDropped(), 255U);
+}
+
+TEST(gpcc_log_LogStagingBuffer_Test, Flags)
+{
+  LogStagingBuffer uut(4U, 2U);
+
+  uut.MarkProducerTerminated();
+  EXPECT_TRUE(uut.IsProducerTerminated());
+  EXPECT_FALSE(uut.IsConsumerReleased());
+
+  uut.MarkConsumerReleased();
+  EXPECT_TRUE(uut.IsConsumerReleased());
+}
+
+} // namespace log
+} // namespace gpcc_tests
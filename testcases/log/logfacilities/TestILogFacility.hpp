@@ -24,6 +24,7 @@
 #include <memory>
 #include <sstream>
 #include <stdexcept>
+#include <cstdio>
 
 using namespace gpcc::log;
 using namespace testing;
@@ -31,6 +32,16 @@ using namespace testing;
 namespace gpcc_tests {
 namespace log {
 
+// Traits used by the test fixtures below to create the UUT.
+// By default, T is the type of the UUT and the UUT is created with a capacity of 8 messages.
+// Specialize this for a tag type in order to test a log facility with a different configuration.
+template <typename T>
+struct ILogFacility_UUTTraits
+{
+  typedef T UUT;
+  static UUT Create(void) { return UUT("LFThread", 8); }
+};
+
 // Test fixture for gpcc::log::ILogFacility related tests.
 // This test fixture can be used to test Logger and Backend registration and
 // unregistration. There is a derived test fixture "ILogFacility_Log_TestsF",
@@ -43,7 +54,7 @@ class ILogFacility_TestsF: public Test
     virtual ~ILogFacility_TestsF(void) = default;
 
   protected:
-    T uut;
+    typename ILogFacility_UUTTraits<T>::UUT uut;
     bool uutRunning;
 
     void SetUp(void) override;
@@ -56,7 +67,7 @@ class ILogFacility_TestsF: public Test
 template <typename T>
 ILogFacility_TestsF<T>::ILogFacility_TestsF()
 : Test()
-, uut("LFThread", 8)
+, uut(ILogFacility_UUTTraits<T>::Create())
 , uutRunning(false)
 {
 }
@@ -218,7 +229,8 @@ TYPED_TEST_P(ILogFacility_Tests1F, RegisterLogger_TwiceAtSameLogFacility)
 }
 TYPED_TEST_P(ILogFacility_Tests1F, RegisterLogger_TwiceAtDifferentLogFacilities)
 {
-  std::unique_ptr<gtest_TypeParam_> spUUT2(new gtest_TypeParam_("LFThread", 8));
+  typedef typename ILogFacility_UUTTraits<gtest_TypeParam_>::UUT UUT;
+  std::unique_ptr<UUT> spUUT2(new UUT(ILogFacility_UUTTraits<gtest_TypeParam_>::Create()));
 
   Logger logger("TL1");
 
@@ -263,7 +275,8 @@ TYPED_TEST_P(ILogFacility_Tests1F, UnregisterLogger_ButNotRegisteredAnywhere)
 }
 TYPED_TEST_P(ILogFacility_Tests1F, UnregisterLogger_ButRegisteredSomewhereElse)
 {
-  std::unique_ptr<gtest_TypeParam_> spUUT2(new gtest_TypeParam_("LFThread", 8));
+  typedef typename ILogFacility_UUTTraits<gtest_TypeParam_>::UUT UUT;
+  std::unique_ptr<UUT> spUUT2(new UUT(ILogFacility_UUTTraits<gtest_TypeParam_>::Create()));
   Logger logger("TL1");
 
   // register logger at the other log facility
@@ -464,7 +477,8 @@ TYPED_TEST_P(ILogFacility_Tests1F, RegisterBackend_TwiceAtSameLogFacility)
 }
 TYPED_TEST_P(ILogFacility_Tests1F, RegisterBackend_TwiceAtDifferentLogFacilities)
 {
-  std::unique_ptr<gtest_TypeParam_> spUUT2(new gtest_TypeParam_("LFThread", 8));
+  typedef typename ILogFacility_UUTTraits<gtest_TypeParam_>::UUT UUT;
+  std::unique_ptr<UUT> spUUT2(new UUT(ILogFacility_UUTTraits<gtest_TypeParam_>::Create()));
 
   FakeBackend backend;
 
@@ -487,7 +501,8 @@ TYPED_TEST_P(ILogFacility_Tests1F, UnregisterBackend_ButNotRegisteredAnywhere)
 }
 TYPED_TEST_P(ILogFacility_Tests1F, UnregisterBackend_ButRegisteredSomewhereElse)
 {
-  std::unique_ptr<gtest_TypeParam_> spUUT2(new gtest_TypeParam_("LFThread", 8));
+  typedef typename ILogFacility_UUTTraits<gtest_TypeParam_>::UUT UUT;
+  std::unique_ptr<UUT> spUUT2(new UUT(ILogFacility_UUTTraits<gtest_TypeParam_>::Create()));
   FakeBackend backend;
 
   // register backend at the other log facility
@@ -974,6 +989,56 @@ TYPED_TEST_P(ILogFacility_Tests2F, LogFailedAndBackendThrows)
 
   ASSERT_TRUE(variant1 || variant2);
 }
+TYPED_TEST_P(ILogFacility_Tests2F, RateLimit)
+{
+  this->logger.SetRateLimit(1U, 2U);
+  ON_SCOPE_EXIT(disableRateLimit) { this->logger.SetRateLimit(0U, 0U); };
+
+  for (int i = 0; i < 5; i++)
+  {
+    std::ostringstream s;
+    s << "Test" << i;
+    this->logger.Log(LogType::Debug, s.str());
+  }
+  this->uut.Flush();
+
+  ASSERT_GE(this->backend.records.size(), 3U);
+  ASSERT_TRUE(this->backend.records[0] == "[DEBUG] TL1: Test0");
+  ASSERT_TRUE(this->backend.records[1] == "[DEBUG] TL1: Test1");
+
+  // The log facility's thread may report the dropped messages in several portions
+  unsigned int nbOfDroppedMsgs = 0U;
+  for (size_t i = 2U; i < this->backend.records.size(); i++)
+  {
+    unsigned int n = 0U;
+    ASSERT_EQ(1, sscanf(this->backend.records[i].c_str(),
+                        "[ERROR] *** Logger: %u not (properly) delivered message(s)! ***", &n));
+    nbOfDroppedMsgs += n;
+  }
+  ASSERT_EQ(3U, nbOfDroppedMsgs);
+}
+TYPED_TEST_P(ILogFacility_Tests2F, RateLimit_ButNoBackend)
+{
+  this->logger.SetRateLimit(1U, 1U);
+  ON_SCOPE_EXIT(disableRateLimit) { this->logger.SetRateLimit(0U, 0U); };
+
+  // unregister backend
+  this->uut.Unregister(this->backend);
+  ON_SCOPE_EXIT(unregBackend) { this->uut.Register(this->backend); };
+
+  // log something, the second message is dropped
+  this->logger.Log(LogType::Debug, "Test1");
+  this->logger.Log(LogType::Debug, "Test2");
+  this->uut.Flush();
+
+  // register backend again
+  ON_SCOPE_EXIT_DISMISS(unregBackend);
+  this->uut.Register(this->backend);
+
+  // verify that nothing is logged
+  this->uut.Flush();
+  ASSERT_EQ(0U, this->backend.records.size());
+}
 
 REGISTER_TYPED_TEST_SUITE_P(ILogFacility_Tests1F,
                             Instantiation,
@@ -1026,7 +1091,9 @@ REGISTER_TYPED_TEST_SUITE_P(ILogFacility_Tests2F,
                             LogFailed254,
                             LogFailed255,
                             LogFailed256,
-                            LogFailedAndBackendThrows);
+                            LogFailedAndBackendThrows,
+                            RateLimit,
+                            RateLimit_ButNoBackend);
 
 } // namespace log
 } // namespace gpcc_tests
@@ -151,6 +151,35 @@ TYPED_TEST_P(ILogFacilityCtrl_TestsF, EnumerateLogSources_Two)
   EXPECT_TRUE(v[1].first == "TL2");
   EXPECT_TRUE(v[1].second == LogLevel::WarningOrAbove);
 }
+TYPED_TEST_P(ILogFacilityCtrl_TestsF, EnumerateLogSources_Sorted)
+{
+  Logger logger1("b");
+  Logger logger2("B");
+  Logger logger3("a");
+
+  this->uut.Register(logger1);
+  ON_SCOPE_EXIT(unregLogger1) { this->uut.Unregister(logger1); };
+
+  this->uut.Register(logger2);
+  ON_SCOPE_EXIT(unregLogger2) { this->uut.Unregister(logger2); };
+
+  this->uut.Register(logger3);
+  ON_SCOPE_EXIT(unregLogger3) { this->uut.Unregister(logger3); };
+
+  auto v = this->uut.EnumerateLogSources();
+  ASSERT_EQ(3U, v.size());
+  EXPECT_TRUE(v[0].first == "B");
+  EXPECT_TRUE(v[1].first == "a");
+  EXPECT_TRUE(v[2].first == "b");
+
+  ON_SCOPE_EXIT_DISMISS(unregLogger2);
+  this->uut.Unregister(logger2);
+
+  v = this->uut.EnumerateLogSources();
+  ASSERT_EQ(2U, v.size());
+  EXPECT_TRUE(v[0].first == "a");
+  EXPECT_TRUE(v[1].first == "b");
+}
 TYPED_TEST_P(ILogFacilityCtrl_TestsF, GetLogLevel_OK)
 {
   Logger logger1("TL1");
@@ -248,6 +277,58 @@ TYPED_TEST_P(ILogFacilityCtrl_TestsF, RaiseLogLevel)
   ASSERT_TRUE(this->uut.RaiseLogLevel("TL1", LogLevel::WarningOrAbove));
   ASSERT_EQ(LogLevel::WarningOrAbove, logger.GetLogLevel());
 }
+TYPED_TEST_P(ILogFacilityCtrl_TestsF, SetLogLevelByPattern)
+{
+  Logger logger1("cood.TL1");
+  Logger logger2("cood.TL2");
+  Logger logger3("TL3");
+  logger1.SetLogLevel(LogLevel::InfoOrAbove);
+  logger2.SetLogLevel(LogLevel::InfoOrAbove);
+  logger3.SetLogLevel(LogLevel::InfoOrAbove);
+
+  this->uut.Register(logger1);
+  ON_SCOPE_EXIT(unregLogger1) { this->uut.Unregister(logger1); };
+
+  this->uut.Register(logger2);
+  ON_SCOPE_EXIT(unregLogger2) { this->uut.Unregister(logger2); };
+
+  this->uut.Register(logger3);
+  ON_SCOPE_EXIT(unregLogger3) { this->uut.Unregister(logger3); };
+
+  ASSERT_EQ(2U, this->uut.SetLogLevelByPattern("cood.*", LogLevel::DebugOrAbove));
+  EXPECT_TRUE(logger1.GetLogLevel() == LogLevel::DebugOrAbove);
+  EXPECT_TRUE(logger2.GetLogLevel() == LogLevel::DebugOrAbove);
+  EXPECT_TRUE(logger3.GetLogLevel() == LogLevel::InfoOrAbove);
+
+  ASSERT_EQ(3U, this->uut.SetLogLevelByPattern("*TL?", LogLevel::WarningOrAbove));
+  EXPECT_TRUE(logger1.GetLogLevel() == LogLevel::WarningOrAbove);
+  EXPECT_TRUE(logger2.GetLogLevel() == LogLevel::WarningOrAbove);
+  EXPECT_TRUE(logger3.GetLogLevel() == LogLevel::WarningOrAbove);
+
+  ASSERT_EQ(1U, this->uut.SetLogLevelByPattern("TL3", LogLevel::ErrorOrAbove));
+  EXPECT_TRUE(logger1.GetLogLevel() == LogLevel::WarningOrAbove);
+  EXPECT_TRUE(logger3.GetLogLevel() == LogLevel::ErrorOrAbove);
+
+  ASSERT_EQ(0U, this->uut.SetLogLevelByPattern("COOD.*", LogLevel::DebugOrAbove));
+  EXPECT_TRUE(logger1.GetLogLevel() == LogLevel::WarningOrAbove);
+}
+TYPED_TEST_P(ILogFacilityCtrl_TestsF, SetLogLevelByPattern_BadPattern)
+{
+  Logger logger1("TL1");
+  Logger logger2("TL2");
+  logger1.SetLogLevel(LogLevel::InfoOrAbove);
+  logger2.SetLogLevel(LogLevel::InfoOrAbove);
+
+  this->uut.Register(logger1);
+  ON_SCOPE_EXIT(unregLogger1) { this->uut.Unregister(logger1); };
+
+  this->uut.Register(logger2);
+  ON_SCOPE_EXIT(unregLogger2) { this->uut.Unregister(logger2); };
+
+  EXPECT_THROW((void)this->uut.SetLogLevelByPattern("TL**", LogLevel::DebugOrAbove), std::invalid_argument);
+  EXPECT_TRUE(logger1.GetLogLevel() == LogLevel::InfoOrAbove);
+  EXPECT_TRUE(logger2.GetLogLevel() == LogLevel::InfoOrAbove);
+}
 TYPED_TEST_P(ILogFacilityCtrl_TestsF, RegisterLogger_NoDefaultSettingsSet)
 {
   Logger logger("NewLogger");
@@ -348,6 +429,41 @@ TYPED_TEST_P(ILogFacilityCtrl_TestsF, RegisterLogger_ReplaceOfDefaultSettings)
   ASSERT_EQ(0U, this->backend.records.size());
   ASSERT_TRUE(logger.GetLogLevel() == LogLevel::WarningOrAbove);
 }
+TYPED_TEST_P(ILogFacilityCtrl_TestsF, RegisterLogger_DefaultSettingsPartiallyConsumed)
+{
+  Logger logger1("TL2");
+  Logger logger2("TL4");
+
+  std::vector<ILogFacilityCtrl::tLogSrcConfig> defaultSettings;
+  defaultSettings.push_back(ILogFacilityCtrl::tLogSrcConfig("TL1", LogLevel::WarningOrAbove));
+  defaultSettings.push_back(ILogFacilityCtrl::tLogSrcConfig("TL2", LogLevel::ErrorOrAbove));
+  defaultSettings.push_back(ILogFacilityCtrl::tLogSrcConfig("TL3", LogLevel::DebugOrAbove));
+  defaultSettings.push_back(ILogFacilityCtrl::tLogSrcConfig("TL2", LogLevel::DebugOrAbove));
+  defaultSettings.push_back(ILogFacilityCtrl::tLogSrcConfig("TL4", LogLevel::FatalOrAbove));
+  this->uut.SetDefaultSettings(std::move(defaultSettings));
+
+  this->uut.Register(logger1);
+  ON_SCOPE_EXIT(unregLogger1) { this->uut.Unregister(logger1); };
+
+  this->uut.Register(logger2);
+  ON_SCOPE_EXIT(unregLogger2) { this->uut.Unregister(logger2); };
+
+  this->uut.Flush();
+  ASSERT_EQ(0U, this->backend.records.size());
+
+  // the first matching entry shall have been consumed
+  EXPECT_TRUE(logger1.GetLogLevel() == LogLevel::ErrorOrAbove);
+  EXPECT_TRUE(logger2.GetLogLevel() == LogLevel::FatalOrAbove);
+
+  defaultSettings = this->uut.RemoveDefaultSettings();
+  ASSERT_EQ(3U, defaultSettings.size());
+  EXPECT_TRUE(defaultSettings[0].first == "TL1");
+  EXPECT_TRUE(defaultSettings[0].second == LogLevel::WarningOrAbove);
+  EXPECT_TRUE(defaultSettings[1].first == "TL3");
+  EXPECT_TRUE(defaultSettings[1].second == LogLevel::DebugOrAbove);
+  EXPECT_TRUE(defaultSettings[2].first == "TL2");
+  EXPECT_TRUE(defaultSettings[2].second == LogLevel::DebugOrAbove);
+}
 TYPED_TEST_P(ILogFacilityCtrl_TestsF, RegisterLogger_AllDefaultSettingConsumed)
 {
   Logger logger("NewLogger");
@@ -368,18 +484,22 @@ REGISTER_TYPED_TEST_SUITE_P(ILogFacilityCtrl_TestsF,
                             EnumerateLogSources_None,
                             EnumerateLogSources_One,
                             EnumerateLogSources_Two,
+                            EnumerateLogSources_Sorted,
                             GetLogLevel_OK,
                             GetLogLevel_LogSrcNotExisting,
                             SetLogLevel,
                             SetLogLevel_NoSuchSource,
                             LowerLogLevel,
                             RaiseLogLevel,
+                            SetLogLevelByPattern,
+                            SetLogLevelByPattern_BadPattern,
                             RegisterLogger_NoDefaultSettingsSet,
                             RegisterLogger_DefaultSettingsRemoved,
                             RegisterLogger_DefaultSettingsRemovedTwice,
                             RegisterLogger_DefaultSettingsNeverSetButRemoved,
                             RegisterLogger_NoMatchingDefaultSetting,
                             RegisterLogger_ReplaceOfDefaultSettings,
+                            RegisterLogger_DefaultSettingsPartiallyConsumed,
                             RegisterLogger_AllDefaultSettingConsumed);
 
 } // namespace log
@@ -11,7 +11,9 @@
 #include "TestILogFacility.hpp"
 #include "TestILogFacilityCtrl.hpp"
 #include <gpcc/log/logfacilities/ThreadedLogFacility.hpp>
+#include <gpcc/osal/Thread.hpp>
 #include <gtest/gtest.h>
+#include <sstream>
 #include <stdexcept>
 
 using namespace gpcc::log;
@@ -20,10 +22,40 @@ using namespace testing;
 namespace gpcc_tests {
 namespace log {
 
+// Tag type used to instantiate the ILogFacility tests for a ThreadedLogFacility using IntakeMode::lockFreeRing.
+struct ThreadedLogFacility_RingIntake {};
+
+template <>
+struct ILogFacility_UUTTraits<ThreadedLogFacility_RingIntake>
+{
+  typedef ThreadedLogFacility UUT;
+  static UUT Create(void) { return UUT("LFThread", 8, ThreadedLogFacility::IntakeMode::lockFreeRing); }
+};
+
+#if (defined(OS_LINUX_ARM) || defined(OS_LINUX_ARM_TFC) || defined(OS_LINUX_X64) || defined(OS_LINUX_X64_TFC))
+// Tag type used to instantiate the ILogFacility tests for a ThreadedLogFacility using IntakeMode::perThreadBuffers.
+struct ThreadedLogFacility_PerThreadBuffers {};
+
+template <>
+struct ILogFacility_UUTTraits<ThreadedLogFacility_PerThreadBuffers>
+{
+  typedef ThreadedLogFacility UUT;
+  static UUT Create(void) { return UUT("LFThread", 8, ThreadedLogFacility::IntakeMode::perThreadBuffers); }
+};
+#endif
+
 INSTANTIATE_TYPED_TEST_SUITE_P(gpcc_log_ThreadedLogFacility_, ILogFacility_Tests1F, ThreadedLogFacility);
 INSTANTIATE_TYPED_TEST_SUITE_P(gpcc_log_ThreadedLogFacility_, ILogFacility_Tests2F, ThreadedLogFacility);
 INSTANTIATE_TYPED_TEST_SUITE_P(gpcc_log_ThreadedLogFacility_, ILogFacilityCtrl_TestsF, ThreadedLogFacility);
 
+INSTANTIATE_TYPED_TEST_SUITE_P(gpcc_log_ThreadedLogFacilityRingIntake_, ILogFacility_Tests1F, ThreadedLogFacility_RingIntake);
+INSTANTIATE_TYPED_TEST_SUITE_P(gpcc_log_ThreadedLogFacilityRingIntake_, ILogFacility_Tests2F, ThreadedLogFacility_RingIntake);
+
+#if (defined(OS_LINUX_ARM) || defined(OS_LINUX_ARM_TFC) || defined(OS_LINUX_X64) || defined(OS_LINUX_X64_TFC))
+INSTANTIATE_TYPED_TEST_SUITE_P(gpcc_log_ThreadedLogFacilityPerThreadBuffers_, ILogFacility_Tests1F, ThreadedLogFacility_PerThreadBuffers);
+INSTANTIATE_TYPED_TEST_SUITE_P(gpcc_log_ThreadedLogFacilityPerThreadBuffers_, ILogFacility_Tests2F, ThreadedLogFacility_PerThreadBuffers);
+#endif
+
 TEST(gpcc_log_ThreadedLogFacility_Tests, Instantiation)
 {
   std::unique_ptr<ThreadedLogFacility> spUUT(new ThreadedLogFacility("LFThread", 8));
@@ -42,6 +74,387 @@ TEST(gpcc_log_ThreadedLogFacility_Tests, StartStop)
   spUUT->Stop();
 }
 
+TEST(gpcc_log_ThreadedLogFacility_Tests, RingIntake_Instantiation)
+{
+  std::unique_ptr<ThreadedLogFacility> spUUT(new ThreadedLogFacility("LFThread", 8, ThreadedLogFacility::IntakeMode::lockFreeRing));
+  spUUT.reset();
+}
+TEST(gpcc_log_ThreadedLogFacility_Tests, RingIntake_Instantiation_BadCapacity)
+{
+  std::unique_ptr<ThreadedLogFacility> spUUT;
+
+  ASSERT_THROW(spUUT.reset(new ThreadedLogFacility("LFThread", 7, ThreadedLogFacility::IntakeMode::lockFreeRing)), std::invalid_argument);
+}
+TEST(gpcc_log_ThreadedLogFacility_Tests, RingIntake_DestroyWithMessagesInRingAndQueue)
+{
+  // capacity 8 -> 16 slots in the ring
+  std::unique_ptr<ThreadedLogFacility> spUUT(new ThreadedLogFacility("LFThread", 8, ThreadedLogFacility::IntakeMode::lockFreeRing));
+  std::unique_ptr<Logger> spLogger(new Logger("TL1"));
+
+  spUUT->Register(*spLogger);
+  for (int i = 0; i < 20; i++)
+    spLogger->Log(LogType::Error, "Test");
+  spUUT->Unregister(*spLogger);
+
+  spUUT.reset();
+}
+TEST(gpcc_log_ThreadedLogFacility_Tests, RingIntake_RingOverflowMaintainsOrder)
+{
+  // capacity 8 -> 16 slots in the ring
+  ThreadedLogFacility uut("LFThread", 8, ThreadedLogFacility::IntakeMode::lockFreeRing);
+  Logger logger("TL1");
+  FakeBackend backend;
+
+  logger.SetLogLevel(LogLevel::DebugOrAbove);
+  uut.Register(logger);
+  ON_SCOPE_EXIT(unregLogger) { uut.Unregister(logger); };
+  uut.Register(backend);
+  ON_SCOPE_EXIT(unregBackend) { uut.Unregister(backend); };
+
+  // Fill the ring while the log facility is stopped. Errors beyond the ring's capacity are enqueued in the
+  // mutex-protected queue. Debug messages logged after that must not overtake the errors.
+  for (int i = 0; i < 8; i++)
+    logger.Log(LogType::Debug, "D" + std::to_string(i));
+  for (int i = 0; i < 12; i++)
+    logger.Log(LogType::Error, "E" + std::to_string(i));
+  logger.Log(LogType::Debug, "Dropped");
+
+  uut.Start(gpcc::osal::Thread::SchedPolicy::Other, 0, gpcc::osal::Thread::GetDefaultStackSize());
+  ON_SCOPE_EXIT(stopUUT) { uut.Stop(); };
+  uut.Flush();
+
+  ASSERT_EQ(21U, backend.records.size());
+  for (int i = 0; i < 8; i++)
+  {
+    ASSERT_TRUE(backend.records[i] == "[DEBUG] TL1: D" + std::to_string(i));
+  }
+  for (int i = 0; i < 12; i++)
+  {
+    ASSERT_TRUE(backend.records[8 + i] == "[ERROR] TL1: E" + std::to_string(i));
+  }
+  ASSERT_TRUE(backend.records[20] == "[ERROR] *** Logger: 1 not (properly) delivered message(s)! ***");
+
+  // the ring must be usable after the overflow
+  backend.records.clear();
+  logger.Log(LogType::Debug, "Test");
+  uut.Flush();
+
+  ASSERT_EQ(1U, backend.records.size());
+  ASSERT_TRUE(backend.records[0] == "[DEBUG] TL1: Test");
+}
+TEST(gpcc_log_ThreadedLogFacility_Tests, RingIntake_MultipleThreads)
+{
+  size_t const nbOfThreads = 4U;
+  size_t const nbOfMsgsPerThread = 200U;
+
+  ThreadedLogFacility uut("LFThread", nbOfThreads * nbOfMsgsPerThread, ThreadedLogFacility::IntakeMode::lockFreeRing);
+  Logger logger("TL1");
+  FakeBackend backend;
+
+  logger.SetLogLevel(LogLevel::DebugOrAbove);
+  uut.Register(logger);
+  ON_SCOPE_EXIT(unregLogger) { uut.Unregister(logger); };
+  uut.Register(backend);
+  ON_SCOPE_EXIT(unregBackend) { uut.Unregister(backend); };
+
+  uut.Start(gpcc::osal::Thread::SchedPolicy::Other, 0, gpcc::osal::Thread::GetDefaultStackSize());
+  ON_SCOPE_EXIT(stopUUT) { uut.Stop(); };
+
+  std::vector<std::unique_ptr<gpcc::osal::Thread>> threads;
+  for (size_t t = 0U; t < nbOfThreads; t++)
+  {
+    threads.emplace_back(new gpcc::osal::Thread("Producer"));
+    threads.back()->Start([&logger, t, nbOfMsgsPerThread]() -> void*
+                          {
+                            for (size_t i = 0U; i < nbOfMsgsPerThread; i++)
+                              logger.Log(LogType::Debug, std::to_string(t) + " " + std::to_string(i));
+                            return nullptr;
+                          },
+                          gpcc::osal::Thread::SchedPolicy::Other, 0, gpcc::osal::Thread::GetDefaultStackSize());
+  }
+
+  for (auto & spThread : threads)
+    spThread->Join();
+
+  uut.Flush();
+
+  // all messages must have been delivered, and the messages of each thread must be in order
+  ASSERT_EQ(nbOfThreads * nbOfMsgsPerThread, backend.records.size());
+
+  std::vector<size_t> expected(nbOfThreads, 0U);
+  for (auto const & record : backend.records)
+  {
+    std::istringstream iss(record.substr(std::string("[DEBUG] TL1: ").size()));
+    size_t t;
+    size_t i;
+    iss >> t >> i;
+    ASSERT_TRUE(t < nbOfThreads);
+    ASSERT_EQ(expected[t], i);
+    expected[t]++;
+  }
+}
+
+#if (defined(OS_LINUX_ARM) || defined(OS_LINUX_ARM_TFC) || defined(OS_LINUX_X64) || defined(OS_LINUX_X64_TFC))
+TEST(gpcc_log_ThreadedLogFacility_Tests, PerThreadBuffers_Instantiation)
+{
+  std::unique_ptr<ThreadedLogFacility> spUUT(new ThreadedLogFacility("LFThread", 8, ThreadedLogFacility::IntakeMode::perThreadBuffers));
+  spUUT.reset();
+}
+TEST(gpcc_log_ThreadedLogFacility_Tests, PerThreadBuffers_Instantiation_BadCapacity)
+{
+  std::unique_ptr<ThreadedLogFacility> spUUT;
+
+  ASSERT_THROW(spUUT.reset(new ThreadedLogFacility("LFThread", 7, ThreadedLogFacility::IntakeMode::perThreadBuffers)), std::invalid_argument);
+}
+TEST(gpcc_log_ThreadedLogFacility_Tests, PerThreadBuffers_DestroyWithMessagesInStagingBuffer)
+{
+  std::unique_ptr<ThreadedLogFacility> spUUT(new ThreadedLogFacility("LFThread", 8, ThreadedLogFacility::IntakeMode::perThreadBuffers));
+  std::unique_ptr<Logger> spLogger(new Logger("TL1"));
+
+  spUUT->Register(*spLogger);
+  for (int i = 0; i < 10; i++)
+    spLogger->Log(LogType::Error, "Test");
+  spUUT->Unregister(*spLogger);
+
+  spUUT.reset();
+
+  // The thread still refers to the staging buffer. A new log facility must get a new one.
+  spUUT.reset(new ThreadedLogFacility("LFThread", 8, ThreadedLogFacility::IntakeMode::perThreadBuffers));
+  FakeBackend backend;
+
+  spUUT->Register(*spLogger);
+  ON_SCOPE_EXIT(unregLogger) { spUUT->Unregister(*spLogger); };
+  spUUT->Register(backend);
+  ON_SCOPE_EXIT(unregBackend) { spUUT->Unregister(backend); };
+
+  spUUT->Start(gpcc::osal::Thread::SchedPolicy::Other, 0, gpcc::osal::Thread::GetDefaultStackSize());
+  ON_SCOPE_EXIT(stopUUT) { spUUT->Stop(); };
+
+  spLogger->Log(LogType::Error, "Test");
+  spUUT->Flush();
+
+  ASSERT_EQ(1U, backend.records.size());
+  ASSERT_TRUE(backend.records[0] == "[ERROR] TL1: Test");
+}
+TEST(gpcc_log_ThreadedLogFacility_Tests, PerThreadBuffers_Overflow)
+{
+  // capacity 8 -> 16 slots per staging buffer
+  ThreadedLogFacility uut("LFThread", 8, ThreadedLogFacility::IntakeMode::perThreadBuffers);
+  Logger logger("TL1");
+  FakeBackend backend;
+
+  logger.SetLogLevel(LogLevel::DebugOrAbove);
+  uut.Register(logger);
+  ON_SCOPE_EXIT(unregLogger) { uut.Unregister(logger); };
+  uut.Register(backend);
+  ON_SCOPE_EXIT(unregBackend) { uut.Unregister(backend); };
+
+  // Fill the staging buffer while the log facility is stopped.
+  for (int i = 0; i < 9; i++)
+    logger.Log(LogType::Debug, "D" + std::to_string(i));
+  for (int i = 0; i < 9; i++)
+    logger.Log(LogType::Error, "E" + std::to_string(i));
+
+  uut.Start(gpcc::osal::Thread::SchedPolicy::Other, 0, gpcc::osal::Thread::GetDefaultStackSize());
+  ON_SCOPE_EXIT(stopUUT) { uut.Stop(); };
+  uut.Flush();
+
+  // D8 and E8 are dropped
+  ASSERT_EQ(17U, backend.records.size());
+  for (int i = 0; i < 8; i++)
+  {
+    ASSERT_TRUE(backend.records[i] == "[DEBUG] TL1: D" + std::to_string(i));
+    ASSERT_TRUE(backend.records[8 + i] == "[ERROR] TL1: E" + std::to_string(i));
+  }
+  ASSERT_TRUE(backend.records[16] == "[ERROR] *** Logger: 2 not (properly) delivered message(s)! ***");
+
+  // the staging buffer must be usable after the overflow
+  backend.records.clear();
+  logger.Log(LogType::Debug, "Test");
+  uut.Flush();
+
+  ASSERT_EQ(1U, backend.records.size());
+  ASSERT_TRUE(backend.records[0] == "[DEBUG] TL1: Test");
+}
+TEST(gpcc_log_ThreadedLogFacility_Tests, PerThreadBuffers_TimestampOrder)
+{
+  ThreadedLogFacility uut("LFThread", 8, ThreadedLogFacility::IntakeMode::perThreadBuffers);
+  Logger logger("TL1");
+  FakeBackend backend;
+
+  uut.Register(logger);
+  ON_SCOPE_EXIT(unregLogger) { uut.Unregister(logger); };
+  uut.Register(backend);
+  ON_SCOPE_EXIT(unregBackend) { uut.Unregister(backend); };
+
+  auto logFromOtherThread = [&](char const * const pMsg)
+  {
+    gpcc::osal::Thread thread("Producer");
+    thread.Start([&logger, pMsg]() -> void*
+                 {
+                   logger.Log(LogType::Info, pMsg);
+                   return nullptr;
+                 },
+                 gpcc::osal::Thread::SchedPolicy::Other, 0, gpcc::osal::Thread::GetDefaultStackSize());
+    thread.Join();
+  };
+
+  // Log from different threads while the log facility is stopped. The messages end up in different staging buffers.
+  logger.Log(LogType::Info, "1");
+  gpcc::osal::Thread::Sleep_ms(1);
+  logFromOtherThread("2");
+  gpcc::osal::Thread::Sleep_ms(1);
+  logger.Log(LogType::Info, "3");
+  gpcc::osal::Thread::Sleep_ms(1);
+  logFromOtherThread("4");
+  gpcc::osal::Thread::Sleep_ms(1);
+  logger.Log(LogType::Info, "5");
+
+  uut.Start(gpcc::osal::Thread::SchedPolicy::Other, 0, gpcc::osal::Thread::GetDefaultStackSize());
+  ON_SCOPE_EXIT(stopUUT) { uut.Stop(); };
+  uut.Flush();
+
+  ASSERT_EQ(5U, backend.records.size());
+  for (int i = 0; i < 5; i++)
+  {
+    ASSERT_TRUE(backend.records[i] == "[INFO ] TL1: " + std::to_string(i + 1));
+  }
+}
+TEST(gpcc_log_ThreadedLogFacility_Tests, PerThreadBuffers_MultipleThreads)
+{
+  size_t const nbOfThreads = 4U;
+  size_t const nbOfMsgsPerThread = 200U;
+
+  ThreadedLogFacility uut("LFThread", nbOfMsgsPerThread, ThreadedLogFacility::IntakeMode::perThreadBuffers);
+  Logger logger("TL1");
+  FakeBackend backend;
+
+  logger.SetLogLevel(LogLevel::DebugOrAbove);
+  uut.Register(logger);
+  ON_SCOPE_EXIT(unregLogger) { uut.Unregister(logger); };
+  uut.Register(backend);
+  ON_SCOPE_EXIT(unregBackend) { uut.Unregister(backend); };
+
+  uut.Start(gpcc::osal::Thread::SchedPolicy::Other, 0, gpcc::osal::Thread::GetDefaultStackSize());
+  ON_SCOPE_EXIT(stopUUT) { uut.Stop(); };
+
+  // two rounds: the staging buffers of the threads of the first round are released after the threads have terminated
+  for (size_t round = 0U; round < 2U; round++)
+  {
+    backend.records.clear();
+
+    std::vector<std::unique_ptr<gpcc::osal::Thread>> threads;
+    for (size_t t = 0U; t < nbOfThreads; t++)
+    {
+      threads.emplace_back(new gpcc::osal::Thread("Producer"));
+      threads.back()->Start([&logger, t, nbOfMsgsPerThread]() -> void*
+                            {
+                              for (size_t i = 0U; i < nbOfMsgsPerThread; i++)
+                                logger.Log(LogType::Debug, std::to_string(t) + " " + std::to_string(i));
+                              return nullptr;
+                            },
+                            gpcc::osal::Thread::SchedPolicy::Other, 0, gpcc::osal::Thread::GetDefaultStackSize());
+    }
+
+    for (auto & spThread : threads)
+      spThread->Join();
+
+    uut.Flush();
+
+    // all messages must have been delivered, and the messages of each thread must be in order
+    ASSERT_EQ(nbOfThreads * nbOfMsgsPerThread, backend.records.size());
+
+    std::vector<size_t> expected(nbOfThreads, 0U);
+    for (auto const & record : backend.records)
+    {
+      std::istringstream iss(record.substr(std::string("[DEBUG] TL1: ").size()));
+      size_t t;
+      size_t i;
+      iss >> t >> i;
+      ASSERT_TRUE(t < nbOfThreads);
+      ASSERT_EQ(expected[t], i);
+      expected[t]++;
+    }
+  }
+}
+#else
+TEST(gpcc_log_ThreadedLogFacility_Tests, PerThreadBuffers_NotSupported)
+{
+  std::unique_ptr<ThreadedLogFacility> spUUT;
+
+  ASSERT_THROW(spUUT.reset(new ThreadedLogFacility("LFThread", 8, ThreadedLogFacility::IntakeMode::perThreadBuffers)), std::invalid_argument);
+}
+#endif // #if (defined(OS_LINUX_ARM) || defined(OS_LINUX_ARM_TFC) || defined(OS_LINUX_X64) || defined(OS_LINUX_X64_TFC))
+
+TEST(gpcc_log_ThreadedLogFacility_Tests, DuplicateSuppression)
+{
+  ThreadedLogFacility uut("LFThread", 8);
+  Logger logger("TL1");
+  FakeBackend backend;
+
+  logger.SetLogLevel(LogLevel::DebugOrAbove);
+  uut.Register(logger);
+  ON_SCOPE_EXIT(unregLogger) { uut.Unregister(logger); };
+  uut.Register(backend);
+  ON_SCOPE_EXIT(unregBackend) { uut.Unregister(backend); };
+
+  uut.SetDuplicateSuppression(true);
+
+  // Enqueue messages while the log facility is stopped, so that they are delivered in one batch.
+  logger.Log(LogType::Info, "A");
+  logger.Log(LogType::Info, "A");
+  logger.Log(LogType::Info, "A");
+  logger.Log(LogType::Warning, "A");
+  logger.Log(LogType::Info, "B");
+  logger.Log(LogType::Info, "C");
+  logger.Log(LogType::Info, "C");
+
+  uut.Start(gpcc::osal::Thread::SchedPolicy::Other, 0, gpcc::osal::Thread::GetDefaultStackSize());
+  ON_SCOPE_EXIT(stopUUT) { uut.Stop(); };
+  uut.Flush();
+
+  ASSERT_EQ(6U, backend.records.size());
+  ASSERT_TRUE(backend.records[0] == "[INFO ] TL1: A");
+  ASSERT_TRUE(backend.records[1] == "[INFO ] *** Logger: Last message repeated 2 time(s) ***");
+  ASSERT_TRUE(backend.records[2] == "[WARN ] TL1: A");
+  ASSERT_TRUE(backend.records[3] == "[INFO ] TL1: B");
+  ASSERT_TRUE(backend.records[4] == "[INFO ] TL1: C");
+  ASSERT_TRUE(backend.records[5] == "[INFO ] *** Logger: Last message repeated 1 time(s) ***");
+
+  // the last message is forgotten at the end of each batch
+  backend.records.clear();
+  logger.Log(LogType::Info, "C");
+  uut.Flush();
+
+  ASSERT_EQ(1U, backend.records.size());
+  ASSERT_TRUE(backend.records[0] == "[INFO ] TL1: C");
+}
+TEST(gpcc_log_ThreadedLogFacility_Tests, DuplicateSuppression_Disabled)
+{
+  ThreadedLogFacility uut("LFThread", 8);
+  Logger logger("TL1");
+  FakeBackend backend;
+
+  uut.Register(logger);
+  ON_SCOPE_EXIT(unregLogger) { uut.Unregister(logger); };
+  uut.Register(backend);
+  ON_SCOPE_EXIT(unregBackend) { uut.Unregister(backend); };
+
+  uut.SetDuplicateSuppression(true);
+  uut.SetDuplicateSuppression(false);
+
+  logger.Log(LogType::Info, "A");
+  logger.Log(LogType::Info, "A");
+
+  uut.Start(gpcc::osal::Thread::SchedPolicy::Other, 0, gpcc::osal::Thread::GetDefaultStackSize());
+  ON_SCOPE_EXIT(stopUUT) { uut.Stop(); };
+  uut.Flush();
+
+  ASSERT_EQ(2U, backend.records.size());
+  ASSERT_TRUE(backend.records[0] == "[INFO ] TL1: A");
+  ASSERT_TRUE(backend.records[1] == "[INFO ] TL1: A");
+}
+
 TEST(gpcc_log_ThreadedLogFacility_DeathTests, DestroyButLoggerNotUnregistered)
 {
   ::testing::FLAGS_gtest_death_test_style = "threadsafe";
@@ -0,0 +1,369 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#include <gpcc/stream/BufferedStreamReader.hpp>
+#include <gpcc/raii/scope_guard.hpp>
+#include <gpcc/stream/MemStreamReader.hpp>
+#include <gpcc/stream/MemStreamWriter.hpp>
+#include <gpcc/stream/stream_errors.hpp>
+#if defined(OS_LINUX_ARM) || defined(OS_LINUX_ARM_TFC) || defined(OS_LINUX_X64) || defined(OS_LINUX_X64_TFC)
+#include <gpcc/file_systems/linux_fs/FileStorage.hpp>
+#include "src/file_systems/linux_fs/internal/UnitTestDirProvider.hpp"
+#endif
+#include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <cstring>
+
+namespace gpcc_tests {
+namespace stream     {
+
+using namespace gpcc::stream;
+using namespace testing;
+
+namespace {
+
+// IStreamReader reading from a MemStreamReader. Support for RemainingBytes() is configurable and the number of calls
+// to Pop() and PopBits() is recorded.
+class FakeReader final: public StreamReaderBase
+{
+  public:
+    size_t nbOfCalls;
+
+    FakeReader(void const * const pMem, size_t const size, bool const _remainingBytesSupported)
+    : StreamReaderBase((size != 0U) ? States::open : States::empty, Endian::Little)
+    , nbOfCalls(0U)
+    , inner(pMem, size, Endian::Little)
+    , remainingBytesSupported(_remainingBytesSupported)
+    {
+    }
+
+    bool IsRemainingBytesSupported(void) const override { return remainingBytesSupported; }
+    size_t RemainingBytes(void) const override
+    {
+      if (!remainingBytesSupported)
+        throw std::logic_error("FakeReader::RemainingBytes: Operation not supported");
+      return inner.RemainingBytes();
+    }
+    void EnsureAllDataConsumed(RemainingNbOfBits const expectation) const override
+    {
+      inner.EnsureAllDataConsumed(expectation);
+    }
+    void Close(void) override
+    {
+      inner.Close();
+      state = States::closed;
+    }
+    void Skip(size_t nBits) override
+    {
+      ON_SCOPE_EXIT() { state = inner.GetState(); };
+      nbOfCalls++;
+      inner.Skip(nBits);
+    }
+    std::string Read_line(void) override
+    {
+      ON_SCOPE_EXIT() { state = inner.GetState(); };
+      nbOfCalls++;
+      return inner.Read_line();
+    }
+
+  private:
+    MemStreamReader inner;
+    bool const remainingBytesSupported;
+
+    unsigned char Pop(void) override
+    {
+      ON_SCOPE_EXIT() { state = inner.GetState(); };
+      nbOfCalls++;
+      return inner.Read_uint8();
+    }
+    void Pop(void* p, size_t n) override
+    {
+      ON_SCOPE_EXIT() { state = inner.GetState(); };
+      nbOfCalls++;
+      inner.Read_uint8(static_cast<uint8_t*>(p), n);
+    }
+    uint8_t PopBits(uint_fast8_t n) override
+    {
+      ON_SCOPE_EXIT() { state = inner.GetState(); };
+      nbOfCalls++;
+      return inner.Read_bits(n);
+    }
+};
+
+} // anonymous namespace
+
+/// Test fixture for gpcc::stream::BufferedStreamReader related tests.
+class GPCC_Stream_BufferedStreamReader_Tests: public Test
+{
+  public:
+    GPCC_Stream_BufferedStreamReader_Tests(void);
+
+  protected:
+    std::vector<uint8_t> data;
+
+    void CreateTestData(void);
+    void ReadTestData(IStreamReader & uut);
+};
+
+GPCC_Stream_BufferedStreamReader_Tests::GPCC_Stream_BufferedStreamReader_Tests(void)
+: Test()
+, data()
+{
+}
+
+// Writes a mix of data into "data". The data can be read and checked via ReadTestData().
+void GPCC_Stream_BufferedStreamReader_Tests::CreateTestData(void)
+{
+  data.resize(1024U);
+  MemStreamWriter msw(data.data(), data.size(), IStreamWriter::Endian::Little);
+
+  msw.Write_uint8(0x12U);
+  msw.Write_uint32(0xDEADBEEFUL);
+  msw.Write_Bits(static_cast<uint8_t>(0x05U), 3U);
+  msw.Write_Bits(static_cast<uint8_t>(0x7FU), 7U);
+  msw.Write_string("Hello World");
+  msw.Write_Bit(true);
+  msw.Write_char("Line1\nLine2\r\nLine3\rLine4", 24U);
+  msw.Write_uint8(0x00U);
+  msw.Write_string("");
+
+  uint64_t values[40];
+  for (size_t i = 0U; i < 40U; i++)
+    values[i] = 0x0102030405060708ULL * i;
+  msw.Write_uint64(values, 40U);
+
+  msw.Write_double(1.25);
+  msw.FillBytes(20U, 0xAAU);
+  msw.Write_uint16(0xCAFEU);
+  msw.Write_char("End", 3U);
+
+  data.resize(data.size() - msw.RemainingCapacity());
+  msw.Close();
+}
+
+// Reads and checks the data created by CreateTestData().
+void GPCC_Stream_BufferedStreamReader_Tests::ReadTestData(IStreamReader & uut)
+{
+  EXPECT_EQ(0x12U, uut.Read_uint8());
+  EXPECT_EQ(0xDEADBEEFUL, uut.Read_uint32());
+  EXPECT_EQ(0x05U, uut.Read_bits(3U));
+  EXPECT_EQ(0x7FU, uut.Read_bits(7U));
+  EXPECT_EQ("Hello World", uut.Read_string());
+  EXPECT_TRUE(uut.Read_bit());
+  EXPECT_EQ("Line1", uut.Read_line());
+  EXPECT_EQ("Line2", uut.Read_line());
+  EXPECT_EQ("Line3", uut.Read_line());
+  EXPECT_EQ("Line4", uut.Read_line());
+  EXPECT_EQ("", uut.Read_string());
+
+  uint64_t values[40];
+  uut.Read_uint64(values, 40U);
+  for (size_t i = 0U; i < 40U; i++)
+  {
+    ASSERT_EQ(0x0102030405060708ULL * i, values[i]);
+  }
+
+  EXPECT_EQ(1.25, uut.Read_double());
+  uut.Skip(20U * 8U);
+  EXPECT_EQ(0xCAFEU, uut.Read_uint16());
+  EXPECT_EQ(IStreamReader::States::open, uut.GetState());
+  EXPECT_EQ("End", uut.Read_line());
+  EXPECT_EQ(IStreamReader::States::empty, uut.GetState());
+}
+
+TEST_F(GPCC_Stream_BufferedStreamReader_Tests, Instantiation)
+{
+  uint8_t mem[4] = { 0U, 0U, 0U, 0U };
+
+  {
+    MemStreamReader msr(mem, sizeof(mem), IStreamReader::Endian::Big);
+    BufferedStreamReader uut(msr, 16U);
+    EXPECT_EQ(IStreamReader::States::open, uut.GetState());
+    EXPECT_EQ(IStreamReader::Endian::Big, uut.GetEndian());
+    EXPECT_TRUE(uut.IsRemainingBytesSupported());
+    EXPECT_EQ(4U, uut.RemainingBytes());
+    uut.Close();
+    EXPECT_EQ(IStreamReader::States::closed, uut.GetState());
+    EXPECT_EQ(IStreamReader::States::open, msr.GetState());
+  }
+
+  {
+    MemStreamReader msr(mem, sizeof(mem), IStreamReader::Endian::Little);
+    EXPECT_THROW(BufferedStreamReader uut(msr, 0U), std::invalid_argument);
+    msr.Close();
+    EXPECT_THROW(BufferedStreamReader uut(msr), ClosedError);
+  }
+
+  {
+    MemStreamReader msr(mem, 0U, IStreamReader::Endian::Little);
+    BufferedStreamReader uut(msr);
+    EXPECT_EQ(IStreamReader::States::empty, uut.GetState());
+    EXPECT_EQ(0U, uut.RemainingBytes());
+    EXPECT_THROW((void)uut.Read_uint8(), EmptyError);
+    EXPECT_EQ(IStreamReader::States::error, uut.GetState());
+  }
+}
+
+TEST_F(GPCC_Stream_BufferedStreamReader_Tests, ReadMixedData_RemainingBytesSupported)
+{
+  CreateTestData();
+
+  for (size_t bufferSize = 1U; bufferSize < 40U; bufferSize++)
+  {
+    SCOPED_TRACE(bufferSize);
+
+    FakeReader fr(data.data(), data.size(), true);
+    BufferedStreamReader uut(fr, bufferSize);
+    EXPECT_EQ(data.size(), uut.RemainingBytes());
+    ReadTestData(uut);
+    EXPECT_EQ(0U, uut.RemainingBytes());
+    uut.EnsureAllDataConsumed(IStreamReader::RemainingNbOfBits::zero);
+    uut.Close();
+  }
+}
+
+TEST_F(GPCC_Stream_BufferedStreamReader_Tests, ReadMixedData_RemainingBytesNotSupported)
+{
+  CreateTestData();
+
+  for (size_t bufferSize = 1U; bufferSize < 40U; bufferSize++)
+  {
+    SCOPED_TRACE(bufferSize);
+
+    FakeReader fr(data.data(), data.size(), false);
+    BufferedStreamReader uut(fr, bufferSize);
+    EXPECT_FALSE(uut.IsRemainingBytesSupported());
+    EXPECT_THROW((void)uut.RemainingBytes(), std::logic_error);
+    ReadTestData(uut);
+    uut.EnsureAllDataConsumed(IStreamReader::RemainingNbOfBits::zero);
+    uut.Close();
+  }
+}
+
+#if defined(OS_LINUX_ARM) || defined(OS_LINUX_ARM_TFC) || defined(OS_LINUX_X64) || defined(OS_LINUX_X64_TFC)
+TEST_F(GPCC_Stream_BufferedStreamReader_Tests, ReadMixedData_StdIOFileReader)
+{
+  using gpcc::file_systems::linux_fs::FileStorage;
+  using gpcc::file_systems::linux_fs::internal::UnitTestDirProvider;
+
+  CreateTestData();
+
+  UnitTestDirProvider testDirProvider;
+  FileStorage fs(testDirProvider.GetAbsPath());
+
+  auto spISW = fs.Create("Test.dat", false);
+  spISW->Write_uint8(data.data(), data.size());
+  spISW->Close();
+  spISW.reset();
+
+  for (size_t bufferSize : { 1U, 7U, 64U, 512U })
+  {
+    SCOPED_TRACE(bufferSize);
+
+    auto spISR = fs.Open("Test.dat");
+    BufferedStreamReader uut(*spISR, bufferSize);
+    EXPECT_TRUE(uut.IsRemainingBytesSupported());
+    EXPECT_EQ(data.size(), uut.RemainingBytes());
+    ReadTestData(uut);
+    uut.EnsureAllDataConsumed(IStreamReader::RemainingNbOfBits::zero);
+    EXPECT_EQ(IStreamReader::States::empty, spISR->GetState());
+    uut.Close();
+    spISR->Close();
+  }
+}
+#endif
+
+TEST_F(GPCC_Stream_BufferedStreamReader_Tests, NumberOfCalls)
+{
+  std::vector<uint8_t> mem(256U);
+  for (size_t i = 0U; i < mem.size(); i++)
+    mem[i] = static_cast<uint8_t>(i);
+
+  FakeReader fr(mem.data(), mem.size(), true);
+  BufferedStreamReader uut(fr, 64U);
+
+  for (size_t i = 0U; i < 128U; i++)
+  {
+    ASSERT_EQ(static_cast<uint8_t>(i), uut.Read_uint8());
+  }
+
+  EXPECT_EQ(2U, fr.nbOfCalls);
+
+  // large read bypasses the buffer
+  uint8_t dest[128];
+  uut.Read_uint8(dest, sizeof(dest));
+  EXPECT_EQ(3U, fr.nbOfCalls);
+  EXPECT_EQ(128U, dest[0]);
+  EXPECT_EQ(255U, dest[127]);
+
+  EXPECT_EQ(IStreamReader::States::empty, uut.GetState());
+}
+
+TEST_F(GPCC_Stream_BufferedStreamReader_Tests, EnsureAllDataConsumed)
+{
+  uint8_t mem[2] = { 0x12U, 0x34U };
+
+  MemStreamReader msr(mem, sizeof(mem), IStreamReader::Endian::Little);
+  BufferedStreamReader uut(msr, 1U);
+
+  uut.EnsureAllDataConsumed(IStreamReader::RemainingNbOfBits::moreThanSeven);
+  EXPECT_THROW(uut.EnsureAllDataConsumed(IStreamReader::RemainingNbOfBits::sevenOrLess), RemainingBitsError);
+
+  (void)uut.Read_uint8();
+  (void)uut.Read_bits(5U);
+
+  uut.EnsureAllDataConsumed(IStreamReader::RemainingNbOfBits::three);
+  uut.EnsureAllDataConsumed(IStreamReader::RemainingNbOfBits::sevenOrLess);
+  EXPECT_THROW(uut.EnsureAllDataConsumed(IStreamReader::RemainingNbOfBits::moreThanSeven), RemainingBitsError);
+  EXPECT_THROW(uut.EnsureAllDataConsumed(IStreamReader::RemainingNbOfBits::zero), RemainingBitsError);
+
+  EXPECT_EQ(0x01U, uut.Read_bits(3U));
+  EXPECT_EQ(IStreamReader::States::empty, uut.GetState());
+}
+
+TEST_F(GPCC_Stream_BufferedStreamReader_Tests, ReadBeyondEnd)
+{
+  uint8_t mem[8] = { 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U };
+
+  {
+    MemStreamReader msr(mem, sizeof(mem), IStreamReader::Endian::Little);
+    BufferedStreamReader uut(msr, 4U);
+    (void)uut.Read_uint8();
+
+    uint8_t dest[8];
+    EXPECT_THROW(uut.Read_uint8(dest, 8U), EmptyError);
+    EXPECT_EQ(IStreamReader::States::error, uut.GetState());
+    EXPECT_THROW((void)uut.Read_uint8(), ErrorStateError);
+  }
+
+  {
+    FakeReader fr(mem, sizeof(mem), false);
+    BufferedStreamReader uut(fr, 4U);
+    (void)uut.Read_uint32();
+
+    // no null-terminator
+    EXPECT_THROW((void)uut.Read_string(), EmptyError);
+    EXPECT_EQ(IStreamReader::States::error, uut.GetState());
+  }
+
+  {
+    FakeReader fr(mem, sizeof(mem), false);
+    BufferedStreamReader uut(fr, 3U);
+
+    EXPECT_THROW(uut.Skip(65U), EmptyError);
+    EXPECT_EQ(IStreamReader::States::error, uut.GetState());
+  }
+}
+
+} // namespace stream
+} // namespace gpcc_tests
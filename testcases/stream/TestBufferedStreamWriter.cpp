@@ -0,0 +1,220 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#include <gpcc/stream/BufferedStreamWriter.hpp>
+#include <gpcc/stream/MemStreamWriter.hpp>
+#include <gpcc/stream/SegmentedStreamWriter.hpp>
+#include <gpcc/stream/SegmentPool.hpp>
+#include <gpcc/stream/stream_errors.hpp>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+#include <cstring>
+
+namespace gpcc_tests {
+namespace stream     {
+
+using namespace gpcc::stream;
+using namespace testing;
+
+/// Test fixture for gpcc::stream::BufferedStreamWriter related tests.
+class GPCC_Stream_BufferedStreamWriter_Tests: public Test
+{
+  public:
+    GPCC_Stream_BufferedStreamWriter_Tests(void);
+
+  protected:
+    uint8_t memory[1024];
+
+    void SetUp(void) override;
+
+    static void WriteTestData(IStreamWriter & uut);
+};
+
+GPCC_Stream_BufferedStreamWriter_Tests::GPCC_Stream_BufferedStreamWriter_Tests(void)
+: Test()
+, memory()
+{
+}
+
+void GPCC_Stream_BufferedStreamWriter_Tests::SetUp(void)
+{
+  memset(memory, 0xFF, sizeof(memory));
+}
+
+// Writes a mix of data into the given stream.
+void GPCC_Stream_BufferedStreamWriter_Tests::WriteTestData(IStreamWriter & uut)
+{
+  uut.Write_uint8(0x12U);
+  uut.Write_uint32(0xDEADBEEFUL);
+  uut.Write_Bits(static_cast<uint8_t>(0x05U), 3U);
+  uut.Write_Bits(static_cast<uint8_t>(0x7FU), 7U);
+  uut.Write_string("Hello World");
+  uut.Write_Bit(true);
+  uut.Write_line("Line1");
+
+  uint64_t values[40];
+  for (size_t i = 0U; i < 40U; i++)
+    values[i] = 0x0102030405060708ULL * i;
+  uut.Write_uint64(values, 40U);
+
+  uut.Write_double(1.25);
+  uut.FillBits(13U, true);
+  uut.FillBytes(20U, 0xAAU);
+  uut.Write_uint16(0xCAFEU);
+  uut.Write_Bits(static_cast<uint8_t>(0x03U), 2U);
+}
+
+TEST_F(GPCC_Stream_BufferedStreamWriter_Tests, Instantiation)
+{
+  MemStreamWriter msw(memory, 8U, IStreamWriter::Endian::Big);
+
+  {
+    BufferedStreamWriter uut(msw, 16U);
+    EXPECT_EQ(IStreamWriter::States::open, uut.GetState());
+    EXPECT_EQ(IStreamWriter::Endian::Big, uut.GetEndian());
+    EXPECT_TRUE(uut.IsRemainingCapacitySupported());
+    EXPECT_EQ(8U, uut.RemainingCapacity());
+    EXPECT_EQ(0U, uut.GetNbOfCachedBits());
+    uut.Close();
+    EXPECT_EQ(IStreamWriter::States::closed, uut.GetState());
+  }
+
+  EXPECT_EQ(IStreamWriter::States::open, msw.GetState());
+
+  EXPECT_THROW(BufferedStreamWriter uut(msw, 0U), std::invalid_argument);
+
+  msw.Write_Bit(true);
+  EXPECT_THROW(BufferedStreamWriter uut(msw), std::invalid_argument);
+
+  msw.Close();
+  EXPECT_THROW(BufferedStreamWriter uut(msw), ClosedError);
+}
+
+TEST_F(GPCC_Stream_BufferedStreamWriter_Tests, WriteMixedData)
+{
+  // reference
+  uint8_t expected[sizeof(memory)];
+  memset(expected, 0xFF, sizeof(expected));
+  MemStreamWriter ref(expected, sizeof(expected), IStreamWriter::Endian::Little);
+  WriteTestData(ref);
+  size_t const expectedSize = sizeof(expected) - ref.RemainingCapacity() + 1U;
+  ref.Close();
+
+  for (size_t bufferSize = 1U; bufferSize < 40U; bufferSize++)
+  {
+    SCOPED_TRACE(bufferSize);
+    memset(memory, 0xFF, sizeof(memory));
+
+    MemStreamWriter msw(memory, sizeof(memory), IStreamWriter::Endian::Little);
+    BufferedStreamWriter uut(msw, bufferSize);
+    WriteTestData(uut);
+    EXPECT_EQ(sizeof(memory) - expectedSize + 1U, uut.RemainingCapacity());
+    EXPECT_EQ(2U, uut.GetNbOfCachedBits());
+    uut.Close();
+
+    // cached bits have been passed to the decorated stream
+    EXPECT_EQ(2U, msw.GetNbOfCachedBits());
+    msw.Close();
+
+    ASSERT_TRUE(memcmp(memory, expected, sizeof(memory)) == 0);
+  }
+}
+
+TEST_F(GPCC_Stream_BufferedStreamWriter_Tests, RemainingCapacityNotSupported)
+{
+  SegmentPool pool(16U, 0U);
+  SegmentedStreamWriter ssw(pool, IStreamWriter::Endian::Little);
+
+  BufferedStreamWriter uut(ssw, 8U);
+  EXPECT_FALSE(uut.IsRemainingCapacitySupported());
+  EXPECT_THROW((void)uut.RemainingCapacity(), std::logic_error);
+
+  WriteTestData(uut);
+  uut.Close();
+  ssw.Close();
+
+  MemStreamWriter ref(memory, sizeof(memory), IStreamWriter::Endian::Little);
+  WriteTestData(ref);
+  size_t const expectedSize = sizeof(memory) - ref.RemainingCapacity() + 1U;
+  ref.Close();
+
+  auto const data = ssw.Flatten();
+  ASSERT_EQ(expectedSize, data.size());
+  EXPECT_TRUE(memcmp(memory, data.data(), expectedSize) == 0);
+}
+
+TEST_F(GPCC_Stream_BufferedStreamWriter_Tests, Flush)
+{
+  MemStreamWriter msw(memory, sizeof(memory), IStreamWriter::Endian::Little);
+  BufferedStreamWriter uut(msw, 16U);
+
+  uut.Write_uint32(0x12345678UL);
+  uut.Write_Bits(static_cast<uint8_t>(0x01U), 1U);
+
+  // data is still buffered
+  EXPECT_EQ(sizeof(memory), msw.RemainingCapacity());
+  EXPECT_EQ(sizeof(memory) - 4U, uut.RemainingCapacity());
+
+  // flush does not write cached bits
+  uut.Flush();
+  EXPECT_EQ(sizeof(memory) - 4U, msw.RemainingCapacity());
+  EXPECT_EQ(0U, msw.GetNbOfCachedBits());
+  EXPECT_EQ(1U, uut.GetNbOfCachedBits());
+
+  uut.Close();
+  EXPECT_THROW(uut.Flush(), ClosedError);
+  msw.Close();
+
+  uint8_t const expected[] = { 0x78U, 0x56U, 0x34U, 0x12U, 0x01U, 0xFFU };
+  EXPECT_TRUE(memcmp(memory, expected, sizeof(expected)) == 0);
+}
+
+TEST_F(GPCC_Stream_BufferedStreamWriter_Tests, Full)
+{
+  MemStreamWriter msw(memory, 6U, IStreamWriter::Endian::Little);
+  BufferedStreamWriter uut(msw, 16U);
+
+  uut.Write_uint32(0x12345678UL);
+  uut.Write_uint8(0xABU);
+  uut.Write_Bits(static_cast<uint8_t>(0x0FU), 4U);
+  EXPECT_EQ(IStreamWriter::States::open, uut.GetState());
+  uut.Write_Bits(static_cast<uint8_t>(0x0FU), 4U);
+  EXPECT_EQ(IStreamWriter::States::full, uut.GetState());
+  EXPECT_EQ(0U, uut.RemainingCapacity());
+
+  EXPECT_THROW(uut.Write_uint8(0U), FullError);
+  EXPECT_EQ(IStreamWriter::States::error, uut.GetState());
+
+  uut.Close();
+  EXPECT_EQ(IStreamWriter::States::closed, uut.GetState());
+
+  // buffered data has been discarded
+  EXPECT_EQ(6U, msw.RemainingCapacity());
+  msw.Close();
+}
+
+TEST_F(GPCC_Stream_BufferedStreamWriter_Tests, WriteBeyondCapacity)
+{
+  MemStreamWriter msw(memory, 6U, IStreamWriter::Endian::Little);
+  BufferedStreamWriter uut(msw, 2U);
+
+  uut.Write_uint8(0x01U);
+
+  uint8_t const data[6] = { 0U, 0U, 0U, 0U, 0U, 0U };
+  EXPECT_THROW(uut.Write_uint8(data, 6U), FullError);
+  EXPECT_EQ(IStreamWriter::States::error, uut.GetState());
+
+  uut.Close();
+  msw.Close();
+}
+
+} // namespace stream
+} // namespace gpcc_tests
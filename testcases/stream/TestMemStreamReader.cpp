@@ -1420,6 +1420,70 @@ TEST_F(GPCC_Stream_MemStreamReader_Tests, ReadMultipleElements)
 
   ASSERT_EQ(IStreamReader::States::closed, uut.GetState());
 }
+TEST_F(GPCC_Stream_MemStreamReader_Tests, ReadLargeArrays)
+{
+  // Arrays larger than any internal buffer used for byte swapping are written and read in both byte orders.
+
+  uint16_t data_u16[300];
+  uint32_t data_u32[300];
+  uint64_t data_u64[300];
+  double   data_double[300];
+  for (size_t i = 0U; i < 300U; i++)
+  {
+    data_u16[i] = static_cast<uint16_t>(0x0102U + i);
+    data_u32[i] = 0x01020304UL + i;
+    data_u64[i] = 0x0102030405060708ULL + i;
+    data_double[i] = -1.5 * i;
+  }
+
+  std::unique_ptr<uint8_t[]> spMem(new uint8_t[300U * 22U]);
+
+  for (bool const little : { true, false })
+  {
+    MemStreamWriter writer(spMem.get(), 300U * 22U, little ? IStreamWriter::Endian::Little : IStreamWriter::Endian::Big);
+    writer.Write_uint16(data_u16, 300U);
+    writer.Write_uint32(data_u32, 300U);
+    writer.Write_uint64(data_u64, 300U);
+    writer.Write_double(data_double, 300U);
+    ASSERT_EQ(0U, writer.RemainingCapacity());
+    writer.Close();
+
+    // check byte order of the first and last uint16_t
+    if (little)
+    {
+      EXPECT_EQ(0x02U, spMem[0]);
+      EXPECT_EQ(0x01U, spMem[1]);
+      EXPECT_EQ(0x2DU, spMem[598]);
+      EXPECT_EQ(0x02U, spMem[599]);
+    }
+    else
+    {
+      EXPECT_EQ(0x01U, spMem[0]);
+      EXPECT_EQ(0x02U, spMem[1]);
+      EXPECT_EQ(0x02U, spMem[598]);
+      EXPECT_EQ(0x2DU, spMem[599]);
+    }
+
+    uint16_t read_data_u16[300];
+    uint32_t read_data_u32[300];
+    uint64_t read_data_u64[300];
+    double   read_data_double[300];
+
+    MemStreamReader reader(spMem.get(), 300U * 22U, little ? IStreamReader::Endian::Little : IStreamReader::Endian::Big);
+    reader.Read_uint16(read_data_u16, 300U);
+    reader.Read_uint32(read_data_u32, 300U);
+    reader.Read_uint64(read_data_u64, 300U);
+    reader.Read_double(read_data_double, 300U);
+    ASSERT_EQ(IStreamReader::States::empty, reader.GetState());
+    reader.Close();
+
+    EXPECT_TRUE(memcmp(data_u16, read_data_u16, sizeof(data_u16)) == 0);
+    EXPECT_TRUE(memcmp(data_u32, read_data_u32, sizeof(data_u32)) == 0);
+    EXPECT_TRUE(memcmp(data_u64, read_data_u64, sizeof(data_u64)) == 0);
+    EXPECT_TRUE(memcmp(data_double, read_data_double, sizeof(data_double)) == 0);
+  }
+}
+
 TEST_F(GPCC_Stream_MemStreamReader_Tests, ReadBits_UpperZero)
 {
   memory[0] = 0x1F;
@@ -3483,6 +3547,88 @@ TEST_F(GPCC_Stream_MemStreamReader_Tests, EnsureAllDataConsumed_ClosedState)
   EXPECT_THROW(uut.EnsureAllDataConsumed(IStreamReader::RemainingNbOfBits::moreThanSeven), ClosedError);
   EXPECT_THROW(uut.EnsureAllDataConsumed(IStreamReader::RemainingNbOfBits::any), ClosedError);
 }
+TEST_F(GPCC_Stream_MemStreamReader_Tests, PeekAndReadSpan_OK)
+{
+  for (uint_fast8_t i = 0U; i < 8U; i++)
+    memory[i] = i;
+
+  MemStreamReader uut(memory, 8U, IStreamReader::Endian::Little);
+
+  EXPECT_TRUE(uut.PeekSpan(0U) == nullptr);
+  EXPECT_TRUE(uut.ReadSpan(0U) == nullptr);
+
+  ASSERT_EQ(0U, uut.Read_uint8());
+
+  // peek does not modify the stream
+  EXPECT_EQ(&memory[1], uut.PeekSpan(7U));
+  EXPECT_EQ(&memory[1], uut.PeekSpan(3U));
+  ASSERT_EQ(7U, uut.RemainingBytes());
+
+  EXPECT_EQ(&memory[1], uut.ReadSpan(3U));
+  ASSERT_EQ(4U, uut.RemainingBytes());
+
+  ASSERT_EQ(4U, uut.Read_uint8());
+
+  EXPECT_EQ(&memory[5], uut.ReadSpan(3U));
+  ASSERT_EQ(IStreamReader::States::empty, uut.GetState());
+
+  EXPECT_TRUE(uut.PeekSpan(0U) == nullptr);
+  EXPECT_TRUE(uut.ReadSpan(0U) == nullptr);
+  ASSERT_EQ(IStreamReader::States::empty, uut.GetState());
+}
+TEST_F(GPCC_Stream_MemStreamReader_Tests, PeekAndReadSpan_BitsDiscarded)
+{
+  memory[0] = 0xFFU;
+  memory[1] = 0x12U;
+
+  MemStreamReader uut(memory, 2U, IStreamReader::Endian::Little);
+
+  ASSERT_EQ(0x07U, uut.Read_bits(3U));
+
+  // peek points to the byte behind the current read byte and does not discard any bits
+  EXPECT_EQ(&memory[1], uut.PeekSpan(1U));
+  ASSERT_EQ(1U, uut.RemainingBytes());
+  uut.EnsureAllDataConsumed(IStreamReader::RemainingNbOfBits::moreThanSeven);
+
+  // read discards any bits
+  EXPECT_EQ(&memory[1], uut.ReadSpan(1U));
+  ASSERT_EQ(IStreamReader::States::empty, uut.GetState());
+}
+TEST_F(GPCC_Stream_MemStreamReader_Tests, ReadSpan_ZeroDiscardsBits)
+{
+  memory[0] = 0xFFU;
+
+  MemStreamReader uut(memory, 1U, IStreamReader::Endian::Little);
+
+  ASSERT_EQ(0x07U, uut.Read_bits(3U));
+  ASSERT_EQ(IStreamReader::States::open, uut.GetState());
+
+  EXPECT_TRUE(uut.ReadSpan(0U) == nullptr);
+  ASSERT_EQ(IStreamReader::States::empty, uut.GetState());
+}
+TEST_F(GPCC_Stream_MemStreamReader_Tests, PeekAndReadSpan_NotEnoughData)
+{
+  MemStreamReader uut(memory, 4U, IStreamReader::Endian::Little);
+
+  EXPECT_THROW((void)uut.PeekSpan(5U), EmptyError);
+  EXPECT_THROW((void)uut.ReadSpan(5U), EmptyError);
+
+  // stream is not modified
+  ASSERT_EQ(IStreamReader::States::open, uut.GetState());
+  ASSERT_EQ(4U, uut.RemainingBytes());
+
+  (void)uut.ReadSpan(4U);
+  ASSERT_EQ(IStreamReader::States::empty, uut.GetState());
+
+  EXPECT_THROW((void)uut.PeekSpan(1U), EmptyError);
+  EXPECT_THROW((void)uut.ReadSpan(1U), EmptyError);
+  ASSERT_EQ(IStreamReader::States::empty, uut.GetState());
+
+  uut.Close();
+
+  EXPECT_THROW((void)uut.PeekSpan(0U), ClosedError);
+  EXPECT_THROW((void)uut.ReadSpan(0U), ClosedError);
+}
 
 } // namespace stream
 } // namespace gpcc_tests
@@ -1845,6 +1845,88 @@ TEST_F(GPCC_Stream_MemStreamWriter_Tests, CopyAssignment)
   EXPECT_EQ(IStreamWriter::Endian::Little, uut2.GetEndian());
   EXPECT_EQ(sizeof(memory), uut2.RemainingCapacity());
 }
+TEST_F(GPCC_Stream_MemStreamWriter_Tests, ReserveSpan_OK)
+{
+  MemStreamWriter uut(memory, 8U, IStreamWriter::Endian::Little);
+
+  uut.Write_uint8(0x12U);
+
+  uint8_t * p = static_cast<uint8_t*>(uut.ReserveSpan(3U));
+  ASSERT_EQ(&memory[1], p);
+  p[0] = 0xAAU;
+  p[1] = 0xBBU;
+  p[2] = 0xCCU;
+
+  ASSERT_EQ(4U, uut.RemainingCapacity());
+
+  uut.Write_uint8(0x34U);
+
+  EXPECT_TRUE(uut.ReserveSpan(0U) == nullptr);
+
+  p = static_cast<uint8_t*>(uut.ReserveSpan(3U));
+  ASSERT_EQ(&memory[5], p);
+  p[0] = 0x01U;
+  p[1] = 0x02U;
+  p[2] = 0x03U;
+
+  ASSERT_EQ(IStreamWriter::States::full, uut.GetState());
+  EXPECT_TRUE(uut.ReserveSpan(0U) == nullptr);
+  EXPECT_EQ(IStreamWriter::States::full, uut.GetState());
+
+  uut.Close();
+
+  uint8_t const expected[] = { 0x12U, 0xAAU, 0xBBU, 0xCCU, 0x34U, 0x01U, 0x02U, 0x03U, 0xFFU };
+  ASSERT_TRUE(compare_memory(expected, sizeof(expected)));
+}
+TEST_F(GPCC_Stream_MemStreamWriter_Tests, ReserveSpan_CachedBits)
+{
+  MemStreamWriter uut(memory, 4U, IStreamWriter::Endian::Little);
+
+  uut.Write_Bits(static_cast<uint8_t>(0x05U), 3U);
+
+  // capacity is not sufficient due to cached bits
+  EXPECT_THROW((void)uut.ReserveSpan(4U), FullError);
+  ASSERT_EQ(IStreamWriter::States::open, uut.GetState());
+  ASSERT_EQ(3U, uut.GetNbOfCachedBits());
+  ASSERT_EQ(4U, uut.RemainingCapacity());
+
+  // cached bits are written first
+  uint8_t * const p = static_cast<uint8_t*>(uut.ReserveSpan(3U));
+  ASSERT_EQ(&memory[1], p);
+  ASSERT_EQ(0U, uut.GetNbOfCachedBits());
+  ASSERT_EQ(IStreamWriter::States::full, uut.GetState());
+  p[0] = 0xAAU;
+  p[1] = 0xBBU;
+  p[2] = 0xCCU;
+
+  uut.Close();
+
+  uint8_t const expected[] = { 0x05U, 0xAAU, 0xBBU, 0xCCU, 0xFFU };
+  ASSERT_TRUE(compare_memory(expected, sizeof(expected)));
+}
+TEST_F(GPCC_Stream_MemStreamWriter_Tests, ReserveSpan_InsufficientCapacity)
+{
+  MemStreamWriter uut(memory, 4U, IStreamWriter::Endian::Little);
+
+  EXPECT_THROW((void)uut.ReserveSpan(5U), FullError);
+
+  // stream is not modified
+  ASSERT_EQ(IStreamWriter::States::open, uut.GetState());
+  ASSERT_EQ(4U, uut.RemainingCapacity());
+
+  uut.Write_uint32(0x12345678UL);
+  ASSERT_EQ(IStreamWriter::States::full, uut.GetState());
+
+  EXPECT_THROW((void)uut.ReserveSpan(1U), FullError);
+  ASSERT_EQ(IStreamWriter::States::full, uut.GetState());
+
+  uut.Close();
+
+  EXPECT_THROW((void)uut.ReserveSpan(0U), ClosedError);
+
+  uint8_t const expected[] = { 0x78U, 0x56U, 0x34U, 0x12U, 0xFFU };
+  ASSERT_TRUE(compare_memory(expected, sizeof(expected)));
+}
 
 } // namespace stream
 } // namespace gpcc_tests
@@ -0,0 +1,241 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#include <gpcc/stream/SegmentedStreamWriter.hpp>
+#include <gpcc/stream/MemStreamReader.hpp>
+#include <gpcc/stream/SegmentPool.hpp>
+#include <gpcc/stream/stream_errors.hpp>
+#include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+#include <cstring>
+
+namespace gpcc_tests {
+namespace stream     {
+
+using namespace gpcc::stream;
+using namespace testing;
+
+/// Test fixture for gpcc::stream::SegmentedStreamWriter related tests.
+class GPCC_Stream_SegmentedStreamWriter_Tests: public Test
+{
+  public:
+    GPCC_Stream_SegmentedStreamWriter_Tests(void);
+
+  protected:
+    static constexpr size_t segmentSize = 8U;
+
+    SegmentPool pool;
+
+    std::vector<uint8_t> Concatenate(std::vector<SegmentedStreamWriter::Chunk> const & list);
+};
+
+GPCC_Stream_SegmentedStreamWriter_Tests::GPCC_Stream_SegmentedStreamWriter_Tests(void)
+: Test()
+, pool(segmentSize, 4U)
+{
+}
+
+// Concatenates the chunks of a gather list.
+std::vector<uint8_t>
+GPCC_Stream_SegmentedStreamWriter_Tests::Concatenate(std::vector<SegmentedStreamWriter::Chunk> const & list)
+{
+  std::vector<uint8_t> v;
+  for (auto const & chunk : list)
+  {
+    uint8_t const * const p = static_cast<uint8_t const*>(chunk.pData);
+    v.insert(v.end(), p, p + chunk.size);
+  }
+  return v;
+}
+
+TEST(GPCC_Stream_SegmentPool_Tests, Instantiation)
+{
+  EXPECT_THROW(SegmentPool uut(0U, 4U), std::invalid_argument);
+
+  SegmentPool uut(16U, 4U);
+  EXPECT_EQ(16U, uut.GetSegmentSize());
+  EXPECT_EQ(0U, uut.GetNbOfCachedSegments());
+}
+
+TEST_F(GPCC_Stream_SegmentedStreamWriter_Tests, Instantiation)
+{
+  SegmentedStreamWriter uut(pool, IStreamWriter::Endian::Little);
+
+  EXPECT_EQ(IStreamWriter::States::open, uut.GetState());
+  EXPECT_EQ(IStreamWriter::Endian::Little, uut.GetEndian());
+  EXPECT_FALSE(uut.IsRemainingCapacitySupported());
+  EXPECT_THROW((void)uut.RemainingCapacity(), std::logic_error);
+  EXPECT_EQ(0U, uut.GetNbOfCachedBits());
+  EXPECT_EQ(0U, uut.GetSize());
+  EXPECT_TRUE(uut.GetGatherList().empty());
+  EXPECT_TRUE(uut.Flatten().empty());
+
+  uut.Close();
+  EXPECT_EQ(IStreamWriter::States::closed, uut.GetState());
+  EXPECT_EQ(0U, uut.GetSize());
+}
+
+TEST_F(GPCC_Stream_SegmentedStreamWriter_Tests, WriteAcrossSegments)
+{
+  std::vector<uint8_t> expected;
+
+  {
+    SegmentedStreamWriter uut(pool, IStreamWriter::Endian::Big);
+
+    for (uint_fast8_t i = 0U; i < 5U; i++)
+    {
+      uut.Write_uint8(i);
+      expected.push_back(i);
+    }
+
+    uint8_t data[19];
+    for (uint_fast8_t i = 0U; i < sizeof(data); i++)
+      data[i] = 0x80U + i;
+    uut.Write_uint8(data, sizeof(data));
+    expected.insert(expected.end(), data, data + sizeof(data));
+
+    uut.Write_uint32(0x12345678UL);
+    expected.insert(expected.end(), { 0x12U, 0x34U, 0x56U, 0x78U });
+
+    uut.Close();
+
+    ASSERT_EQ(28U, uut.GetSize());
+
+    auto const list = uut.GetGatherList();
+    ASSERT_EQ(4U, list.size());
+    EXPECT_EQ(segmentSize, list[0].size);
+    EXPECT_EQ(segmentSize, list[1].size);
+    EXPECT_EQ(segmentSize, list[2].size);
+    EXPECT_EQ(4U, list[3].size);
+
+    EXPECT_TRUE(Concatenate(list) == expected);
+    EXPECT_TRUE(uut.Flatten() == expected);
+
+    uint8_t buffer[30];
+    memset(buffer, 0xFF, sizeof(buffer));
+    EXPECT_THROW(uut.Flatten(buffer, 27U), std::invalid_argument);
+    uut.Flatten(buffer, sizeof(buffer));
+    EXPECT_TRUE(memcmp(buffer, expected.data(), expected.size()) == 0);
+    EXPECT_EQ(0xFFU, buffer[28]);
+  }
+
+  // all segments have been returned to the pool
+  EXPECT_EQ(4U, pool.GetNbOfCachedSegments());
+}
+
+TEST_F(GPCC_Stream_SegmentedStreamWriter_Tests, SegmentsAreReused)
+{
+  {
+    SegmentedStreamWriter uut(pool, IStreamWriter::Endian::Little);
+    uut.FillBytes(6U * segmentSize, 0xAAU);
+    uut.Close();
+  }
+
+  // the pool keeps up to 4 segments
+  ASSERT_EQ(4U, pool.GetNbOfCachedSegments());
+
+  {
+    SegmentedStreamWriter uut(pool, IStreamWriter::Endian::Little);
+    uut.FillBytes(segmentSize + 1U, 0x55U);
+    EXPECT_EQ(2U, pool.GetNbOfCachedSegments());
+
+    uut.Close();
+    auto const data = uut.Flatten();
+    ASSERT_EQ(segmentSize + 1U, data.size());
+    for (auto const b : data)
+    {
+      ASSERT_EQ(0x55U, b);
+    }
+  }
+
+  EXPECT_EQ(4U, pool.GetNbOfCachedSegments());
+}
+
+TEST_F(GPCC_Stream_SegmentedStreamWriter_Tests, Bits)
+{
+  SegmentedStreamWriter uut(pool, IStreamWriter::Endian::Little);
+
+  // fill the first segment up to the last byte
+  uut.FillBytes(segmentSize - 1U, 0x00U);
+
+  uut.Write_Bits(static_cast<uint8_t>(0x05U), 3U);
+  EXPECT_EQ(3U, uut.GetNbOfCachedBits());
+  EXPECT_EQ(segmentSize - 1U, uut.GetSize());
+
+  // completes the byte and leaves 3 bits cached, which require a second segment
+  uut.Write_Bits(static_cast<uint8_t>(0x3FU), 8U);
+  EXPECT_EQ(3U, uut.GetNbOfCachedBits());
+  EXPECT_EQ(segmentSize, uut.GetSize());
+
+  // cached bits are written before byte-based data
+  uut.Write_uint8(0xABU);
+  EXPECT_EQ(0U, uut.GetNbOfCachedBits());
+
+  uut.Write_Bit(true);
+
+  // close writes remaining bits
+  uut.Close();
+
+  auto const data = uut.Flatten();
+  ASSERT_EQ(segmentSize + 3U, data.size());
+  EXPECT_EQ(0xFDU, data[segmentSize - 1U]);
+  EXPECT_EQ(0x01U, data[segmentSize]);
+  EXPECT_EQ(0xABU, data[segmentSize + 1U]);
+  EXPECT_EQ(0x01U, data[segmentSize + 2U]);
+}
+
+TEST_F(GPCC_Stream_SegmentedStreamWriter_Tests, RoundTrip)
+{
+  SegmentedStreamWriter uut(pool, IStreamWriter::Endian::Big);
+
+  uint64_t values[10];
+  for (size_t i = 0U; i < 10U; i++)
+    values[i] = 0x0102030405060708ULL * (i + 1U);
+
+  uut.Write_uint64(values, 10U);
+  uut.Write_string("Text");
+  uut.Write_double(3.5);
+  uut.Close();
+
+  auto const data = uut.Flatten();
+  MemStreamReader reader(data.data(), data.size(), IStreamReader::Endian::Big);
+
+  uint64_t readValues[10];
+  reader.Read_uint64(readValues, 10U);
+  EXPECT_TRUE(memcmp(values, readValues, sizeof(values)) == 0);
+  EXPECT_EQ("Text", reader.Read_string());
+  EXPECT_EQ(3.5, reader.Read_double());
+  EXPECT_EQ(IStreamReader::States::empty, reader.GetState());
+  reader.Close();
+}
+
+TEST_F(GPCC_Stream_SegmentedStreamWriter_Tests, Closed)
+{
+  SegmentedStreamWriter uut(pool, IStreamWriter::Endian::Little);
+  uut.Write_uint16(0x1234U);
+  uut.Close();
+  uut.Close();
+
+  EXPECT_THROW(uut.Write_uint8(0U), ClosedError);
+  EXPECT_THROW(uut.Write_Bit(true), ClosedError);
+  EXPECT_THROW((void)uut.GetNbOfCachedBits(), ClosedError);
+  EXPECT_THROW((void)uut.RemainingCapacity(), ClosedError);
+
+  // data is still accessible
+  EXPECT_EQ(2U, uut.GetSize());
+  auto const list = uut.GetGatherList();
+  ASSERT_EQ(1U, list.size());
+  EXPECT_EQ(2U, list[0].size);
+}
+
+} // namespace stream
+} // namespace gpcc_tests
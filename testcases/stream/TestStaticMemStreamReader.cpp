@@ -0,0 +1,304 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#include <gpcc/stream/StaticMemStreamReader.hpp>
+#include <gpcc/stream/StaticStreamReaderAdapter.hpp>
+#include <gpcc/stream/MemStreamWriter.hpp>
+#include <gpcc/stream/stream_errors.hpp>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <cstring>
+
+namespace gpcc_tests {
+namespace stream     {
+
+using namespace gpcc::stream;
+using namespace testing;
+
+/// Test fixture for gpcc::stream::StaticMemStreamReader related tests.
+class GPCC_Stream_StaticMemStreamReader_Tests: public Test
+{
+  public:
+    GPCC_Stream_StaticMemStreamReader_Tests(void);
+
+  protected:
+    uint8_t memory[256];
+    size_t n;
+
+    void SetUp(void) override;
+
+    void CreateTestData(IStreamWriter::Endian const endian);
+
+    template<class READER>
+    static void ReadTestData(READER & uut);
+};
+
+GPCC_Stream_StaticMemStreamReader_Tests::GPCC_Stream_StaticMemStreamReader_Tests(void)
+: Test()
+, memory()
+, n(0)
+{
+}
+
+void GPCC_Stream_StaticMemStreamReader_Tests::SetUp(void)
+{
+  memset(memory, 0xFF, sizeof(memory));
+}
+
+// Writes a mix of data into "memory" using a MemStreamWriter. "n" is set to the number of bytes written.
+void GPCC_Stream_StaticMemStreamReader_Tests::CreateTestData(IStreamWriter::Endian const endian)
+{
+  MemStreamWriter msw(memory, sizeof(memory), endian);
+
+  msw.Write_uint8(0x12U);
+  msw.Write_uint16(0xCAFEU);
+  msw.Write_uint32(0xDEADBEEFUL);
+  msw.Write_uint64(0x0123456789ABCDEFULL);
+  msw.Write_int8(-5);
+  msw.Write_int16(-1000);
+  msw.Write_int32(-100000L);
+  msw.Write_int64(-10000000000LL);
+  msw.Write_float(1.5F);
+  msw.Write_double(-2.25);
+  msw.Write_Bits(static_cast<uint8_t>(0x05U), 3U);
+  msw.Write_Bit(true);
+  msw.Write_char('X');
+  msw.Write_string("Hello");
+  msw.Write_line("Line1");
+
+  uint16_t const u16[3] = { 0x0102U, 0x0304U, 0x0506U };
+  msw.Write_uint16(u16, 3U);
+  uint32_t const u32[2] = { 0x01020304UL, 0x05060708UL };
+  msw.Write_uint32(u32, 2U);
+  double const dbl[2] = { 0.5, -0.125 };
+  msw.Write_double(dbl, 2U);
+
+  msw.Write_Bits(static_cast<uint8_t>(0x0AU), 4U);
+
+  n = sizeof(memory) - msw.RemainingCapacity() + 1U;
+  msw.Close();
+}
+
+// Reads the data written by CreateTestData() from "uut" and checks it.
+template<class READER>
+void GPCC_Stream_StaticMemStreamReader_Tests::ReadTestData(READER & uut)
+{
+  EXPECT_EQ(0x12U, uut.Read_uint8());
+  EXPECT_EQ(0xCAFEU, uut.Read_uint16());
+  EXPECT_EQ(0xDEADBEEFUL, uut.Read_uint32());
+  EXPECT_EQ(0x0123456789ABCDEFULL, uut.Read_uint64());
+  EXPECT_EQ(-5, uut.Read_int8());
+  EXPECT_EQ(-1000, uut.Read_int16());
+  EXPECT_EQ(-100000L, uut.Read_int32());
+  EXPECT_EQ(-10000000000LL, uut.Read_int64());
+  EXPECT_EQ(1.5F, uut.Read_float());
+  EXPECT_EQ(-2.25, uut.Read_double());
+  EXPECT_EQ(0x05U, uut.Read_bits(3U));
+  EXPECT_TRUE(uut.Read_bit());
+  EXPECT_EQ('X', uut.Read_char());
+  EXPECT_EQ("Hello", uut.Read_string());
+  EXPECT_EQ("Line1", uut.Read_line());
+
+  uint16_t u16[3];
+  uut.Read_uint16(u16, 3U);
+  EXPECT_EQ(0x0102U, u16[0]);
+  EXPECT_EQ(0x0304U, u16[1]);
+  EXPECT_EQ(0x0506U, u16[2]);
+
+  uint32_t u32[2];
+  uut.Read_uint32(u32, 2U);
+  EXPECT_EQ(0x01020304UL, u32[0]);
+  EXPECT_EQ(0x05060708UL, u32[1]);
+
+  double dbl[2];
+  uut.Read_double(dbl, 2U);
+  EXPECT_EQ(0.5, dbl[0]);
+  EXPECT_EQ(-0.125, dbl[1]);
+
+  EXPECT_EQ(IStreamReader::States::open, uut.GetState());
+  uut.EnsureAllDataConsumed(IStreamReader::RemainingNbOfBits::moreThanSeven);
+  EXPECT_EQ(0x0AU, uut.Read_bits(4U));
+  uut.EnsureAllDataConsumed(IStreamReader::RemainingNbOfBits::four);
+  EXPECT_EQ(IStreamReader::States::open, uut.GetState());
+  uut.Skip(4U);
+  EXPECT_EQ(IStreamReader::States::empty, uut.GetState());
+}
+
+TEST_F(GPCC_Stream_StaticMemStreamReader_Tests, Instantiation)
+{
+  StaticMemStreamReader<IStreamReader::Endian::Little> uut1(memory, sizeof(memory));
+  EXPECT_EQ(IStreamReader::States::open, uut1.GetState());
+  EXPECT_EQ(IStreamReader::Endian::Little, uut1.GetEndian());
+  EXPECT_TRUE(uut1.IsRemainingBytesSupported());
+  EXPECT_EQ(sizeof(memory), uut1.RemainingBytes());
+
+  StaticMemStreamReader<IStreamReader::Endian::Big> uut2(nullptr, 0U);
+  EXPECT_EQ(IStreamReader::States::empty, uut2.GetState());
+  EXPECT_EQ(IStreamReader::Endian::Big, uut2.GetEndian());
+  EXPECT_EQ(0U, uut2.RemainingBytes());
+
+  using uut_t = StaticMemStreamReader<IStreamReader::Endian::Big>;
+  EXPECT_THROW(uut_t uut3(nullptr, 1U), std::invalid_argument);
+}
+TEST_F(GPCC_Stream_StaticMemStreamReader_Tests, ReadMixedData_LittleEndian)
+{
+  CreateTestData(IStreamWriter::Endian::Little);
+  StaticMemStreamReader<IStreamReader::Endian::Little> uut(memory, n);
+  ReadTestData(uut);
+}
+TEST_F(GPCC_Stream_StaticMemStreamReader_Tests, ReadMixedData_BigEndian)
+{
+  CreateTestData(IStreamWriter::Endian::Big);
+  StaticMemStreamReader<IStreamReader::Endian::Big> uut(memory, n);
+  ReadTestData(uut);
+}
+TEST_F(GPCC_Stream_StaticMemStreamReader_Tests, ReadMixedData_ViaAdapter)
+{
+  CreateTestData(IStreamWriter::Endian::Big);
+  StaticMemStreamReader<IStreamReader::Endian::Big> sms(memory, n);
+  StaticStreamReaderAdapter<decltype(sms)> uut(sms);
+  IStreamReader & isr = uut;
+
+  EXPECT_EQ(IStreamReader::Endian::Big, isr.GetEndian());
+  EXPECT_TRUE(isr.IsRemainingBytesSupported());
+  EXPECT_EQ(n, isr.RemainingBytes());
+  ReadTestData(isr);
+
+  isr.Close();
+  EXPECT_EQ(IStreamReader::States::closed, sms.GetState());
+}
+TEST_F(GPCC_Stream_StaticMemStreamReader_Tests, StreamOperators)
+{
+  CreateTestData(IStreamWriter::Endian::Little);
+  StaticMemStreamReader<IStreamReader::Endian::Little> uut(memory, n);
+
+  uint8_t u8;
+  uint16_t u16;
+  uint32_t u32;
+  uint64_t u64;
+  uut >> u8 >> u16 >> u32 >> u64;
+  EXPECT_EQ(0x12U, u8);
+  EXPECT_EQ(0xCAFEU, u16);
+  EXPECT_EQ(0xDEADBEEFUL, u32);
+  EXPECT_EQ(0x0123456789ABCDEFULL, u64);
+}
+TEST_F(GPCC_Stream_StaticMemStreamReader_Tests, ReadBeyondEnd)
+{
+  memory[0] = 0x12U;
+  memory[1] = 0x34U;
+  memory[2] = 0x56U;
+  StaticMemStreamReader<IStreamReader::Endian::Little> uut(memory, 3U);
+
+  EXPECT_EQ(0x3412U, uut.Read_uint16());
+  EXPECT_THROW((void)uut.Read_uint16(), EmptyError);
+  EXPECT_EQ(IStreamReader::States::error, uut.GetState());
+  EXPECT_THROW((void)uut.Read_uint8(), ErrorStateError);
+  EXPECT_THROW((void)uut.RemainingBytes(), ErrorStateError);
+
+  uut.Close();
+  EXPECT_EQ(IStreamReader::States::closed, uut.GetState());
+  EXPECT_THROW((void)uut.Read_uint8(), ClosedError);
+}
+TEST_F(GPCC_Stream_StaticMemStreamReader_Tests, ReadFromEmptyStream)
+{
+  memory[0] = 0x12U;
+  StaticMemStreamReader<IStreamReader::Endian::Little> uut(memory, 1U);
+
+  EXPECT_EQ(0x12U, uut.Read_uint8());
+  EXPECT_EQ(IStreamReader::States::empty, uut.GetState());
+  EXPECT_THROW((void)uut.Read_bit(), EmptyError);
+  EXPECT_EQ(IStreamReader::States::error, uut.GetState());
+}
+TEST_F(GPCC_Stream_StaticMemStreamReader_Tests, Read_string_NoNullTerminator)
+{
+  memory[0] = 'A';
+  memory[1] = 'B';
+  StaticMemStreamReader<IStreamReader::Endian::Little> uut(memory, 2U);
+
+  EXPECT_THROW((void)uut.Read_string(), std::runtime_error);
+  EXPECT_EQ(IStreamReader::States::error, uut.GetState());
+}
+TEST_F(GPCC_Stream_StaticMemStreamReader_Tests, Read_line_Terminators)
+{
+  char const data[] = "L1\nL2\rL3\r\nL4";
+  StaticMemStreamReader<IStreamReader::Endian::Little> uut(data, sizeof(data));
+
+  EXPECT_EQ("L1", uut.Read_line());
+  EXPECT_EQ("L2", uut.Read_line());
+  EXPECT_EQ("L3", uut.Read_line());
+  EXPECT_EQ("L4", uut.Read_line());
+  EXPECT_EQ(IStreamReader::States::empty, uut.GetState());
+}
+TEST_F(GPCC_Stream_StaticMemStreamReader_Tests, Skip)
+{
+  for (uint_fast8_t i = 0U; i < 8U; i++)
+    memory[i] = i;
+
+  StaticMemStreamReader<IStreamReader::Endian::Little> uut(memory, 8U);
+
+  uut.Skip(4U);
+  EXPECT_EQ(0x0U, uut.Read_bits(4U));
+  uut.Skip(12U);
+  EXPECT_EQ(0x0U, uut.Read_bits(4U));
+  EXPECT_EQ(0x03U, uut.Read_uint8());
+  uut.Skip(24U);
+  EXPECT_EQ(0x07U, uut.Read_uint8());
+  EXPECT_EQ(IStreamReader::States::empty, uut.GetState());
+
+  EXPECT_THROW(uut.Skip(1U), EmptyError);
+  EXPECT_EQ(IStreamReader::States::error, uut.GetState());
+}
+TEST_F(GPCC_Stream_StaticMemStreamReader_Tests, SubStreamAndSpans)
+{
+  for (uint_fast8_t i = 0U; i < 8U; i++)
+    memory[i] = i;
+
+  StaticMemStreamReader<IStreamReader::Endian::Big> uut(memory, 8U);
+
+  auto sub = uut.SubStream(4U);
+  EXPECT_EQ(4U, sub.RemainingBytes());
+  EXPECT_EQ(0x00010203UL, sub.Read_uint32());
+  EXPECT_EQ(IStreamReader::States::empty, sub.GetState());
+
+  EXPECT_EQ(&memory[4], uut.PeekSpan(2U));
+  EXPECT_EQ(4U, uut.RemainingBytes());
+  EXPECT_EQ(&memory[4], uut.ReadSpan(2U));
+  EXPECT_EQ(2U, uut.RemainingBytes());
+
+  EXPECT_THROW((void)uut.ReadSpan(3U), EmptyError);
+  EXPECT_EQ(IStreamReader::States::open, uut.GetState());
+
+  uut.Shrink(1U);
+  EXPECT_EQ(0x06U, uut.Read_uint8());
+  EXPECT_EQ(IStreamReader::States::empty, uut.GetState());
+}
+TEST_F(GPCC_Stream_StaticMemStreamReader_Tests, CopyAndMove)
+{
+  for (uint_fast8_t i = 0U; i < 4U; i++)
+    memory[i] = i;
+
+  StaticMemStreamReader<IStreamReader::Endian::Little> uut1(memory, 4U);
+  (void)uut1.Read_bits(4U);
+
+  StaticMemStreamReader<IStreamReader::Endian::Little> uut2(uut1);
+  EXPECT_EQ(0x0U, uut2.Read_bits(4U));
+  EXPECT_EQ(0x01U, uut2.Read_uint8());
+
+  StaticMemStreamReader<IStreamReader::Endian::Little> uut3(std::move(uut1));
+  EXPECT_EQ(IStreamReader::States::closed, uut1.GetState());
+  EXPECT_EQ(0x01U, uut3.Read_uint8());
+
+  uut1 = uut3;
+  EXPECT_EQ(0x02U, uut1.Read_uint8());
+  EXPECT_EQ(0x02U, uut3.Read_uint8());
+}
+
+} // namespace stream
+} // namespace gpcc_tests
@@ -0,0 +1,244 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#include <gpcc/stream/StaticMemStreamWriter.hpp>
+#include <gpcc/stream/StaticStreamWriterAdapter.hpp>
+#include <gpcc/stream/MemStreamWriter.hpp>
+#include <gpcc/stream/stream_errors.hpp>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <cstring>
+
+namespace gpcc_tests {
+namespace stream     {
+
+using namespace gpcc::stream;
+using namespace testing;
+
+/// Test fixture for gpcc::stream::StaticMemStreamWriter related tests.
+class GPCC_Stream_StaticMemStreamWriter_Tests: public Test
+{
+  public:
+    GPCC_Stream_StaticMemStreamWriter_Tests(void);
+
+  protected:
+    uint8_t memory[512];
+    uint8_t expected[512];
+
+    void SetUp(void) override;
+
+    template<class WRITER>
+    static void WriteTestData(WRITER & uut);
+
+    size_t CreateExpectedData(IStreamWriter::Endian const endian);
+};
+
+GPCC_Stream_StaticMemStreamWriter_Tests::GPCC_Stream_StaticMemStreamWriter_Tests(void)
+: Test()
+, memory()
+, expected()
+{
+}
+
+void GPCC_Stream_StaticMemStreamWriter_Tests::SetUp(void)
+{
+  memset(memory, 0xFF, sizeof(memory));
+  memset(expected, 0xFF, sizeof(expected));
+}
+
+// Writes a mix of data into "uut".
+template<class WRITER>
+void GPCC_Stream_StaticMemStreamWriter_Tests::WriteTestData(WRITER & uut)
+{
+  uut.Write_uint8(0x12U);
+  uut.Write_uint16(0xCAFEU);
+  uut.Write_uint32(0xDEADBEEFUL);
+  uut.Write_uint64(0x0123456789ABCDEFULL);
+  uut.Write_int8(-5);
+  uut.Write_int16(-1000);
+  uut.Write_int32(-100000L);
+  uut.Write_int64(-10000000000LL);
+  uut.Write_float(1.5F);
+  uut.Write_double(-2.25);
+  uut.Write_Bits(static_cast<uint8_t>(0x05U), 3U);
+  uut.Write_Bit(true);
+  uut.Write_bool(false);
+  uut.Write_char('X');
+  uut.Write_string("Hello");
+  uut.Write_line("Line1");
+
+  uint16_t u16[100];
+  for (size_t i = 0U; i < 100U; i++)
+    u16[i] = static_cast<uint16_t>(0x0102U + i);
+  uut.Write_uint16(u16, 100U);
+
+  int32_t const i32[2] = { -1, 0x01020304L };
+  uut.Write_int32(i32, 2U);
+  double const dbl[2] = { 0.5, -0.125 };
+  uut.Write_double(dbl, 2U);
+
+  uut.FillBits(11U, true);
+  (void)uut.AlignToByteBoundary(false);
+  uut.FillBytes(3U, 0xA5U);
+  uut.Write_Bits(static_cast<uint8_t>(0x0AU), 4U);
+}
+
+// Writes the data written by WriteTestData() into "expected" using a MemStreamWriter.
+// Returns the number of bytes written.
+size_t GPCC_Stream_StaticMemStreamWriter_Tests::CreateExpectedData(IStreamWriter::Endian const endian)
+{
+  MemStreamWriter msw(expected, sizeof(expected), endian);
+  WriteTestData(msw);
+  size_t const n = sizeof(expected) - msw.RemainingCapacity() + 1U;
+  msw.Close();
+  return n;
+}
+
+TEST_F(GPCC_Stream_StaticMemStreamWriter_Tests, Instantiation)
+{
+  StaticMemStreamWriter<IStreamWriter::Endian::Little> uut1(memory, sizeof(memory));
+  EXPECT_EQ(IStreamWriter::States::open, uut1.GetState());
+  EXPECT_EQ(IStreamWriter::Endian::Little, uut1.GetEndian());
+  EXPECT_TRUE(uut1.IsRemainingCapacitySupported());
+  EXPECT_EQ(sizeof(memory), uut1.RemainingCapacity());
+  EXPECT_EQ(0U, uut1.GetNbOfCachedBits());
+
+  StaticMemStreamWriter<IStreamWriter::Endian::Big> uut2(nullptr, 0U);
+  EXPECT_EQ(IStreamWriter::States::full, uut2.GetState());
+  EXPECT_EQ(IStreamWriter::Endian::Big, uut2.GetEndian());
+
+  using uut_t = StaticMemStreamWriter<IStreamWriter::Endian::Big>;
+  EXPECT_THROW(uut_t uut3(nullptr, 1U), std::invalid_argument);
+}
+TEST_F(GPCC_Stream_StaticMemStreamWriter_Tests, WriteMixedData_LittleEndian)
+{
+  size_t const n = CreateExpectedData(IStreamWriter::Endian::Little);
+
+  StaticMemStreamWriter<IStreamWriter::Endian::Little> uut(memory, sizeof(memory));
+  WriteTestData(uut);
+  EXPECT_EQ(sizeof(memory) - n + 1U, uut.RemainingCapacity());
+  EXPECT_EQ(4U, uut.GetNbOfCachedBits());
+  uut.Close();
+
+  EXPECT_TRUE(memcmp(memory, expected, sizeof(memory)) == 0);
+}
+TEST_F(GPCC_Stream_StaticMemStreamWriter_Tests, WriteMixedData_BigEndian)
+{
+  (void)CreateExpectedData(IStreamWriter::Endian::Big);
+
+  StaticMemStreamWriter<IStreamWriter::Endian::Big> uut(memory, sizeof(memory));
+  WriteTestData(uut);
+  uut.Close();
+
+  EXPECT_TRUE(memcmp(memory, expected, sizeof(memory)) == 0);
+}
+TEST_F(GPCC_Stream_StaticMemStreamWriter_Tests, WriteMixedData_ViaAdapter)
+{
+  (void)CreateExpectedData(IStreamWriter::Endian::Big);
+
+  StaticMemStreamWriter<IStreamWriter::Endian::Big> smw(memory, sizeof(memory));
+  StaticStreamWriterAdapter<decltype(smw)> uut(smw);
+  IStreamWriter & isw = uut;
+
+  EXPECT_EQ(IStreamWriter::Endian::Big, isw.GetEndian());
+  EXPECT_TRUE(isw.IsRemainingCapacitySupported());
+  WriteTestData(isw);
+  EXPECT_EQ(4U, isw.GetNbOfCachedBits());
+  isw.Close();
+  EXPECT_EQ(IStreamWriter::States::closed, smw.GetState());
+
+  EXPECT_TRUE(memcmp(memory, expected, sizeof(memory)) == 0);
+}
+TEST_F(GPCC_Stream_StaticMemStreamWriter_Tests, StreamOperators)
+{
+  StaticMemStreamWriter<IStreamWriter::Endian::Big> uut(memory, sizeof(memory));
+  uut << static_cast<uint8_t>(0x12U) << static_cast<uint16_t>(0x3456U) << std::string("AB");
+  uut.Close();
+
+  uint8_t const exp[] = { 0x12U, 0x34U, 0x56U, 'A', 'B', 0x00U, 0xFFU };
+  EXPECT_TRUE(memcmp(memory, exp, sizeof(exp)) == 0);
+}
+TEST_F(GPCC_Stream_StaticMemStreamWriter_Tests, Full)
+{
+  StaticMemStreamWriter<IStreamWriter::Endian::Little> uut(memory, 3U);
+
+  uut.Write_uint16(0x1234U);
+  uut.Write_Bits(static_cast<uint8_t>(0x0FU), 4U);
+  EXPECT_EQ(IStreamWriter::States::open, uut.GetState());
+  uut.Write_Bits(static_cast<uint8_t>(0x0AU), 4U);
+  EXPECT_EQ(IStreamWriter::States::full, uut.GetState());
+  EXPECT_EQ(0U, uut.RemainingCapacity());
+
+  EXPECT_THROW(uut.Write_uint8(0U), FullError);
+  EXPECT_EQ(IStreamWriter::States::error, uut.GetState());
+  EXPECT_THROW(uut.Write_uint8(0U), ErrorStateError);
+
+  uut.Close();
+  EXPECT_THROW(uut.Write_uint8(0U), ClosedError);
+
+  uint8_t const exp[] = { 0x34U, 0x12U, 0xAFU, 0xFFU };
+  EXPECT_TRUE(memcmp(memory, exp, sizeof(exp)) == 0);
+}
+TEST_F(GPCC_Stream_StaticMemStreamWriter_Tests, WriteBeyondCapacity)
+{
+  StaticMemStreamWriter<IStreamWriter::Endian::Little> uut(memory, 3U);
+
+  uut.Write_uint8(0x01U);
+  EXPECT_THROW(uut.Write_uint32(0U), FullError);
+  EXPECT_EQ(IStreamWriter::States::error, uut.GetState());
+  uut.Close();
+
+  EXPECT_EQ(0xFFU, memory[1]);
+}
+TEST_F(GPCC_Stream_StaticMemStreamWriter_Tests, BitsBeyondCapacity)
+{
+  StaticMemStreamWriter<IStreamWriter::Endian::Little> uut(memory, 1U);
+
+  uut.Write_Bits(static_cast<uint8_t>(0x3FU), 6U);
+  EXPECT_THROW(uut.Write_Bits(static_cast<uint8_t>(0x0FU), 4U), FullError);
+  EXPECT_EQ(IStreamWriter::States::error, uut.GetState());
+  uut.Close();
+}
+TEST_F(GPCC_Stream_StaticMemStreamWriter_Tests, ReserveSpan)
+{
+  StaticMemStreamWriter<IStreamWriter::Endian::Little> uut(memory, 4U);
+
+  uut.Write_Bit(true);
+  EXPECT_THROW((void)uut.ReserveSpan(4U), FullError);
+  EXPECT_EQ(IStreamWriter::States::open, uut.GetState());
+
+  void* const p = uut.ReserveSpan(3U);
+  EXPECT_EQ(&memory[1], p);
+  EXPECT_EQ(0x01U, memory[0]);
+  EXPECT_EQ(IStreamWriter::States::full, uut.GetState());
+  EXPECT_TRUE(uut.ReserveSpan(0U) == nullptr);
+  uut.Close();
+}
+TEST_F(GPCC_Stream_StaticMemStreamWriter_Tests, CopyAndMove)
+{
+  StaticMemStreamWriter<IStreamWriter::Endian::Little> uut1(memory, 4U);
+  uut1.Write_uint8(0x01U);
+
+  StaticMemStreamWriter<IStreamWriter::Endian::Little> uut2(std::move(uut1));
+  EXPECT_EQ(IStreamWriter::States::closed, uut1.GetState());
+  uut2.Write_uint8(0x02U);
+
+  uut1 = uut2;
+  EXPECT_EQ(2U, uut1.RemainingCapacity());
+  uut1.Write_uint8(0x03U);
+  uut1.Close();
+
+  EXPECT_EQ(0x01U, memory[0]);
+  EXPECT_EQ(0x02U, memory[1]);
+  EXPECT_EQ(0x03U, memory[2]);
+}
+
+} // namespace stream
+} // namespace gpcc_tests
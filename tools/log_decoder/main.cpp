@@ -0,0 +1,115 @@
+/*
+    General Purpose Class Collection (GPCC)
+
+    This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+    If a copy of the MPL was not distributed with this file,
+    You can obtain one at https://mozilla.org/MPL/2.0/.
+
+    Copyright (C) 2026 Daniel Jerolm
+*/
+
+#include <gpcc/log/BinaryLogDecoder.hpp>
+#include <gpcc/stream/MemStreamReader.hpp>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace {
+
+void PrintUsage(char const * const pProgName)
+{
+  std::cout << "Usage: " << pProgName << " [options] <file>" << std::endl
+            << "Converts a binary log file written by gpcc::log::Backend_Binary into text." << std::endl
+            << "Options:" << std::endl
+            << "  --output=<file>    Writes the text into <file> instead of stdout" << std::endl
+            << "  --help             Prints this text and exits" << std::endl;
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv)
+{
+  std::string inputFile;
+  std::string outputFile;
+
+  for (int i = 1; i < argc; i++)
+  {
+    std::string const arg = argv[i];
+
+    if (arg.rfind("--output=", 0) == 0)
+      outputFile = arg.substr(9);
+    else if (arg == "--help")
+    {
+      PrintUsage(argv[0]);
+      return 0;
+    }
+    else if ((arg.rfind("--", 0) != 0) && (inputFile.empty()))
+      inputFile = arg;
+    else
+    {
+      std::cerr << "Invalid argument: " << arg << std::endl;
+      PrintUsage(argv[0]);
+      return 1;
+    }
+  }
+
+  if (inputFile.empty())
+  {
+    std::cerr << "No input file specified." << std::endl;
+    PrintUsage(argv[0]);
+    return 1;
+  }
+
+  std::ifstream in(inputFile, std::ios_base::in | std::ios_base::binary);
+  if (!in)
+  {
+    std::cerr << "Cannot open input file: " << inputFile << std::endl;
+    return 1;
+  }
+  std::vector<char> const data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+  std::ofstream file;
+  if (!outputFile.empty())
+  {
+    file.open(outputFile, std::ios_base::out | std::ios_base::trunc);
+    if (!file)
+    {
+      std::cerr << "Cannot open output file: " << outputFile << std::endl;
+      return 1;
+    }
+  }
+  std::ostream & out = outputFile.empty() ? std::cout : file;
+
+  size_t nbOfMessages = 0U;
+  try
+  {
+    gpcc::stream::MemStreamReader reader(data.data(), data.size(), gpcc::stream::IStreamReader::Endian::Little);
+    gpcc::log::BinaryLogDecoder decoder(reader);
+
+    std::string msg;
+    gpcc::log::LogType type;
+    while (decoder.Next(msg, type))
+    {
+      out << msg << '\n';
+      nbOfMessages++;
+    }
+  }
+  catch (std::exception const & e)
+  {
+    out.flush();
+    std::cerr << "Error after " << nbOfMessages << " message(s): " << e.what() << std::endl;
+    return 1;
+  }
+
+  out.flush();
+  if (!out)
+  {
+    std::cerr << "Failed to write output." << std::endl;
+    return 1;
+  }
+
+  return 0;
+}